@@ -39,8 +39,16 @@
 #include <CommonConstants/PhysicsConstants.h>
 #include <Framework/Logger.h>
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstring>
 #include <map>
+#include <memory>
 #include <string>
+#include <vector>
 
 namespace o2
 {
@@ -83,77 +91,162 @@ bool TrackSmearer::loadTable(int pdg, const char* filename, bool forceReload)
     return loadTable(pdg, filename, forceReload);
   }
 
-  mLUTHeader[ipdg] = new lutHeader_t;
-
-  std::ifstream lutFile(filename, std::ifstream::binary);
-  if (!lutFile.is_open()) {
-    LOG(info) << " --- cannot open covariance matrix file for PDG " << pdg << ": " << filename << std::endl;
-    delete mLUTHeader[ipdg];
-    mLUTHeader[ipdg] = nullptr;
-    return false;
-  }
-  lutFile.read(reinterpret_cast<char*>(mLUTHeader[ipdg]), sizeof(lutHeader_t));
-  if (lutFile.gcount() != sizeof(lutHeader_t)) {
-    LOG(info) << " --- troubles reading covariance matrix header for PDG " << pdg << ": " << filename << std::endl;
-    delete mLUTHeader[ipdg];
-    mLUTHeader[ipdg] = nullptr;
-    return false;
-  }
-  if (mLUTHeader[ipdg]->version != LUTCOVM_VERSION) {
-    LOG(info) << " --- LUT header version mismatch: expected/detected = " << LUTCOVM_VERSION << "/" << mLUTHeader[ipdg]->version << std::endl;
-    delete mLUTHeader[ipdg];
-    mLUTHeader[ipdg] = nullptr;
+  auto header = std::make_shared<lutHeader_t>();
+  std::shared_ptr<const lutEntry_t> entries;
+  if (!readTable(filename, *header, entries)) {
+    LOG(info) << " --- cannot read covariance matrix table for PDG " << pdg << ": " << filename << std::endl;
     return false;
   }
   bool specialPdgCase = false;
   switch (pdg) {                         // Handle special cases
     case o2::constants::physics::kAlpha: // Special case: Allow Alpha particles to use He3 LUT
-      specialPdgCase = (mLUTHeader[ipdg]->pdg == o2::constants::physics::kHelium3);
+      specialPdgCase = (header->pdg == o2::constants::physics::kHelium3);
       if (specialPdgCase)
         LOG(info)
-          << " --- Alpha particles (PDG " << pdg << ") will use He3 LUT data (PDG " << mLUTHeader[ipdg]->pdg << ")" << std::endl;
+          << " --- Alpha particles (PDG " << pdg << ") will use He3 LUT data (PDG " << header->pdg << ")" << std::endl;
       break;
     default:
       break;
   }
-  if (mLUTHeader[ipdg]->pdg != pdg && !specialPdgCase) {
-    LOG(info) << " --- LUT header PDG mismatch: expected/detected = " << pdg << "/" << mLUTHeader[ipdg]->pdg << std::endl;
-    delete mLUTHeader[ipdg];
-    mLUTHeader[ipdg] = nullptr;
+  if (header->pdg != pdg && !specialPdgCase) {
+    LOG(info) << " --- LUT header PDG mismatch: expected/detected = " << pdg << "/" << header->pdg << std::endl;
     return false;
   }
-  const int nnch = mLUTHeader[ipdg]->nchmap.nbins;
-  const int nrad = mLUTHeader[ipdg]->radmap.nbins;
-  const int neta = mLUTHeader[ipdg]->etamap.nbins;
-  const int npt = mLUTHeader[ipdg]->ptmap.nbins;
-  mLUTEntry[ipdg] = new lutEntry_t****[nnch];
-  for (int inch = 0; inch < nnch; ++inch) {
-    mLUTEntry[ipdg][inch] = new lutEntry_t***[nrad];
-    for (int irad = 0; irad < nrad; ++irad) {
-      mLUTEntry[ipdg][inch][irad] = new lutEntry_t**[neta];
-      for (int ieta = 0; ieta < neta; ++ieta) {
-        mLUTEntry[ipdg][inch][irad][ieta] = new lutEntry_t*[npt];
-        for (int ipt = 0; ipt < npt; ++ipt) {
-          mLUTEntry[ipdg][inch][irad][ieta][ipt] = new lutEntry_t;
-          lutFile.read(reinterpret_cast<char*>(mLUTEntry[ipdg][inch][irad][ieta][ipt]), sizeof(lutEntry_t));
-          if (lutFile.gcount() != sizeof(lutEntry_t)) {
-            LOG(info) << " --- troubles reading covariance matrix entry for PDG " << pdg << ": " << filename << std::endl;
-            return false;
-          }
-        }
+  mLUTHeader[ipdg] = header;
+  mLUTStorage[ipdg] = entries;
+  mLUTEntry[ipdg] = entries.get();
+  mLUTStride[ipdg][2] = header->ptmap.nbins;
+  mLUTStride[ipdg][1] = header->etamap.nbins * mLUTStride[ipdg][2];
+  mLUTStride[ipdg][0] = header->radmap.nbins * mLUTStride[ipdg][1];
+  LOG(info) << " --- read covariance matrix table for PDG " << pdg << ": " << filename << std::endl;
+  mLUTHeader[ipdg]->print();
+  return true;
+}
+
+/*****************************************************************/
+
+bool TrackSmearer::readTable(const char* filename, lutHeader_t& header, std::shared_ptr<const lutEntry_t>& entries)
+{
+  std::ifstream lutFile(filename, std::ifstream::binary);
+  if (!lutFile.is_open()) {
+    LOG(info) << " --- cannot open covariance matrix file: " << filename << std::endl;
+    return false;
+  }
+  lutFlatHeader_t flatHeader;
+  lutFile.read(reinterpret_cast<char*>(&flatHeader), sizeof(lutFlatHeader_t));
+  if (lutFile.gcount() == sizeof(lutFlatHeader_t) && flatHeader.check_magic()) {
+    // flat format: map the file and use the entries in place
+    lutFile.close();
+    if (!flatHeader.check_version()) {
+      LOG(info) << " --- flat LUT version mismatch: expected/detected = " << LUTCOVM_FLAT_VERSION << "/" << flatHeader.flatVersion << ", entry size " << sizeof(lutEntry_t) << "/" << flatHeader.entrySize << ", LUT version " << LUTCOVM_VERSION << "/" << flatHeader.header.version << std::endl;
+      return false;
+    }
+    header = flatHeader.header;
+    const uint64_t nEntries = static_cast<uint64_t>(header.nchmap.nbins) * header.radmap.nbins * header.etamap.nbins * header.ptmap.nbins;
+    const int fd = open(filename, O_RDONLY);
+    struct stat fileStat;
+    if (fd < 0 || fstat(fd, &fileStat) != 0 || nEntries != flatHeader.nEntries || flatHeader.entryOffset % alignof(lutEntry_t) != 0 || static_cast<uint64_t>(fileStat.st_size) < flatHeader.entryOffset + nEntries * sizeof(lutEntry_t)) {
+      LOG(info) << " --- troubles reading flat covariance matrix table: " << filename << std::endl;
+      if (fd >= 0) {
+        close(fd);
       }
+      return false;
+    }
+    const size_t size = fileStat.st_size;
+    void* mapped = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd); // the mapping stays valid
+    if (mapped == MAP_FAILED) {
+      LOG(info) << " --- cannot map flat covariance matrix table: " << filename << std::endl;
+      return false;
     }
+    entries = std::shared_ptr<const lutEntry_t>(reinterpret_cast<const lutEntry_t*>(static_cast<const char*>(mapped) + flatHeader.entryOffset), [mapped, size](const lutEntry_t*) { munmap(mapped, size); });
+    return true;
   }
-  LOG(info) << " --- read covariance matrix table for PDG " << pdg << ": " << filename << std::endl;
-  mLUTHeader[ipdg]->print();
 
-  lutFile.close();
+  // legacy format: header followed by the entries
+  lutFile.clear();
+  lutFile.seekg(0);
+  lutFile.read(reinterpret_cast<char*>(&header), sizeof(lutHeader_t));
+  if (lutFile.gcount() != sizeof(lutHeader_t)) {
+    LOG(info) << " --- troubles reading covariance matrix header: " << filename << std::endl;
+    return false;
+  }
+  if (header.version != LUTCOVM_VERSION) {
+    LOG(info) << " --- LUT header version mismatch: expected/detected = " << LUTCOVM_VERSION << "/" << header.version << std::endl;
+    return false;
+  }
+  const uint64_t nEntries = static_cast<uint64_t>(header.nchmap.nbins) * header.radmap.nbins * header.etamap.nbins * header.ptmap.nbins;
+  auto data = new lutEntry_t[nEntries];
+  lutFile.read(reinterpret_cast<char*>(data), nEntries * sizeof(lutEntry_t));
+  if (static_cast<uint64_t>(lutFile.gcount()) != nEntries * sizeof(lutEntry_t)) {
+    LOG(info) << " --- troubles reading covariance matrix entries: " << filename << std::endl;
+    delete[] data;
+    return false;
+  }
+  entries = std::shared_ptr<const lutEntry_t>(data, [](const lutEntry_t* p) { delete[] p; });
+  return true;
+}
+
+/*****************************************************************/
+
+bool TrackSmearer::convertTable(const char* inFilename, const char* outFilename)
+{
+  lutFlatHeader_t flatHeader;
+  std::shared_ptr<const lutEntry_t> entries;
+  if (!readTable(inFilename, flatHeader.header, entries)) {
+    return false;
+  }
+  flatHeader.nEntries = static_cast<uint64_t>(flatHeader.header.nchmap.nbins) * flatHeader.header.radmap.nbins * flatHeader.header.etamap.nbins * flatHeader.header.ptmap.nbins;
+  std::ofstream outFile(outFilename, std::ofstream::binary);
+  if (!outFile.is_open()) {
+    LOG(info) << " --- cannot open output file: " << outFilename << std::endl;
+    return false;
+  }
+  outFile.write(reinterpret_cast<const char*>(&flatHeader), sizeof(lutFlatHeader_t));
+  const std::vector<char> padding(flatHeader.entryOffset - sizeof(lutFlatHeader_t), 0);
+  outFile.write(padding.data(), padding.size());
+  outFile.write(reinterpret_cast<const char*>(entries.get()), flatHeader.nEntries * sizeof(lutEntry_t));
+  if (!outFile.good()) {
+    LOG(info) << " --- troubles writing flat covariance matrix table: " << outFilename << std::endl;
+    return false;
+  }
+  LOG(info) << " --- converted covariance matrix table " << inFilename << " to flat format: " << outFilename << std::endl;
+  return true;
+}
+
+/*****************************************************************/
+
+bool TrackSmearer::checkConvertedTable(const char* inFilename, const char* outFilename)
+{
+  lutHeader_t inHeader, outHeader;
+  std::shared_ptr<const lutEntry_t> inEntries, outEntries;
+  if (!readTable(inFilename, inHeader, inEntries) || !readTable(outFilename, outHeader, outEntries)) {
+    return false;
+  }
+  auto sameMap = [](const map_t& a, const map_t& b) {
+    return a.nbins == b.nbins && a.min == b.min && a.max == b.max && a.log == b.log;
+  };
+  if (inHeader.version != outHeader.version || inHeader.pdg != outHeader.pdg || inHeader.mass != outHeader.mass || inHeader.field != outHeader.field || !sameMap(inHeader.nchmap, outHeader.nchmap) || !sameMap(inHeader.radmap, outHeader.radmap) || !sameMap(inHeader.etamap, outHeader.etamap) || !sameMap(inHeader.ptmap, outHeader.ptmap)) {
+    LOG(info) << " --- covariance matrix table headers differ: " << inFilename << " / " << outFilename << std::endl;
+    return false;
+  }
+  // the entries are written byte by byte, compare them as such also for NaN values
+  const uint64_t nEntries = static_cast<uint64_t>(inHeader.nchmap.nbins) * inHeader.radmap.nbins * inHeader.etamap.nbins * inHeader.ptmap.nbins;
+  uint64_t nDifferent = 0;
+  for (uint64_t iEntry = 0; iEntry < nEntries; ++iEntry) {
+    nDifferent += (std::memcmp(inEntries.get() + iEntry, outEntries.get() + iEntry, sizeof(lutEntry_t)) != 0);
+  }
+  if (nDifferent > 0) {
+    LOG(info) << " --- " << nDifferent << " / " << nEntries << " covariance matrix entries differ: " << inFilename << " / " << outFilename << std::endl;
+    return false;
+  }
+  LOG(info) << " --- " << nEntries << " covariance matrix entries identical: " << inFilename << " / " << outFilename << std::endl;
   return true;
 }
 
 /*****************************************************************/
 
-lutEntry_t* TrackSmearer::getLUTEntry(const int pdg, const float nch, const float radius, const float eta, const float pt, float& interpolatedEff)
+const lutEntry_t* TrackSmearer::getLUTEntry(const int pdg, const float nch, const float radius, const float eta, const float pt, float& interpolatedEff)
 {
   const int ipdg = getIndexPDG(pdg);
   if (!mLUTHeader[ipdg]) {
@@ -164,6 +257,8 @@ lutEntry_t* TrackSmearer::getLUTEntry(const int pdg, const float nch, const floa
   auto irad = mLUTHeader[ipdg]->radmap.find(radius);
   auto ieta = mLUTHeader[ipdg]->etamap.find(eta);
   auto ipt = mLUTHeader[ipdg]->ptmap.find(pt);
+  const lutEntry_t* lutEntry = mLUTEntry[ipdg] + inch * mLUTStride[ipdg][0] + irad * mLUTStride[ipdg][1] + ieta * mLUTStride[ipdg][2] + ipt;
+  const int nchStride = mLUTStride[ipdg][0];
 
   // Interpolate if requested
   auto fraction = mLUTHeader[ipdg]->nchmap.fracPositionWithinBin(nch);
@@ -173,16 +268,16 @@ lutEntry_t* TrackSmearer::getLUTEntry(const int pdg, const float nch, const floa
       switch (mWhatEfficiency) {
         case 1:
           if (inch < mLUTHeader[ipdg]->nchmap.nbins - 1) {
-            interpolatedEff = (1.5f - fraction) * mLUTEntry[ipdg][inch][irad][ieta][ipt]->eff + (-0.5f + fraction) * mLUTEntry[ipdg][inch + 1][irad][ieta][ipt]->eff;
+            interpolatedEff = (1.5f - fraction) * lutEntry->eff + (-0.5f + fraction) * lutEntry[nchStride].eff;
           } else {
-            interpolatedEff = mLUTEntry[ipdg][inch][irad][ieta][ipt]->eff;
+            interpolatedEff = lutEntry->eff;
           }
           break;
         case 2:
           if (inch < mLUTHeader[ipdg]->nchmap.nbins - 1) {
-            interpolatedEff = (1.5f - fraction) * mLUTEntry[ipdg][inch][irad][ieta][ipt]->eff2 + (-0.5f + fraction) * mLUTEntry[ipdg][inch + 1][irad][ieta][ipt]->eff2;
+            interpolatedEff = (1.5f - fraction) * lutEntry->eff2 + (-0.5f + fraction) * lutEntry[nchStride].eff2;
           } else {
-            interpolatedEff = mLUTEntry[ipdg][inch][irad][ieta][ipt]->eff2;
+            interpolatedEff = lutEntry->eff2;
           }
           break;
         default:
@@ -193,16 +288,16 @@ lutEntry_t* TrackSmearer::getLUTEntry(const int pdg, const float nch, const floa
       switch (mWhatEfficiency) {
         case 1:
           if (inch > 0 && comparisonValue < mLUTHeader[ipdg]->nchmap.max) {
-            interpolatedEff = (0.5f + fraction) * mLUTEntry[ipdg][inch][irad][ieta][ipt]->eff + (0.5f - fraction) * mLUTEntry[ipdg][inch - 1][irad][ieta][ipt]->eff;
+            interpolatedEff = (0.5f + fraction) * lutEntry->eff + (0.5f - fraction) * lutEntry[-nchStride].eff;
           } else {
-            interpolatedEff = mLUTEntry[ipdg][inch][irad][ieta][ipt]->eff;
+            interpolatedEff = lutEntry->eff;
           }
           break;
         case 2:
           if (inch > 0 && comparisonValue < mLUTHeader[ipdg]->nchmap.max) {
-            interpolatedEff = (0.5f + fraction) * mLUTEntry[ipdg][inch][irad][ieta][ipt]->eff2 + (0.5f - fraction) * mLUTEntry[ipdg][inch - 1][irad][ieta][ipt]->eff2;
+            interpolatedEff = (0.5f + fraction) * lutEntry->eff2 + (0.5f - fraction) * lutEntry[-nchStride].eff2;
           } else {
-            interpolatedEff = mLUTEntry[ipdg][inch][irad][ieta][ipt]->eff2;
+            interpolatedEff = lutEntry->eff2;
           }
           break;
         default:
@@ -212,21 +307,21 @@ lutEntry_t* TrackSmearer::getLUTEntry(const int pdg, const float nch, const floa
   } else {
     switch (mWhatEfficiency) {
       case 1:
-        interpolatedEff = mLUTEntry[ipdg][inch][irad][ieta][ipt]->eff;
+        interpolatedEff = lutEntry->eff;
         break;
       case 2:
-        interpolatedEff = mLUTEntry[ipdg][inch][irad][ieta][ipt]->eff2;
+        interpolatedEff = lutEntry->eff2;
         break;
       default:
         LOG(fatal) << " --- getLUTEntry: unknown efficiency type " << mWhatEfficiency;
     }
   }
-  return mLUTEntry[ipdg][inch][irad][ieta][ipt];
+  return lutEntry;
 } //;
 
 /*****************************************************************/
 
-bool TrackSmearer::smearTrack(O2Track& o2track, lutEntry_t* lutEntry, float interpolatedEff)
+bool TrackSmearer::smearTrack(O2Track& o2track, const lutEntry_t* lutEntry, float interpolatedEff)
 {
   bool isReconstructed = true;
   // generate efficiency
@@ -291,7 +386,7 @@ bool TrackSmearer::smearTrack(O2Track& o2track, int pdg, float nch)
   }
   auto eta = o2track.getEta();
   float interpolatedEff = 0.0f;
-  lutEntry_t* lutEntry = getLUTEntry(pdg, nch, 0., eta, pt, interpolatedEff);
+  const lutEntry_t* lutEntry = getLUTEntry(pdg, nch, 0., eta, pt, interpolatedEff);
   if (!lutEntry || !lutEntry->valid)
     return false;
   return smearTrack(o2track, lutEntry, interpolatedEff);
@@ -302,7 +397,7 @@ bool TrackSmearer::smearTrack(O2Track& o2track, int pdg, float nch)
 double TrackSmearer::getPtRes(const int pdg, const float nch, const float eta, const float pt)
 {
   float dummy = 0.0f;
-  lutEntry_t* lutEntry = getLUTEntry(pdg, nch, 0., eta, pt, dummy);
+  const lutEntry_t* lutEntry = getLUTEntry(pdg, nch, 0., eta, pt, dummy);
   auto val = std::sqrt(lutEntry->covm[14]) * lutEntry->pt;
   return val;
 }
@@ -312,7 +407,7 @@ double TrackSmearer::getPtRes(const int pdg, const float nch, const float eta, c
 double TrackSmearer::getEtaRes(const int pdg, const float nch, const float eta, const float pt)
 {
   float dummy = 0.0f;
-  lutEntry_t* lutEntry = getLUTEntry(pdg, nch, 0., eta, pt, dummy);
+  const lutEntry_t* lutEntry = getLUTEntry(pdg, nch, 0., eta, pt, dummy);
   auto sigmatgl = std::sqrt(lutEntry->covm[9]);                                  // sigmatgl2
   auto etaRes = std::fabs(std::sin(2.0 * std::atan(std::exp(-eta)))) * sigmatgl; // propagate tgl to eta uncertainty
   etaRes /= lutEntry->eta;                                                       // relative uncertainty
@@ -323,7 +418,7 @@ double TrackSmearer::getEtaRes(const int pdg, const float nch, const float eta,
 double TrackSmearer::getAbsPtRes(const int pdg, const float nch, const float eta, const float pt)
 {
   float dummy = 0.0f;
-  lutEntry_t* lutEntry = getLUTEntry(pdg, nch, 0., eta, pt, dummy);
+  const lutEntry_t* lutEntry = getLUTEntry(pdg, nch, 0., eta, pt, dummy);
   auto val = std::sqrt(lutEntry->covm[14]) * lutEntry->pt * lutEntry->pt;
   return val;
 }
@@ -333,7 +428,7 @@ double TrackSmearer::getAbsPtRes(const int pdg, const float nch, const float eta
 double TrackSmearer::getAbsEtaRes(const int pdg, const float nch, const float eta, const float pt)
 {
   float dummy = 0.0f;
-  lutEntry_t* lutEntry = getLUTEntry(pdg, nch, 0., eta, pt, dummy);
+  const lutEntry_t* lutEntry = getLUTEntry(pdg, nch, 0., eta, pt, dummy);
   auto sigmatgl = std::sqrt(lutEntry->covm[9]);                                  // sigmatgl2
   auto etaRes = std::fabs(std::sin(2.0 * std::atan(std::exp(-eta)))) * sigmatgl; // propagate tgl to eta uncertainty
   return etaRes;
@@ -29,10 +29,12 @@
 
 #include <TRandom.h>
 
+#include <cstdint>
 #include <cstdio>
 #include <fstream>
 #include <iostream>
 #include <map>
+#include <memory>
 
 ///////////////////////////////
 /// DelphesO2/src/lutCovm.hh //
@@ -49,7 +51,7 @@ struct map_t {
   float min = 0.;
   float max = 1.e6;
   bool log = false;
-  float eval(int bin)
+  float eval(int bin) const
   {
     float width = (max - min) / nbins;
     float val = min + (bin + 0.5) * width;
@@ -58,7 +60,7 @@ struct map_t {
     return val;
   }
   // function needed to interpolate some dimensions
-  float fracPositionWithinBin(float val)
+  float fracPositionWithinBin(float val) const
   {
     float width = (max - min) / nbins;
     int bin;
@@ -73,7 +75,7 @@ struct map_t {
     return returnVal;
   }
 
-  int find(float val)
+  int find(float val) const
   {
     float width = (max - min) / nbins;
     int bin;
@@ -89,7 +91,7 @@ struct map_t {
       return nbins - 1;
     return bin;
   } //;
-  void print() { printf("nbins = %d, min = %f, max = %f, log = %s \n", nbins, min, max, log ? "on" : "off"); } //;
+  void print() const { printf("nbins = %d, min = %f, max = %f, log = %s \n", nbins, min, max, log ? "on" : "off"); } //;
 };
 
 struct lutHeader_t {
@@ -101,11 +103,11 @@ struct lutHeader_t {
   map_t radmap;
   map_t etamap;
   map_t ptmap;
-  bool check_version()
+  bool check_version() const
   {
     return (version == LUTCOVM_VERSION);
   } //;
-  void print()
+  void print() const
   {
     printf(" version: %d \n", version);
     printf("     pdg: %d \n", pdg);
@@ -149,6 +151,35 @@ struct lutEntry_t {
   }
 };
 
+#define LUTCOVM_FLAT_VERSION 1
+
+/// Header of the flat LUT format.
+/// The lutHeader_t is followed, at entryOffset, by all the entries in a single array ordered as [nch][rad][eta][pt],
+/// so that the file can be memory-mapped read-only and the entries used in place.
+struct lutFlatHeader_t {
+  static constexpr char kMagic[8] = {'L', 'U', 'T', 'F', 'L', 'A', 'T', '\0'};
+  static constexpr uint64_t kEntryAlignment = 64;
+  char magic[8] = {'L', 'U', 'T', 'F', 'L', 'A', 'T', '\0'};
+  int flatVersion = LUTCOVM_FLAT_VERSION;
+  int entrySize = sizeof(lutEntry_t);
+  uint64_t entryOffset = (sizeof(lutFlatHeader_t) + kEntryAlignment - 1) / kEntryAlignment * kEntryAlignment;
+  uint64_t nEntries = 0;
+  lutHeader_t header;
+  bool check_magic() const
+  {
+    for (int i = 0; i < 8; ++i) {
+      if (magic[i] != kMagic[i]) {
+        return false;
+      }
+    }
+    return true;
+  }
+  bool check_version() const
+  {
+    return (flatVersion == LUTCOVM_FLAT_VERSION && entrySize == sizeof(lutEntry_t) && header.version == LUTCOVM_VERSION);
+  }
+};
+
 ////////////////////////////////////
 /// DelphesO2/src/TrackSmearer.hh //
 ////////////////////////////////////
@@ -179,16 +210,21 @@ class TrackSmearer
   ~TrackSmearer() = default;
 
   /** LUT methods **/
+  /// Load a LUT either in the legacy (.dat) or in the flat format, the latter is memory-mapped
   bool loadTable(int pdg, const char* filename, bool forceReload = false);
-  bool hasTable(int pdg) { return (mLUTHeader[getIndexPDG(pdg)] != nullptr); } //;
-  void useEfficiency(bool val) { mUseEfficiency = val; }                       //;
-  void interpolateEfficiency(bool val) { mInterpolateEfficiency = val; }       //;
-  void skipUnreconstructed(bool val) { mSkipUnreconstructed = val; }           //;
-  void setWhatEfficiency(int val) { mWhatEfficiency = val; }                   //;
-  lutHeader_t* getLUTHeader(int pdg) { return mLUTHeader[getIndexPDG(pdg)]; }  //;
-  lutEntry_t* getLUTEntry(const int pdg, const float nch, const float radius, const float eta, const float pt, float& interpolatedEff);
-
-  bool smearTrack(O2Track& o2track, lutEntry_t* lutEntry, float interpolatedEff);
+  /// Convert a LUT from the legacy to the flat format
+  static bool convertTable(const char* inFilename, const char* outFilename);
+  /// Check that a converted LUT reads back the same header and entries as the original one
+  static bool checkConvertedTable(const char* inFilename, const char* outFilename);
+  bool hasTable(int pdg) { return (mLUTHeader[getIndexPDG(pdg)] != nullptr); }            //;
+  void useEfficiency(bool val) { mUseEfficiency = val; }                                  //;
+  void interpolateEfficiency(bool val) { mInterpolateEfficiency = val; }                  //;
+  void skipUnreconstructed(bool val) { mSkipUnreconstructed = val; }                      //;
+  void setWhatEfficiency(int val) { mWhatEfficiency = val; }                              //;
+  const lutHeader_t* getLUTHeader(int pdg) { return mLUTHeader[getIndexPDG(pdg)].get(); } //;
+  const lutEntry_t* getLUTEntry(const int pdg, const float nch, const float radius, const float eta, const float pt, float& interpolatedEff);
+
+  bool smearTrack(O2Track& o2track, const lutEntry_t* lutEntry, float interpolatedEff);
   bool smearTrack(O2Track& o2track, int pdg, float nch);
   // bool smearTrack(Track& track, bool atDCA = true); // Only in DelphesO2
   double getPtRes(const int pdg, const float nch, const float eta, const float pt);
@@ -252,9 +288,11 @@ class TrackSmearer
   void setCcdbManager(o2::ccdb::BasicCCDBManager* mgr) { mCcdbManager = mgr; } //;
 
  protected:
-  static constexpr unsigned int nLUTs = 9; // Number of LUT available
-  lutHeader_t* mLUTHeader[nLUTs] = {nullptr};
-  lutEntry_t***** mLUTEntry[nLUTs] = {nullptr};
+  static constexpr unsigned int nLUTs = 9;              // Number of LUT available
+  std::shared_ptr<const lutHeader_t> mLUTHeader[nLUTs]; // header of each LUT, shared by copies of the smearer like the entries
+  const lutEntry_t* mLUTEntry[nLUTs] = {nullptr};       // contiguous entries of each LUT, ordered as [nch][rad][eta][pt]
+  std::shared_ptr<const lutEntry_t> mLUTStorage[nLUTs]; // owner of the entries, either allocated or memory-mapped
+  int mLUTStride[nLUTs][3] = {{0}};                     // strides of the nch, rad and eta bins, in number of entries
   bool mUseEfficiency = true;
   bool mInterpolateEfficiency = false;
   bool mSkipUnreconstructed = true; // don't smear tracks that are not reco'ed
@@ -262,6 +300,8 @@ class TrackSmearer
   float mdNdEta = 1600.;
 
  private:
+  static bool readTable(const char* filename, lutHeader_t& header, std::shared_ptr<const lutEntry_t>& entries);
+
   o2::ccdb::BasicCCDBManager* mCcdbManager = nullptr;
 };
 
@@ -17,13 +17,17 @@
 #include "TMatrixD.h"
 #include "TMatrixDSymEigen.h"
 #include "TRandom.h"
+#include "TRandom3.h"
 #include <TEnv.h>
 #include <THashList.h>
 #include <TObject.h>
 
+#include <algorithm>
 #include <fstream>
+#include <functional>
 #include <map>
 #include <string>
+#include <thread>
 #include <vector>
 
 namespace o2
@@ -577,7 +581,7 @@ int FastTracker::FastTrack(o2::track::TrackParCov inputTrack, o2::track::TrackPa
     // get perfect data point position
     std::array<float, 3> spacePoint;
     inputTrack.getXYZGlo(spacePoint);
-    std::vector<float> thisHit = {spacePoint[0], spacePoint[1], spacePoint[2]};
+    const std::array<float, 3> thisHit = {spacePoint[0], spacePoint[1], spacePoint[2]};
 
     // towards adding cluster: move to track alpha
     float alpha = inwardTrack.getAlpha();
@@ -657,8 +661,9 @@ int FastTracker::FastTrack(o2::track::TrackParCov inputTrack, o2::track::TrackPa
 
     eff *= iGoodHit;
   }
+  TRandom* random = mRandom ? mRandom : gRandom;
   if (mApplyEffCorrection) {
-    if (gRandom->Uniform() > eff)
+    if (random->Uniform() > eff)
       return -8;
   }
 
@@ -727,7 +732,7 @@ int FastTracker::FastTrack(o2::track::TrackParCov inputTrack, o2::track::TrackPa
     for (int j = 0; j < 5; ++j)
       val += eigVec[j][ii] * outputTrack.getParam(j);
     // smear parameters according to eigenvalues
-    params_[ii] = gRandom->Gaus(val, sqrt(eigVal[ii]));
+    params_[ii] = random->Gaus(val, sqrt(eigVal[ii]));
   }
 
   // invert eigenvector matrix
@@ -749,6 +754,60 @@ int FastTracker::FastTrack(o2::track::TrackParCov inputTrack, o2::track::TrackPa
 }
 // +-~-<*>-~-+-~-<*>-~-+-~-<*>-~-+-~-<*>-~-+-~-<*>-~-+-~-<*>-~-+-~-<*>-~-+-~-<*>-~-+
 
+void FastTracker::FastTrackBatch(std::span<const o2::track::TrackParCov> inputTracks, std::span<o2::track::TrackParCov> outputTracks, std::span<int> results, const float nch, const int nThreads, const uint64_t seed)
+{
+  const size_t nTracks = inputTracks.size();
+  if (outputTracks.size() < nTracks || results.size() < nTracks) {
+    LOG(fatal) << "FastTrackBatch: " << nTracks << " input tracks but only " << outputTracks.size() << " output tracks and " << results.size() << " results";
+    return;
+  }
+
+  // seed of track i, mixed (splitmix64) so that neighbouring tracks get uncorrelated sequences
+  auto trackSeed = [seed](uint64_t i) {
+    uint64_t z = seed + (i + 1) * 0x9e3779b97f4a7c15ULL;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    z ^= z >> 31;
+    const uint32_t s = static_cast<uint32_t>(z ^ (z >> 32));
+    return s != 0 ? s : 1u; // TRandom3::SetSeed(0) would pick a time-dependent seed
+  };
+
+  auto processTracks = [&](FastTracker& tracker, const size_t first, const size_t last) {
+    TRandom3 random;
+    tracker.mRandom = &random;
+    for (size_t i = first; i < last; i++) {
+      random.SetSeed(trackSeed(i));
+      results[i] = tracker.FastTrack(inputTracks[i], outputTracks[i], nch);
+    }
+    tracker.mRandom = nullptr;
+  };
+
+  const size_t nWorkers = std::min<size_t>(std::max(nThreads, 1), std::max<size_t>(nTracks, 1));
+  if (nWorkers == 1) {
+    processTracks(*this, 0, nTracks);
+    return;
+  }
+
+  // the copies hold the per-thread state (hits, hit probabilities, counters)
+  std::vector<FastTracker> workers(nWorkers, *this);
+  std::vector<std::thread> threads;
+  threads.reserve(nWorkers);
+  const size_t chunkSize = (nTracks + nWorkers - 1) / nWorkers;
+  for (size_t iw = 0; iw < nWorkers; iw++) {
+    workers[iw].covMatOK = 0;
+    workers[iw].covMatNotOK = 0;
+    threads.emplace_back(processTracks, std::ref(workers[iw]), std::min(nTracks, iw * chunkSize), std::min(nTracks, (iw + 1) * chunkSize));
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (const auto& worker : workers) {
+    covMatOK += worker.covMatOK;
+    covMatNotOK += worker.covMatNotOK;
+  }
+}
+// +-~-<*>-~-+-~-<*>-~-+-~-<*>-~-+-~-<*>-~-+-~-<*>-~-+-~-<*>-~-+-~-<*>-~-+-~-<*>-~-+
+
 } /* namespace fastsim */
 } /* namespace o2 */
 
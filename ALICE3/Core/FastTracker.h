@@ -19,9 +19,14 @@
 
 #include <fairlogger/Logger.h>
 
+#include <array>
+#include <cstdint>
+#include <span>
 #include <string>
 #include <vector>
 
+class TRandom;
+
 namespace o2
 {
 namespace fastsim
@@ -95,6 +100,23 @@ class FastTracker
    */
   int FastTrack(o2::track::TrackParCov inputTrack, o2::track::TrackParCov& outputTrack, const float nch);
 
+  /**
+   * @brief Performs fast tracking on a batch of input tracks, split across threads.
+   *
+   * Each thread processes a contiguous chunk of tracks with its own copy of the tracker.
+   * The random numbers of track i are drawn from a generator seeded with (seed, i), so the
+   * results do not depend on the number of threads. The covariance matrix counters are
+   * accumulated in this tracker, the getters for the last track are not meaningful afterwards.
+   *
+   * @param inputTracks The input track parameters and covariances.
+   * @param outputTracks The output tracks, at least as many as the input tracks.
+   * @param results The return value of FastTrack for each track, at least as many as the input tracks.
+   * @param nch Charged particle multiplicity (used for hit density calculations).
+   * @param nThreads Number of threads (1 or less: process the tracks in the calling thread).
+   * @param seed Seed from which the per-track seeds are derived.
+   */
+  void FastTrackBatch(std::span<const o2::track::TrackParCov> inputTracks, std::span<o2::track::TrackParCov> outputTracks, std::span<int> results, const float nch, const int nThreads = 1, const uint64_t seed = 0);
+
   // For efficiency calculation
   float Dist(float z, float radius);
   float OneEventHitDensity(float multiplicity, float radius);
@@ -135,7 +157,7 @@ class FastTracker
  private:
   // Definition of detector layers
   std::vector<DetLayer> layers;
-  std::vector<std::vector<float>> hits; // bookkeep last added hits
+  std::vector<std::array<float, 3>> hits; // bookkeep last added hits
 
   /// configuration parameters
   bool mApplyZacceptance = false;       /// check z acceptance or not
@@ -168,7 +190,9 @@ class FastTracker
   int nGasPoints = 0;     /// tpc-based space points added to track
   std::vector<float> goodHitProbability;
 
-  ClassDef(FastTracker, 1);
+  TRandom* mRandom = nullptr; //! generator of the track being processed in batch mode (gRandom otherwise)
+
+  ClassDef(FastTracker, 2);
 };
 
 // +-~-<*>-~-+-~-<*>-~-+-~-<*>-~-+-~-<*>-~-+-~-<*>-~-+-~-<*>-~-+-~-<*>-~-+-~-<*>-~-+
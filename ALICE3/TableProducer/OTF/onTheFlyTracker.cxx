@@ -167,6 +167,7 @@ struct OnTheFlyTracker {
     Configurable<bool> applyMSCorrection{"applyMSCorrection", true, "apply ms corrections for secondaries or not"};
     Configurable<bool> applyElossCorrection{"applyElossCorrection", true, "apply eloss corrections for secondaries or not"};
     Configurable<bool> applyEffCorrection{"applyEffCorrection", true, "apply efficiency correction or not"};
+    Configurable<int> nThreads{"nThreads", 0, "if > 0, fast track all primaries of a collision in one batch with this number of threads (per-track seeds, results independent of the number of threads)"};
   } fastPrimaryTrackerSettings;
 
   struct : ConfigurableGroup {
@@ -295,6 +296,12 @@ struct OnTheFlyTracker {
   std::vector<cascadecandidate> cascadesAlice3;
   std::vector<v0candidate> v0sAlice3;
 
+  // For batch fast tracking of primaries
+  std::vector<int64_t> primaryBatchIds; // particle global indices, increasing
+  std::vector<o2::track::TrackParCov> primaryBatchInputTracks;
+  std::vector<o2::track::TrackParCov> primaryBatchOutputTracks;
+  std::vector<int> primaryBatchNHits;
+
   // For TGenPhaseSpace seed
   TRandom3 rand;
   Service<o2::ccdb::BasicCCDBManager> ccdb;
@@ -746,6 +753,33 @@ struct OnTheFlyTracker {
 
     gRandom->SetSeed(seed);
 
+    // Fast track the primaries in one batch, with the selection of the loop below
+    primaryBatchIds.clear();
+    primaryBatchInputTracks.clear();
+    size_t iPrimaryBatch = 0;
+    if (fastPrimaryTrackerSettings.fastTrackPrimaries && fastPrimaryTrackerSettings.nThreads > 0) {
+      for (const auto& mcParticle : mcParticles) {
+        if (!mcParticle.isPhysicalPrimary() || std::fabs(mcParticle.eta()) > maxEta || mcParticle.pt() < minPt) {
+          continue;
+        }
+        const auto pdg = std::abs(mcParticle.pdgCode());
+        const bool isV0 = std::find(v0PDGs.begin(), v0PDGs.end(), pdg) != v0PDGs.end();
+        const bool longLivedToBeHandled = std::find(longLivedHandledPDGs.begin(), longLivedHandledPDGs.end(), pdg) != longLivedHandledPDGs.end();
+        const bool nucleiToBeHandled = std::find(nucleiPDGs.begin(), nucleiPDGs.end(), pdg) != nucleiPDGs.end();
+        const bool pdgsToBeHandled = longLivedToBeHandled || (enableNucleiSmearing && nucleiToBeHandled) || (cascadeDecaySettings.decayXi && mcParticle.pdgCode() == kXiMinus) || (v0DecaySettings.decayV0 && isV0);
+        if (!pdgsToBeHandled) {
+          continue;
+        }
+        primaryBatchIds.push_back(mcParticle.globalIndex());
+        o2::upgrade::convertMCParticleToO2Track(mcParticle, primaryBatchInputTracks.emplace_back(), pdgDB);
+      }
+      primaryBatchOutputTracks.resize(primaryBatchInputTracks.size());
+      primaryBatchNHits.resize(primaryBatchInputTracks.size());
+      // one stream per collision and configuration, such that the configurations do not share the random draws
+      const uint64_t batchSeed = ((static_cast<uint64_t>(mcCollision.globalIndex()) * kMaxLUTConfigs + icfg) << 32) | static_cast<uint32_t>(seed.value);
+      fastPrimaryTracker.FastTrackBatch(primaryBatchInputTracks, primaryBatchOutputTracks, primaryBatchNHits, dNdEta, fastPrimaryTrackerSettings.nThreads, batchSeed);
+    }
+
     for (const auto& mcParticle : mcParticles) {
       double xiDecayRadius2D = 0;
       double laDecayRadius2D = 0;
@@ -1271,9 +1305,18 @@ struct OnTheFlyTracker {
       if (enablePrimarySmearing && !fastPrimaryTrackerSettings.fastTrackPrimaries) {
         reconstructed = mSmearer[icfg]->smearTrack(trackParCov, mcParticle.pdgCode(), dNdEta);
       } else if (fastPrimaryTrackerSettings.fastTrackPrimaries) {
-        o2::track::TrackParCov o2Track;
-        o2::upgrade::convertMCParticleToO2Track(mcParticle, o2Track, pdgDB);
-        int nHits = fastPrimaryTracker.FastTrack(o2Track, trackParCov, dNdEta);
+        int nHits = 0;
+        while (iPrimaryBatch < primaryBatchIds.size() && primaryBatchIds[iPrimaryBatch] < mcParticle.globalIndex()) {
+          iPrimaryBatch++;
+        }
+        if (iPrimaryBatch < primaryBatchIds.size() && primaryBatchIds[iPrimaryBatch] == mcParticle.globalIndex()) {
+          trackParCov = primaryBatchOutputTracks[iPrimaryBatch];
+          nHits = primaryBatchNHits[iPrimaryBatch];
+        } else {
+          o2::track::TrackParCov o2Track;
+          o2::upgrade::convertMCParticleToO2Track(mcParticle, o2Track, pdgDB);
+          nHits = fastPrimaryTracker.FastTrack(o2Track, trackParCov, dNdEta);
+        }
         if (nHits < fastPrimaryTrackerSettings.minSiliconHits) {
           reconstructed = false;
         }
@@ -28,23 +28,74 @@
 
 namespace o2
 {
-double ctpRateFetcher::fetch(o2::ccdb::BasicCCDBManager* ccdb, uint64_t timeStamp, int runNumber, const std::string& sourceName, bool fCrashOnNull)
+ctpRateFetcher::RateSource ctpRateFetcher::getSource(const std::string& sourceName)
 {
-  setupRun(runNumber, ccdb, timeStamp);
   if (sourceName.find("ZNC") != std::string::npos) {
-    if (runNumber < 544448) {
-      return fetchCTPratesInputs(ccdb, timeStamp, runNumber, 25) / (sourceName.find("hadronic") != std::string::npos ? 28. : 1.);
-    } else {
-      return fetchCTPratesClasses(ccdb, timeStamp, runNumber, "C1ZNC-B-NOPF-CRU", 6) / (sourceName.find("hadronic") != std::string::npos ? 28. : 1.);
-    }
+    return sourceName.find("hadronic") != std::string::npos ? kZNChadronic : kZNC;
   } else if (sourceName == "T0CE") {
-    return fetchCTPratesClasses(ccdb, timeStamp, runNumber, "CMTVXTCE-B-NOPF");
+    return kT0CE;
   } else if (sourceName == "T0SC") {
-    return fetchCTPratesClasses(ccdb, timeStamp, runNumber, "CMTVXTSC-B-NOPF");
+    return kT0SC;
   } else if (sourceName == "T0VTX") {
-    if (runNumber < 534202) {
-      return fetchCTPratesClasses(ccdb, timeStamp, runNumber, "minbias_TVX_L0", 3); // 2022
-    } else {
+    return kT0VTX;
+  }
+  return kUnknownSource;
+}
+
+double ctpRateFetcher::fetch(o2::ccdb::BasicCCDBManager* ccdb, uint64_t timeStamp, int runNumber, const std::string& sourceName, bool fCrashOnNull)
+{
+  const RateSource source = getSource(sourceName);
+  if (source == kUnknownSource) {
+    LOG(error) << "CTP rate for " << sourceName << " not available";
+    return -1.;
+  }
+  return fetch(ccdb, timeStamp, runNumber, source, fCrashOnNull);
+}
+
+double ctpRateFetcher::fetch(o2::ccdb::BasicCCDBManager* ccdb, uint64_t timeStamp, int runNumber, RateSource source, bool fCrashOnNull)
+{
+  if (source < 0 || source >= kNRateSources) {
+    LOG(error) << "CTP rate for source " << static_cast<int>(source) << " not available";
+    return -1.;
+  }
+  setupRun(runNumber, ccdb, timeStamp);
+  RateCache& cache = mCaches[source];
+  const size_t slot = RateCache::slot(timeStamp);
+  if (!cache.timeStamps.empty() && cache.timeStamps[slot] == timeStamp) {
+    return cache.rates[slot];
+  }
+  const double rate = fetchRate(ccdb, timeStamp, runNumber, source, fCrashOnNull);
+  if (rate < 0.) {
+    return rate;
+  }
+  if (cache.timeStamps.empty()) {
+    cache.timeStamps.assign(RateCache::kSize, RateCache::kEmpty);
+    cache.rates.assign(RateCache::kSize, 0.);
+  }
+  cache.timeStamps[slot] = timeStamp;
+  cache.rates[slot] = rate;
+  return rate;
+}
+
+double ctpRateFetcher::fetchRate(o2::ccdb::BasicCCDBManager* ccdb, uint64_t timeStamp, int runNumber, RateSource source, bool fCrashOnNull)
+{
+  switch (source) {
+    case kZNC:
+    case kZNChadronic: {
+      const double scale = source == kZNChadronic ? 28. : 1.;
+      if (runNumber < 544448) {
+        return fetchCTPratesInputs(ccdb, timeStamp, runNumber, 25) / scale;
+      }
+      return fetchCTPratesClasses(ccdb, timeStamp, runNumber, "C1ZNC-B-NOPF-CRU", 6) / scale;
+    }
+    case kT0CE:
+      return fetchCTPratesClasses(ccdb, timeStamp, runNumber, "CMTVXTCE-B-NOPF");
+    case kT0SC:
+      return fetchCTPratesClasses(ccdb, timeStamp, runNumber, "CMTVXTSC-B-NOPF");
+    case kT0VTX: {
+      if (runNumber < 534202) {
+        return fetchCTPratesClasses(ccdb, timeStamp, runNumber, "minbias_TVX_L0", 3); // 2022
+      }
       double_t ret = fetchCTPratesClasses(ccdb, timeStamp, runNumber, "CMTVX-B-NOPF");
       if (ret < 0.) {
         LOG(info) << "Trying different class";
@@ -55,8 +106,10 @@ double ctpRateFetcher::fetch(o2::ccdb::BasicCCDBManager* ccdb, uint64_t timeStam
       }
       return ret;
     }
+    default:
+      break;
   }
-  LOG(error) << "CTP rate for " << sourceName << " not available";
+  LOG(error) << "CTP rate for source " << static_cast<int>(source) << " not available";
   return -1.;
 }
 
@@ -95,9 +148,7 @@ double ctpRateFetcher::pileUpCorrection(double triggerRate)
   if (mLHCIFdata == nullptr) {
     LOG(fatal) << "No filling" << std::endl;
   }
-  auto bfilling = mLHCIFdata->getBunchFilling();
-  std::vector<int> bcs = bfilling.getFilledBCs();
-  double nbc = bcs.size();
+  double nbc = mNFilledBCs;
   double nTriggersPerFilledBC = triggerRate / nbc / constants::lhc::LHCRevFreq;
   double mu = -std::log(1 - nTriggersPerFilledBC);
   return mu * nbc * constants::lhc::LHCRevFreq;
@@ -120,6 +171,10 @@ void ctpRateFetcher::setupRun(int runNumber, o2::ccdb::BasicCCDBManager* ccdb, u
   if (mLHCIFdata == nullptr) {
     LOG(fatal) << "GRPLHCIFData not in database, timestamp:" << timeStamp;
   }
+  mNFilledBCs = mLHCIFdata->getBunchFilling().getFilledBCs().size();
+  for (auto& cache : mCaches) {
+    cache.clear();
+  }
   metadata["runNumber"] = std::to_string(mRunNumber);
   mConfig = ccdb->getSpecific<ctp::CTPConfiguration>("CTP/Config/Config", timeStamp, metadata);
   if (mConfig == nullptr) {
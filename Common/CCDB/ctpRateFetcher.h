@@ -14,8 +14,12 @@
 
 #include <CCDB/BasicCCDBManager.h>
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
 #include <cstdint>
 #include <string>
+#include <vector>
 
 namespace o2
 {
@@ -34,14 +38,39 @@ class GRPLHCIFData;
 class ctpRateFetcher
 {
  public:
+  /// Sources of the interaction rate, resolve the name once with getSource and use the handle in the loops
+  enum RateSource : int {
+    kUnknownSource = -1,
+    kZNC = 0,
+    kZNChadronic,
+    kT0CE,
+    kT0SC,
+    kT0VTX,
+    kNRateSources
+  };
+
   ctpRateFetcher() = default;
+  static RateSource getSource(const std::string& sourceName);
   double fetch(o2::ccdb::BasicCCDBManager* ccdb, uint64_t timeStamp, int runNumber, const std::string& sourceName, bool fCrashOnNull = true);
+  double fetch(o2::ccdb::BasicCCDBManager* ccdb, uint64_t timeStamp, int runNumber, RateSource source, bool fCrashOnNull = true);
+
+  /// Fill the rate of each entry of a BC table (with timestamp() and runNumber())
+  template <typename TBCs>
+  void fetch(o2::ccdb::BasicCCDBManager* ccdb, const TBCs& bcs, RateSource source, std::vector<double>& rates, bool fCrashOnNull = true)
+  {
+    rates.resize(bcs.size());
+    size_t iBC = 0;
+    for (const auto& bc : bcs) {
+      rates[iBC++] = fetch(ccdb, bc.timestamp(), bc.runNumber(), source, fCrashOnNull);
+    }
+  }
 
   void setManualCleanup(bool manualCleanup = true) { mManualCleanup = manualCleanup; }
 
  private:
   double fetchCTPratesInputs(o2::ccdb::BasicCCDBManager* ccdb, uint64_t timeStamp, int runNumber, int input);
   double fetchCTPratesClasses(o2::ccdb::BasicCCDBManager* ccdb, uint64_t timeStamp, int runNumber, const std::string& className, int inputType = 1);
+  double fetchRate(o2::ccdb::BasicCCDBManager* ccdb, uint64_t timeStamp, int runNumber, RateSource source, bool fCrashOnNull);
   double pileUpCorrection(double rate);
   void setupRun(int runNumber, o2::ccdb::BasicCCDBManager* ccdb, uint64_t timeStamp);
 
@@ -50,6 +79,25 @@ class ctpRateFetcher
   ctp::CTPConfiguration* mConfig = nullptr;
   ctp::CTPRunScalers* mScalers = nullptr;
   parameters::GRPLHCIFData* mLHCIFdata = nullptr;
+  double mNFilledBCs = 0.; /// Filled BCs of the current run, used in the pile-up correction
+
+  /// Rates of one source already computed in the current run, direct-mapped on the timestamp.
+  /// The size is fixed: a new timestamp replaces the entry in its slot. Failed fetches (rate < 0) are not stored.
+  /// The rates are not precomputed per run: each entry comes from CTPRunScalers::getRateGivenT, so it is identical to an uncached fetch.
+  struct RateCache {
+    static constexpr size_t kSize = 1 << 12;
+    static constexpr uint64_t kEmpty = ~static_cast<uint64_t>(0);
+    std::vector<uint64_t> timeStamps;
+    std::vector<double> rates;
+    static size_t slot(uint64_t timeStamp) { return timeStamp & (kSize - 1); }
+    void clear()
+    {
+      if (!timeStamps.empty()) {
+        std::fill(timeStamps.begin(), timeStamps.end(), kEmpty);
+      }
+    }
+  };
+  std::array<RateCache, kNRateSources> mCaches;
 };
 } // namespace o2
 
@@ -30,7 +30,6 @@
 #include <cmath>
 #include <cstdint>
 #include <cstdlib>
-#include <memory>
 #include <utility>
 #include <vector>
 
@@ -132,6 +131,25 @@ class CollisionAssociation
                         Assoc& association,
                         RevIndices& reverseIndices)
   {
+    // index of the (first) ambiguous-track row of each track, built in one pass
+    std::vector<int> ambTrackRows;
+    if (mIncludeUnassigned) {
+      ambTrackRows.assign(tracksUnfiltered.size(), -1);
+      int ambTrackRow = 0;
+      for (const auto& ambTrack : ambiguousTracks) {
+        int64_t trackId = -1;
+        if constexpr (isCentralBarrel) { // FIXME: to be removed as soon as it is possible to use getId<Table>() for joined tables
+          trackId = ambTrack.trackId();
+        } else {
+          trackId = ambTrack.template getId<TTracks>();
+        }
+        if (trackId >= 0 && trackId < static_cast<int64_t>(ambTrackRows.size()) && ambTrackRows[trackId] < 0) {
+          ambTrackRows[trackId] = ambTrackRow;
+        }
+        ambTrackRow++;
+      }
+    }
+
     // cache globalBC and track time in BC for optimization
     std::vector<int64_t> globalBC;
     std::vector<int64_t> trackBCCache;
@@ -148,27 +166,16 @@ class CollisionAssociation
       int64_t trackBC = -1;
       if (track.has_collision()) {
         trackBC = track.collision().bc().globalBC();
-      } else if (mIncludeUnassigned) {
-        for (const auto& ambTrack : ambiguousTracks) {
-          if constexpr (isCentralBarrel) { // FIXME: to be removed as soon as it is possible to use getId<Table>() for joined tables
-            if (ambTrack.trackId() == track.globalIndex()) {
-              // special check to avoid crashes (in particular on some MC datasets)
-              // related to shifts in ambiguous tracks association to bc slices (off by 1) - see https://mattermost.web.cern.ch/alice/pl/g9yaaf3tn3g4pgn7c1yex9copy
-              if (ambTrack.bcIds()[0] >= bcs.size() || ambTrack.bcIds()[1] >= bcs.size()) {
-                break;
-              }
-              if (!ambTrack.has_bc() || ambTrack.bc().size() == 0) {
-                break;
-              }
-              trackBC = ambTrack.bc().begin().globalBC();
-              break;
-            }
-          } else {
-            if (ambTrack.template getId<TTracks>() == track.globalIndex()) {
-              trackBC = ambTrack.bc().begin().globalBC();
-              break;
-            }
+      } else if (mIncludeUnassigned && ambTrackRows[track.globalIndex()] >= 0) {
+        auto ambTrack = ambiguousTracks.rawIteratorAt(ambTrackRows[track.globalIndex()]);
+        if constexpr (isCentralBarrel) {
+          // special check to avoid crashes (in particular on some MC datasets)
+          // related to shifts in ambiguous tracks association to bc slices (off by 1) - see https://mattermost.web.cern.ch/alice/pl/g9yaaf3tn3g4pgn7c1yex9copy
+          if (ambTrack.bcIds()[0] < bcs.size() && ambTrack.bcIds()[1] < bcs.size() && ambTrack.has_bc() && ambTrack.bc().size() != 0) {
+            trackBC = ambTrack.bc().begin().globalBC();
           }
+        } else {
+          trackBC = ambTrack.bc().begin().globalBC();
         }
       }
       globalBC.push_back(trackBC);
@@ -189,8 +196,9 @@ class CollisionAssociation
       trackIterationWindows.push_back(std::make_pair(trackBegin, track));
     }
 
-    // define vector of vectors to store indices of compatible collisions per track
-    std::vector<std::unique_ptr<std::vector<int>>> collsPerTrack(tracksUnfiltered.size());
+    // compatible (track, collision) pairs in the order in which they are found, sorted per track at the end
+    std::vector<int64_t> compatibleTrackIds;
+    std::vector<int> compatibleCollIds;
 
     // loop over collisions to find time-compatible tracks
     int64_t bcOffsetMax = mBcWindowForOneSigma * mNumSigmaForTimeCompat + mTimeMargin / o2::constants::lhc::LHCBunchSpacingNS;
@@ -278,10 +286,8 @@ class CollisionAssociation
             LOGP(debug, "Filling track id {} for coll id {}", trackIdx, collIdx);
             association(collIdx, trackIdx);
             if (mFillTableOfCollIdsPerTrack) {
-              if (collsPerTrack[trackIdx] == nullptr) {
-                collsPerTrack[trackIdx] = std::make_unique<std::vector<int>>();
-              }
-              collsPerTrack[trackIdx].get()->push_back(collIdx);
+              compatibleTrackIds.push_back(trackIdx);
+              compatibleCollIds.push_back(collIdx);
             }
           }
         }
@@ -289,15 +295,25 @@ class CollisionAssociation
     }
     // create reverse index track to collisions if enabled
     if (mFillTableOfCollIdsPerTrack) {
-      std::vector<int> empty{};
-      for (const auto& trackUnfiltered : tracksUnfiltered) {
+      // compressed sparse rows: the compatible collisions of track i are collIds[offsets[i]] to collIds[offsets[i + 1] - 1], in the order they were found
+      std::vector<int> offsets(tracksUnfiltered.size() + 1, 0);
+      for (const auto trackIdx : compatibleTrackIds) {
+        offsets[trackIdx + 1]++;
+      }
+      for (size_t i = 1; i < offsets.size(); i++) {
+        offsets[i] += offsets[i - 1];
+      }
+      std::vector<int> collIds(compatibleCollIds.size());
+      std::vector<int> fillPositions(offsets.begin(), offsets.end() - 1);
+      for (size_t i = 0; i < compatibleTrackIds.size(); i++) {
+        collIds[fillPositions[compatibleTrackIds[i]]++] = compatibleCollIds[i];
+      }
 
+      std::vector<int> collsThisTrack{};
+      for (const auto& trackUnfiltered : tracksUnfiltered) {
         const auto trackId = trackUnfiltered.globalIndex();
-        if (collsPerTrack[trackId] == nullptr) {
-          reverseIndices(empty);
-        } else {
-          reverseIndices(*collsPerTrack[trackId].get());
-        }
+        collsThisTrack.assign(collIds.begin() + offsets[trackId], collIds.begin() + offsets[trackId + 1]);
+        reverseIndices(collsThisTrack);
       }
     }
   }
@@ -12,8 +12,285 @@
 #ifndef ANALYSIS_CORE_EVENTMIXING_H_
 #define ANALYSIS_CORE_EVENTMIXING_H_
 
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <utility>
+#include <vector>
+
 namespace eventmixing
 {
+/// Binning of one event variable used for the mixing categories.
+/// The bin of a value is found with a binary search on the edges or, for (close to) uniform
+/// edges, with a direct index guess which is corrected against the stored edges, so both give
+/// identical results.
+class MixingAxis
+{
+ public:
+  MixingAxis() = default;
+  template <typename T>
+  explicit MixingAxis(const T& edges) : mEdges(edges.begin(), edges.end())
+  {
+    init();
+  }
+
+  /// \return Number of bins of the axis
+  int getNBins() const { return mEdges.size() > 1 ? mEdges.size() - 1 : 0; }
+  /// \return Bin edges of the axis
+  const std::vector<double>& getEdges() const { return mEdges; }
+
+  /// Find the bin of a value
+  /// \param value Value of the event variable
+  /// \return Bin index in [0, getNBins()), -1 if the value is outside the axis range or NaN
+  template <typename T>
+  int findBin(const T& value) const
+  {
+    const double x = value;
+    if (!(x >= mEdges.front()) || !(x < mEdges.back())) {
+      return -1;
+    }
+    if (mUniform) {
+      int bin = static_cast<int>((x - mEdges.front()) * mInvWidth);
+      bin = std::clamp(bin, 0, getNBins() - 1);
+      while (x < mEdges[bin]) {
+        --bin;
+      }
+      while (x >= mEdges[bin + 1]) {
+        ++bin;
+      }
+      return bin;
+    }
+    return std::upper_bound(mEdges.begin(), mEdges.end(), x) - mEdges.begin() - 1;
+  }
+
+ private:
+  void init()
+  {
+    const int nBins = getNBins();
+    mUniform = false;
+    if (nBins < 1) {
+      return;
+    }
+    const double width = (mEdges.back() - mEdges.front()) / nBins;
+    if (!(width > 0.)) {
+      return;
+    }
+    mUniform = true;
+    for (int i = 1; i < nBins; i++) {
+      if (std::abs(mEdges[i] - (mEdges.front() + i * width)) > 1e-3 * width) {
+        mUniform = false;
+        break;
+      }
+    }
+    mInvWidth = 1. / width;
+  }
+
+  std::vector<double> mEdges;
+  bool mUniform = false;
+  double mInvWidth = 0.;
+};
+
+/// Mixing categories built from any number of event variables (z-vertex, centrality, event plane angle, occupancy, ...).
+/// Categories are numbered in row-major order, i.e. the last added variable runs fastest.
+class MixingBinning
+{
+ public:
+  /// Add an event variable
+  /// \param edges Bin edges in increasing order
+  /// \return Position of the variable in the binning
+  template <typename T>
+  int addAxis(const T& edges)
+  {
+    mAxes.emplace_back(edges);
+    mNCategories = 1;
+    for (const auto& axis : mAxes) {
+      mNCategories *= axis.getNBins();
+    }
+    return mAxes.size() - 1;
+  }
+
+  int getNAxes() const { return mAxes.size(); }
+  const MixingAxis& getAxis(int i) const { return mAxes[i]; }
+  /// \return Number of mixing categories (product of the number of bins of all variables)
+  int getNCategories() const { return mAxes.empty() ? 0 : mNCategories; }
+
+  /// Find the mixing category of an event
+  /// \param values Values of the event variables, in the order in which the axes were added
+  /// \return Category index, -1 if no variable is defined or any value is outside its axis
+  template <typename T>
+  int getCategory(const T* values) const
+  {
+    if (mAxes.empty()) {
+      return -1;
+    }
+    int category = 0;
+    for (size_t i = 0; i < mAxes.size(); i++) {
+      const int bin = mAxes[i].findBin(values[i]);
+      if (bin < 0) {
+        return -1;
+      }
+      category = category * mAxes[i].getNBins() + bin;
+    }
+    return category;
+  }
+
+  /// Find the mixing category of an event from a larger array of values
+  /// \param values Array of event variables, e.g. the VarManager values
+  /// \param indices Position in values of the variable of each axis
+  template <typename T>
+  int getCategory(const T* values, const int* indices) const
+  {
+    if (mAxes.empty()) {
+      return -1;
+    }
+    int category = 0;
+    for (size_t i = 0; i < mAxes.size(); i++) {
+      const int bin = mAxes[i].findBin(values[indices[i]]);
+      if (bin < 0) {
+        return -1;
+      }
+      category = category * mAxes[i].getNBins() + bin;
+    }
+    return category;
+  }
+
+  /// Variadic version of getCategory, e.g. getCategory(posZ, centrality)
+  template <typename... Ts>
+  int getCategoryOf(const Ts&... values) const
+  {
+    const double v[] = {static_cast<double>(values)...};
+    return sizeof...(Ts) == mAxes.size() ? getCategory(v) : -1;
+  }
+
+  /// \return Bin of variable iAxis for the given category
+  int getAxisBin(int iAxis, int category) const
+  {
+    for (int i = mAxes.size() - 1; i > iAxis; --i) {
+      category /= mAxes[i].getNBins();
+    }
+    return category % mAxes[iAxis].getNBins();
+  }
+
+ private:
+  std::vector<MixingAxis> mAxes;
+  int mNCategories = 0;
+};
+
+/// Pool of the most recent events of each mixing category, with at most depth events per category.
+/// The events of a category are stored contiguously from the oldest to the most recent one, such that they can be
+/// read as a span; adding to a full category drops its oldest event. Categories can be added while filling, e.g.
+/// for pools indexed by a map of bin keys.
+/// \tparam THandle Event handle stored in the pool, e.g. a collision index or a small struct with offsets into a track buffer
+template <typename THandle>
+class MixingPool
+{
+ public:
+  MixingPool() = default;
+  MixingPool(int nCategories, int depth) { init(nCategories, depth); }
+
+  void init(int nCategories, int depth)
+  {
+    mDepth = std::max(depth, 0);
+    mHandles.assign(static_cast<size_t>(nCategories) * mDepth, THandle{});
+    mSize.assign(nCategories, 0);
+  }
+
+  /// Remove all events, keeping the allocated storage
+  void clear()
+  {
+    std::fill(mSize.begin(), mSize.end(), 0);
+  }
+
+  /// Add an empty category
+  /// \return Index of the new category
+  int addCategory()
+  {
+    mHandles.resize(mHandles.size() + mDepth, THandle{});
+    mSize.push_back(0);
+    return mSize.size() - 1;
+  }
+
+  /// Change the depth of all categories, keeping their most recent events
+  /// \param onEvicted Called for each event which no longer fits into the pool, from the oldest to the most recent one
+  template <typename F>
+  void setDepth(int depth, F&& onEvicted)
+  {
+    depth = std::max(depth, 0);
+    if (depth == mDepth) {
+      return;
+    }
+    std::vector<THandle> handles(mSize.size() * depth, THandle{});
+    for (size_t category = 0; category < mSize.size(); category++) {
+      const THandle* events = mHandles.data() + category * mDepth;
+      const int nKept = std::min(mSize[category], depth);
+      for (int i = 0; i < mSize[category] - nKept; i++) {
+        onEvicted(events[i]);
+      }
+      std::copy(events + mSize[category] - nKept, events + mSize[category], handles.begin() + category * depth);
+      mSize[category] = nKept;
+    }
+    mHandles.swap(handles);
+    mDepth = depth;
+  }
+  void setDepth(int depth)
+  {
+    setDepth(depth, [](const THandle&) {});
+  }
+
+  int getNCategories() const { return mSize.size(); }
+  int getDepth() const { return mDepth; }
+  /// \return Number of events currently stored for the category
+  int size(int category) const { return mSize[category]; }
+
+  /// Add an event, replacing the oldest one if the pool of the category is full
+  /// \return Handle which was evicted from the pool, or nullptr if the pool was not full
+  const THandle* push(int category, const THandle& handle)
+  {
+    if (category < 0 || category >= getNCategories() || mDepth == 0) {
+      return nullptr;
+    }
+    THandle* events = mHandles.data() + static_cast<size_t>(category) * mDepth;
+    const THandle* evicted = nullptr;
+    if (mSize[category] == mDepth) {
+      mEvicted = std::move(events[0]);
+      evicted = &mEvicted;
+      std::move(events + 1, events + mDepth, events); // depth is small, shifting keeps the events contiguous
+    } else {
+      mSize[category]++;
+    }
+    events[mSize[category] - 1] = handle;
+    return evicted;
+  }
+
+  /// \return i-th event of the category, 0 being the most recent one
+  const THandle& get(int category, int i) const
+  {
+    return mHandles[static_cast<size_t>(category) * mDepth + mSize[category] - 1 - i];
+  }
+
+  /// \return Events of the category, from the oldest to the most recent one
+  std::span<const THandle> getEvents(int category) const
+  {
+    return std::span<const THandle>(mHandles.data() + static_cast<size_t>(category) * mDepth, mSize[category]);
+  }
+
+  /// Call f(handle) for the events of the category, from the most recent to the oldest one
+  template <typename F>
+  void forEach(int category, F&& f) const
+  {
+    for (int i = 0; i < mSize[category]; i++) {
+      f(get(category, i));
+    }
+  }
+
+ private:
+  int mDepth = 0;
+  std::vector<THandle> mHandles; // nCategories x depth, oldest event first in each category
+  std::vector<int> mSize;        // number of valid events per category
+  THandle mEvicted{};
+};
+
 /// Calculate hash for an element based on 2 properties and their bins.
 /// \tparam T1 Data type of the configurable of the z-vertex and multiplicity bins
 /// \tparam T2 Data type of the value of the z-vertex and multiplicity
@@ -25,25 +302,16 @@ namespace eventmixing
 template <typename T1, typename T2>
 static int getMixingBin(const T1& vtxBins, const T1& multBins, const T2& vtx, const T2& mult)
 {
-  // underflow
-  if (vtx < vtxBins.at(0)) {
+  // first edge above the value; under- and overflow (and NaN) give -1
+  const unsigned int i = std::upper_bound(vtxBins.begin(), vtxBins.end(), vtx) - vtxBins.begin();
+  if (i == 0 || i == vtxBins.size()) {
     return -1;
   }
-  if (mult < multBins.at(0)) {
+  const unsigned int j = std::upper_bound(multBins.begin(), multBins.end(), mult) - multBins.begin();
+  if (j == 0 || j == multBins.size()) {
     return -1;
   }
-
-  for (unsigned int i = 1; i < vtxBins.size(); i++) {
-    if (vtx < vtxBins.at(i)) {
-      for (unsigned int j = 1; j < multBins.size(); j++) {
-        if (mult < multBins.at(j)) {
-          return i + j * (vtxBins.size() + 1);
-        }
-      }
-    }
-  }
-  // overflow
-  return -1;
+  return i + j * (vtxBins.size() + 1);
 }
 }; // namespace eventmixing
 
@@ -32,6 +32,7 @@
 
 #include <array>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <cstdlib>
 #include <string>
@@ -559,6 +560,148 @@ class ExpTimes
   }
 };
 
+/// \brief Columns of the track quantities needed by the batched TOF response (structure of arrays)
+struct TOFTrackColumns {
+  std::vector<float> p;            /// Track momentum, used for the expected resolution
+  std::vector<float> tofExpMom;    /// TOF expected momentum, used for the expected time
+  std::vector<float> length;       /// Track length
+  std::vector<float> tofSignal;    /// TOF signal
+  std::vector<float> tofEvTime;    /// Event time
+  std::vector<float> tofEvTimeErr; /// Event time resolution
+  std::vector<float> eta;          /// Track pseudorapidity
+  std::vector<int16_t> sign;       /// Track charge sign
+  std::vector<uint8_t> hasTOF;     /// 1 if the track has a TOF measurement
+  std::vector<uint8_t> isRun2;     /// 1 for Run 2 tracks (expected momentum not in units of the speed of light)
+
+  std::size_t size() const { return p.size(); }
+
+  void clear()
+  {
+    p.clear();
+    tofExpMom.clear();
+    length.clear();
+    tofSignal.clear();
+    tofEvTime.clear();
+    tofEvTimeErr.clear();
+    eta.clear();
+    sign.clear();
+    hasTOF.clear();
+    isRun2.clear();
+  }
+
+  void reserve(const std::size_t n)
+  {
+    p.reserve(n);
+    tofExpMom.reserve(n);
+    length.reserve(n);
+    tofSignal.reserve(n);
+    tofEvTime.reserve(n);
+    tofEvTimeErr.reserve(n);
+    eta.reserve(n);
+    sign.reserve(n);
+    hasTOF.reserve(n);
+    isRun2.reserve(n);
+  }
+
+  /// Appends a track, with the event time taken from the track itself
+  /// \param track Track of interest
+  template <typename TrackType>
+  void push_back(const TrackType& track)
+  {
+    push_back(track, track.tofEvTime(), track.tofEvTimeErr());
+  }
+
+  /// Appends a track
+  /// \param track Track of interest
+  /// \param evTime Event time
+  /// \param evTimeErr Event time resolution
+  template <typename TrackType>
+  void push_back(const TrackType& track, const float evTime, const float evTimeErr)
+  {
+    p.push_back(track.p());
+    tofExpMom.push_back(track.tofExpMom());
+    length.push_back(track.length());
+    tofSignal.push_back(track.tofSignal());
+    tofEvTime.push_back(evTime);
+    tofEvTimeErr.push_back(evTimeErr);
+    eta.push_back(track.eta());
+    sign.push_back(track.sign());
+    hasTOF.push_back(track.hasTOF());
+    isRun2.push_back(track.trackType() == o2::aod::track::Run2Track);
+  }
+};
+
+/// \brief Batched version of ExpTimes::GetExpectedSigma and ExpTimes::GetSeparation over track columns
+/// The species-independent terms (momentum and time shifts) are computed once per track in prepare(),
+/// the parameters of the expected resolution once per species. Results are identical to the track-by-track ones.
+class ExpTimesBatch
+{
+ public:
+  /// Computes the species-independent terms of the tracks
+  /// \param parameters Parameters to correct for the momentum and time shifts
+  /// \param tracks Track columns
+  template <typename ParamType>
+  void prepare(const ParamType& parameters, const TOFTrackColumns& tracks)
+  {
+    const std::size_t n = tracks.size();
+    mExpMom.resize(n);
+    mTimeShift.resize(n);
+    mDeltaT.resize(n);
+    for (std::size_t i = 0; i < n; i++) {
+      const float shift = 1.f + tracks.sign[i] * parameters.getMomentumChargeShift(tracks.eta[i]);
+      mExpMom[i] = tracks.isRun2[i] ? tracks.tofExpMom[i] * o2::constants::physics::invLightSpeedCm2PS / shift : tracks.tofExpMom[i] / shift;
+      mTimeShift[i] = tracks.isRun2[i] ? 0.f : parameters.getTimeShift(tracks.eta[i], tracks.sign[i]);
+      mDeltaT[i] = tracks.tofSignal[i] - tracks.tofEvTime[i];
+    }
+  }
+
+  /// Computes the expected resolution and the number of sigmas of all tracks under the PID assumption, prepare() must have been called first
+  /// \param parameters Detector response parameters
+  /// \param tracks Track columns
+  /// \param nSigma Output array of the separations, of size tracks.size()
+  /// \param expSigma Optional output array of the expected resolutions, of size tracks.size()
+  template <o2::track::PID::ID id, typename ParamType>
+  void computeSeparation(const ParamType& parameters, const TOFTrackColumns& tracks, float* nSigma, float* expSigma = nullptr) const
+  {
+    using Response = ExpTimes<TOFTrackColumns, id>;
+    constexpr float massZ = Response::mMassZ;
+    constexpr float massZSquared = Response::mMassZSqared;
+    constexpr int offset = id <= o2::track::PID::Pion ? 0 : (id == o2::track::PID::Kaon ? 5 : 9); // Pion, kaon and proton parametrisations
+    const auto par0 = parameters[offset];
+    const auto par1 = parameters[offset + 1];
+    const auto par2 = parameters[offset + 2];
+    const auto par3 = parameters[offset + 3];
+    const auto timeResolution = parameters[4];
+
+    const std::size_t n = tracks.size();
+    for (std::size_t i = 0; i < n; i++) {
+      const float mom = tracks.p[i];
+      const float evTimeErr = tracks.tofEvTimeErr[i];
+      float sigma = -999.f;
+      if (mom > 0) {
+        const float reso = parameters.template getResolution<id>(mom, tracks.eta[i]);
+        if (reso > 0) {
+          sigma = std::sqrt(reso * reso + timeResolution * timeResolution + evTimeErr * evTimeErr);
+        } else {
+          const float dpp = par0 + par1 * mom + par2 * massZ / mom; // mean relative pt resolution;
+          const float sigmaMom = dpp * tracks.tofSignal[i] / (1. + mom * mom / (massZSquared));
+          sigma = std::sqrt(sigmaMom * sigmaMom + par3 * par3 / mom / mom + timeResolution * timeResolution + evTimeErr * evTimeErr);
+        }
+      }
+      const float expTime = Response::ComputeExpectedTime(mExpMom[i], tracks.length[i]) + mTimeShift[i];
+      nSigma[i] = tracks.hasTOF[i] ? (mDeltaT[i] - expTime) / sigma : defaultReturnValue;
+      if (expSigma) {
+        expSigma[i] = sigma;
+      }
+    }
+  }
+
+ private:
+  std::vector<float> mExpMom;    /// Expected momentum corrected for the charge shift
+  std::vector<float> mTimeShift; /// Time shift of the expected time
+  std::vector<float> mDeltaT;    /// TOF signal minus event time
+};
+
 /// \brief Class to convert the trackTime to the tofSignal used for PID
 template <typename TrackType>
 class TOFSignal
@@ -23,8 +23,10 @@
 
 #include <Rtypes.h>
 
+#include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstddef>
 #include <vector>
 
 namespace o2::pid::tpc
@@ -40,14 +42,38 @@ class Response
   ~Response() = default;
 
   /// Setter and Getter for the private parameters
-  void SetBetheBlochParams(const std::array<float, 5>& betheBlochParams) { mBetheBlochParams = betheBlochParams; }
-  void SetResolutionParamsDefault(const std::array<float, 2>& resolutionParamsDefault) { mResolutionParamsDefault = resolutionParamsDefault; }
-  void SetResolutionParams(const std::vector<double>& resolutionParams) { mResolutionParams = resolutionParams; }
-  void SetMIP(const float mip) { mMIP = mip; }
-  void SetChargeFactor(const float chargeFactor) { mChargeFactor = chargeFactor; }
+  void SetBetheBlochParams(const std::array<float, 5>& betheBlochParams)
+  {
+    mBetheBlochParams = betheBlochParams;
+    ClearLookupTables();
+  }
+  void SetResolutionParamsDefault(const std::array<float, 2>& resolutionParamsDefault)
+  {
+    mResolutionParamsDefault = resolutionParamsDefault;
+    ClearLookupTables();
+  }
+  void SetResolutionParams(const std::vector<double>& resolutionParams)
+  {
+    mResolutionParams = resolutionParams;
+    ClearLookupTables();
+  }
+  void SetMIP(const float mip)
+  {
+    mMIP = mip;
+    ClearLookupTables();
+  }
+  void SetChargeFactor(const float chargeFactor)
+  {
+    mChargeFactor = chargeFactor;
+    ClearLookupTables();
+  }
   void SetMultiplicityNormalization(const float multNormalization) { mMultNormalization = multNormalization; }
   void SetNClNormalization(const float nclnorm) { nClNorm = nclnorm; }
-  void SetUseDefaultResolutionParam(const bool useDefault) { mUseDefaultResolutionParam = useDefault; }
+  void SetUseDefaultResolutionParam(const bool useDefault)
+  {
+    mUseDefaultResolutionParam = useDefault;
+    ClearLookupTables();
+  }
   void SetParameters(const Response* response)
   {
     mBetheBlochParams = response->GetBetheBlochParams();
@@ -58,6 +84,7 @@ class Response
     mChargeFactor = response->GetChargeFactor();
     mMultNormalization = response->GetMultiplicityNormalization();
     mUseDefaultResolutionParam = response->GetUseDefaultResolutionParam();
+    ClearLookupTables();
   }
 
   const std::array<float, 5> GetBetheBlochParams() const { return mBetheBlochParams; }
@@ -90,9 +117,32 @@ class Response
   /// Gets the deviation to the expected signal
   template <typename TrackType>
   float GetSignalDelta(const TrackType& trk, const o2::track::PID::ID id) const;
+  /// Gets the number of sigmas of all tracks of a table, in the order of the table (multTPC = 0 for tracks without collision)
+  template <typename CollisionsType, typename TracksType>
+  void GetNumberOfSigma(const CollisionsType& collisions, const TracksType& tracks, const o2::track::PID::ID id, std::vector<float>& nSigma) const;
   /// Gets relative dEdx resolution contribution due to relative pt resolution
   float GetRelativeResolutiondEdx(const float p, const float mass, const float charge, const float resol) const;
 
+  /// Tabulated mode: the Bethe-Bloch curve and the betagamma-dependent terms of the resolution are computed once
+  /// on a grid uniform in log(betagamma), for each charge of the PID hypotheses, and linearly interpolated afterwards.
+  /// The NCl, tgl, 1/pT and multiplicity dependencies are cheap and stay analytic. Tracks outside the grid use the exact formulas.
+  /// The tables are dropped whenever a parameter changes, they have to be rebuilt after a new response object is loaded.
+  /// \param nPointsPerDecade Number of grid points per decade of betagamma
+  /// \param bgMin Lower edge of the grid in betagamma
+  /// \param bgMax Upper edge of the grid in betagamma
+  void BuildLookupTables(const int nPointsPerDecade = 500, const float bgMin = 0.1f, const float bgMax = 1.e6f);
+  void ClearLookupTables()
+  {
+    mLookupTables.clear();
+    mLookupAccuracy = 0.f;
+  }
+  bool HasLookupTables() const { return !mLookupTables.empty(); }
+  /// \return Maximal relative deviation of the tabulated terms (expected signal, relative resolution from pT, resolution power law)
+  /// from the exact ones. It is evaluated at the centres between grid points, where the linear interpolation error is largest.
+  /// With the default grid it is ~1e-5, giving deviations of the number of sigmas below ~1e-3 (see check-tpc-response-tabulated).
+  /// The default lower edge excludes betagamma < 0.1, where the Bethe-Bloch parametrisation is not monotonic.
+  float GetLookupTableAccuracy() const { return mLookupAccuracy; }
+
   void PrintAll() const;
 
  private:
@@ -105,6 +155,35 @@ class Response
   bool mUseDefaultResolutionParam = true;
   float nClNorm = 152.f;
 
+  // Lookup tables of the tabulated mode, [charge - 1][term][grid point] with the terms dE/dx, relative resolution from pT, (1/dE/dx)^mResolutionParams[2]
+  static constexpr int kNLookupTerms = 3;
+  std::vector<float> mLookupTables; //!
+  int mLookupNPoints = 0;           //!
+  float mLookupLogBgMin = 0.f;      //!
+  float mLookupInvStep = 0.f;       //!
+  float mLookupAccuracy = 0.f;      //!
+
+  /// Finds the grid interval of betagamma in the lookup tables
+  /// \return false if the tables are not built or betagamma is outside the grid
+  bool FindLookupPoint(const float bg, int& point, float& fraction) const
+  {
+    if (mLookupTables.empty()) {
+      return false;
+    }
+    const float u = (std::log(bg) - mLookupLogBgMin) * mLookupInvStep;
+    if (!(u >= 0.f) || !(u < mLookupNPoints - 1)) {
+      return false;
+    }
+    point = static_cast<int>(u);
+    fraction = u - point;
+    return true;
+  }
+  float InterpolateLookup(const int charge, const int term, const int point, const float fraction) const
+  {
+    const float* table = &mLookupTables[((charge - 1) * kNLookupTerms + term) * mLookupNPoints + point];
+    return table[0] + fraction * (table[1] - table[0]);
+  }
+
   ClassDefNV(Response, 3);
 
 }; // class Response
@@ -116,6 +195,12 @@ inline float Response::GetExpectedSignal(const TrackType& track, const o2::track
   if (!track.hasTPC()) {
     return -999.f;
   }
+  int point = 0;
+  float fraction = 0.f;
+  if (FindLookupPoint(track.tpcInnerParam() / o2::track::pid_constants::sMasses[id], point, fraction)) {
+    const float bethe = mMIP * InterpolateLookup(o2::track::pid_constants::sCharges[id], 0, point, fraction);
+    return bethe >= 0.f ? bethe : -999.f;
+  }
   const float bethe = mMIP * o2::tpc::BetheBlochAleph(track.tpcInnerParam() / o2::track::pid_constants::sMasses[id], mBetheBlochParams[0], mBetheBlochParams[1], mBetheBlochParams[2], mBetheBlochParams[3], mBetheBlochParams[4]) * std::pow(static_cast<float>(o2::track::pid_constants::sCharges[id]), mChargeFactor);
   return bethe >= 0.f ? bethe : -999.f;
 }
@@ -141,6 +226,23 @@ inline float Response::GetExpectedSigmaAtMultiplicity(const long multTPC, const
     reso >= 0.f ? resolution = reso : resolution = -999.f;
   } else {
 
+    int point = 0;
+    float fraction = 0.f;
+    if (FindLookupPoint(track.tpcInnerParam() / o2::track::pid_constants::sMasses[id], point, fraction)) {
+      const int charge = o2::track::pid_constants::sCharges[id];
+      const double dEdx = InterpolateLookup(charge, 0, point, fraction);
+      const double relReso = InterpolateLookup(charge, 1, point, fraction);
+      const double invdEdxPow = InterpolateLookup(charge, 2, point, fraction);
+      const double invdEdx = 1.f / dEdx;
+      const double sqrtNcl = std::sqrt(nClNorm / track.tpcNClsFound());
+      const double tglTerm = 1 + track.tgl() * track.tgl();
+      const double mult = multTPC / mMultNormalization;
+      const double q = track.signed1Pt();
+
+      const float reso = std::sqrt(mResolutionParams[0] * mResolutionParams[0] * invdEdx + mResolutionParams[1] * mResolutionParams[1] * (sqrtNcl * mResolutionParams[5]) * invdEdxPow * std::pow(tglTerm, -0.5 * mResolutionParams[2]) + sqrtNcl * relReso * relReso + std::pow(mResolutionParams[4] * q, 2) + std::pow(mult * mResolutionParams[6], 2) + std::pow(mult * (invdEdx / std::sqrt(tglTerm)) * mResolutionParams[7], 2)) * dEdx * mMIP;
+      return reso >= 0.f ? reso : -999.f;
+    }
+
     const double ncl = nClNorm / track.tpcNClsFound(); //
     const double p = track.tpcInnerParam();
     const double mass = o2::track::pid_constants::sMasses[id];
@@ -172,6 +274,20 @@ inline float Response::GetNumberOfSigma(const CollisionType& collision, const Tr
   return ((trk.tpcSignal() - GetExpectedSignal(trk, id)) / GetExpectedSigma(collision, trk, id));
 }
 
+/// Gets the number of sigmas of all tracks of a table
+template <typename CollisionsType, typename TracksType>
+inline void Response::GetNumberOfSigma(const CollisionsType& collisions, const TracksType& tracks, const o2::track::PID::ID id, std::vector<float>& nSigma) const
+{
+  nSigma.resize(tracks.size());
+  std::size_t i = 0;
+  for (auto const& trk : tracks) {
+    const long multTPC = trk.has_collision() ? collisions.rawIteratorAt(trk.collisionId()).multTPC() : 0;
+    const float expSigma = GetExpectedSigmaAtMultiplicity(multTPC, trk, id);
+    const float expSignal = GetExpectedSignal(trk, id);
+    nSigma[i++] = (expSigma < 0. || expSignal < 0. || !trk.hasTPC()) ? -999.f : (trk.tpcSignal() - expSignal) / expSigma;
+  }
+}
+
 template <typename CollisionType, typename TrackType>
 inline float Response::GetNumberOfSigmaMCTuned(const CollisionType& collision, const TrackType& trk, const o2::track::PID::ID id, float mcTunedTPCSignal) const
 {
@@ -218,6 +334,61 @@ inline float Response::GetRelativeResolutiondEdx(const float p, const float mass
   return deltaRel;
 }
 
+inline void Response::BuildLookupTables(const int nPointsPerDecade, const float bgMin, const float bgMax)
+{
+  ClearLookupTables();
+  int maxCharge = 1;
+  for (const auto charge : o2::track::pid_constants::sCharges) {
+    maxCharge = std::max(maxCharge, static_cast<int>(charge));
+  }
+  mLookupLogBgMin = std::log(bgMin);
+  const float step = std::log(10.f) / nPointsPerDecade;
+  mLookupInvStep = 1.f / step;
+  mLookupNPoints = static_cast<int>(std::ceil((std::log(bgMax) - mLookupLogBgMin) * mLookupInvStep)) + 1;
+  const bool useResolutionParams = !mUseDefaultResolutionParam && mResolutionParams.size() >= 8;
+
+  // Exact values of the tabulated terms at a given betagamma
+  auto computeTerms = [&](const float bg, const int charge, float* terms) {
+    terms[0] = o2::tpc::BetheBlochAleph(bg, mBetheBlochParams[0], mBetheBlochParams[1], mBetheBlochParams[2], mBetheBlochParams[3], mBetheBlochParams[4]) * std::pow(static_cast<float>(charge), mChargeFactor);
+    terms[1] = useResolutionParams ? GetRelativeResolutiondEdx(bg, 1.f, charge, mResolutionParams[3]) : 0.f;
+    terms[2] = useResolutionParams ? std::pow(1. / terms[0], mResolutionParams[2]) : 0.f;
+  };
+
+  std::vector<float> tables(maxCharge * kNLookupTerms * mLookupNPoints);
+  float terms[kNLookupTerms];
+  for (int charge = 1; charge <= maxCharge; charge++) {
+    for (int point = 0; point < mLookupNPoints; point++) {
+      computeTerms(std::exp(mLookupLogBgMin + point * step), charge, terms);
+      for (int term = 0; term < kNLookupTerms; term++) {
+        tables[((charge - 1) * kNLookupTerms + term) * mLookupNPoints + point] = terms[term];
+      }
+    }
+  }
+  mLookupTables.swap(tables);
+
+  // Accuracy of the linear interpolation, checked between the grid points.
+  // The relative resolution from pT vanishes at the minimum of ionisation, its deviation is taken relative to its maximum
+  float accuracy = 0.f;
+  for (int charge = 1; charge <= maxCharge; charge++) {
+    const float* relResoTable = &mLookupTables[((charge - 1) * kNLookupTerms + 1) * mLookupNPoints];
+    float relResoScale = 0.f;
+    for (int point = 0; point < mLookupNPoints; point++) {
+      relResoScale = std::max(relResoScale, std::abs(relResoTable[point]));
+    }
+    for (int point = 0; point < mLookupNPoints - 1; point++) {
+      computeTerms(std::exp(mLookupLogBgMin + (point + 0.5f) * step), charge, terms);
+      for (int term = 0; term < kNLookupTerms; term++) {
+        const float scale = term == 1 ? relResoScale : std::abs(terms[term]);
+        if (scale > 0.f) {
+          accuracy = std::max(accuracy, std::abs(InterpolateLookup(charge, term, point, 0.5f) - terms[term]) / scale);
+        }
+      }
+    }
+  }
+  mLookupAccuracy = accuracy;
+  LOGP(info, "Built TPC PID response lookup tables with {} points in betagamma [{}, {}], maximal relative deviation {}", mLookupNPoints, bgMin, bgMax, mLookupAccuracy);
+}
+
 inline void Response::PrintAll() const
 {
   LOGP(info, "==== TPC PID response parameters: ====");
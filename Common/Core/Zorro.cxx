@@ -30,11 +30,13 @@
 #include <RtypesCore.h>
 
 #include <algorithm>
+#include <bit>
 #include <bitset>
 #include <cstddef>
 #include <cstdint>
 #include <map>
 #include <memory>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -201,6 +203,12 @@ std::vector<int> Zorro::initCCDB(o2::ccdb::BasicCCDBManager* ccdb, int runNumber
     mTOIs.push_back(token);
     mTOIidx.push_back(bin);
   }
+  mTOImask.reset();
+  for (const auto idx : mTOIidx) {
+    if (idx >= 0) {
+      mTOImask.set(idx);
+    }
+  }
   mTOIcounts.resize(mTOIs.size(), 0);
   mATcounts.resize(mSelections->GetNbinsX() - 2, 0);
   LOGF(info, "Zorro initialized for run %d, triggers of interest:", runNumber);
@@ -225,37 +233,53 @@ std::bitset<128> Zorro::fetch(uint64_t bcGlobalId, uint64_t tolerance)
   }
 
   o2::dataformats::IRFrame bcFrame{InteractionRecord::long2IR(bcGlobalId) - tolerance, InteractionRecord::long2IR(bcGlobalId) + tolerance};
-  if (bcGlobalId < mLastBCglobalId) { /// Handle the possible discontinuity in the BC processed by the analyses
-    mLastSelectedIdx = 0;
-  }
-  uint64_t lastSelectedIdx = mLastSelectedIdx;
+  const uint64_t bcFrameMin = bcFrame.getMin().toLong();
+  const uint64_t bcFrameMax = bcFrame.getMax().toLong();
   mLastBCglobalId = bcGlobalId;
-  for (size_t i = mLastSelectedIdx; i < mBCranges.size(); i++) {
-    if (!mBCranges[i].isOutside(bcFrame)) {
+
+  /// Ranges overlapping the frame start at or before its end and end at or after its start:
+  /// [first range whose running maximum reaches the frame, first range starting after the frame)
+  const size_t first = std::lower_bound(mBCrangeMaxPrefix.begin(), mBCrangeMaxPrefix.end(), bcFrameMin) - mBCrangeMaxPrefix.begin();
+  const size_t last = std::upper_bound(mBCrangeMin.begin(), mBCrangeMin.end(), bcFrameMax) - mBCrangeMin.begin();
+  bool found{false};
+  for (size_t i = first; i < last; i++) {
+    if (mBCrangeMax[i] < bcFrameMin) {
+      continue;
+    }
+    mLastResult |= mBCrangeMask[i];
+    if (!mAccountedBCranges[i]) {
       for (int iMask{0}; iMask < 2; ++iMask) {
-        for (int iTOI{0}; iTOI < 64; ++iTOI) {
-          if (mZorroHelpers->at(i).selMask[iMask] & (1ull << iTOI)) {
-            mLastResult.set(iMask * 64 + iTOI, 1);
-            if (!mAccountedBCranges[i]) {
-              mATcounts[iMask * 64 + iTOI]++;
-              if (mAnalysedTriggers) {
-                mAnalysedTriggers->Fill(iMask * 64 + iTOI);
-              }
-            }
+        for (uint64_t bits = mZorroHelpers->at(i).selMask[iMask]; bits; bits &= bits - 1) {
+          const int iTrigger = iMask * 64 + std::countr_zero(bits);
+          mATcounts[iTrigger]++;
+          if (mAnalysedTriggers) {
+            mAnalysedTriggers->Fill(iTrigger);
           }
         }
       }
       mAccountedBCranges[i] = true;
-      mLastSelectedIdx = mLastSelectedIdx == lastSelectedIdx-- ? i : mLastSelectedIdx; /// Decrease lastSelectedIdx to make sure this check is valid only in its first instance
-    } else if (mBCranges[i].getMax() < bcFrame.getMin()) {
-      mLastSelectedIdx = i;
-    } else if (mBCranges[i].getMin() > bcFrame.getMax()) {
-      break;
+    }
+    if (!found) {
+      mLastSelectedIdx = i; /// First range overlapping the frame, used to avoid double counting in isSelected
+      found = true;
     }
   }
+  if (!found && first > 0) {
+    mLastSelectedIdx = first - 1;
+  }
   return mLastResult;
 }
 
+std::vector<std::bitset<128>> Zorro::fetchBatch(std::span<const uint64_t> bcGlobalIds, uint64_t tolerance)
+{
+  std::vector<std::bitset<128>> results;
+  results.reserve(bcGlobalIds.size());
+  for (const auto bcGlobalId : bcGlobalIds) {
+    results.push_back(fetch(bcGlobalId, tolerance));
+  }
+  return results;
+}
+
 bool Zorro::isSelected(uint64_t bcGlobalId, uint64_t tolerance, TH2* ToiHisto)
 {
   uint64_t lastSelectedIdx = mLastSelectedIdx;
@@ -322,4 +346,18 @@ void Zorro::setupHelpers(int64_t timestamp)
     mBCranges.emplace_back(InteractionRecord::long2IR(std::min(helper.bcAOD, helper.bcEvSel)), InteractionRecord::long2IR(std::max(helper.bcAOD, helper.bcEvSel)));
   }
   mAccountedBCranges.resize(mBCranges.size(), false);
+
+  mBCrangeMin.clear();
+  mBCrangeMax.clear();
+  mBCrangeMaxPrefix.clear();
+  mBCrangeMask.clear();
+  uint64_t maxPrefix{0};
+  for (size_t i{0}; i < mBCranges.size(); ++i) {
+    mBCrangeMin.push_back(mBCranges[i].getMin().toLong());
+    mBCrangeMax.push_back(mBCranges[i].getMax().toLong());
+    maxPrefix = std::max(maxPrefix, mBCrangeMax.back());
+    mBCrangeMaxPrefix.push_back(maxPrefix);
+    const auto& selMask = (*mZorroHelpers)[i].selMask;
+    mBCrangeMask.push_back((std::bitset<128>(selMask[1]) << 64) | std::bitset<128>(selMask[0]));
+  }
 }
@@ -30,6 +30,7 @@
 
 #include <bitset>
 #include <cstdint>
+#include <span>
 #include <string>
 #include <utility>
 #include <vector>
@@ -48,6 +49,7 @@ class Zorro
   Zorro() = default;
   std::vector<int> initCCDB(o2::ccdb::BasicCCDBManager* ccdb, int runNumber, uint64_t timestamp, std::string tois, int bcTolerance = 500);
   std::bitset<128> fetch(uint64_t bcGlobalId, uint64_t tolerance = 100);
+  std::vector<std::bitset<128>> fetchBatch(std::span<const uint64_t> bcGlobalIds, uint64_t tolerance = 100);
   bool isSelected(uint64_t bcGlobalId, uint64_t tolerance = 100, TH2* toiHisto = nullptr);
   bool isNotSelectedByAny(uint64_t bcGlobalId, uint64_t tolerance = 100);
 
@@ -58,6 +60,8 @@ class Zorro
   TH1D* getSelections() const { return mSelections; }
   TH1D* getInspectedTVX() const { return mInspectedTVX; }
   std::bitset<128> getLastResult() const { return mLastResult; }
+  std::bitset<128> getTOImask() const { return mTOImask; } /// Triggers of interest, a fetch result passes the selection if (result & mask).any()
+  bool hasTOI(const std::bitset<128>& result) const { return (result & mTOImask).any(); }
   std::vector<int> getTOIcounters() const { return mTOIcounts; }
   std::vector<int> getATcounters() const { return mATcounts; }
   std::vector<bool> getTriggerOfInterestResults(uint64_t bcGlobalId, uint64_t tolerance = 100);
@@ -95,9 +99,14 @@ class Zorro
   std::bitset<128> mLastResult;
   std::vector<bool> mAccountedBCranges; /// Avoid double accounting of inspected BC ranges
   std::vector<o2::dataformats::IRFrame> mBCranges;
+  std::vector<uint64_t> mBCrangeMin;          /// Lower edges of mBCranges (sorted)
+  std::vector<uint64_t> mBCrangeMax;          /// Upper edges of mBCranges
+  std::vector<uint64_t> mBCrangeMaxPrefix;    /// Running maximum of the upper edges, to find the first range reaching a BC
+  std::vector<std::bitset<128>> mBCrangeMask; /// Selection mask of each range
   std::vector<ZorroHelper>* mZorroHelpers = nullptr;
   std::vector<std::string> mTOIs;
   std::vector<int> mTOIidx;
+  std::bitset<128> mTOImask;
   std::vector<int> mTOIcounts;
   std::vector<int> mATcounts;
   o2::ccdb::BasicCCDBManager* mCCDB = nullptr;
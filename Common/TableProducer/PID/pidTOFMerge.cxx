@@ -625,8 +625,12 @@ struct tofPidMerge {
   HistogramRegistry histos{"Histos", {}, OutputObjHandlingPolicy::AnalysisObject};
 
   // Running variables
-  std::vector<int> mEnabledParticles;     // Vector of enabled PID hypotheses to loop on when making tables
-  std::vector<int> mEnabledParticlesFull; // Vector of enabled PID hypotheses to loop on when making full tables
+  std::vector<int> mEnabledParticles;                 // Vector of enabled PID hypotheses to loop on when making tables
+  std::vector<int> mEnabledParticlesFull;             // Vector of enabled PID hypotheses to loop on when making full tables
+  o2::pid::tof::TOFTrackColumns mTrackColumns;        // Track columns for the batched computation of the separations
+  o2::pid::tof::ExpTimesBatch mResponseBatch;         // Batched TOF response
+  std::array<std::vector<float>, nSpecies> mNSigma;   // Separation of each track for the enabled PID hypotheses
+  std::array<std::vector<float>, nSpecies> mExpSigma; // Expected resolution of each track for the enabled PID hypotheses
   void init(o2::framework::InitContext& initContext)
   {
     LOG(debug) << "Initializing the TOF PID Merge task";
@@ -881,24 +885,124 @@ struct tofPidMerge {
     }
   }
 
+  // Fills the table for the given particle ID
+  void makeTable(const int id, const bool fullTable, const float resolution, const float nsigma)
+  {
+    switch (id) {
+      case kIdxEl:
+        if (fullTable) {
+          tablePIDFullEl(resolution, nsigma);
+        } else {
+          aod::pidtof_tiny::binning::packInTable(nsigma, tablePIDEl);
+        }
+        break;
+      case kIdxMu:
+        if (fullTable) {
+          tablePIDFullMu(resolution, nsigma);
+        } else {
+          aod::pidtof_tiny::binning::packInTable(nsigma, tablePIDMu);
+        }
+        break;
+      case kIdxPi:
+        if (fullTable) {
+          tablePIDFullPi(resolution, nsigma);
+        } else {
+          aod::pidtof_tiny::binning::packInTable(nsigma, tablePIDPi);
+        }
+        break;
+      case kIdxKa:
+        if (fullTable) {
+          tablePIDFullKa(resolution, nsigma);
+        } else {
+          aod::pidtof_tiny::binning::packInTable(nsigma, tablePIDKa);
+        }
+        break;
+      case kIdxPr:
+        if (fullTable) {
+          tablePIDFullPr(resolution, nsigma);
+        } else {
+          aod::pidtof_tiny::binning::packInTable(nsigma, tablePIDPr);
+        }
+        break;
+      case kIdxDe:
+        if (fullTable) {
+          tablePIDFullDe(resolution, nsigma);
+        } else {
+          aod::pidtof_tiny::binning::packInTable(nsigma, tablePIDDe);
+        }
+        break;
+      case kIdxTr:
+        if (fullTable) {
+          tablePIDFullTr(resolution, nsigma);
+        } else {
+          aod::pidtof_tiny::binning::packInTable(nsigma, tablePIDTr);
+        }
+        break;
+      case kIdxHe:
+        if (fullTable) {
+          tablePIDFullHe(resolution, nsigma);
+        } else {
+          aod::pidtof_tiny::binning::packInTable(nsigma, tablePIDHe);
+        }
+        break;
+      case kIdxAl:
+        if (fullTable) {
+          tablePIDFullAl(resolution, nsigma);
+        } else {
+          aod::pidtof_tiny::binning::packInTable(nsigma, tablePIDAl);
+        }
+        break;
+      default:
+        LOG(fatal) << "Wrong particle ID in makeTable() for " << (fullTable ? "full" : "tiny") << " tables";
+        break;
+    }
+  }
+
+  // Computes the separation and expected resolution of all tracks in mTrackColumns for the given particle ID
+  void computeSeparations(const int id)
+  {
+    mNSigma[id].resize(mTrackColumns.size());
+    mExpSigma[id].resize(mTrackColumns.size());
+    switch (id) {
+      case kIdxEl:
+        mResponseBatch.computeSeparation<PID::Electron>(tofResponse->parameters, mTrackColumns, mNSigma[id].data(), mExpSigma[id].data());
+        break;
+      case kIdxMu:
+        mResponseBatch.computeSeparation<PID::Muon>(tofResponse->parameters, mTrackColumns, mNSigma[id].data(), mExpSigma[id].data());
+        break;
+      case kIdxPi:
+        mResponseBatch.computeSeparation<PID::Pion>(tofResponse->parameters, mTrackColumns, mNSigma[id].data(), mExpSigma[id].data());
+        break;
+      case kIdxKa:
+        mResponseBatch.computeSeparation<PID::Kaon>(tofResponse->parameters, mTrackColumns, mNSigma[id].data(), mExpSigma[id].data());
+        break;
+      case kIdxPr:
+        mResponseBatch.computeSeparation<PID::Proton>(tofResponse->parameters, mTrackColumns, mNSigma[id].data(), mExpSigma[id].data());
+        break;
+      case kIdxDe:
+        mResponseBatch.computeSeparation<PID::Deuteron>(tofResponse->parameters, mTrackColumns, mNSigma[id].data(), mExpSigma[id].data());
+        break;
+      case kIdxTr:
+        mResponseBatch.computeSeparation<PID::Triton>(tofResponse->parameters, mTrackColumns, mNSigma[id].data(), mExpSigma[id].data());
+        break;
+      case kIdxHe:
+        mResponseBatch.computeSeparation<PID::Helium3>(tofResponse->parameters, mTrackColumns, mNSigma[id].data(), mExpSigma[id].data());
+        break;
+      case kIdxAl:
+        mResponseBatch.computeSeparation<PID::Alpha>(tofResponse->parameters, mTrackColumns, mNSigma[id].data(), mExpSigma[id].data());
+        break;
+      default:
+        LOG(fatal) << "Wrong particle ID in computeSeparations()";
+        break;
+    }
+  }
+
   void process(aod::BCs const&) {}
 
-  template <o2::track::PID::ID pid>
-  using ResponseImplementation = o2::pid::tof::ExpTimes<Run3TrksWtofWevTime::iterator, pid>;
   void processRun3(Run3TrksWtofWevTime const& tracks,
                    aod::Collisions const&,
                    aod::BCsWithTimestamps const& bcs)
   {
-    constexpr auto responseEl = ResponseImplementation<PID::Electron>();
-    constexpr auto responseMu = ResponseImplementation<PID::Muon>();
-    constexpr auto responsePi = ResponseImplementation<PID::Pion>();
-    constexpr auto responseKa = ResponseImplementation<PID::Kaon>();
-    constexpr auto responsePr = ResponseImplementation<PID::Proton>();
-    constexpr auto responseDe = ResponseImplementation<PID::Deuteron>();
-    constexpr auto responseTr = ResponseImplementation<PID::Triton>();
-    constexpr auto responseHe = ResponseImplementation<PID::Helium3>();
-    constexpr auto responseAl = ResponseImplementation<PID::Alpha>();
-
     tofResponse->processSetup(bcs.iteratorAt(0)); // Update the calibration parameters
 
     for (auto const& pidId : mEnabledParticles) {
@@ -909,8 +1013,29 @@ struct tofPidMerge {
       reserveTable(pidId, tracks.size(), true);
     }
 
-    float resolution = 1.f; // Last resolution assigned
+    // Computing the separations for all tracks at once, hypothesis by hypothesis
+    mTrackColumns.clear();
+    mTrackColumns.reserve(tracks.size());
+    for (auto const& trk : tracks) {
+      mTrackColumns.push_back(trk);
+    }
+    mResponseBatch.prepare(tofResponse->parameters, mTrackColumns);
+    std::array<bool, nSpecies> computed{false};
+    auto computeOnce = [&](const int pidId) {
+      if (!computed[pidId]) {
+        computeSeparations(pidId);
+        computed[pidId] = true;
+      }
+    };
+    for (auto const& pidId : mEnabledParticles) {
+      computeOnce(pidId);
+    }
+    for (auto const& pidId : mEnabledParticlesFull) {
+      computeOnce(pidId);
+    }
+
     float nsigma = 0;
+    int64_t iTrack = 0;
     for (auto const& trk : tracks) { // Loop on all tracks
       if (!trk.has_collision()) {    // Track was not assigned, cannot compute NSigma (no event time) -> filling with empty table
         for (auto const& pidId : mEnabledParticles) {
@@ -919,128 +1044,25 @@ struct tofPidMerge {
         for (auto const& pidId : mEnabledParticlesFull) {
           makeTableEmpty(pidId, true);
         }
+        iTrack++;
         continue;
       }
 
       for (auto const& pidId : mEnabledParticles) { // Loop on enabled particle hypotheses
-        switch (pidId) {
-          case kIdxEl: {
-            nsigma = responseEl.GetSeparation(tofResponse->parameters, trk);
-            aod::pidtof_tiny::binning::packInTable(nsigma, tablePIDEl);
-            break;
-          }
-          case kIdxMu: {
-            nsigma = responseMu.GetSeparation(tofResponse->parameters, trk);
-            aod::pidtof_tiny::binning::packInTable(nsigma, tablePIDMu);
-            break;
-          }
-          case kIdxPi: {
-            nsigma = responsePi.GetSeparation(tofResponse->parameters, trk);
-            aod::pidtof_tiny::binning::packInTable(nsigma, tablePIDPi);
-            break;
-          }
-          case kIdxKa: {
-            nsigma = responseKa.GetSeparation(tofResponse->parameters, trk);
-            aod::pidtof_tiny::binning::packInTable(nsigma, tablePIDKa);
-            break;
-          }
-          case kIdxPr: {
-            nsigma = responsePr.GetSeparation(tofResponse->parameters, trk);
-            aod::pidtof_tiny::binning::packInTable(nsigma, tablePIDPr);
-            break;
-          }
-          case kIdxDe: {
-            nsigma = responseDe.GetSeparation(tofResponse->parameters, trk);
-            aod::pidtof_tiny::binning::packInTable(nsigma, tablePIDDe);
-            break;
-          }
-          case kIdxTr: {
-            nsigma = responseTr.GetSeparation(tofResponse->parameters, trk);
-            aod::pidtof_tiny::binning::packInTable(nsigma, tablePIDTr);
-            break;
-          }
-          case kIdxHe: {
-            nsigma = responseHe.GetSeparation(tofResponse->parameters, trk);
-            aod::pidtof_tiny::binning::packInTable(nsigma, tablePIDHe);
-            break;
-          }
-          case kIdxAl: {
-            nsigma = responseAl.GetSeparation(tofResponse->parameters, trk);
-            aod::pidtof_tiny::binning::packInTable(nsigma, tablePIDAl);
-            break;
-          }
-          default:
-            LOG(fatal) << "Wrong particle ID for standard tables";
-            break;
-        }
+        nsigma = mNSigma[pidId][iTrack];
+        makeTable(pidId, false, mExpSigma[pidId][iTrack], nsigma);
         if (enableQaHistograms) {
           hnsigma[pidId]->Fill(trk.p(), nsigma);
         }
       }
       for (auto const& pidId : mEnabledParticlesFull) { // Loop on enabled particle hypotheses with full tables
-        switch (pidId) {
-          case kIdxEl: {
-            resolution = responseEl.GetExpectedSigma(tofResponse->parameters, trk);
-            nsigma = responseEl.GetSeparation(tofResponse->parameters, trk, resolution);
-            tablePIDFullEl(resolution, nsigma);
-            break;
-          }
-          case kIdxMu: {
-            resolution = responseMu.GetExpectedSigma(tofResponse->parameters, trk);
-            nsigma = responseMu.GetSeparation(tofResponse->parameters, trk, resolution);
-            tablePIDFullMu(resolution, nsigma);
-            break;
-          }
-          case kIdxPi: {
-            resolution = responsePi.GetExpectedSigma(tofResponse->parameters, trk);
-            nsigma = responsePi.GetSeparation(tofResponse->parameters, trk);
-            tablePIDFullPi(resolution, nsigma);
-            break;
-          }
-          case kIdxKa: {
-            resolution = responseKa.GetExpectedSigma(tofResponse->parameters, trk);
-            nsigma = responseKa.GetSeparation(tofResponse->parameters, trk, resolution);
-            tablePIDFullKa(resolution, nsigma);
-            break;
-          }
-          case kIdxPr: {
-            resolution = responsePr.GetExpectedSigma(tofResponse->parameters, trk);
-            nsigma = responsePr.GetSeparation(tofResponse->parameters, trk, resolution);
-            tablePIDFullPr(resolution, nsigma);
-            break;
-          }
-          case kIdxDe: {
-            resolution = responseDe.GetExpectedSigma(tofResponse->parameters, trk);
-            nsigma = responseDe.GetSeparation(tofResponse->parameters, trk, resolution);
-            tablePIDFullDe(resolution, nsigma);
-            break;
-          }
-          case kIdxTr: {
-            resolution = responseTr.GetExpectedSigma(tofResponse->parameters, trk);
-            nsigma = responseTr.GetSeparation(tofResponse->parameters, trk, resolution);
-            tablePIDFullTr(resolution, nsigma);
-            break;
-          }
-          case kIdxHe: {
-            resolution = responseHe.GetExpectedSigma(tofResponse->parameters, trk);
-            nsigma = responseHe.GetSeparation(tofResponse->parameters, trk, resolution);
-            tablePIDFullHe(resolution, nsigma);
-            break;
-          }
-          case kIdxAl: {
-            resolution = responseAl.GetExpectedSigma(tofResponse->parameters, trk);
-            nsigma = responseAl.GetSeparation(tofResponse->parameters, trk, resolution);
-            tablePIDFullAl(resolution, nsigma);
-            break;
-          }
-          default:
-            LOG(fatal) << "Wrong particle ID for full tables";
-            break;
-        }
+        nsigma = mNSigma[pidId][iTrack];
+        makeTable(pidId, true, mExpSigma[pidId][iTrack], nsigma);
         if (enableQaHistograms) {
           hnsigmaFull[pidId]->Fill(trk.p(), nsigma);
         }
       }
+      iTrack++;
     }
   }
   PROCESS_SWITCH(tofPidMerge, processRun3, "Produce Run 3 Nsigma table. Set to off if the tables are not required, or autoset is on", false);
@@ -43,10 +43,12 @@
 #include <TRandom.h>
 #include <TString.h>
 
+#include <algorithm>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
+#include <future>
 #include <map>
 #include <memory>
 #include <ratio>
@@ -119,6 +121,7 @@ struct tpcPid {
   Configurable<std::string> ccdbPath{"ccdbPath", "Analysis/PID/TPC/Response", "Path of the TPC parametrization on the CCDB"};
   Configurable<std::string> recoPass{"recoPass", "", "Reconstruction pass name for CCDB query (automatically takes latest object for timestamp if blank)"};
   Configurable<int64_t> ccdbTimestamp{"ccdb-timestamp", 0, "timestamp of the object used to query in CCDB the detector response. Exceptions: -1 gets the latest object, 0 gets the run dependent timestamp"};
+  Configurable<bool> useTabulatedResponse{"useTabulatedResponse", false, "(bool) Interpolate the Bethe-Bloch and resolution parametrisations from lookup tables built when the response object changes"};
   // Parameters for loading network from a file / downloading the file
   Configurable<bool> useNetworkCorrection{"useNetworkCorrection", 0, "(bool) Wether or not to use the network correction for the TPC dE/dx signal"};
   Configurable<bool> autofetchNetworks{"autofetchNetworks", 1, "(bool) Automatically fetches networks from CCDB for the correct run number"};
@@ -158,11 +161,17 @@ struct tpcPid {
   Configurable<int> useNetworkAl{"useNetworkAl", 1, {"Switch for applying neural network on the alpha mass hypothesis (if network enabled) (set to 0 to disable)"}};
   Configurable<float> networkBetaGammaCutoff{"networkBetaGammaCutoff", 0.45, {"Lower value of beta-gamma to override the NN application"}};
   Configurable<float> networkInputBatchedMode{"networkInputBatchedMode", -1, {"-1: Takes all tracks, >0: Takes networkInputBatchedMode number of tracks at once"}};
+  Configurable<int> networkPipelineChunk{"networkPipelineChunk", 0, {"0: Synchronous evaluation, >0: Evaluates the network for all species of networkPipelineChunk tracks at once while the next chunk is filled"}};
   Configurable<std::string> irSource{"irSource", "ZNC hadronic", "Estimator of the interaction rate (Recommended: pp --> T0VTX, Pb-Pb --> ZNC hadronic)"};
   ctpRateFetcher mRateFetcher;
+  ctpRateFetcher::RateSource mRateSource = ctpRateFetcher::kUnknownSource; // irSource resolved once in init
   // Parametrization configuration
   bool useCCDBParam = false;
   std::vector<float> track_properties;
+  std::vector<float> track_columns;        // species-independent network inputs, one column per feature (pipelined mode)
+  std::vector<int> track_collision;        // position of the collision properties of each track (pipelined mode)
+  std::vector<float> collision_properties; // multTPC, occupancy and hadronic rate inputs per collision (pipelined mode)
+  std::vector<float> pipeline_input[2];    // double-buffered network input (pipelined mode)
 
   void init(o2::framework::InitContext& initContext)
   {
@@ -173,6 +182,7 @@ struct tpcPid {
       LOG(fatal) << "pid-tpc must have only one of the options 'processStandard', 'processStandard2', 'processMcTuneOnData' enabled. Please check your configuration.";
     }
     response = new o2::pid::tpc::Response();
+    mRateSource = ctpRateFetcher::getSource(irSource.value);
     // Checking the tables are requested in the workflow and enabling them
     auto enableFlag = [&](const std::string& particle, Configurable<int>& flag) {
       enableFlagIfTableRequired(initContext, "pidTPC" + particle, flag);
@@ -233,6 +243,9 @@ struct tpcPid {
         LOGF(fatal, "Loading the TPC PID Response from file {} failed!", fname.Data());
       }
       response->PrintAll();
+      if (useTabulatedResponse) {
+        response->BuildLookupTables();
+      }
     } else {
       useCCDBParam = true;
       const std::string path = ccdbPath.value;
@@ -260,6 +273,9 @@ struct tpcPid {
         LOG(info) << "Successfully retrieved TPC PID object from CCDB for timestamp " << time << ", period " << headers["LPMProductionTag"] << ", recoPass " << headers["RecoPassName"];
         metadata["RecoPassName"] = headers["RecoPassName"]; // Force pass number for NN request to match retrieved BB
         response->PrintAll();
+        if (useTabulatedResponse) {
+          response->BuildLookupTables();
+        }
       }
     }
 
@@ -332,6 +348,9 @@ struct tpcPid {
         LOG(info) << "Successfully retrieved TPC PID object from CCDB for timestamp " << bc.timestamp() << ", period " << headers["LPMProductionTag"] << ", recoPass " << headers["RecoPassName"];
         metadata["RecoPassName"] = headers["RecoPassName"]; // Force pass number for NN request to match retrieved BB
         response->PrintAll();
+        if (useTabulatedResponse) {
+          response->BuildLookupTables();
+        }
       }
 
       if (bc.timestamp() < network.getValidityFrom() || bc.timestamp() > network.getValidityUntil()) { // fetches network only if the runnumbers change
@@ -368,6 +387,13 @@ struct tpcPid {
     track_properties.resize(track_prop_size * input_dimensions);         // If the networkInputBatchedMode is set, we use the number of tracks specified in the config
     std::vector<float> network_prediction(prediction_size * numSpecies); // For each mass hypotheses
 
+    if (networkPipelineChunk.value > 0) {
+      duration_network = fillNetworkPredictionPipelined<C, T, B>(collisions, tracks, size, network_prediction);
+      auto stop_network_total = std::chrono::high_resolution_clock::now();
+      LOG(debug) << "Neural Network for the TPC PID response correction (pipelined): Time per track (eval ONNX): " << duration_network / (size * 9) << "ns ; Total time (eval + overhead): " << std::chrono::duration<float, std::ratio<1, 1000000000>>(stop_network_total - start_network_total).count() / 1000000000 << " s";
+      return network_prediction;
+    }
+
     // Filling a std::vector<float> to be evaluated by the network
     // Evaluation on single tracks brings huge overhead: Thus evaluation is done on one large vector
     for (int species = 0; species < numSpecies; species++) { // Loop over particle number for which network correction is used
@@ -412,7 +438,7 @@ struct tpcPid {
           track_properties[counter_track_props + 6] = trk.has_collision() ? collisions.iteratorAt(trk.collisionId()).ft0cOccupancyInTimeRange() / 60000. : 1.;
           if (trk.has_collision()) {
             auto trk_bc = (collisions.iteratorAt(trk.collisionId())).template bc_as<B>();
-            float hadronicRate = mRateFetcher.fetch(ccdb.service, trk_bc.timestamp(), trk_bc.runNumber(), irSource) * 1.e-3;
+            float hadronicRate = mRateFetcher.fetch(ccdb.service, trk_bc.timestamp(), trk_bc.runNumber(), mRateSource) * 1.e-3;
             track_properties[counter_track_props + 7] = hadronicRate / 50.;
           } else {
             track_properties[counter_track_props + 7] = 1;
@@ -433,6 +459,120 @@ struct tpcPid {
     return network_prediction;
   }
 
+  /// Pipelined version of the network evaluation. The species-independent track inputs and the per-collision inputs
+  /// are gathered once, then the network is evaluated for all species of a chunk of tracks in one call while the
+  /// inputs of the next chunk are being filled. The prediction layout is the same as for the synchronous evaluation.
+  /// \return Time spent in the network evaluation in ns
+  template <typename C, typename T, typename B>
+  float fillNetworkPredictionPipelined(C const& collisions, T const& tracks, const uint64_t size, std::vector<float>& network_prediction)
+  {
+    const int input_dimensions = network.getNumInputNodes();
+    const int output_dimensions = network.getNumOutputNodes();
+    const uint8_t numSpecies = 9;
+    const float nNclNormalization = response->GetNClNormalization();
+    const bool useOccupancy = (input_dimensions == 7 && networkVersion == "2") || (input_dimensions == 8 && networkVersion == "3");
+    const bool useRate = (input_dimensions == 8 && networkVersion == "3");
+
+    // Per-collision inputs, the last entry is used for tracks without collision
+    const int nCollisions = collisions.size();
+    collision_properties.assign(3 * (nCollisions + 1), 1.f);
+    int iCollision = 0;
+    for (auto const& col : collisions) {
+      float* properties = &collision_properties[3 * iCollision++];
+      properties[0] = col.multTPC() / 11000.;
+      if (useOccupancy) {
+        properties[1] = col.ft0cOccupancyInTimeRange() / 60000.;
+      }
+      if (useRate) {
+        auto col_bc = col.template bc_as<B>();
+        float hadronicRate = mRateFetcher.fetch(ccdb.service, col_bc.timestamp(), col_bc.runNumber(), mRateSource) * 1.e-3;
+        properties[2] = hadronicRate / 50.;
+      }
+    }
+
+    // Species-independent track inputs: tpcInnerParam, tgl, signed1Pt, NCl normalisation
+    track_columns.resize(4 * size);
+    track_collision.resize(size);
+    uint64_t iTrack = 0;
+    for (auto const& trk : tracks) {
+      if (!trk.hasTPC()) {
+        continue;
+      }
+      if (skipTPCOnly) {
+        if (!trk.hasITS() && !trk.hasTRD() && !trk.hasTOF()) {
+          continue;
+        }
+      }
+      if (iTrack == size) {
+        LOG(fatal) << "More tracks selected for the network (" << iTrack + 1 << ") than expected (" << size << ")!";
+      }
+      track_columns[iTrack] = trk.tpcInnerParam();
+      track_columns[size + iTrack] = trk.tgl();
+      track_columns[2 * size + iTrack] = trk.signed1Pt();
+      track_columns[3 * size + iTrack] = std::sqrt(nNclNormalization / trk.tpcNClsFound());
+      track_collision[iTrack] = 3 * (trk.has_collision() ? trk.collisionId() : nCollisions);
+      iTrack++;
+    }
+
+    // Rows of a chunk are ordered by species, then by track
+    auto fillChunk = [&](std::vector<float>& input, const uint64_t first, const uint64_t nTracks) {
+      input.resize(nTracks * numSpecies * input_dimensions);
+      float* row = input.data();
+      for (int species = 0; species < numSpecies; species++) {
+        const float mass = o2::track::pid_constants::sMasses[species];
+        for (uint64_t i = first; i < first + nTracks; i++, row += input_dimensions) {
+          const float* properties = &collision_properties[track_collision[i]];
+          std::fill(row + 6, row + input_dimensions, 0.f);
+          row[0] = track_columns[i];
+          row[1] = track_columns[size + i];
+          row[2] = track_columns[2 * size + i];
+          row[3] = mass;
+          row[4] = properties[0];
+          row[5] = track_columns[3 * size + i];
+          if (useOccupancy) {
+            row[6] = properties[1];
+          }
+          if (useRate) {
+            row[7] = properties[2];
+          }
+        }
+      }
+    };
+
+    // Evaluates a chunk and scatters the output of each species to its place in the prediction
+    auto evalChunk = [&](std::vector<float>& input, const uint64_t first, const uint64_t nTracks) {
+      auto start_network_eval = std::chrono::high_resolution_clock::now();
+      const float* output_network = network.evalModel(input);
+      auto stop_network_eval = std::chrono::high_resolution_clock::now();
+      if (!output_network) {
+        LOG(fatal) << "Evaluation of the TPC PID network failed!";
+      }
+      const uint64_t speciesOutputs = nTracks * output_dimensions;
+      for (int species = 0; species < numSpecies; species++) {
+        std::copy(output_network + species * speciesOutputs, output_network + (species + 1) * speciesOutputs, network_prediction.begin() + (species * size + first) * output_dimensions);
+      }
+      return std::chrono::duration<float, std::ratio<1, 1000000000>>(stop_network_eval - start_network_eval).count();
+    };
+
+    // At most one chunk is evaluated while the other input buffer is filled
+    float duration_network = 0;
+    const uint64_t chunkSize = networkPipelineChunk.value;
+    std::future<float> pending;
+    int buffer = 0;
+    for (uint64_t first = 0; first < size; first += chunkSize, buffer ^= 1) {
+      const uint64_t nTracks = std::min(chunkSize, size - first);
+      fillChunk(pipeline_input[buffer], first, nTracks);
+      if (pending.valid()) {
+        duration_network += pending.get();
+      }
+      pending = std::async(std::launch::async, evalChunk, std::ref(pipeline_input[buffer]), first, nTracks);
+    }
+    if (pending.valid()) {
+      duration_network += pending.get();
+    }
+    return duration_network;
+  }
+
   template <typename C, typename T, typename NSF, typename NST>
   void makePidTables(const int flagFull, NSF& tableFull, const int flagTiny, NST& tableTiny, const o2::track::PID::ID pid, const float tpcSignal, const T& trk, const C& collisions, const std::vector<float>& network_prediction, const int& count_tracks, const int& tracksForNet_size)
   {
@@ -565,6 +705,9 @@ struct tpcPid {
         }
         LOG(info) << "Successfully retrieved TPC PID object from CCDB for timestamp " << bc.timestamp() << ", period " << headers["LPMProductionTag"] << ", recoPass " << headers["RecoPassName"];
         response->PrintAll();
+        if (useTabulatedResponse) {
+          response->BuildLookupTables();
+        }
       }
 
       auto makePidTablesDefault = [&trk, &collisions, &network_prediction, &count_tracks, &tracksForNet_size, this](const int flagFull, auto& tableFull, const int flagTiny, auto& tableTiny, const o2::track::PID::ID pid) {
@@ -663,6 +806,9 @@ struct tpcPid {
         }
         LOG(info) << "Successfully retrieved TPC PID object from CCDB for timestamp " << bc.timestamp() << ", period " << headers["LPMProductionTag"] << ", recoPass " << headers["RecoPassName"];
         response->PrintAll();
+        if (useTabulatedResponse) {
+          response->BuildLookupTables();
+        }
       }
       auto makePidTablesDefault = [&trk, &dedx_corr, &collisions, &network_prediction, &count_tracks, &tracksForNet_size, this](const int flagFull, auto& tableFull, const int flagTiny, auto& tableTiny, const o2::track::PID::ID pid) {
         makePidTables(flagFull, tableFull, flagTiny, tableTiny, pid, dedx_corr.tpcSignalCorrected(), trk, collisions, network_prediction, count_tracks, tracksForNet_size);
@@ -746,6 +892,9 @@ struct tpcPid {
           }
         }
         response->PrintAll();
+        if (useTabulatedResponse) {
+          response->BuildLookupTables();
+        }
       }
 
       // Perform TuneOnData sampling for MC dE/dx
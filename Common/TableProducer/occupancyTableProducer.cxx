@@ -17,6 +17,7 @@
 
 #include "Common/DataModel/Multiplicity.h"
 #include "Common/DataModel/OccupancyTables.h"
+#include "Common/Tools/occupancyHelpers.h"
 
 #include <CCDB/BasicCCDBManager.h>
 #include <CommonConstants/LHCConstants.h>
@@ -48,6 +49,7 @@
 using namespace o2;
 using namespace o2::framework;
 using namespace o2::framework::expressions;
+using namespace o2::common::occupancy;
 
 int32_t nBCsPerOrbit = o2::constants::lhc::LHCMaxBunches;
 // const int nBCinTFgrp80 = 1425;
@@ -136,6 +138,7 @@ struct OccupancyTableProducer {
 
   std::vector<int> tfList;
   std::vector<std::vector<int64_t>> bcTFMap;
+  std::vector<bool> bcTFMapSorted;
 
   std::vector<std::vector<float>> occPrimUnfm80;
   std::vector<std::vector<float>> occFV0AUnfm80;
@@ -188,83 +191,9 @@ struct OccupancyTableProducer {
     tfList.resize(occVecArraySize);
     bcTFMap.resize(occVecArraySize);
 
-    if (buildFullOccTableProducer || buildOnlyOccsPrim || buildOnlyOccsT0V0Prim || buildOnlyOccsFDDT0V0Prim || buildOnlyOccsNtrackDet || buildOnlyOccsMultExtra) {
-      occPrimUnfm80.resize(occVecArraySize);
-    }
-    if (buildFullOccTableProducer || buildOnlyOccsT0V0Prim || buildOnlyOccsFDDT0V0Prim) {
-      occFV0AUnfm80.resize(occVecArraySize);
-      occFV0CUnfm80.resize(occVecArraySize);
-      occFT0AUnfm80.resize(occVecArraySize);
-      occFT0CUnfm80.resize(occVecArraySize);
-    }
-    if (buildFullOccTableProducer || buildOnlyOccsFDDT0V0Prim) {
-      occFDDAUnfm80.resize(occVecArraySize);
-      occFDDCUnfm80.resize(occVecArraySize);
-    }
-    if (buildFullOccTableProducer || buildOnlyOccsNtrackDet) {
-      occNTrackITSUnfm80.resize(occVecArraySize);
-      occNTrackTPCUnfm80.resize(occVecArraySize);
-      occNTrackTRDUnfm80.resize(occVecArraySize);
-      occNTrackTOFUnfm80.resize(occVecArraySize);
-      occNTrackSizeUnfm80.resize(occVecArraySize);
-      occNTrackTPCAUnfm80.resize(occVecArraySize);
-      occNTrackTPCCUnfm80.resize(occVecArraySize);
-      occNTrackITSTPCAUnfm80.resize(occVecArraySize);
-      occNTrackITSTPCCUnfm80.resize(occVecArraySize);
-    }
-    if (buildFullOccTableProducer || buildOnlyOccsNtrackDet || buildOnlyOccsMultExtra) {
-      occNTrackITSTPCUnfm80.resize(occVecArraySize);
-    }
-    if (buildFullOccTableProducer || buildOnlyOccsMultExtra) {
-      occMultNTracksHasITSUnfm80.resize(occVecArraySize);
-      occMultNTracksHasTPCUnfm80.resize(occVecArraySize);
-      occMultNTracksHasTOFUnfm80.resize(occVecArraySize);
-      occMultNTracksHasTRDUnfm80.resize(occVecArraySize);
-      occMultNTracksITSOnlyUnfm80.resize(occVecArraySize);
-      occMultNTracksTPCOnlyUnfm80.resize(occVecArraySize);
-      occMultNTracksITSTPCUnfm80.resize(occVecArraySize);
-      occMultAllTracksTPCOnlyUnfm80.resize(occVecArraySize);
-    }
-
+    // the occupancy buffers of a time frame are allocated in resetTFBuffers when the time frame is met
     for (int i = 0; i < occVecArraySize; i++) {
       bcTFMap[i].resize(nBCinTF / bcGrouping);
-      if (buildFullOccTableProducer || buildOnlyOccsPrim || buildOnlyOccsT0V0Prim || buildOnlyOccsFDDT0V0Prim || buildOnlyOccsNtrackDet || buildOnlyOccsMultExtra) {
-        occPrimUnfm80[i].resize(nBCinTF / bcGrouping);
-      }
-      if (buildFullOccTableProducer || buildOnlyOccsT0V0Prim || buildOnlyOccsFDDT0V0Prim) {
-        occFV0AUnfm80[i].resize(nBCinTF / bcGrouping);
-        occFV0CUnfm80[i].resize(nBCinTF / bcGrouping);
-        occFT0AUnfm80[i].resize(nBCinTF / bcGrouping);
-        occFT0CUnfm80[i].resize(nBCinTF / bcGrouping);
-      }
-      if (buildFullOccTableProducer || buildOnlyOccsFDDT0V0Prim) {
-        occFDDAUnfm80[i].resize(nBCinTF / bcGrouping);
-        occFDDCUnfm80[i].resize(nBCinTF / bcGrouping);
-      }
-      if (buildFullOccTableProducer || buildOnlyOccsNtrackDet) {
-        occNTrackITSUnfm80[i].resize(nBCinTF / bcGrouping);
-        occNTrackTPCUnfm80[i].resize(nBCinTF / bcGrouping);
-        occNTrackTRDUnfm80[i].resize(nBCinTF / bcGrouping);
-        occNTrackTOFUnfm80[i].resize(nBCinTF / bcGrouping);
-        occNTrackSizeUnfm80[i].resize(nBCinTF / bcGrouping);
-        occNTrackTPCAUnfm80[i].resize(nBCinTF / bcGrouping);
-        occNTrackTPCCUnfm80[i].resize(nBCinTF / bcGrouping);
-        occNTrackITSTPCAUnfm80[i].resize(nBCinTF / bcGrouping);
-        occNTrackITSTPCCUnfm80[i].resize(nBCinTF / bcGrouping);
-      }
-      if (buildFullOccTableProducer || buildOnlyOccsNtrackDet || buildOnlyOccsMultExtra) {
-        occNTrackITSTPCUnfm80[i].resize(nBCinTF / bcGrouping);
-      }
-      if (buildFullOccTableProducer || buildOnlyOccsMultExtra) {
-        occMultNTracksHasITSUnfm80[i].resize(nBCinTF / bcGrouping);
-        occMultNTracksHasTPCUnfm80[i].resize(nBCinTF / bcGrouping);
-        occMultNTracksHasTOFUnfm80[i].resize(nBCinTF / bcGrouping);
-        occMultNTracksHasTRDUnfm80[i].resize(nBCinTF / bcGrouping);
-        occMultNTracksITSOnlyUnfm80[i].resize(nBCinTF / bcGrouping);
-        occMultNTracksTPCOnlyUnfm80[i].resize(nBCinTF / bcGrouping);
-        occMultNTracksITSTPCUnfm80[i].resize(nBCinTF / bcGrouping);
-        occMultAllTracksTPCOnlyUnfm80[i].resize(nBCinTF / bcGrouping);
-      }
     }
 
     if (buildFullOccTableProducer || buildOnlyOccsT0V0Prim || buildFlag02OccRobustTable || buildFlag03OccMeanRobustTable) {
@@ -305,47 +234,6 @@ struct OccupancyTableProducer {
     std::transform(OriginalVec.begin(), OriginalVec.end(), OriginalVec.begin(), [scaleFactor](float x) { return x * scaleFactor; });
   }
 
-  template <typename... Vecs>
-  void getMedianOccVect(
-    std::vector<float>& medianVector,
-    std::vector<std::array<int, 2>>& medianPosVec,
-    const Vecs&... vectors)
-  {
-    const int n = sizeof...(Vecs);                             // Number of vectors
-    const int size = std::get<0>(std::tie(vectors...)).size(); // Size of the first vector
-
-    for (int i = 0; i < size; i++) {
-      std::vector<std::array<double, 2>> data; // first element is entry, second is index
-      int iEntry = 0;
-
-      // Lambda to iterate over all vectors
-      auto collect = [&](const auto& vec) {
-        data.push_back({vec[i], static_cast<double>(iEntry)});
-        iEntry++;
-      };
-      (collect(vectors), ...); // Unpack variadic arguments and apply lambda
-
-      // Sort the data
-      std::sort(data.begin(), data.end(), [](const std::array<double, 2>& a, const std::array<double, 2>& b) {
-        return a[0] < b[0];
-      });
-
-      double median;
-      int two = 2;
-      // Find the median
-      if (n % two == 0) {
-        median = (data[(n - 1) / 2][0] + data[(n - 1) / 2 + 1][0]) / 2;
-        medianPosVec[i][0] = static_cast<int>(data[(n - 1) / 2][1] + 0.001);
-        medianPosVec[i][1] = static_cast<int>(data[(n - 1) / 2 + 1][1] + 0.001);
-      } else {
-        median = data[n / 2][0];
-        medianPosVec[i][0] = static_cast<int>(data[n / 2][1] + 0.001);
-        medianPosVec[i][1] = -10; // For odd entries, only one value can be the median
-      }
-      medianVector[i] = median;
-    }
-  }
-
   void getRunInfo(const int& run, int& nBCsPerTF, int64_t& bcSOR)
   {
     auto runDuration = ccdb->getRunDuration(run, true);
@@ -416,6 +304,73 @@ struct OccupancyTableProducer {
     fillOccMeanRobustTable
   };
 
+  // Zero the occupancy buffers of one time frame slot, they are allocated the first time the slot is used
+  // and released by releaseTFBuffers, so that the memory follows the number of time frames of the data frame
+  template <int processMode>
+  void resetTFBuffers(const int& slot)
+  {
+    if (static_cast<int>(tfList.size()) <= slot) {
+      tfList.resize(slot + 1, -1);
+      bcTFMap.resize(slot + 1);
+    }
+    auto reset = [&](std::vector<std::vector<float>>& occVec) {
+      if (static_cast<int>(occVec.size()) <= slot) {
+        occVec.resize(slot + 1);
+      }
+      occVec[slot].assign(nBCinTF / bcGrouping, 0.);
+    };
+    if constexpr (processMode == kProcessFullOccTableProducer || processMode == kProcessOnlyOccPrim || processMode == kProcessOnlyOccT0V0Prim || processMode == kProcessOnlyOccFDDT0V0Prim || processMode == kProcessOnlyOccNtrackDet || processMode == kProcessOnlyOccMultExtra) {
+      reset(occPrimUnfm80);
+    }
+    if constexpr (processMode == kProcessFullOccTableProducer || processMode == kProcessOnlyOccT0V0Prim || processMode == kProcessOnlyOccFDDT0V0Prim) {
+      reset(occFV0AUnfm80);
+      reset(occFV0CUnfm80);
+      reset(occFT0AUnfm80);
+      reset(occFT0CUnfm80);
+    }
+    if constexpr (processMode == kProcessFullOccTableProducer || processMode == kProcessOnlyOccFDDT0V0Prim) {
+      reset(occFDDAUnfm80);
+      reset(occFDDCUnfm80);
+    }
+    if constexpr (processMode == kProcessFullOccTableProducer || processMode == kProcessOnlyOccNtrackDet) {
+      reset(occNTrackITSUnfm80);
+      reset(occNTrackTPCUnfm80);
+      reset(occNTrackTRDUnfm80);
+      reset(occNTrackTOFUnfm80);
+      reset(occNTrackSizeUnfm80);
+      reset(occNTrackTPCAUnfm80);
+      reset(occNTrackTPCCUnfm80);
+      reset(occNTrackITSTPCAUnfm80);
+      reset(occNTrackITSTPCCUnfm80);
+    }
+    if constexpr (processMode == kProcessFullOccTableProducer || processMode == kProcessOnlyOccNtrackDet || processMode == kProcessOnlyOccMultExtra) {
+      reset(occNTrackITSTPCUnfm80);
+    }
+    if constexpr (processMode == kProcessFullOccTableProducer || processMode == kProcessOnlyOccMultExtra) {
+      reset(occMultNTracksHasITSUnfm80);
+      reset(occMultNTracksHasTPCUnfm80);
+      reset(occMultNTracksHasTOFUnfm80);
+      reset(occMultNTracksHasTRDUnfm80);
+      reset(occMultNTracksITSOnlyUnfm80);
+      reset(occMultNTracksTPCOnlyUnfm80);
+      reset(occMultNTracksITSTPCUnfm80);
+      reset(occMultAllTracksTPCOnlyUnfm80);
+    }
+  }
+
+  // Release the occupancy buffers of the slots beyond the time frames of the current data frame,
+  // such that a data frame with many time frames does not keep its memory for the following ones
+  void releaseTFBuffers(const uint& nSlots)
+  {
+    for (auto* occVec : {&occPrimUnfm80, &occFV0AUnfm80, &occFV0CUnfm80, &occFT0AUnfm80, &occFT0CUnfm80, &occFDDAUnfm80, &occFDDCUnfm80,
+                         &occNTrackITSUnfm80, &occNTrackTPCUnfm80, &occNTrackTRDUnfm80, &occNTrackTOFUnfm80, &occNTrackSizeUnfm80, &occNTrackTPCAUnfm80, &occNTrackTPCCUnfm80, &occNTrackITSTPCUnfm80, &occNTrackITSTPCAUnfm80, &occNTrackITSTPCCUnfm80,
+                         &occMultNTracksHasITSUnfm80, &occMultNTracksHasTPCUnfm80, &occMultNTracksHasTOFUnfm80, &occMultNTracksHasTRDUnfm80, &occMultNTracksITSOnlyUnfm80, &occMultNTracksTPCOnlyUnfm80, &occMultNTracksITSTPCUnfm80, &occMultAllTracksTPCOnlyUnfm80}) {
+      if (occVec->size() > nSlots) {
+        occVec->resize(nSlots);
+      }
+    }
+  }
+
   template <typename B, typename C>
   void executeCollisionCheckAndBCprocessing(B const& BCs, C const& collisions, bool& collisionsSizeIsZero)
   {
@@ -486,49 +441,11 @@ struct OccupancyTableProducer {
       // Initialisze the vectors components to zero
       tfIDX = 0;
       tfCounted = 0;
-      for (int i = 0; i < occVecArraySize; i++) {
+      for (size_t i = 0; i < tfList.size(); i++) {
         tfList[i] = -1;
         bcTFMap[i].clear(); // list of BCs used in one time frame;
-        if constexpr (processMode == kProcessFullOccTableProducer || processMode == kProcessOnlyOccPrim || processMode == kProcessOnlyOccT0V0Prim || processMode == kProcessOnlyOccFDDT0V0Prim || processMode == kProcessOnlyOccNtrackDet || processMode == kProcessOnlyOccMultExtra) {
-          std::fill(occPrimUnfm80[i].begin(), occPrimUnfm80[i].end(), 0.);
-        }
-        if constexpr (processMode == kProcessFullOccTableProducer || processMode == kProcessOnlyOccT0V0Prim || processMode == kProcessOnlyOccFDDT0V0Prim) {
-          std::fill(occFV0AUnfm80[i].begin(), occFV0AUnfm80[i].end(), 0.);
-          std::fill(occFV0CUnfm80[i].begin(), occFV0CUnfm80[i].end(), 0.);
-          std::fill(occFT0AUnfm80[i].begin(), occFT0AUnfm80[i].end(), 0.);
-          std::fill(occFT0CUnfm80[i].begin(), occFT0CUnfm80[i].end(), 0.);
-        }
-        if constexpr (processMode == kProcessFullOccTableProducer || processMode == kProcessOnlyOccFDDT0V0Prim) {
-          std::fill(occFDDAUnfm80[i].begin(), occFDDAUnfm80[i].end(), 0.);
-          std::fill(occFDDCUnfm80[i].begin(), occFDDCUnfm80[i].end(), 0.);
-        }
-        if constexpr (processMode == kProcessFullOccTableProducer || processMode == kProcessOnlyOccNtrackDet) {
-          std::fill(occNTrackITSUnfm80[i].begin(), occNTrackITSUnfm80[i].end(), 0.);
-          std::fill(occNTrackTPCUnfm80[i].begin(), occNTrackTPCUnfm80[i].end(), 0.);
-          std::fill(occNTrackTRDUnfm80[i].begin(), occNTrackTRDUnfm80[i].end(), 0.);
-          std::fill(occNTrackTOFUnfm80[i].begin(), occNTrackTOFUnfm80[i].end(), 0.);
-          std::fill(occNTrackSizeUnfm80[i].begin(), occNTrackSizeUnfm80[i].end(), 0.);
-          std::fill(occNTrackTPCAUnfm80[i].begin(), occNTrackTPCAUnfm80[i].end(), 0.);
-          std::fill(occNTrackTPCCUnfm80[i].begin(), occNTrackTPCCUnfm80[i].end(), 0.);
-          std::fill(occNTrackITSTPCAUnfm80[i].begin(), occNTrackITSTPCAUnfm80[i].end(), 0.);
-          std::fill(occNTrackITSTPCCUnfm80[i].begin(), occNTrackITSTPCCUnfm80[i].end(), 0.);
-        }
-        if constexpr (processMode == kProcessFullOccTableProducer || processMode == kProcessOnlyOccNtrackDet || processMode == kProcessOnlyOccMultExtra) {
-          std::fill(occNTrackITSTPCUnfm80[i].begin(), occNTrackITSTPCUnfm80[i].end(), 0.);
-        }
-        if constexpr (processMode == kProcessFullOccTableProducer || processMode == kProcessOnlyOccMultExtra) {
-          std::fill(occMultNTracksHasITSUnfm80[i].begin(), occMultNTracksHasITSUnfm80[i].end(), 0.);
-          std::fill(occMultNTracksHasTPCUnfm80[i].begin(), occMultNTracksHasTPCUnfm80[i].end(), 0.);
-          std::fill(occMultNTracksHasTOFUnfm80[i].begin(), occMultNTracksHasTOFUnfm80[i].end(), 0.);
-          std::fill(occMultNTracksHasTRDUnfm80[i].begin(), occMultNTracksHasTRDUnfm80[i].end(), 0.);
-          std::fill(occMultNTracksITSOnlyUnfm80[i].begin(), occMultNTracksITSOnlyUnfm80[i].end(), 0.);
-          std::fill(occMultNTracksTPCOnlyUnfm80[i].begin(), occMultNTracksTPCOnlyUnfm80[i].end(), 0.);
-          std::fill(occMultNTracksITSTPCUnfm80[i].begin(), occMultNTracksITSTPCUnfm80[i].end(), 0.);
-          std::fill(occMultAllTracksTPCOnlyUnfm80[i].begin(), occMultAllTracksTPCOnlyUnfm80[i].end(), 0.);
-        }
       }
 
-      std::vector<int64_t> tfIDList;
       int nTrackITS = 0;
       int nTrackTPC = 0;
       int nTrackTRD = 0;
@@ -646,12 +563,11 @@ struct OccupancyTableProducer {
         //   return;
         // }
 
-        tfIDList.push_back(tfIdThis);
-
         if (tfList[tfIDX] != tfIdThis) {
           if (tfCounted != 0) {
             tfIDX++;
           } //
+          resetTFBuffers<processMode>(tfIDX);
           tfList[tfIDX] = tfIdThis;
           tfCounted++;
         }
@@ -727,66 +643,67 @@ struct OccupancyTableProducer {
           fNTrackITSTPCC = nTrackITSTPCC;
         }
         // Processing for bcGrouping of 80 BCs
-        for (int deltaBin = 0; deltaBin < nBCinDrift / bcGrouping; deltaBin++) {
-
-          if constexpr (processMode == kProcessFullOccTableProducer || processMode == kProcessOnlyOccPrim || processMode == kProcessOnlyOccT0V0Prim || processMode == kProcessOnlyOccFDDT0V0Prim || processMode == kProcessOnlyOccNtrackDet || processMode == kProcessOnlyOccMultExtra) {
-            (*tfOccPrimUnfm80)[(bin80Zero + deltaBin) % (nBCinTF / bcGrouping)] += fNumContrib * 1;
-          }
-          if constexpr (processMode == kProcessFullOccTableProducer || processMode == kProcessOnlyOccT0V0Prim || processMode == kProcessOnlyOccFDDT0V0Prim) {
-            (*tfOccFV0AUnfm80)[(bin80Zero + deltaBin) % (nBCinTF / bcGrouping)] += fMultFV0A * 1;
-            (*tfOccFV0CUnfm80)[(bin80Zero + deltaBin) % (nBCinTF / bcGrouping)] += fMultFV0C * 1;
-            (*tfOccFT0AUnfm80)[(bin80Zero + deltaBin) % (nBCinTF / bcGrouping)] += fMultFT0A * 1;
-            (*tfOccFT0CUnfm80)[(bin80Zero + deltaBin) % (nBCinTF / bcGrouping)] += fMultFT0C * 1;
-          }
-          if constexpr (processMode == kProcessFullOccTableProducer || processMode == kProcessOnlyOccFDDT0V0Prim) {
-            (*tfOccFDDAUnfm80)[(bin80Zero + deltaBin) % (nBCinTF / bcGrouping)] += fMultFDDA * 1;
-            (*tfOccFDDCUnfm80)[(bin80Zero + deltaBin) % (nBCinTF / bcGrouping)] += fMultFDDC * 1;
-          }
-          if constexpr (processMode == kProcessFullOccTableProducer || processMode == kProcessOnlyOccNtrackDet) {
-            (*tfOccNTrackITSUnfm80)[(bin80Zero + deltaBin) % (nBCinTF / bcGrouping)] += fNTrackITS * 1;
-            (*tfOccNTrackTPCUnfm80)[(bin80Zero + deltaBin) % (nBCinTF / bcGrouping)] += fNTrackTPC * 1;
-            (*tfOccNTrackTRDUnfm80)[(bin80Zero + deltaBin) % (nBCinTF / bcGrouping)] += fNTrackTRD * 1;
-            (*tfOccNTrackTOFUnfm80)[(bin80Zero + deltaBin) % (nBCinTF / bcGrouping)] += fNTrackTOF * 1;
-            (*tfOccNTrackSizeUnfm80)[(bin80Zero + deltaBin) % (nBCinTF / bcGrouping)] += fNTrackSize * 1;
-            (*tfOccNTrackTPCAUnfm80)[(bin80Zero + deltaBin) % (nBCinTF / bcGrouping)] += fNTrackTPCA * 1;
-            (*tfOccNTrackTPCCUnfm80)[(bin80Zero + deltaBin) % (nBCinTF / bcGrouping)] += fNTrackTPCC * 1;
-            (*tfOccNTrackITSTPCAUnfm80)[(bin80Zero + deltaBin) % (nBCinTF / bcGrouping)] += fNTrackITSTPCA * 1;
-            (*tfOccNTrackITSTPCCUnfm80)[(bin80Zero + deltaBin) % (nBCinTF / bcGrouping)] += fNTrackITSTPCC * 1;
-          }
-          if constexpr (processMode == kProcessFullOccTableProducer || processMode == kProcessOnlyOccNtrackDet || processMode == kProcessOnlyOccMultExtra) {
-            (*tfOccNTrackITSTPCUnfm80)[(bin80Zero + deltaBin) % (nBCinTF / bcGrouping)] += fNTrackITSTPC * 1;
-          }
-
-          if constexpr (processMode == kProcessFullOccTableProducer || processMode == kProcessOnlyOccMultExtra) {
-            (*tfOccMultNTracksHasITSUnfm80)[(bin80Zero + deltaBin) % (nBCinTF / bcGrouping)] += collision.multNTracksHasITS() * 1;
-            (*tfOccMultNTracksHasTPCUnfm80)[(bin80Zero + deltaBin) % (nBCinTF / bcGrouping)] += collision.multNTracksHasTPC() * 1;
-            (*tfOccMultNTracksHasTOFUnfm80)[(bin80Zero + deltaBin) % (nBCinTF / bcGrouping)] += collision.multNTracksHasTOF() * 1;
-            (*tfOccMultNTracksHasTRDUnfm80)[(bin80Zero + deltaBin) % (nBCinTF / bcGrouping)] += collision.multNTracksHasTRD() * 1;
-            (*tfOccMultNTracksITSOnlyUnfm80)[(bin80Zero + deltaBin) % (nBCinTF / bcGrouping)] += collision.multNTracksITSOnly() * 1;
-            (*tfOccMultNTracksTPCOnlyUnfm80)[(bin80Zero + deltaBin) % (nBCinTF / bcGrouping)] += collision.multNTracksTPCOnly() * 1;
-            (*tfOccMultNTracksITSTPCUnfm80)[(bin80Zero + deltaBin) % (nBCinTF / bcGrouping)] += collision.multNTracksITSTPC() * 1;
-            (*tfOccMultAllTracksTPCOnlyUnfm80)[(bin80Zero + deltaBin) % (nBCinTF / bcGrouping)] += collision.multAllTracksTPCOnly() * 1;
-          }
+        const int nDriftBins = nBCinDrift / bcGrouping;
+        if constexpr (processMode == kProcessFullOccTableProducer || processMode == kProcessOnlyOccPrim || processMode == kProcessOnlyOccT0V0Prim || processMode == kProcessOnlyOccFDDT0V0Prim || processMode == kProcessOnlyOccNtrackDet || processMode == kProcessOnlyOccMultExtra) {
+          addToDriftBins(*tfOccPrimUnfm80, bin80Zero, nDriftBins, fNumContrib);
+        }
+        if constexpr (processMode == kProcessFullOccTableProducer || processMode == kProcessOnlyOccT0V0Prim || processMode == kProcessOnlyOccFDDT0V0Prim) {
+          addToDriftBins(*tfOccFV0AUnfm80, bin80Zero, nDriftBins, fMultFV0A);
+          addToDriftBins(*tfOccFV0CUnfm80, bin80Zero, nDriftBins, fMultFV0C);
+          addToDriftBins(*tfOccFT0AUnfm80, bin80Zero, nDriftBins, fMultFT0A);
+          addToDriftBins(*tfOccFT0CUnfm80, bin80Zero, nDriftBins, fMultFT0C);
+        }
+        if constexpr (processMode == kProcessFullOccTableProducer || processMode == kProcessOnlyOccFDDT0V0Prim) {
+          addToDriftBins(*tfOccFDDAUnfm80, bin80Zero, nDriftBins, fMultFDDA);
+          addToDriftBins(*tfOccFDDCUnfm80, bin80Zero, nDriftBins, fMultFDDC);
+        }
+        if constexpr (processMode == kProcessFullOccTableProducer || processMode == kProcessOnlyOccNtrackDet) {
+          addToDriftBins(*tfOccNTrackITSUnfm80, bin80Zero, nDriftBins, fNTrackITS);
+          addToDriftBins(*tfOccNTrackTPCUnfm80, bin80Zero, nDriftBins, fNTrackTPC);
+          addToDriftBins(*tfOccNTrackTRDUnfm80, bin80Zero, nDriftBins, fNTrackTRD);
+          addToDriftBins(*tfOccNTrackTOFUnfm80, bin80Zero, nDriftBins, fNTrackTOF);
+          addToDriftBins(*tfOccNTrackSizeUnfm80, bin80Zero, nDriftBins, fNTrackSize);
+          addToDriftBins(*tfOccNTrackTPCAUnfm80, bin80Zero, nDriftBins, fNTrackTPCA);
+          addToDriftBins(*tfOccNTrackTPCCUnfm80, bin80Zero, nDriftBins, fNTrackTPCC);
+          addToDriftBins(*tfOccNTrackITSTPCAUnfm80, bin80Zero, nDriftBins, fNTrackITSTPCA);
+          addToDriftBins(*tfOccNTrackITSTPCCUnfm80, bin80Zero, nDriftBins, fNTrackITSTPCC);
+        }
+        if constexpr (processMode == kProcessFullOccTableProducer || processMode == kProcessOnlyOccNtrackDet || processMode == kProcessOnlyOccMultExtra) {
+          addToDriftBins(*tfOccNTrackITSTPCUnfm80, bin80Zero, nDriftBins, fNTrackITSTPC);
+        }
+        if constexpr (processMode == kProcessFullOccTableProducer || processMode == kProcessOnlyOccMultExtra) {
+          addToDriftBins(*tfOccMultNTracksHasITSUnfm80, bin80Zero, nDriftBins, collision.multNTracksHasITS());
+          addToDriftBins(*tfOccMultNTracksHasTPCUnfm80, bin80Zero, nDriftBins, collision.multNTracksHasTPC());
+          addToDriftBins(*tfOccMultNTracksHasTOFUnfm80, bin80Zero, nDriftBins, collision.multNTracksHasTOF());
+          addToDriftBins(*tfOccMultNTracksHasTRDUnfm80, bin80Zero, nDriftBins, collision.multNTracksHasTRD());
+          addToDriftBins(*tfOccMultNTracksITSOnlyUnfm80, bin80Zero, nDriftBins, collision.multNTracksITSOnly());
+          addToDriftBins(*tfOccMultNTracksTPCOnlyUnfm80, bin80Zero, nDriftBins, collision.multNTracksTPCOnly());
+          addToDriftBins(*tfOccMultNTracksITSTPCUnfm80, bin80Zero, nDriftBins, collision.multNTracksITSTPC());
+          addToDriftBins(*tfOccMultAllTracksTPCOnlyUnfm80, bin80Zero, nDriftBins, collision.multAllTracksTPCOnly());
         }
       }
       // collision Loop is over
 
       occupancyQA.fill(HIST("h_TF_in_DataFrame"), tfCounted);
 
-      std::vector<int64_t> sortedTfIDList = tfIDList;
-      std::sort(sortedTfIDList.begin(), sortedTfIDList.end());
-      auto last = std::unique(sortedTfIDList.begin(), sortedTfIDList.end());
-      sortedTfIDList.erase(last, sortedTfIDList.end());
-
-      if (tfCounted != sortedTfIDList.size()) {
-        LOG(error) << "DEBUG :: Number mismatch for tf counted and filled :: " << tfCounted << " != " << sortedTfIDList.size();
+      // every time frame of the collisions opened a slot in tfList, they are all distinct if the collisions are grouped in time frames
+      uint nDistinctTF = 0;
+      for (uint i = 0; i < tfCounted; i++) {
+        if (std::find(tfList.begin(), tfList.begin() + i, tfList[i]) == tfList.begin() + i) {
+          nDistinctTF++;
+        }
+      }
+      if (tfCounted != nDistinctTF) {
+        LOG(error) << "DEBUG :: Number mismatch for tf counted and filled :: " << tfCounted << " != " << nDistinctTF;
       }
 
       int totalBCcountSize = 0;
-      for (int i = 0; i < occVecArraySize; i++) {
+      bcTFMapSorted.assign(bcTFMap.size(), true);
+      for (size_t i = 0; i < bcTFMap.size(); i++) {
         totalBCcountSize += bcTFMap[i].size();
         // check if the BCs are already sorted or not
         if (!std::is_sorted(bcTFMap[i].begin(), bcTFMap[i].end())) {
+          bcTFMapSorted[i] = false;
           LOG(debug) << "DEBUG :: ERROR :: BCs are not sorted";
         }
       }
@@ -1031,8 +948,12 @@ struct OccupancyTableProducer {
           LOG(error) << "DEBUG :: SEVERE :: BC  Timeframe not in the list";
         }
 
-        auto it = std::find(bcTFMap[idx].begin(), bcTFMap[idx].end(), bc.globalIndex()); // will find the iterator where object is placed.
-        if (it != bcTFMap[idx].end()) {
+        bool bcHasCollision = false;
+        if (idx >= 0) {
+          const auto& bcList = bcTFMap[idx];
+          bcHasCollision = bcTFMapSorted[idx] ? std::binary_search(bcList.begin(), bcList.end(), bc.globalIndex()) : std::find(bcList.begin(), bcList.end(), bc.globalIndex()) != bcList.end();
+        }
+        if (bcHasCollision) {
           occIDX = idx; // Element is in the vector
         } else {
           occIDX = -1; // Element is not in the vector
@@ -1041,6 +962,7 @@ struct OccupancyTableProducer {
         genBCTFinfoTable(tfIdThis, bcInTF);
         genOccIndexTable(bc.globalIndex(), occIDX); // BCId, OccId
       }
+      releaseTFBuffers(tfCounted);
     } // else block for constexpr
   }
 
@@ -0,0 +1,127 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// \file   checkTPCResponseTabulated.cxx
+/// \brief  exec to compare the throughput and the accuracy of the exact and tabulated TPC PID response
+///
+
+#include "Common/Core/PID/TPCPIDResponse.h"
+
+#include <Framework/Logger.h>
+#include <ReconstructionDataFormats/PID.h>
+
+#include <TRandom.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+using namespace o2;
+
+// Minimal track and collision with the accessors used by the response
+struct Track {
+  float mTpcInnerParam = 0.f;
+  float mTgl = 0.f;
+  float mSigned1Pt = 0.f;
+  float mTpcSignal = 0.f;
+  int16_t mTpcNClsFound = 0;
+  int mCollisionId = 0;
+  bool hasTPC() const { return true; }
+  bool has_collision() const { return true; }
+  int collisionId() const { return mCollisionId; }
+  float tpcInnerParam() const { return mTpcInnerParam; }
+  float tgl() const { return mTgl; }
+  float signed1Pt() const { return mSigned1Pt; }
+  float tpcSignal() const { return mTpcSignal; }
+  int16_t tpcNClsFound() const { return mTpcNClsFound; }
+};
+
+struct Collision {
+  float mMultTPC = 0.f;
+  float multTPC() const { return mMultTPC; }
+};
+
+struct Collisions {
+  std::vector<Collision> mCollisions;
+  const Collision& rawIteratorAt(const int i) const { return mCollisions[i]; }
+};
+
+struct Tracks : std::vector<Track> {
+};
+
+template <typename F>
+float timeIt(F&& f)
+{
+  const auto start = std::chrono::high_resolution_clock::now();
+  f();
+  const auto stop = std::chrono::high_resolution_clock::now();
+  return std::chrono::duration<float, std::ratio<1, 1000000000>>(stop - start).count();
+}
+
+void process(const bool useDefaultResolutionParam, const int nTracks, const int nPointsPerDecade)
+{
+  pid::tpc::Response exact;
+  exact.SetUseDefaultResolutionParam(useDefaultResolutionParam);
+  pid::tpc::Response tabulated;
+  tabulated.SetParameters(&exact);
+  tabulated.BuildLookupTables(nPointsPerDecade);
+
+  Collisions collisions;
+  for (int i = 0; i < 100; i++) {
+    collisions.mCollisions.push_back({static_cast<float>(gRandom->Uniform(0, 5000))});
+  }
+  Tracks tracks;
+  for (int i = 0; i < nTracks; i++) {
+    Track trk;
+    trk.mTpcInnerParam = std::exp(gRandom->Uniform(std::log(0.05), std::log(20.)));
+    trk.mTgl = gRandom->Uniform(-1., 1.);
+    trk.mSigned1Pt = (gRandom->Rndm() > 0.5 ? 1.f : -1.f) * std::sqrt(1.f + trk.mTgl * trk.mTgl) / trk.mTpcInnerParam;
+    trk.mTpcNClsFound = static_cast<int16_t>(gRandom->Uniform(60, 159));
+    trk.mCollisionId = i % collisions.mCollisions.size();
+    trk.mTpcSignal = gRandom->Uniform(20, 500);
+    tracks.push_back(trk);
+  }
+
+  LOG(info) << "Resolution parametrisation: " << (useDefaultResolutionParam ? "default" : "full") << ", " << nPointsPerDecade << " points per decade, table accuracy " << tabulated.GetLookupTableAccuracy();
+  std::vector<float> nSigmaExact;
+  std::vector<float> nSigmaTabulated;
+  for (int id = 0; id < track::PID::NIDs; id++) {
+    const float timeExact = timeIt([&]() { exact.GetNumberOfSigma(collisions, tracks, id, nSigmaExact); });
+    const float timeTabulated = timeIt([&]() { tabulated.GetNumberOfSigma(collisions, tracks, id, nSigmaTabulated); });
+    float maxDeviation = 0.f;
+    float maxRelDeviationSignal = 0.f;
+    for (int i = 0; i < nTracks; i++) {
+      if (std::abs(nSigmaExact[i]) < 10.f) {
+        maxDeviation = std::max(maxDeviation, std::abs(nSigmaTabulated[i] - nSigmaExact[i]));
+      }
+      const float signalExact = exact.GetExpectedSignal(tracks[i], id);
+      if (signalExact > 0.f) {
+        maxRelDeviationSignal = std::max(maxRelDeviationSignal, std::abs(tabulated.GetExpectedSignal(tracks[i], id) / signalExact - 1.f));
+      }
+    }
+    LOG(info) << track::PID::getName(id) << ": exact " << timeExact / nTracks << " ns/track, tabulated " << timeTabulated / nTracks << " ns/track (x" << timeExact / timeTabulated << ")"
+              << ", max |delta nsigma| " << maxDeviation << " (|nsigma| < 10), max relative deviation of the expected signal " << maxRelDeviationSignal;
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  const int nTracks = argc > 1 ? std::atoi(argv[1]) : 1000000;
+  const int nPointsPerDecade = argc > 2 ? std::atoi(argv[2]) : 500;
+  process(true, nTracks, nPointsPerDecade);
+  process(false, nTracks, nPointsPerDecade);
+  return 0;
+}
@@ -23,6 +23,7 @@
 
 #include <CommonConstants/GeomConstants.h>
 #include <DetectorsBase/Propagator.h>
+#include <Field/MagneticField.h>
 #include <Framework/AnalysisDataModel.h>
 #include <Framework/AnalysisHelpers.h>
 #include <Framework/Configurable.h>
@@ -35,14 +36,19 @@
 #include <ReconstructionDataFormats/TrackParametrization.h>
 #include <ReconstructionDataFormats/TrackParametrizationWithError.h>
 
+#include <TGeoGlobalMagField.h>
 #include <TH1.h>
 #include <TH2.h>
 
+#include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstdint>
 #include <cstdlib>
 #include <memory>
 #include <string>
+#include <thread>
+#include <vector>
 
 //__________________________________________
 // track propagation module
@@ -72,6 +78,7 @@ struct TrackPropagationProducts : o2::framework::ProducesGroup {
 struct TrackPropagationConfigurables : o2::framework::ConfigurableGroup {
   std::string prefix = "trackPropagation";
   o2::framework::Configurable<float> minPropagationRadius{"minPropagationDistance", o2::constants::geom::XTPCInnerRef + 0.1, "Only tracks which are at a smaller radius will be propagated, defaults to TPC inner wall"};
+  o2::framework::Configurable<int> nThreads{"nThreads", 1, "Number of threads for the propagation. If > 1, all tracks are propagated first in parallel chunks, then the tables are filled in order (same output as with 1 thread). Only with the fast field map and without the TGeo material budget, otherwise serial"};
   // for TrackTuner only (MC smearing)
   o2::framework::Configurable<bool> useTrackTuner{"useTrackTuner", false, "Apply track tuner corrections to MC"};
   o2::framework::Configurable<bool> useTrkPid{"useTrkPid", false, "use pid in tracking"};
@@ -107,6 +114,19 @@ class TrackPropagationModule
   o2::track::TrackParametrizationWithError<float> mTrackParCov;
   bool autoDetectDcaCalib = false; // track tuner setting
 
+  // Buffers of the two-phase (multi-threaded) mode, one entry per track
+  std::vector<o2::track::TrackParametrization<float>> mTrackParBuffer;
+  std::vector<o2::track::TrackParametrizationWithError<float>> mTrackParCovBuffer;
+  std::vector<std::array<float, 2>> mDcaInfoBuffer;
+  std::vector<o2::dataformats::DCA> mDcaInfoCovBuffer;
+  std::vector<int> mVertexIdBuffer; // collision to propagate to, kMeanVertex or kNotPropagated
+  std::vector<uint8_t> mPropagationOKBuffer;
+  std::vector<double> mQ2OverPtNewBuffer;
+  std::vector<o2::dataformats::VertexBase> mVertices; // collision vertices, followed by the mean vertex
+  static constexpr int kMeanVertex = -1;
+  static constexpr int kNotPropagated = -2;
+  bool mSerialFallbackReported = false;
+
   template <typename TConfigurableGroup, typename TInitContext, typename THistoRegistry>
   void init(TConfigurableGroup const& cGroup, TrackTuner& trackTunerObj, THistoRegistry& registry, TInitContext& initContext)
   {
@@ -233,6 +253,17 @@ class TrackPropagationModule
       return; // suppress everything
     }
 
+    if (cGroup.nThreads.value > 1) {
+      if (isParallelPropagationSafe()) {
+        fillTrackTablesTwoPhase<isMc>(cGroup, trackTunerObj, ccdbLoader, collisions, tracks, cursors, registry);
+        return;
+      }
+      if (!mSerialFallbackReported) {
+        LOG(warning) << "[TrackPropagationModule] nThreads = " << cGroup.nThreads.value << " requested, but the propagation is not thread-safe without the fast field map or with the TGeo material budget: propagating serially";
+        mSerialFallbackReported = true;
+      }
+    }
+
     if (fillTracksCov) {
       cursors.tracksParCovPropagated.reserve(tracks.size());
       cursors.tracksParCovExtensionPropagated.reserve(tracks.size());
@@ -326,34 +357,207 @@ class TrackPropagationModule
           } // MC and fillCovMat block ends
         }
       }
-      // Filling modified Q/Pt values at IU/production point by track tuner in track tuner table
-      if (cGroup.useTrackTuner.value && cGroup.fillTrackTunerTable.value) {
-        cursors.tunertable(q2OverPtNew);
+      fillTrackCursors(cGroup, track, trackType, q2OverPtNew, mTrackPar, mDcaInfo, mTrackParCov, mDcaInfoCov, cursors);
+    }
+  }
+
+  /// The threads share the propagator. Its field is evaluated without internal state only with the fast (parametrised) field map,
+  /// the Chebyshev map of the full field and the TGeo navigation of the material budget use scratch buffers of the instance.
+  /// Any other field than o2::field::MagneticField is not known to be thread-safe
+  bool isParallelPropagationSafe() const
+  {
+    if (matCorr == o2::base::Propagator::MatCorrType::USEMatCorrTGeo) {
+      return false;
+    }
+    const auto* field = dynamic_cast<const o2::field::MagneticField*>(TGeoGlobalMagField::Instance()->GetField());
+    return field != nullptr && field->getFastField() != nullptr;
+  }
+
+  /// Propagate the buffered tracks to their vertices, in nThreads contiguous chunks.
+  /// The tracks are independent, so the result does not depend on nThreads
+  void propagateBuffers(const int nThreads)
+  {
+    const size_t nTracks = mVertexIdBuffer.size();
+    const auto* propagator = o2::base::Propagator::Instance();
+    auto propagateTracks = [&](const size_t first, const size_t last) {
+      for (size_t i = first; i < last; i++) {
+        if (mVertexIdBuffer[i] == kNotPropagated) {
+          continue;
+        }
+        const auto& vertex = mVertexIdBuffer[i] == kMeanVertex ? mVertices.back() : mVertices[mVertexIdBuffer[i]];
+        if (fillTracksCov) {
+          mPropagationOKBuffer[i] = propagator->propagateToDCABxByBz(vertex, mTrackParCovBuffer[i], 2.f, matCorr, &mDcaInfoCovBuffer[i]);
+        } else {
+          mPropagationOKBuffer[i] = propagator->propagateToDCABxByBz(vertex.getXYZ(), mTrackParBuffer[i], 2.f, matCorr, &mDcaInfoBuffer[i]);
+        }
       }
-      // LOG(info) <<  " trackPropagation (this value filled in tuner table)--> "  << q2OverPtNew;
+    };
+    const size_t nWorkers = std::min<size_t>(std::max(nThreads, 1), std::max<size_t>(nTracks, 1));
+    if (nWorkers == 1) {
+      propagateTracks(0, nTracks);
+      return;
+    }
+    const size_t chunkSize = (nTracks + nWorkers - 1) / nWorkers;
+    std::vector<std::thread> threads;
+    threads.reserve(nWorkers);
+    for (size_t iw = 0; iw < nWorkers; iw++) {
+      threads.emplace_back(propagateTracks, std::min(nTracks, iw * chunkSize), std::min(nTracks, (iw + 1) * chunkSize));
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  }
+
+  /// Two-phase version of fillTrackTables, with the same output.
+  /// The input tracks are prepared (and tuned) serially, then propagated in parallel chunks into the buffers,
+  /// then the histograms and the tables are filled in the track order.
+  template <bool isMc, typename TConfigurableGroup, typename TCCDBLoader, typename TCollisions, typename TTracks, typename TOutputGroup, typename THistoRegistry>
+  void fillTrackTablesTwoPhase(TConfigurableGroup const& cGroup, TrackTuner& trackTunerObj, TCCDBLoader const& ccdbLoader, TCollisions const& collisions, TTracks const& tracks, TOutputGroup& cursors, THistoRegistry& registry)
+  {
+    const size_t nTracks = tracks.size();
+    if (fillTracksCov) {
+      mTrackParCovBuffer.resize(nTracks);
+      mDcaInfoCovBuffer.resize(nTracks);
+    } else {
+      mTrackParBuffer.resize(nTracks);
+      mDcaInfoBuffer.resize(nTracks);
+    }
+    mVertexIdBuffer.resize(nTracks);
+    mPropagationOKBuffer.resize(nTracks);
+    mQ2OverPtNewBuffer.resize(nTracks);
+
+    // vertices to propagate to
+    mVertices.resize(collisions.size() + 1);
+    for (const auto& collision : collisions) {
+      auto& vertex = mVertices[collision.globalIndex()];
+      vertex.setPos({collision.posX(), collision.posY(), collision.posZ()});
+      vertex.setCov(collision.covXX(), collision.covXY(), collision.covYY(), collision.covXZ(), collision.covYZ(), collision.covZZ());
+    }
+    if (ccdbLoader.mMeanVtx != nullptr) {
+      auto& meanVertex = mVertices.back();
+      meanVertex.setPos({ccdbLoader.mMeanVtx->getX(), ccdbLoader.mMeanVtx->getY(), ccdbLoader.mMeanVtx->getZ()});
+      meanVertex.setCov(ccdbLoader.mMeanVtx->getSigmaX() * ccdbLoader.mMeanVtx->getSigmaX(), 0.0f, ccdbLoader.mMeanVtx->getSigmaY() * ccdbLoader.mMeanVtx->getSigmaY(), 0.0f, 0.0f, ccdbLoader.mMeanVtx->getSigmaZ() * ccdbLoader.mMeanVtx->getSigmaZ());
+    }
+
+    // phase 0: input tracks, in order since the track tuner uses the random generator and fills histograms
+    size_t iTrack = 0;
+    for (const auto& track : tracks) {
+      double q2OverPtNew = -9999.;
       if (fillTracksCov) {
-        cursors.tracksParPropagated(track.collisionId(), trackType, mTrackParCov.getX(), mTrackParCov.getAlpha(), mTrackParCov.getY(), mTrackParCov.getZ(), mTrackParCov.getSnp(), mTrackParCov.getTgl(), mTrackParCov.getQ2Pt());
-        cursors.tracksParExtensionPropagated(mTrackParCov.getPt(), mTrackParCov.getP(), mTrackParCov.getEta(), mTrackParCov.getPhi());
-        // TODO do we keep the rho as 0? Also the sigma's are duplicated information
-        cursors.tracksParCovPropagated(std::sqrt(mTrackParCov.getSigmaY2()), std::sqrt(mTrackParCov.getSigmaZ2()), std::sqrt(mTrackParCov.getSigmaSnp2()),
-                                       std::sqrt(mTrackParCov.getSigmaTgl2()), std::sqrt(mTrackParCov.getSigma1Pt2()), 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
-        cursors.tracksParCovExtensionPropagated(mTrackParCov.getSigmaY2(), mTrackParCov.getSigmaZY(), mTrackParCov.getSigmaZ2(), mTrackParCov.getSigmaSnpY(),
-                                                mTrackParCov.getSigmaSnpZ(), mTrackParCov.getSigmaSnp2(), mTrackParCov.getSigmaTglY(), mTrackParCov.getSigmaTglZ(), mTrackParCov.getSigmaTglSnp(),
-                                                mTrackParCov.getSigmaTgl2(), mTrackParCov.getSigma1PtY(), mTrackParCov.getSigma1PtZ(), mTrackParCov.getSigma1PtSnp(), mTrackParCov.getSigma1PtTgl(),
-                                                mTrackParCov.getSigma1Pt2());
-        if (fillTracksDCA) {
-          cursors.tracksDCA(mDcaInfoCov.getY(), mDcaInfoCov.getZ());
-        }
-        if (fillTracksDCACov) {
-          cursors.tracksDCACov(mDcaInfoCov.getSigmaY2(), mDcaInfoCov.getSigmaZ2());
+        mDcaInfoCovBuffer[iTrack].set(999, 999, 999, 999, 999);
+        setTrackParCov(track, mTrackParCovBuffer[iTrack]);
+        if (cGroup.useTrkPid.value) {
+          mTrackParCovBuffer[iTrack].setPID(track.pidForTracking());
         }
       } else {
-        cursors.tracksParPropagated(track.collisionId(), trackType, mTrackPar.getX(), mTrackPar.getAlpha(), mTrackPar.getY(), mTrackPar.getZ(), mTrackPar.getSnp(), mTrackPar.getTgl(), mTrackPar.getQ2Pt());
-        cursors.tracksParExtensionPropagated(mTrackPar.getPt(), mTrackPar.getP(), mTrackPar.getEta(), mTrackPar.getPhi());
-        if (fillTracksDCA) {
-          cursors.tracksDCA(mDcaInfo[0], mDcaInfo[1]);
+        mDcaInfoBuffer[iTrack] = {999, 999};
+        setTrackPar(track, mTrackParBuffer[iTrack]);
+        if (cGroup.useTrkPid.value) {
+          mTrackParBuffer[iTrack].setPID(track.pidForTracking());
+        }
+      }
+      int vertexId = kNotPropagated;
+      if (track.trackType() == o2::aod::track::TrackIU && track.x() < cGroup.minPropagationRadius.value) {
+        if (fillTracksCov) {
+          if constexpr (isMc) {
+            if (cGroup.useTrackTuner.value) {
+              trackTunedTracks->Fill(1); // all tracks
+              if (track.has_mcParticle()) {
+                auto mcParticle = track.mcParticle();
+                trackTunerObj.tuneTrackParams(mcParticle, mTrackParCovBuffer[iTrack], matCorr, &mDcaInfoCovBuffer[iTrack], trackTunedTracks);
+                q2OverPtNew = mTrackParCovBuffer[iTrack].getQ2Pt();
+              }
+            }
+          }
+        }
+        vertexId = track.has_collision() ? track.collisionId() : kMeanVertex;
+        if (vertexId == kMeanVertex && ccdbLoader.mMeanVtx == nullptr) {
+          LOG(fatal) << "[TrackPropagationModule] no mean vertex available to propagate the tracks without collision";
+        }
+      }
+      mVertexIdBuffer[iTrack] = vertexId;
+      mQ2OverPtNewBuffer[iTrack] = q2OverPtNew;
+      iTrack++;
+    }
+
+    // phase 1: propagation, each thread on a contiguous chunk of tracks
+    propagateBuffers(cGroup.nThreads.value);
+
+    // phase 2: QA histograms and tables, in order
+    if (fillTracksCov) {
+      cursors.tracksParCovPropagated.reserve(nTracks);
+      cursors.tracksParCovExtensionPropagated.reserve(nTracks);
+      if (fillTracksDCACov) {
+        cursors.tracksDCACov.reserve(nTracks);
+      }
+    } else {
+      cursors.tracksParPropagated.reserve(nTracks);
+      cursors.tracksParExtensionPropagated.reserve(nTracks);
+      if (fillTracksDCA) {
+        cursors.tracksDCA.reserve(nTracks);
+      }
+    }
+    iTrack = 0;
+    for (const auto& track : tracks) {
+      o2::aod::track::TrackTypeEnum trackType = (o2::aod::track::TrackTypeEnum)track.trackType();
+      if (mVertexIdBuffer[iTrack] != kNotPropagated && mPropagationOKBuffer[iTrack]) {
+        trackType = o2::aod::track::Track;
+        if (fillTracksCov) {
+          if constexpr (isMc) {
+            if (track.has_mcParticle()) {
+              auto mcParticle1 = track.mcParticle();
+              if (mcParticle1.isPhysicalPrimary()) {
+                registry.fill(HIST("hDCAxyVsPtRec"), mDcaInfoCovBuffer[iTrack].getY(), mTrackParCovBuffer[iTrack].getPt());
+                registry.fill(HIST("hDCAxyVsPtMC"), mDcaInfoCovBuffer[iTrack].getY(), mcParticle1.pt());
+                registry.fill(HIST("hDCAzVsPtRec"), mDcaInfoCovBuffer[iTrack].getZ(), mTrackParCovBuffer[iTrack].getPt());
+                registry.fill(HIST("hDCAzVsPtMC"), mDcaInfoCovBuffer[iTrack].getZ(), mcParticle1.pt());
+              }
+            }
+          }
         }
       }
+      if (fillTracksCov) {
+        fillTrackCursors(cGroup, track, trackType, mQ2OverPtNewBuffer[iTrack], mTrackPar, mDcaInfo, mTrackParCovBuffer[iTrack], mDcaInfoCovBuffer[iTrack], cursors);
+      } else {
+        fillTrackCursors(cGroup, track, trackType, mQ2OverPtNewBuffer[iTrack], mTrackParBuffer[iTrack], mDcaInfoBuffer[iTrack], mTrackParCov, mDcaInfoCov, cursors);
+      }
+      iTrack++;
+    }
+  }
+
+  /// Fill the output tables of one track, from trackParCov and dcaInfoCov if fillTracksCov, from trackPar and dcaInfo otherwise
+  template <typename TConfigurableGroup, typename TTrack, typename TOutputGroup>
+  void fillTrackCursors(TConfigurableGroup const& cGroup, TTrack const& track, o2::aod::track::TrackTypeEnum trackType, double q2OverPtNew,
+                        o2::track::TrackParametrization<float> const& trackPar, std::array<float, 2> const& dcaInfo,
+                        o2::track::TrackParametrizationWithError<float> const& trackParCov, o2::dataformats::DCA const& dcaInfoCov, TOutputGroup& cursors)
+  {
+    // Filling modified Q/Pt values at IU/production point by track tuner in track tuner table
+    if (cGroup.useTrackTuner.value && cGroup.fillTrackTunerTable.value) {
+      cursors.tunertable(q2OverPtNew);
+    }
+    // LOG(info) <<  " trackPropagation (this value filled in tuner table)--> "  << q2OverPtNew;
+    if (fillTracksCov) {
+      cursors.tracksParPropagated(track.collisionId(), trackType, trackParCov.getX(), trackParCov.getAlpha(), trackParCov.getY(), trackParCov.getZ(), trackParCov.getSnp(), trackParCov.getTgl(), trackParCov.getQ2Pt());
+      cursors.tracksParExtensionPropagated(trackParCov.getPt(), trackParCov.getP(), trackParCov.getEta(), trackParCov.getPhi());
+      // TODO do we keep the rho as 0? Also the sigma's are duplicated information
+      cursors.tracksParCovPropagated(std::sqrt(trackParCov.getSigmaY2()), std::sqrt(trackParCov.getSigmaZ2()), std::sqrt(trackParCov.getSigmaSnp2()),
+                                     std::sqrt(trackParCov.getSigmaTgl2()), std::sqrt(trackParCov.getSigma1Pt2()), 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+      cursors.tracksParCovExtensionPropagated(trackParCov.getSigmaY2(), trackParCov.getSigmaZY(), trackParCov.getSigmaZ2(), trackParCov.getSigmaSnpY(),
+                                              trackParCov.getSigmaSnpZ(), trackParCov.getSigmaSnp2(), trackParCov.getSigmaTglY(), trackParCov.getSigmaTglZ(), trackParCov.getSigmaTglSnp(),
+                                              trackParCov.getSigmaTgl2(), trackParCov.getSigma1PtY(), trackParCov.getSigma1PtZ(), trackParCov.getSigma1PtSnp(), trackParCov.getSigma1PtTgl(),
+                                              trackParCov.getSigma1Pt2());
+      if (fillTracksDCA) {
+        cursors.tracksDCA(dcaInfoCov.getY(), dcaInfoCov.getZ());
+      }
+      if (fillTracksDCACov) {
+        cursors.tracksDCACov(dcaInfoCov.getSigmaY2(), dcaInfoCov.getSigmaZ2());
+      }
+    } else {
+      cursors.tracksParPropagated(track.collisionId(), trackType, trackPar.getX(), trackPar.getAlpha(), trackPar.getY(), trackPar.getZ(), trackPar.getSnp(), trackPar.getTgl(), trackPar.getQ2Pt());
+      cursors.tracksParExtensionPropagated(trackPar.getPt(), trackPar.getP(), trackPar.getEta(), trackPar.getPhi());
+      if (fillTracksDCA) {
+        cursors.tracksDCA(dcaInfo[0], dcaInfo[1]);
+      }
     }
   }
 };
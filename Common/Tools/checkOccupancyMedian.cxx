@@ -0,0 +1,128 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// \file   checkOccupancyMedian.cxx
+/// \brief  exec to check that the robust occupancy median of getMedianOccVect is identical to the median from std::sort,
+///         and that addToDriftBins gives the same bins as the modulo per bin
+///         arguments: [nBins]
+///         the estimators take few distinct values, such that ties are frequent
+///
+
+#include "Common/Tools/occupancyHelpers.h"
+
+#include <Framework/Logger.h>
+
+#include <TRandom.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdlib>
+#include <utility>
+#include <vector>
+
+using namespace o2::common::occupancy;
+
+namespace
+{
+// median of the entries of each bin, as computed with std::sort before getMedianOccVect
+void getMedianSorted(std::vector<float>& medianVector, std::vector<std::array<int, 2>>& medianPosVec, const std::vector<std::vector<float>>& vectors)
+{
+  const int n = vectors.size();
+  for (std::size_t i = 0; i < medianVector.size(); i++) {
+    std::vector<std::array<double, 2>> data;
+    for (int iEntry = 0; iEntry < n; iEntry++) {
+      data.push_back({vectors[iEntry][i], static_cast<double>(iEntry)});
+    }
+    std::sort(data.begin(), data.end(), [](const std::array<double, 2>& a, const std::array<double, 2>& b) {
+      return a[0] < b[0];
+    });
+    if (n % 2 == 0) {
+      medianVector[i] = (data[(n - 1) / 2][0] + data[(n - 1) / 2 + 1][0]) / 2;
+      medianPosVec[i] = {static_cast<int>(data[(n - 1) / 2][1] + 0.001), static_cast<int>(data[(n - 1) / 2 + 1][1] + 0.001)};
+    } else {
+      medianVector[i] = data[n / 2][0];
+      medianPosVec[i] = {static_cast<int>(data[n / 2][1] + 0.001), -10};
+    }
+  }
+}
+
+// the positions may point to different entries of a tie, but they must hold the same values
+template <std::size_t... I>
+int compareMedians(const std::vector<std::vector<float>>& vectors, std::index_sequence<I...>)
+{
+  const int nBins = vectors[0].size();
+  std::vector<float> median(nBins), medianSorted(nBins);
+  std::vector<std::array<int, 2>> medianPos(nBins), medianPosSorted(nBins);
+  getMedianOccVect(median, medianPos, vectors[I]...);
+  getMedianSorted(medianSorted, medianPosSorted, vectors);
+
+  int nErrors = 0;
+  for (int i = 0; i < nBins; i++) {
+    nErrors += (median[i] != medianSorted[i]);
+    for (int j = 0; j < 2; j++) {
+      if (medianPos[i][j] < 0 || medianPosSorted[i][j] < 0) {
+        nErrors += (medianPos[i][j] != medianPosSorted[i][j]);
+      } else {
+        nErrors += (vectors[medianPos[i][j]][i] != vectors[medianPosSorted[i][j]][i]);
+      }
+    }
+  }
+  return nErrors;
+}
+
+template <std::size_t N>
+int checkMedian(const int nBins)
+{
+  std::vector<std::vector<float>> vectors(N, std::vector<float>(nBins));
+  for (auto& vec : vectors) {
+    for (auto& value : vec) {
+      value = 0.5f * gRandom->Integer(8);
+    }
+  }
+  const int nErrors = compareMedians(vectors, std::make_index_sequence<N>{});
+  if (nErrors > 0) {
+    LOG(error) << nErrors << " differences in the median of " << N << " estimators";
+  }
+  return nErrors;
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+  const int nBins = argc > 1 ? std::atoi(argv[1]) : 10000;
+
+  // the numbers of estimators combined in the robust occupancy tables, and an odd one
+  int nErrors = checkMedian<3>(nBins) + checkMedian<4>(nBins) + checkMedian<6>(nBins) + checkMedian<10>(nBins);
+
+  // drift bins starting anywhere in the time frame, also wrapping around its end
+  const int nDriftBins = nBins / 4 + 1;
+  std::vector<float> occ(nBins, 0.f), occModulo(nBins, 0.f);
+  for (int iColl = 0; iColl < 100; iColl++) {
+    const int firstBin = gRandom->Integer(2 * nBins);
+    const float value = gRandom->Uniform(0., 100.);
+    addToDriftBins(occ, firstBin, nDriftBins, value);
+    for (int deltaBin = 0; deltaBin < nDriftBins; deltaBin++) {
+      occModulo[(firstBin + deltaBin) % nBins] += value;
+    }
+  }
+  if (occ != occModulo) {
+    LOG(error) << "addToDriftBins differs from the modulo per bin";
+    nErrors++;
+  }
+
+  if (nErrors > 0) {
+    return 1;
+  }
+  LOG(info) << "Occupancy medians and drift bins identical for " << nBins << " bins";
+  return 0;
+}
@@ -0,0 +1,315 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// \file   checkTrackPropagationThreads.cxx
+/// \brief  exec to check that the multi-threaded propagation of TrackPropagationModule is bit-identical to the single-threaded one,
+///         both for the propagation alone and for the tables filled by fillTrackTables in the two-phase and in the serial mode
+///         arguments: [nTracks] [nThreads]
+///         the nominal 0.5 T field map with its fast parametrisation is used, without material corrections
+///
+
+#include "Common/Tools/TrackPropagationModule.h"
+
+#include <DetectorsBase/Propagator.h>
+#include <Field/MagneticField.h>
+#include <Framework/Logger.h>
+#include <ReconstructionDataFormats/DCA.h>
+#include <ReconstructionDataFormats/TrackParametrization.h>
+#include <ReconstructionDataFormats/TrackParametrizationWithError.h>
+
+#include <TGeoGlobalMagField.h>
+#include <TRandom.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+using namespace o2;
+
+namespace
+{
+bool isIdentical(const track::TrackParametrization<float>& a, const track::TrackParametrization<float>& b)
+{
+  return a.getX() == b.getX() && a.getAlpha() == b.getAlpha() && a.getY() == b.getY() && a.getZ() == b.getZ() && a.getSnp() == b.getSnp() && a.getTgl() == b.getTgl() && a.getQ2Pt() == b.getQ2Pt();
+}
+
+bool isIdentical(const track::TrackParametrizationWithError<float>& a, const track::TrackParametrizationWithError<float>& b)
+{
+  return isIdentical(static_cast<const track::TrackParametrization<float>&>(a), static_cast<const track::TrackParametrization<float>&>(b)) && a.getCov() == b.getCov();
+}
+
+bool isIdentical(const dataformats::DCA& a, const dataformats::DCA& b)
+{
+  return a.getY() == b.getY() && a.getZ() == b.getZ() && a.getSigmaY2() == b.getSigmaY2() && a.getSigmaYZ() == b.getSigmaYZ() && a.getSigmaZ2() == b.getSigmaZ2();
+}
+
+// minimal stand-ins of the configurables, tables and cursors used by fillTrackTables
+template <typename T>
+struct MockConfigurable {
+  T value;
+};
+
+struct MockConfigurables {
+  MockConfigurable<float> minPropagationRadius{30.f};
+  MockConfigurable<int> nThreads{1};
+  MockConfigurable<bool> useTrackTuner{true};
+  MockConfigurable<bool> useTrkPid{false};
+  MockConfigurable<bool> fillTrackTunerTable{true};
+};
+
+struct MockCollision {
+  int64_t index;
+  std::array<float, 3> pos;
+  std::array<float, 6> cov;
+  int64_t globalIndex() const { return index; }
+  float posX() const { return pos[0]; }
+  float posY() const { return pos[1]; }
+  float posZ() const { return pos[2]; }
+  float covXX() const { return cov[0]; }
+  float covXY() const { return cov[1]; }
+  float covYY() const { return cov[2]; }
+  float covXZ() const { return cov[3]; }
+  float covYZ() const { return cov[4]; }
+  float covZZ() const { return cov[5]; }
+};
+
+struct MockCollisions : std::vector<MockCollision> {
+  const MockCollision& rawIteratorAt(int64_t i) const { return (*this)[i]; }
+};
+
+struct MockTrack {
+  track::TrackParametrizationWithError<float> par;
+  uint8_t type;
+  uint32_t pid;
+  int collision;
+  float x() const { return par.getX(); }
+  float alpha() const { return par.getAlpha(); }
+  float y() const { return par.getY(); }
+  float z() const { return par.getZ(); }
+  float snp() const { return par.getSnp(); }
+  float tgl() const { return par.getTgl(); }
+  float signed1Pt() const { return par.getQ2Pt(); }
+  float cYY() const { return par.getSigmaY2(); }
+  float cZY() const { return par.getSigmaZY(); }
+  float cZZ() const { return par.getSigmaZ2(); }
+  float cSnpY() const { return par.getSigmaSnpY(); }
+  float cSnpZ() const { return par.getSigmaSnpZ(); }
+  float cSnpSnp() const { return par.getSigmaSnp2(); }
+  float cTglY() const { return par.getSigmaTglY(); }
+  float cTglZ() const { return par.getSigmaTglZ(); }
+  float cTglSnp() const { return par.getSigmaTglSnp(); }
+  float cTglTgl() const { return par.getSigmaTgl2(); }
+  float c1PtY() const { return par.getSigma1PtY(); }
+  float c1PtZ() const { return par.getSigma1PtZ(); }
+  float c1PtSnp() const { return par.getSigma1PtSnp(); }
+  float c1PtTgl() const { return par.getSigma1PtTgl(); }
+  float c1Pt21Pt2() const { return par.getSigma1Pt2(); }
+  uint8_t trackType() const { return type; }
+  uint32_t pidForTracking() const { return pid; }
+  int collisionId() const { return collision; }
+  bool has_collision() const { return collision >= 0; }
+};
+
+struct MockMeanVertex {
+  std::array<float, 3> pos;
+  std::array<float, 3> sigma;
+  float getX() const { return pos[0]; }
+  float getY() const { return pos[1]; }
+  float getZ() const { return pos[2]; }
+  float getSigmaX() const { return sigma[0]; }
+  float getSigmaY() const { return sigma[1]; }
+  float getSigmaZ() const { return sigma[2]; }
+};
+
+struct MockCCDBLoader {
+  int runNumber = 0;
+  const MockMeanVertex* mMeanVtx = nullptr;
+};
+
+// records all the values filled into a table
+struct MockCursor {
+  std::vector<double> values;
+  void reserve(size_t) {}
+  template <typename... Ts>
+  void operator()(Ts... args)
+  {
+    (values.push_back(static_cast<double>(args)), ...);
+  }
+};
+
+struct MockCursors {
+  MockCursor tracksParPropagated;
+  MockCursor tracksParExtensionPropagated;
+  MockCursor tracksParCovPropagated;
+  MockCursor tracksParCovExtensionPropagated;
+  MockCursor tracksDCA;
+  MockCursor tracksDCACov;
+  MockCursor tunertable;
+};
+
+struct MockRegistry {};
+
+// number of values which are not bit-identical, also for NaN
+size_t countDifferences(const MockCursor& a, const MockCursor& b)
+{
+  if (a.values.size() != b.values.size()) {
+    return std::max(a.values.size(), b.values.size());
+  }
+  size_t nDifferent = 0;
+  for (size_t i = 0; i < a.values.size(); i++) {
+    nDifferent += (std::memcmp(&a.values[i], &b.values[i], sizeof(double)) != 0);
+  }
+  return nDifferent;
+}
+
+size_t countDifferences(const MockCursors& a, const MockCursors& b)
+{
+  return countDifferences(a.tracksParPropagated, b.tracksParPropagated) + countDifferences(a.tracksParExtensionPropagated, b.tracksParExtensionPropagated) + countDifferences(a.tracksParCovPropagated, b.tracksParCovPropagated) + countDifferences(a.tracksParCovExtensionPropagated, b.tracksParCovExtensionPropagated) + countDifferences(a.tracksDCA, b.tracksDCA) + countDifferences(a.tracksDCACov, b.tracksDCACov) + countDifferences(a.tunertable, b.tunertable);
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+  const int nTracks = argc > 1 ? std::atoi(argv[1]) : 20000;
+  const int nThreads = argc > 2 ? std::atoi(argv[2]) : 4;
+  const int nVertices = 20;
+
+  auto* field = field::MagneticField::createNominalField(5);
+  field->AllowFastField(true);
+  TGeoGlobalMagField::Instance()->SetField(field);
+  TGeoGlobalMagField::Instance()->Lock();
+  base::Propagator::Instance();
+
+  common::TrackPropagationModule module;
+  module.matCorr = base::Propagator::MatCorrType::USEMatCorrNONE;
+  if (!module.isParallelPropagationSafe()) {
+    LOG(error) << "The fast field map is not active, the multi-threaded propagation would not be used";
+    return 1;
+  }
+
+  // collision vertices, followed by the mean vertex
+  module.mVertices.resize(nVertices + 1);
+  for (auto& vertex : module.mVertices) {
+    vertex.setPos({static_cast<float>(gRandom->Gaus(0., 0.05)), static_cast<float>(gRandom->Gaus(0., 0.05)), static_cast<float>(gRandom->Uniform(-10., 10.))});
+    vertex.setCov(1.e-4f, 0.f, 1.e-4f, 0.f, 0.f, 1.e-2f);
+  }
+
+  // tracks at the innermost layers, a fraction of them not propagated
+  std::vector<track::TrackParametrizationWithError<float>> inputTracks;
+  std::vector<int> vertexIds;
+  for (int iTrack = 0; iTrack < nTracks; iTrack++) {
+    const std::array<float, 5> params = {static_cast<float>(gRandom->Uniform(-1., 1.)), static_cast<float>(gRandom->Uniform(-10., 10.)), static_cast<float>(gRandom->Uniform(-0.5, 0.5)), static_cast<float>(gRandom->Uniform(-1., 1.)), static_cast<float>(gRandom->Uniform(-5., 5.))};
+    std::array<float, 15> cov{};
+    cov[0] = cov[2] = 1.e-3f;
+    cov[5] = cov[9] = 1.e-4f;
+    cov[14] = 1.e-2f;
+    inputTracks.emplace_back(gRandom->Uniform(2., 40.), gRandom->Uniform(-3.14, 3.14), params, cov);
+    const int vertexChoice = gRandom->Integer(nVertices + 2);
+    vertexIds.push_back(vertexChoice < nVertices ? vertexChoice : (vertexChoice == nVertices ? common::TrackPropagationModule::kMeanVertex : common::TrackPropagationModule::kNotPropagated));
+  }
+
+  int nDifferent = 0;
+  for (const bool withCov : {false, true}) {
+    module.fillTracksCov = withCov;
+    auto setInputs = [&]() {
+      module.mTrackParBuffer.assign(inputTracks.begin(), inputTracks.end());
+      module.mTrackParCovBuffer = inputTracks;
+      module.mDcaInfoBuffer.assign(nTracks, {999, 999});
+      module.mDcaInfoCovBuffer.assign(nTracks, dataformats::DCA(999, 999, 999, 999, 999));
+      module.mVertexIdBuffer = vertexIds;
+      module.mPropagationOKBuffer.assign(nTracks, 0);
+    };
+
+    setInputs();
+    module.propagateBuffers(1);
+    const auto trackParSerial = module.mTrackParBuffer;
+    const auto trackParCovSerial = module.mTrackParCovBuffer;
+    const auto dcaInfoSerial = module.mDcaInfoBuffer;
+    const auto dcaInfoCovSerial = module.mDcaInfoCovBuffer;
+    const auto propagationOKSerial = module.mPropagationOKBuffer;
+
+    setInputs();
+    module.propagateBuffers(nThreads);
+    int nPropagated = 0;
+    for (int iTrack = 0; iTrack < nTracks; iTrack++) {
+      nPropagated += propagationOKSerial[iTrack];
+      bool identical = module.mPropagationOKBuffer[iTrack] == propagationOKSerial[iTrack];
+      if (withCov) {
+        identical = identical && isIdentical(module.mTrackParCovBuffer[iTrack], trackParCovSerial[iTrack]) && isIdentical(module.mDcaInfoCovBuffer[iTrack], dcaInfoCovSerial[iTrack]);
+      } else {
+        identical = identical && isIdentical(module.mTrackParBuffer[iTrack], trackParSerial[iTrack]) && module.mDcaInfoBuffer[iTrack] == dcaInfoSerial[iTrack];
+      }
+      nDifferent += !identical;
+    }
+    LOG(info) << (withCov ? "with" : "without") << " covariance: " << nPropagated << " / " << nTracks << " tracks propagated";
+  }
+
+  if (nDifferent > 0) {
+    LOG(error) << nDifferent << " tracks differ between " << nThreads << " threads and 1 thread";
+    return 1;
+  }
+  LOG(info) << "Propagation with " << nThreads << " threads bit-identical to 1 thread for " << nTracks << " tracks";
+
+  // tables of the same tracks filled serially and in the two-phase mode: tracks at and beyond the minimum propagation radius,
+  // already propagated tracks and tracks without collision, propagated to the mean vertex, are included
+  MockCollisions collisions;
+  for (int iVertex = 0; iVertex < nVertices; iVertex++) {
+    const auto& vertex = module.mVertices[iVertex];
+    collisions.push_back({iVertex, {vertex.getX(), vertex.getY(), vertex.getZ()}, vertex.getCov()});
+  }
+  const MockMeanVertex meanVertex{{0.01f, -0.02f, 0.5f}, {0.005f, 0.005f, 3.f}};
+  const MockCCDBLoader ccdbLoader{0, &meanVertex};
+  std::vector<MockTrack> tracks;
+  for (int iTrack = 0; iTrack < nTracks; iTrack++) {
+    const int collisionChoice = gRandom->Integer(nVertices + 1);
+    tracks.push_back({inputTracks[iTrack], static_cast<uint8_t>(gRandom->Integer(8) > 0 ? aod::track::TrackIU : aod::track::Track), static_cast<uint32_t>(gRandom->Integer(track::PID::NIDs)), collisionChoice < nVertices ? collisionChoice : -1});
+  }
+  common::TrackPropagationModule moduleSerial;
+  moduleSerial.matCorr = module.matCorr;
+  moduleSerial.fillTracks = module.fillTracks = true;
+  TrackTuner trackTuner;
+  MockRegistry registry;
+  MockConfigurables cGroupSerial, cGroupThreads;
+  cGroupThreads.nThreads.value = nThreads;
+  size_t nDifferentValues = 0;
+  int nWrongPID = 0;
+  for (const bool withCov : {false, true}) {
+    for (const bool useTrkPid : {false, true}) {
+      moduleSerial.fillTracksCov = module.fillTracksCov = withCov;
+      moduleSerial.fillTracksDCA = module.fillTracksDCA = true;
+      moduleSerial.fillTracksDCACov = module.fillTracksDCACov = withCov;
+      cGroupSerial.useTrkPid.value = cGroupThreads.useTrkPid.value = useTrkPid;
+      MockCursors cursorsSerial, cursorsThreads;
+      moduleSerial.fillTrackTables<false>(cGroupSerial, trackTuner, ccdbLoader, collisions, tracks, cursorsSerial, registry);
+      module.fillTrackTables<false>(cGroupThreads, trackTuner, ccdbLoader, collisions, tracks, cursorsThreads, registry);
+      nDifferentValues += countDifferences(cursorsSerial, cursorsThreads);
+      // the PID is not written to the tables, check the buffered tracks
+      if (useTrkPid) {
+        for (int iTrack = 0; iTrack < nTracks; iTrack++) {
+          const auto pid = withCov ? module.mTrackParCovBuffer[iTrack].getPID() : module.mTrackParBuffer[iTrack].getPID();
+          nWrongPID += (pid.getID() != tracks[iTrack].pid);
+        }
+      }
+    }
+  }
+
+  if (nDifferentValues > 0 || nWrongPID > 0) {
+    LOG(error) << nDifferentValues << " table values differ between the two-phase mode with " << nThreads << " threads and the serial mode, " << nWrongPID << " tracks with a wrong PID";
+    return 1;
+  }
+  LOG(info) << "Tables of the two-phase mode with " << nThreads << " threads bit-identical to the serial mode for " << nTracks << " tracks";
+  return 0;
+}
@@ -0,0 +1,95 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// \file occupancyHelpers.h
+/// \brief Helpers of the occupancy table producer, shared with its checks
+///
+
+#ifndef COMMON_TOOLS_OCCUPANCYHELPERS_H_
+#define COMMON_TOOLS_OCCUPANCYHELPERS_H_
+
+#include <array>
+#include <tuple>
+#include <vector>
+
+namespace o2
+{
+namespace common
+{
+namespace occupancy
+{
+
+/// Median per bin of the estimator vectors, with the index of the vector(s) giving the median
+template <typename... Vecs>
+void getMedianOccVect(
+  std::vector<float>& medianVector,
+  std::vector<std::array<int, 2>>& medianPosVec,
+  const Vecs&... vectors)
+{
+  constexpr int n = sizeof...(Vecs);                         // Number of vectors
+  const int size = std::get<0>(std::tie(vectors...)).size(); // Size of the first vector
+
+  std::array<std::array<double, 2>, n> data; // first element is entry, second is index
+  for (int i = 0; i < size; i++) {
+    int iEntry = 0;
+
+    // Lambda to iterate over all vectors
+    auto collect = [&](const auto& vec) {
+      data[iEntry] = {vec[i], static_cast<double>(iEntry)};
+      iEntry++;
+    };
+    (collect(vectors), ...); // Unpack variadic arguments and apply lambda
+
+    // Sort the data, insertion sort on the stack as there are at most 10 entries
+    for (int j = 1; j < n; j++) {
+      const std::array<double, 2> entry = data[j];
+      int k = j - 1;
+      while (k >= 0 && entry[0] < data[k][0]) {
+        data[k + 1] = data[k];
+        k--;
+      }
+      data[k + 1] = entry;
+    }
+
+    double median;
+    int two = 2;
+    // Find the median
+    if (n % two == 0) {
+      median = (data[(n - 1) / 2][0] + data[(n - 1) / 2 + 1][0]) / 2;
+      medianPosVec[i][0] = static_cast<int>(data[(n - 1) / 2][1] + 0.001);
+      medianPosVec[i][1] = static_cast<int>(data[(n - 1) / 2 + 1][1] + 0.001);
+    } else {
+      median = data[n / 2][0];
+      medianPosVec[i][0] = static_cast<int>(data[n / 2][1] + 0.001);
+      medianPosVec[i][1] = -10; // For odd entries, only one value can be the median
+    }
+    medianVector[i] = median;
+  }
+}
+
+/// Add the contribution of a collision to the bins of one drift time starting from its own bin, wrapping around the time frame
+inline void addToDriftBins(std::vector<float>& occVec, const int& firstBin, const int& nDriftBins, const float& value)
+{
+  const int nBins = occVec.size();
+  int bin = firstBin % nBins;
+  for (int deltaBin = 0; deltaBin < nDriftBins; deltaBin++) {
+    occVec[bin] += value;
+    if (++bin == nBins) {
+      bin = 0;
+    }
+  }
+}
+
+} // namespace occupancy
+} // namespace common
+} // namespace o2
+
+#endif // COMMON_TOOLS_OCCUPANCYHELPERS_H_
@@ -28,6 +28,7 @@
 #include <array>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <map>
 #include <numeric>
 #include <string>
@@ -212,11 +213,11 @@ class CloseTrackRejection
 
     mDeta = track1.eta() - track2.eta();
 
+    const auto& phistar1 = getPhistar(mPhistarCache1, track1, mChargeAbsTrack1);
+    const auto& phistar2 = getPhistar(mPhistarCache2, track2, mChargeAbsTrack2);
     for (size_t i = 0; i < TpcRadii.size(); i++) {
-      auto phistar1 = utils::dphistar(mMagField, TpcRadii[i], mChargeAbsTrack1 * track1.signedPt(), track1.phi());
-      auto phistar2 = utils::dphistar(mMagField, TpcRadii[i], mChargeAbsTrack2 * track2.signedPt(), track2.phi());
-      if (phistar1 && phistar2) {
-        mDphistar.at(i) = RecoDecay::constrainAngle(phistar1.value() - phistar2.value(), -o2::constants::math::PI); // constrain angular difference between -pi and pi
+      if (phistar1.mask[i] && phistar2.mask[i]) {
+        mDphistar.at(i) = RecoDecay::constrainAngle(phistar1.phistar[i] - phistar2.phistar[i], -o2::constants::math::PI); // constrain angular difference between -pi and pi
         mDphistarMask.at(i) = true;
         count++;
       }
@@ -308,6 +309,43 @@ class CloseTrackRejection
   bool isActivated() const { return mIsActivated; }
 
  private:
+  // phistar of a track at all tpc radii, kept since the same tracks enter many pairs in same and mixed events
+  struct PhistarCacheEntry {
+    int64_t index = -1;
+    float signedPt = 0.f;
+    float phi = 0.f;
+    float magField = 0.f;
+    std::array<float, Nradii> phistar = {0.f};
+    std::array<bool, Nradii> mask = {false};
+  };
+  static constexpr size_t PhistarCacheSize = 2048; // direct-mapped on the track index
+
+  template <typename T>
+  const PhistarCacheEntry& getPhistar(std::vector<PhistarCacheEntry>& cache, T const& track, int chargeAbs)
+  {
+    if (cache.empty()) {
+      cache.resize(PhistarCacheSize);
+    }
+    const int64_t index = track.globalIndex();
+    const float signedPt = chargeAbs * track.signedPt();
+    const float phi = track.phi();
+    auto& entry = cache[static_cast<uint64_t>(index) % cache.size()];
+    // the cached values are only used if all inputs agree, so results are identical to a direct computation
+    if (entry.index == index && entry.signedPt == signedPt && entry.phi == phi && entry.magField == mMagField) {
+      return entry;
+    }
+    entry.index = index;
+    entry.signedPt = signedPt;
+    entry.phi = phi;
+    entry.magField = mMagField;
+    for (size_t i = 0; i < TpcRadii.size(); i++) {
+      auto phistar = utils::dphistar(mMagField, TpcRadii[i], signedPt, phi);
+      entry.mask[i] = phistar.has_value();
+      entry.phistar[i] = phistar.value_or(0.f);
+    }
+    return entry;
+  }
+
   o2::framework::HistogramRegistry* mHistogramRegistry = nullptr;
   bool mPlotAllRadii = false;
   bool mPlotAverage = false;
@@ -332,6 +370,9 @@ class CloseTrackRejection
   float mDeta = 0.f;
   std::array<float, Nradii> mDphistar = {0.f};
   std::array<bool, Nradii> mDphistarMask = {false};
+
+  std::vector<PhistarCacheEntry> mPhistarCache1;
+  std::vector<PhistarCacheEntry> mPhistarCache2;
 };
 
 template <const char* prefix>
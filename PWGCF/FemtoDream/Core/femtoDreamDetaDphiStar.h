@@ -20,6 +20,8 @@
 
 #include "Framework/HistogramRegistry.h"
 
+#include <array>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
@@ -60,6 +62,7 @@ class FemtoDreamDetaDphiStar
     upperQ3LimitForPlotting = Q3Limit;
     isMixedEventLambda = isMELambda;
     runOldVersion = oldversion;
+    phiStarCache.assign(kPhiStarCacheSize, PhiStarCacheEntry{});
     mHistogramRegistry = registry;
     mHistogramRegistryQA = registryQA;
     atWhichRadiiToSelect = atWhichRadiiToCut;
@@ -727,6 +730,19 @@ class FemtoDreamDetaDphiStar
   // possiboility to run old code is turned on so a proper comparison of both code versions can be done
   bool runOldVersion = true;
 
+  /// phi* of a particle at the radii in tmpRadiiTPC, kept between pairs since the same particles enter
+  /// many pairs of an event and of the mixing pools
+  struct PhiStarCacheEntry {
+    int64_t index = -1;
+    int charge = 0;
+    float phi0 = 0.f;
+    float pt = 0.f;
+    float magfield = 0.f;
+    std::array<float, 9> phiStar{};
+  };
+  static constexpr size_t kPhiStarCacheSize = 4096; ///< direct-mapped on the particle index
+  std::vector<PhiStarCacheEntry> phiStarCache = std::vector<PhiStarCacheEntry>(kPhiStarCacheSize);
+
   std::array<std::array<std::shared_ptr<TH2>, 4>, 3> histdetadpi{};
   std::array<std::array<std::shared_ptr<TH2>, 9>, 3> histdetadpiRadii{};
   std::array<std::shared_ptr<THnSparse>, 3> histdetadpi_eta{};
@@ -734,8 +750,9 @@ class FemtoDreamDetaDphiStar
 
   ///  Calculate phi at all required radii stored in tmpRadiiTPC
   /// Magnetic field to be provided in Tesla
+  /// The result is cached per particle and reused as long as index, charge, phi, pt and magnetic field match
   template <typename T>
-  int PhiAtRadiiTPC(const T& part, std::vector<float>& tmpVec)
+  int PhiAtRadiiTPC(const T& part, std::array<float, 9>& tmpVec)
   {
 
     float phi0 = part.phi();
@@ -752,20 +769,27 @@ class FemtoDreamDetaDphiStar
     }
     // End: Get the charge from cutcontainer using masks
     float pt = part.pt();
+    const int64_t index = part.globalIndex();
+    auto& cached = phiStarCache[static_cast<uint64_t>(index) % phiStarCache.size()];
+    if (cached.index == index && cached.charge == charge && cached.phi0 == phi0 && cached.pt == pt && cached.magfield == magfield) {
+      tmpVec = cached.phiStar;
+      return charge;
+    }
     for (size_t i = 0; i < 9; i++) {
       if (runOldVersion) {
-        tmpVec.push_back(phi0 - std::asin(0.3 * charge * 0.1 * magfield * tmpRadiiTPC[i] * 0.01 / (2. * pt)));
+        tmpVec[i] = phi0 - std::asin(0.3 * charge * 0.1 * magfield * tmpRadiiTPC[i] * 0.01 / (2. * pt));
       }
       if (!runOldVersion) {
         auto arg = 0.3 * charge * magfield * tmpRadiiTPC[i] * 0.01 / (2. * pt);
         // for very low pT particles, this value goes outside of range -1 to 1 at at large tpc radius; asin fails
         if (std::fabs(arg) < 1) {
-          tmpVec.push_back(phi0 - std::asin(0.3 * charge * magfield * tmpRadiiTPC[i] * 0.01 / (2. * pt)));
+          tmpVec[i] = phi0 - std::asin(0.3 * charge * magfield * tmpRadiiTPC[i] * 0.01 / (2. * pt));
         } else {
-          tmpVec.push_back(999);
+          tmpVec[i] = 999;
         }
       }
     }
+    cached = {index, charge, phi0, pt, magfield, tmpVec};
     return charge;
   }
 
@@ -830,7 +854,7 @@ class FemtoDreamDetaDphiStar
   }
 
   template <typename T>
-  int PhiAtRadiiTPCForHF(const T& part, std::vector<float>& tmpVec, int prong)
+  int PhiAtRadiiTPCForHF(const T& part, std::array<float, 9>& tmpVec, int prong)
   {
     int charge = 0;
     float pt = -999.;
@@ -857,15 +881,15 @@ class FemtoDreamDetaDphiStar
     }
     for (size_t i = 0; i < 9; i++) {
       if (runOldVersion) {
-        tmpVec.push_back(phi0 - std::asin(0.3 * charge * 0.1 * magfield * tmpRadiiTPC[i] * 0.01 / (2. * pt)));
+        tmpVec[i] = phi0 - std::asin(0.3 * charge * 0.1 * magfield * tmpRadiiTPC[i] * 0.01 / (2. * pt));
       }
       if (!runOldVersion) {
         auto arg = 0.3 * charge * magfield * tmpRadiiTPC[i] * 0.01 / (2. * pt);
         // for very low pT particles, this value goes outside of range -1 to 1 at at large tpc radius; asin fails
         if (std::fabs(arg) < 1) {
-          tmpVec.push_back(phi0 - std::asin(0.3 * charge * magfield * tmpRadiiTPC[i] * 0.01 / (2. * pt)));
+          tmpVec[i] = phi0 - std::asin(0.3 * charge * magfield * tmpRadiiTPC[i] * 0.01 / (2. * pt));
         } else {
-          tmpVec.push_back(999);
+          tmpVec[i] = 999;
         }
       }
     }
@@ -876,8 +900,8 @@ class FemtoDreamDetaDphiStar
   template <bool isHF = false, typename T1, typename T2>
   float AveragePhiStar(const T1& part1, const T2& part2, int iHist, bool* sameCharge)
   {
-    std::vector<float> tmpVec1;
-    std::vector<float> tmpVec2;
+    std::array<float, 9> tmpVec1;
+    std::array<float, 9> tmpVec2;
     auto charge1 = PhiAtRadiiTPC(part1, tmpVec1);
     if constexpr (!isHF) {
       auto charge2 = PhiAtRadiiTPC(part2, tmpVec2);
@@ -888,21 +912,24 @@ class FemtoDreamDetaDphiStar
       PhiAtRadiiTPCForHF(part2, tmpVec2, iHist);
       *sameCharge = true; // always true as we checked the condition in the HF task
     }
-    int num = tmpVec1.size();
+    constexpr int num = 9;
+    // phi differences at all radii first, without branches, then the sum in the original order
+    std::array<float, num> dphi;
     int meaningfulEntries = num;
+    for (int i = 0; i < num; i++) {
+      const bool valid = tmpVec1[i] != 999 && tmpVec2[i] != 999;
+      dphi[i] = valid ? tmpVec1[i] - tmpVec2[i] : 0.f;
+      meaningfulEntries -= !valid;
+    }
     float dPhiAvg = 0;
-    float dphi;
     for (int i = 0; i < num; i++) {
-      if (tmpVec1.at(i) != 999 && tmpVec2.at(i) != 999) {
-        dphi = tmpVec1.at(i) - tmpVec2.at(i);
-      } else {
-        dphi = 0;
-        meaningfulEntries = meaningfulEntries - 1;
-      }
-      dphi = TVector2::Phi_mpi_pi(dphi);
-      dPhiAvg += dphi;
-      if (plotForEveryRadii) {
-        histdetadpiRadii[iHist][i]->Fill(part1.eta() - part2.eta(), dphi);
+      dphi[i] = TVector2::Phi_mpi_pi(dphi[i]);
+      dPhiAvg += dphi[i];
+    }
+    if (plotForEveryRadii) {
+      const float deta = part1.eta() - part2.eta();
+      for (int i = 0; i < num; i++) {
+        histdetadpiRadii[iHist][i]->Fill(deta, dphi[i]);
       }
     }
     return dPhiAvg / static_cast<float>(meaningfulEntries);
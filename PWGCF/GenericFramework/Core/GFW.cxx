@@ -86,9 +86,8 @@ int GFW::CreateRegions()
   }
   int nRegions = 0;
   for (auto pItr = fRegions.begin(); pItr != fRegions.end(); pItr++) {
-    GFWCumulant* lCumulant = new GFWCumulant();
-    lCumulant->CreateComplexVectorArrayVarPower(pItr->Nhar, pItr->NparVec, pItr->NpT);
-    fCumulants.push_back(*lCumulant);
+    fCumulants.emplace_back();
+    fCumulants.back().CreateComplexVectorArrayVarPower(pItr->Nhar, pItr->NparVec, pItr->NpT);
     ++nRegions;
   }
   if (nRegions)
@@ -98,11 +97,34 @@ int GFW::CreateRegions()
 void GFW::Fill(double eta, int ptin, double phi, double weight, int mask, double SecondWeight)
 {
   // if(!fInitialized) return;
+  fCorrCacheValid = false;
   for (int i = 0; i < static_cast<int>(fRegions.size()); ++i) {
     if (fRegions.at(i).EtaMin < eta && fRegions.at(i).EtaMax > eta && (fRegions.at(i).BitMask & mask))
       fCumulants.at(i).FillArray(ptin, phi, weight, SecondWeight);
   }
 };
+void GFW::Fill(int nPart, const double* eta, const int* ptin, const double* phi, const double* weight, const int* mask, const double* secondWeight)
+{
+  fCorrCacheValid = false;
+  for (int i = 0; i < static_cast<int>(fRegions.size()); ++i) {
+    const Region& lReg = fRegions.at(i);
+    fBatchPt.clear();
+    fBatchPhi.clear();
+    fBatchWeight.clear();
+    fBatchSecondWeight.clear();
+    for (int j = 0; j < nPart; ++j) {
+      if (!(lReg.EtaMin < eta[j] && lReg.EtaMax > eta[j] && (lReg.BitMask & mask[j])))
+        continue;
+      fBatchPt.push_back(ptin ? ptin[j] : 0);
+      fBatchPhi.push_back(phi[j]);
+      fBatchWeight.push_back(weight[j]);
+      fBatchSecondWeight.push_back(secondWeight ? secondWeight[j] : -1);
+    }
+    if (fBatchPhi.empty())
+      continue;
+    fCumulants.at(i).FillArrays(static_cast<int>(fBatchPhi.size()), fBatchPt.data(), fBatchPhi.data(), fBatchWeight.data(), fBatchSecondWeight.data());
+  }
+};
 complex<double> GFW::TwoRec(int n1, int n2, int p1, int p2, int ptbin, GFWCumulant* r1, GFWCumulant* r2, GFWCumulant* r3)
 {
   complex<double> part1 = r1->Vec(n1, p1, ptbin);
@@ -128,6 +150,17 @@ complex<double> GFW::RecursiveCorr(GFWCumulant* qpoi, GFWCumulant* qref, GFWCumu
     return qpoi->Vec(hars.at(0), pows.at(0), ptbin);
   if (hars.size() < 3)
     return TwoRec(hars.at(0), hars.at(1), pows.at(0), pows.at(1), ptbin, qpoi, qref, qol);
+  // Higher-order terms are shared between configurations (e.g. c{4} and c{6} over the same regions), so compute them once per event
+  if (fUseCorrCache) {
+    if (!fCorrCacheValid) {
+      fCorrCache.clear();
+      fCorrCacheValid = true;
+    }
+    FillCorrKey(qpoi, qref, qol, ptbin, hars, pows);
+    auto cached = fCorrCache.find(fCorrKey);
+    if (cached != fCorrCache.end())
+      return cached->second;
+  }
   int harlast = hars.at(hars.size() - 1);
   int powlast = pows.at(pows.size() - 1);
   hars.erase(hars.end() - 1);
@@ -157,12 +190,25 @@ complex<double> GFW::RecursiveCorr(GFWCumulant* qpoi, GFWCumulant* qref, GFWCumu
   }
   hars.push_back(harlast);
   pows.push_back(powlast);
+  if (fUseCorrCache) {
+    // the recursion above overwrote the key buffer; only a missing term allocates a key in the map
+    FillCorrKey(qpoi, qref, qol, ptbin, hars, pows);
+    fCorrCache.emplace(fCorrKey, formula);
+  }
   return formula;
 };
+void GFW::FillCorrKey(GFWCumulant* qpoi, GFWCumulant* qref, GFWCumulant* qol, int ptbin, const vector<int>& hars, const vector<int>& pows)
+{
+  fCorrKey.clear();
+  fCorrKey.insert(fCorrKey.end(), {CumulantIndex(qpoi), CumulantIndex(qref), CumulantIndex(qol), ptbin});
+  fCorrKey.insert(fCorrKey.end(), hars.begin(), hars.end());
+  fCorrKey.insert(fCorrKey.end(), pows.begin(), pows.end());
+};
 void GFW::Clear()
 {
   if (!fInitialized)
     CreateRegions();
+  fCorrCacheValid = false;
   for (auto ptr = fCumulants.begin(); ptr != fCumulants.end(); ++ptr)
     ptr->ResetQs();
 };
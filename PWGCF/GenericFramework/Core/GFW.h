@@ -23,6 +23,7 @@
 #include <complex>
 #include <cstdio>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -61,15 +62,40 @@ class GFW
   void AddRegion(std::string refName, int lNhar, int* lNparVec, double lEtaMin, double lEtaMax, int lNpT, int BitMask);  // Legacy support, array instead of a vector
   int CreateRegions();
   void Fill(double eta, int ptin, double phi, double weight, int mask, double secondWeight = -1);
+  // Batched fill of a whole event, see GFWCumulant::FillArrays. ptin and secondWeight can be nullptr
+  void Fill(int nPart, const double* eta, const int* ptin, const double* phi, const double* weight, const int* mask, const double* secondWeight = nullptr);
   void Clear();
   GFWCumulant GetCumulant(int index) { return fCumulants.at(index); }
   CorrConfig GetCorrelatorConfig(std::string config, std::string head = "", bool ptdif = false);
   std::complex<double> Calculate(CorrConfig corconf, int ptbin, bool SetHarmsToZero);
   void InitializePowerArrays();
+  void SetUseCorrelatorCache(bool use) { fUseCorrCache = use; }
 
  protected:
   bool fInitialized;
   std::vector<CorrConfig> fListOfCFGs;
+  // Scratch for the batched fill: particles selected for one region
+  std::vector<int> fBatchPt;              //!
+  std::vector<double> fBatchPhi;          //!
+  std::vector<double> fBatchWeight;       //!
+  std::vector<double> fBatchSecondWeight; //!
+  // Terms of the recursion (3 or more harmonics) already computed in the current event, shared by all correlator configurations.
+  // Key: {POI, ref., overlap region, pT bin, harmonics..., powers...}. Invalidated whenever the Q-vectors change.
+  struct CorrKeyHash {
+    std::size_t operator()(const std::vector<int>& key) const
+    {
+      std::size_t seed = key.size();
+      for (int val : key)
+        seed ^= std::hash<int>()(val) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+      return seed;
+    }
+  };
+  std::unordered_map<std::vector<int>, std::complex<double>, CorrKeyHash> fCorrCache; //!
+  bool fCorrCacheValid = false;                                                      //!
+  bool fUseCorrCache = true;                                                         //!
+  std::vector<int> fCorrKey;                                                         //! key buffer reused for the cache lookups
+  void FillCorrKey(GFWCumulant* qpoi, GFWCumulant* qref, GFWCumulant* qol, int ptbin, const std::vector<int>& hars, const std::vector<int>& pows);
+  int CumulantIndex(GFWCumulant* cumulant) { return cumulant ? static_cast<int>(cumulant - fCumulants.data()) : -1; }
   std::complex<double> TwoRec(int n1, int n2, int p1, int p2, int ptbin, GFWCumulant*, GFWCumulant*, GFWCumulant*);
   std::complex<double> RecursiveCorr(GFWCumulant* qpoi, GFWCumulant* qref, GFWCumulant* qol, int ptbin, std::vector<int>& hars, std::vector<int>& pows); // POI, Ref. flow, overlapping region
   std::complex<double> RecursiveCorr(GFWCumulant* qpoi, GFWCumulant* qref, GFWCumulant* qol, int ptbin, std::vector<int>& hars);                         // POI, Ref. flow, overlapping region
@@ -11,18 +11,21 @@
 
 #include "GFWCumulant.h"
 
+#include <algorithm>
 #include <vector>
 
 using std::complex;
 using std::vector;
 
-GFWCumulant::GFWCumulant() : fQvector(0),
+GFWCumulant::GFWCumulant() : fQvector(),
+                             fHarOffset(),
+                             fQStride(0),
                              fUsed(kBlank),
                              fNEntries(-1),
                              fN(1),
                              fPow(1),
                              fPt(1),
-                             fFilledPts(0),
+                             fFilledPts(),
                              fInitialized(false) {}
 
 GFWCumulant::~GFWCumulant() {}
@@ -35,6 +38,7 @@ void GFWCumulant::FillArray(int ptin, double phi, double weight, double SecondWe
   else if (ptin < 0 || ptin >= fPt)
     return;
   fFilledPts[ptin] = true;
+  std::complex<double>* lQ = &fQvector[QIndex(ptin, 0, 0)];
   for (int lN = 0; lN < fN; lN++) {
     double lSin = sin(lN * phi); // No need to recalculate for each power
     double lCos = cos(lN * phi); // No need to recalculate for each power
@@ -49,39 +53,68 @@ void GFWCumulant::FillArray(int ptin, double phi, double weight, double SecondWe
         lPrefactor = pow(weight, lPow);
       double qsin = lPrefactor * lSin;
       double qcos = lPrefactor * lCos;
-      fQvector[ptin][lN][lPow] += complex<double>(qcos, qsin);
+      lQ[fHarOffset[lN] + lPow] += complex<double>(qcos, qsin);
     }
   }
   Inc();
 };
-void GFWCumulant::ResetQs()
+void GFWCumulant::FillArrays(int nPart, const int* ptin, const double* phi, const double* weight, const double* secondWeight)
 {
-  if (!fNEntries)
-    return; // If 0 entries, then no need to reset. Otherwise, if -1, then just initialized and need to set to 0.
-  for (int i = 0; i < fPt; i++) {
-    fFilledPts[i] = false;
+  if (!fInitialized)
+    CreateComplexVectorArray(1, 1, 1);
+  int lMaxPow = 1;
+  for (int lN = 0; lN < fN; lN++)
+    lMaxPow = std::max(lMaxPow, PW(lN));
+  fCosN.resize(std::max(fN, 2));
+  fSinN.resize(std::max(fN, 2));
+  fPrefac.resize(std::max(lMaxPow, 2));
+  for (int i = 0; i < nPart; i++) {
+    int lPt = ptin ? ptin[i] : 0;
+    if (fPt == 1)
+      lPt = 0; // Same as in FillArray()
+    else if (lPt < 0 || lPt >= fPt)
+      continue;
+    fFilledPts[lPt] = true;
+    // Harmonics: cos((n+1)x) = 2cos(x)cos(nx) - cos((n-1)x), and the same for sin
+    double lCos1 = cos(phi[i]);
+    fCosN[0] = 1.;
+    fSinN[0] = 0.;
+    fCosN[1] = lCos1;
+    fSinN[1] = sin(phi[i]);
+    for (int lN = 2; lN < fN; lN++) {
+      fCosN[lN] = 2. * lCos1 * fCosN[lN - 1] - fCosN[lN - 2];
+      fSinN[lN] = 2. * lCos1 * fSinN[lN - 1] - fSinN[lN - 2];
+    }
+    // Weight powers, with the same convention for the second weight as in FillArray()
+    double lSecondWeight = secondWeight ? secondWeight[i] : -1;
+    fPrefac[0] = 1.;
+    fPrefac[1] = weight[i];
+    for (int lPow = 2; lPow < lMaxPow; lPow++)
+      fPrefac[lPow] = fPrefac[lPow - 1] * (lSecondWeight > 0 ? lSecondWeight : weight[i]);
+    std::complex<double>* lQ = &fQvector[QIndex(lPt, 0, 0)];
     for (int lN = 0; lN < fN; lN++) {
-      for (int lPow = 0; lPow < PW(lN); lPow++) {
-        fQvector[i][lN][lPow] = fNullQ;
-      }
+      std::complex<double>* lQN = lQ + fHarOffset[lN];
+      for (int lPow = 0; lPow < PW(lN); lPow++)
+        lQN[lPow] += complex<double>(fPrefac[lPow] * fCosN[lN], fPrefac[lPow] * fSinN[lN]);
     }
+    Inc();
   }
+};
+void GFWCumulant::ResetQs()
+{
+  if (!fNEntries)
+    return; // If 0 entries, then no need to reset. Otherwise, if -1, then just initialized and need to set to 0.
+  std::fill(fFilledPts.begin(), fFilledPts.end(), false);
+  std::fill(fQvector.begin(), fQvector.end(), fNullQ);
   fNEntries = 0;
 };
 void GFWCumulant::DestroyComplexVectorArray()
 {
   if (!fInitialized)
     return;
-  for (int l_n = 0; l_n < fN; l_n++) {
-    for (int i = 0; i < fPt; i++) {
-      delete[] fQvector[i][l_n];
-    }
-  }
-  for (int i = 0; i < fPt; i++) {
-    delete[] fQvector[i];
-  }
-  delete[] fQvector;
-  delete[] fFilledPts;
+  fQvector.clear();
+  fHarOffset.clear();
+  fFilledPts.clear();
   fInitialized = false;
   fNEntries = -1;
 };
@@ -100,17 +133,15 @@ void GFWCumulant::CreateComplexVectorArrayVarPower(int N, vector<int> PowVec, in
   fN = N;
   fPow = 0;
   fPt = Pt;
-  fFilledPts = new bool[Pt];
+  fFilledPts.assign(Pt, false);
   fPowVec = PowVec;
-  fQvector = new complex<double>**[fPt];
-  for (int i = 0; i < fPt; i++) {
-    fQvector[i] = new complex<double>*[fN];
-  }
+  fHarOffset.assign(fN, 0);
+  fQStride = 0;
   for (int l_n = 0; l_n < fN; l_n++) {
-    for (int i = 0; i < fPt; i++) {
-      fQvector[i][l_n] = new complex<double>[PW(l_n)];
-    }
+    fHarOffset[l_n] = fQStride;
+    fQStride += PW(l_n);
   }
+  fQvector.assign(fPt * fQStride, fNullQ);
   ResetQs();
   fInitialized = true;
 };
@@ -121,12 +152,12 @@ complex<double> GFWCumulant::Vec(int n, int p, int ptbin)
   if (ptbin >= fPt || ptbin < 0)
     ptbin = 0;
   if (n >= 0)
-    return fQvector[ptbin][n][p];
-  return conj(fQvector[ptbin][-n][p]);
+    return fQvector[QIndex(ptbin, n, p)];
+  return conj(fQvector[QIndex(ptbin, -n, p)]);
 };
 bool GFWCumulant::IsPtBinFilled(int ptb)
 {
-  if (!fFilledPts)
+  if (fFilledPts.empty())
     return false;
   if (ptb > 0) {
     if (fPt == 1)
@@ -27,6 +27,11 @@ class GFWCumulant
   ~GFWCumulant();
   void ResetQs();
   void FillArray(int ptin, double phi, double weight = 1, double SecondWeight = -1);
+  // Batched fill for a whole event. Harmonics are obtained with the Chebyshev recurrence from cos(phi) and sin(phi),
+  // and powers of weights by successive multiplications, instead of calling sin/cos/pow for every harmonic and power.
+  // Q-vectors agree with FillArray() within rounding: the relative deviation grows linearly with the harmonic, ~1e-15 * n
+  // ptin and secondWeight can be nullptr (all particles in bin 0, no second weight)
+  void FillArrays(int nPart, const int* ptin, const double* phi, const double* weight, const double* secondWeight = nullptr);
   enum UsedFlags_t { kBlank = 0,
                      kFull = 1,
                      kPt = 2 };
@@ -44,7 +49,9 @@ class GFWCumulant
   void DestroyComplexVectorArray();
   std::complex<double> Vec(int, int, int ptbin = 0); // envelope class to summarize pt-dif. Q-vec getter
  protected:
-  std::complex<double>*** fQvector;
+  std::vector<std::complex<double>> fQvector; // Q-vectors stored contiguously as [pT bin][harmonic][power]
+  std::vector<int> fHarOffset;               //! Offset of each harmonic within one pT bin
+  int fQStride;                              //! Number of Q-vectors per pT bin
   uint fUsed;
   int fNEntries;
   // Q-vectors. Could be done recursively, but maybe defining each one of them explicitly is easier to read
@@ -52,9 +59,13 @@ class GFWCumulant
   int fPow;                 //! Power
   std::vector<int> fPowVec; //! Powers array
   int fPt;                  //! fPt bins
-  bool* fFilledPts;
+  std::vector<bool> fFilledPts;
   bool fInitialized; // Arrays are initialized
   std::complex<double> fNullQ = 0;
+  std::vector<double> fCosN;   //! Scratch for batched fill: cos(n*phi)
+  std::vector<double> fSinN;   //! Scratch for batched fill: sin(n*phi)
+  std::vector<double> fPrefac; //! Scratch for batched fill: weight powers
+  int QIndex(int ptbin, int n, int p) const { return ptbin * fQStride + fHarOffset[n] + p; }
 };
 
 #endif // PWGCF_GENERICFRAMEWORK_CORE_GFWCUMULANT_H_
@@ -41,7 +41,9 @@
 #include <THn.h>
 #include <TVector2.h>
 
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <experimental/type_traits>
 #include <memory>
 #include <string>
@@ -105,6 +107,7 @@ struct CorrelationTask {
   O2_DEFINE_CONFIGURABLE(cfgV0RapidityMax, float, 0.8, "Maximum rapidity for the decay particles (0 = no selection)")
   O2_DEFINE_CONFIGURABLE(cfgMassAxis, int, 0, "Use invariant mass axis (0 = OFF, 1 = ON)")
   O2_DEFINE_CONFIGURABLE(cfgMcTriggerPDGs, std::vector<int>, {}, "MC PDG codes to use exclusively as trigger particles and exclude from associated particles. Empty = no selection.")
+  O2_DEFINE_CONFIGURABLE(cfgBinnedPairKernel, int, 0, "Accumulate pairs per event in a binned buffer before filling the pair histogram (0 = OFF, 1 = ON). Not used with mass axis, pair cuts or 2-prong input. Bin errors are then computed from per-event sums")
 
   O2_DEFINE_CONFIGURABLE(cfgPtDepMLbkg, std::vector<float>, {}, "pT interval for ML training")
   O2_DEFINE_CONFIGURABLE(cfgPtCentDepMLbkgSel, std::vector<float>, {}, "Bkg ML selection")
@@ -146,6 +149,58 @@ struct CorrelationTask {
   std::vector<float> efficiencyAssociatedCache;
   std::vector<int> p2indexCache;
 
+  // binning of one pair histogram axis, following the TAxis::FindFixBin convention
+  struct AxisBinning {
+    std::vector<double> edges;
+    int nBins = 0;
+    bool uniform = false;
+
+    void init(const AxisSpec& spec)
+    {
+      uniform = spec.nBins.has_value();
+      if (uniform) {
+        nBins = *spec.nBins;
+        edges.resize(nBins + 1);
+        for (int i = 0; i <= nBins; i++) {
+          edges[i] = spec.binEdges[0] + (spec.binEdges[1] - spec.binEdges[0]) * i / nBins;
+        }
+      } else {
+        edges = spec.binEdges;
+        nBins = edges.size() - 1;
+      }
+    }
+
+    // 0-based bin, -1 for under- and overflow (which StepTHn does not store)
+    int find(double x) const
+    {
+      if (x < edges.front() || !(x < edges.back())) {
+        return -1;
+      }
+      if (uniform) {
+        return static_cast<int>(nBins * (x - edges.front()) / (edges.back() - edges.front()));
+      }
+      return std::upper_bound(edges.begin(), edges.end(), x) - edges.begin() - 1;
+    }
+
+    double center(int bin) const { return 0.5 * (edges[bin] + edges[bin + 1]); }
+  };
+
+  // Per-event pair accumulation for cfgBinnedPairKernel: the associated particles are kept in pT-sorted SoA arrays
+  // and the pairs are summed into a dense (pT,trig, pT,assoc, deta, dphi) buffer which is written once per event
+  struct BinnedPairKernel {
+    AxisBinning deltaEta, ptAssoc, ptTrigger, deltaPhi;
+    int cellsPerBlock = 0; // deta x dphi cells for one (pT,trig, pT,assoc) combination
+
+    std::vector<float> pt, eta, phi, weight;
+    std::vector<int> sign, ptBin;
+    std::vector<int64_t> index;
+    std::vector<int> order;
+
+    std::vector<float> pairDeltaEta, pairDeltaPhi;
+    std::vector<double> buffer;
+    std::vector<uint8_t> touched; // per (pT,trig, pT,assoc) block
+  } binnedPairs;
+
   std::unique_ptr<TFormula> multCutFormula;
   std::array<uint, 4> multCutFormulaParamIndex;
 
@@ -267,6 +322,16 @@ struct CorrelationTask {
     if (doprocessMixed2Prong2Prong || doprocessMixed2Prong2ProngML)
       userMixingAxis.emplace_back(axisInvMass, "m (GeV/c^2)");
 
+    if (cfgBinnedPairKernel) {
+      binnedPairs.deltaEta.init(corrAxis[0]);
+      binnedPairs.ptAssoc.init(corrAxis[1]);
+      binnedPairs.ptTrigger.init(corrAxis[2]);
+      binnedPairs.deltaPhi.init(corrAxis[4]);
+      binnedPairs.cellsPerBlock = binnedPairs.deltaEta.nBins * binnedPairs.deltaPhi.nBins;
+      binnedPairs.touched.assign(binnedPairs.ptTrigger.nBins * binnedPairs.ptAssoc.nBins, 0);
+      binnedPairs.buffer.assign(binnedPairs.touched.size() * binnedPairs.cellsPerBlock, 0.0);
+    }
+
     same.setObject(new CorrelationContainer("sameEvent", "sameEvent", corrAxis, effAxis, userAxis));
     mixed.setObject(new CorrelationContainer("mixedEvent", "mixedEvent", corrAxis, effAxis, userMixingAxis));
 
@@ -507,6 +572,179 @@ struct CorrelationTask {
     return {true, 0.5f * std::log((E + pz) / (E - pz))};
   }
 
+  // The binned pair kernel covers single-particle inputs only (no 2-prong daughters, decays or ML scores)
+  template <typename TTracks1, typename TTracks2>
+  static constexpr bool isBinnedPairCompatible()
+  {
+    using namespace std::experimental;
+    using T1 = typename TTracks1::iterator;
+    using T2 = typename TTracks2::iterator;
+    return !is_detected<HasDecay, T1>::value && !is_detected<HasDecay, T2>::value &&
+           !is_detected<HasProng0Id, T1>::value && !is_detected<HasProng1Id, T1>::value &&
+           !is_detected<HasProng0Id, T2>::value && !is_detected<HasProng1Id, T2>::value &&
+           !is_detected<HasPartDaugh0Id, T1>::value && !is_detected<HasPartDaugh1Id, T1>::value &&
+           !is_detected<HasMlProbD0, T1>::value && !is_detected<HasMlProbD0, T2>::value &&
+           !is_detected<HasInvMass, T1>::value && !is_detected<HasInvMass, T2>::value;
+  }
+
+  // applies the associated-only selections of fillCorrelations and stores the accepted particles sorted in pT
+  template <CorrelationContainer::CFStep step, typename TTracks2>
+  void prepareBinnedAssociated(TTracks2& tracks2)
+  {
+    auto& k = binnedPairs;
+    k.pt.clear();
+    k.eta.clear();
+    k.phi.clear();
+    k.weight.clear();
+    k.sign.clear();
+    k.ptBin.clear();
+    k.index.clear();
+
+    for (const auto& track2 : tracks2) {
+      if constexpr (std::experimental::is_detected<HasPDGCode, typename TTracks2::iterator>::value) {
+        if (!cfgMcTriggerPDGs->empty() && std::find(cfgMcTriggerPDGs->begin(), cfgMcTriggerPDGs->end(), track2.pdgCode()) != cfgMcTriggerPDGs->end())
+          continue;
+      }
+      if constexpr (step <= CorrelationContainer::kCFStepTracked) {
+        if (!checkObject<step>(track2)) {
+          continue;
+        }
+      }
+      int sign = 0;
+      if constexpr (std::experimental::is_detected<HasSign, typename TTracks2::iterator>::value) {
+        sign = track2.sign();
+        if (cfgAssociatedCharge != 0) {
+          if (cfgAssociatedCharge * sign < 0)
+            continue;
+        } else if (sign == 0) {
+          continue;
+        }
+      }
+      const int ptBin = k.ptAssoc.find(track2.pt());
+      if (ptBin < 0) {
+        continue; // not stored by the pair histogram
+      }
+      float weight = 1.0f;
+      if constexpr (step == CorrelationContainer::kCFStepCorrected) {
+        if (cfg.mEfficiencyAssociated) {
+          weight = efficiencyAssociatedCache[track2.filteredIndex()];
+        }
+      }
+      k.pt.push_back(track2.pt());
+      k.eta.push_back(track2.eta());
+      k.phi.push_back(track2.phi());
+      k.weight.push_back(weight);
+      k.sign.push_back(sign);
+      k.ptBin.push_back(ptBin);
+      k.index.push_back(track2.globalIndex());
+    }
+
+    // sort by pT so that the pT ordering of the pairs is a prefix of the arrays
+    const size_t n = k.pt.size();
+    k.order.resize(n);
+    for (size_t i = 0; i < n; i++) {
+      k.order[i] = i;
+    }
+    std::sort(k.order.begin(), k.order.end(), [&k](int a, int b) { return k.pt[a] < k.pt[b]; });
+    auto permute = [&k, n](auto& v) {
+      auto copy = v;
+      for (size_t i = 0; i < n; i++) {
+        v[i] = copy[k.order[i]];
+      }
+    };
+    permute(k.pt);
+    permute(k.eta);
+    permute(k.phi);
+    permute(k.weight);
+    permute(k.sign);
+    permute(k.ptBin);
+    permute(k.index);
+
+    k.pairDeltaEta.resize(n);
+    k.pairDeltaPhi.resize(n);
+  }
+
+  template <bool checkIdentity, typename TTrack>
+  void accumulateBinnedPairs(TTrack const& track1, float triggerWeight)
+  {
+    auto& k = binnedPairs;
+    const int ptTriggerBin = k.ptTrigger.find(track1.pt());
+    if (ptTriggerBin < 0) {
+      return;
+    }
+    const float pt1 = track1.pt();
+    const float eta1 = track1.eta();
+    const float phi1 = track1.phi();
+    int sign1 = 0;
+    if constexpr (std::experimental::is_detected<HasSign, TTrack>::value) {
+      sign1 = track1.sign();
+    }
+
+    size_t nAssoc = k.pt.size();
+    if (cfgPtOrder != 0) {
+      nAssoc = std::lower_bound(k.pt.begin(), k.pt.end(), pt1) - k.pt.begin();
+    }
+
+    // pair kinematics over contiguous arrays
+    const float* eta2 = k.eta.data();
+    const float* phi2 = k.phi.data();
+    float* deltaEta = k.pairDeltaEta.data();
+    float* deltaPhi = k.pairDeltaPhi.data();
+    for (size_t i = 0; i < nAssoc; i++) {
+      deltaEta[i] = eta1 - eta2[i];
+      deltaPhi[i] = RecoDecay::constrainAngle(phi1 - phi2[i], -o2::constants::math::PIHalf);
+    }
+
+    const int pairCharge = cfgPairCharge;
+    const int nPtAssoc = k.ptAssoc.nBins;
+    const int nDeltaPhi = k.deltaPhi.nBins;
+    double* buffer = k.buffer.data() + static_cast<size_t>(ptTriggerBin) * nPtAssoc * k.cellsPerBlock;
+    uint8_t* touched = k.touched.data() + ptTriggerBin * nPtAssoc;
+    for (size_t i = 0; i < nAssoc; i++) {
+      if constexpr (checkIdentity) {
+        if (k.index[i] == track1.globalIndex()) {
+          continue;
+        }
+      }
+      if (pairCharge != 0 && pairCharge * sign1 * k.sign[i] < 0) {
+        continue;
+      }
+      const int etaBin = k.deltaEta.find(deltaEta[i]);
+      const int phiBin = k.deltaPhi.find(deltaPhi[i]);
+      if (etaBin < 0 || phiBin < 0) {
+        continue;
+      }
+      const float associatedWeight = triggerWeight * k.weight[i];
+      buffer[static_cast<size_t>(k.ptBin[i]) * k.cellsPerBlock + etaBin * nDeltaPhi + phiBin] += associatedWeight;
+      touched[k.ptBin[i]] = 1;
+    }
+  }
+
+  template <CorrelationContainer::CFStep step, typename TTarget>
+  void flushBinnedPairs(TTarget target, float multiplicity, float posZ)
+  {
+    auto& k = binnedPairs;
+    const int nPtAssoc = k.ptAssoc.nBins;
+    const int nDeltaPhi = k.deltaPhi.nBins;
+    for (int ptTriggerBin = 0; ptTriggerBin < k.ptTrigger.nBins; ptTriggerBin++) {
+      for (int ptAssocBin = 0; ptAssocBin < nPtAssoc; ptAssocBin++) {
+        const int block = ptTriggerBin * nPtAssoc + ptAssocBin;
+        if (!k.touched[block]) {
+          continue;
+        }
+        k.touched[block] = 0;
+        double* cells = k.buffer.data() + static_cast<size_t>(block) * k.cellsPerBlock;
+        for (int cell = 0; cell < k.cellsPerBlock; cell++) {
+          if (cells[cell] == 0.0) {
+            continue;
+          }
+          target->getPairHist()->Fill(step, k.deltaEta.center(cell / nDeltaPhi), k.ptAssoc.center(ptAssocBin), k.ptTrigger.center(ptTriggerBin), multiplicity, k.deltaPhi.center(cell % nDeltaPhi), posZ, cells[cell]);
+          cells[cell] = 0.0;
+        }
+      }
+    }
+  }
+
   template <CorrelationContainer::CFStep step, typename TTarget, typename TTracks1, typename TTracks2>
   void fillCorrelations(TTarget target, TTracks1& tracks1, TTracks2& tracks2, float multiplicity, float posZ, int magField, float eventWeight)
   {
@@ -521,6 +759,14 @@ struct CorrelationTask {
       }
     }
 
+    bool useBinnedPairs = false;
+    if constexpr (isBinnedPairCompatible<TTracks1, TTracks2>()) {
+      useBinnedPairs = cfgBinnedPairKernel && !cfgMassAxis && !cfg.mPairCuts && cfgTwoTrackCut <= 0;
+      if (useBinnedPairs) {
+        prepareBinnedAssociated<step>(tracks2);
+      }
+    }
+
     for (const auto& track1 : tracks1) {
       // LOGF(info, "Track %f | %f | %f  %d %d", track1.eta(), track1.phi(), track1.pt(), track1.isGlobalTrack(), track1.isGlobalTrackSDD());
 
@@ -596,6 +842,13 @@ struct CorrelationTask {
         target->getTriggerHist()->Fill(step, track1.pt(), multiplicity, posZ, triggerWeight);
       }
 
+      if constexpr (isBinnedPairCompatible<TTracks1, TTracks2>()) {
+        if (useBinnedPairs) {
+          accumulateBinnedPairs<std::is_same<TTracks1, TTracks2>::value>(track1, triggerWeight);
+          continue;
+        }
+      }
+
       for (const auto& track2 : tracks2) {
         if constexpr (std::is_same<TTracks1, TTracks2>::value) {
           if (track1.globalIndex() == track2.globalIndex()) {
@@ -751,6 +1004,10 @@ struct CorrelationTask {
         }
       }
     }
+
+    if (useBinnedPairs) {
+      flushBinnedPairs<step>(target, multiplicity, posZ);
+    }
   }
 
   void loadEfficiency(uint64_t timestamp)
@@ -96,3 +96,39 @@ bool AnalysisCompositeCut::IsSelected(float* values)
     return false;
   }
 }
+
+//____________________________________________________________________________
+void AnalysisCompositeCut::IsSelectedBatch(float* const* values, int nCand, uint8_t* selected)
+{
+  //
+  // apply cuts on a block of candidates
+  //
+  if (fOptionUseAND) {
+    // the decisions of each cut are combined in place
+    for (auto& cut : fCutList) {
+      cut.IsSelectedBatch(values, nCand, selected);
+    }
+    for (auto& cut : fCompositeCutList) {
+      cut.IsSelectedBatch(values, nCand, selected);
+    }
+    return;
+  }
+
+  fBatchAnySelected.assign(nCand, 0);
+  auto applyOR = [&](AnalysisCut& cut) {
+    fBatchSelected.assign(selected, selected + nCand);
+    cut.IsSelectedBatch(values, nCand, fBatchSelected.data());
+    for (int i = 0; i < nCand; ++i) {
+      fBatchAnySelected[i] |= fBatchSelected[i];
+    }
+  };
+  for (auto& cut : fCutList) {
+    applyOR(cut);
+  }
+  for (auto& cut : fCompositeCutList) {
+    applyOR(cut);
+  }
+  for (int i = 0; i < nCand; ++i) {
+    selected[i] &= fBatchAnySelected[i];
+  }
+}
@@ -43,11 +43,14 @@ class AnalysisCompositeCut : public AnalysisCut
   int GetNCuts() const { return fCutList.size() + fCompositeCutList.size(); }
 
   bool IsSelected(float* values) override;
+  void IsSelectedBatch(float* const* values, int nCand, uint8_t* selected) override;
 
  protected:
   bool fOptionUseAND;                                  // true (default): apply AND on all cuts; false: use OR
   std::vector<AnalysisCut> fCutList;                   // list of cuts
   std::vector<AnalysisCompositeCut> fCompositeCutList; // list of composite cuts
+  std::vector<uint8_t> fBatchSelected;                 //! decisions of a single cut for a batch of candidates, used with OR
+  std::vector<uint8_t> fBatchAnySelected;              //! OR of the decisions for a batch of candidates
 
   ClassDef(AnalysisCompositeCut, 2);
 };
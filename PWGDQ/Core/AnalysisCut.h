@@ -18,6 +18,8 @@
 #define AnalysisCut_H
 
 #include <TF1.h>
+#include <algorithm>
+#include <cstdint>
 #include <vector>
 
 //_________________________________________________________________________
@@ -39,6 +41,13 @@ class AnalysisCut : public TNamed
               int dependentVar2 = -1, float depCut2Low = 0., float depCut2High = 0., bool depCut2Exclude = false);
 
   virtual bool IsSelected(float* values);
+  // NOTE: Batch evaluation on a structure-of-arrays block of nCand candidates: values[var] points to the nCand values of the variable var
+  // NOTE:   (only the variables in fgUsedVars need to be set). Candidates failing the cut get selected[i] = 0, the others are left untouched,
+  // NOTE:   such that the decisions are combined with AND with the input ones
+  virtual void IsSelectedBatch(float* const* values, int nCand, uint8_t* selected);
+  // Evaluate a list of cuts on a block of candidates: bit icut of filterMaps[i] is set if candidate i passes the icut-th cut
+  template <typename TCuts, typename TMap>
+  static void FillFilterMaps(TCuts& cuts, float* const* values, int nCand, TMap* filterMaps);
 
   static std::vector<int> fgUsedVars; //! vector of used variables
 
@@ -66,6 +75,8 @@ class AnalysisCut : public TNamed
 
  protected:
   std::vector<CutContainer> fCuts;
+  std::vector<float> fBatchLow;  //! lower cut limits evaluated from functions for a batch of candidates
+  std::vector<float> fBatchHigh; //! upper cut limits evaluated from functions for a batch of candidates
 
   ClassDef(AnalysisCut, 1);
 };
@@ -176,4 +187,74 @@ inline bool AnalysisCut::IsSelected(float* values)
   return true;
 }
 
+//____________________________________________________________________________
+inline void AnalysisCut::IsSelectedBatch(float* const* values, int nCand, uint8_t* selected)
+{
+  //
+  // apply the configured cuts on a block of candidates
+  //  The same logic as in IsSelected() is written in a branch-free way, such that the loops over candidates can be vectorized.
+  //  Cut limits given by functions are evaluated once per candidate in a separate loop, the constant limits are broadcasted.
+  //
+  for (const auto& cut : fCuts) {
+    const float* x = values[cut.fVar];
+    const float* dep = (cut.fDepVar != -1 ? values[cut.fDepVar] : nullptr);
+    const float* dep2 = (cut.fDepVar2 != -1 ? values[cut.fDepVar2] : nullptr);
+
+    // obtain the low and high cut values (either directly as a value or from a function)
+    const float* low = &cut.fLow;
+    const float* high = &cut.fHigh;
+    int lowStep = 0, highStep = 0;
+    if (cut.fFuncLow) {
+      fBatchLow.resize(nCand);
+      for (int i = 0; i < nCand; ++i) {
+        fBatchLow[i] = (selected[i] ? cut.fFuncLow->Eval(dep[i]) : 0.0f);
+      }
+      low = fBatchLow.data();
+      lowStep = 1;
+    }
+    if (cut.fFuncHigh) {
+      fBatchHigh.resize(nCand);
+      for (int i = 0; i < nCand; ++i) {
+        fBatchHigh[i] = (selected[i] ? cut.fFuncHigh->Eval(dep[i]) : 0.0f);
+      }
+      high = fBatchHigh.data();
+      highStep = 1;
+    }
+
+    for (int i = 0; i < nCand; ++i) {
+      // the cut is applied only if the dependent variables are in (or outside, if excluded) the requested ranges
+      bool applied = true;
+      if (dep) {
+        bool inRange = (dep[i] > cut.fDepLow && dep[i] <= cut.fDepHigh);
+        applied = (inRange != cut.fDepExclude);
+      }
+      if (dep2) {
+        bool inRange = (dep2[i] > cut.fDep2Low && dep2[i] <= cut.fDep2High);
+        applied = applied && (inRange != cut.fDep2Exclude);
+      }
+      bool inRange = (x[i] >= low[i * lowStep] && x[i] <= high[i * highStep]);
+      selected[i] &= static_cast<uint8_t>(!applied || (inRange != cut.fExclude));
+    }
+  }
+}
+
+//____________________________________________________________________________
+template <typename TCuts, typename TMap>
+void AnalysisCut::FillFilterMaps(TCuts& cuts, float* const* values, int nCand, TMap* filterMaps)
+{
+  //
+  // evaluate all the cuts on a block of candidates, one cut at a time
+  //
+  std::vector<uint8_t> selected(nCand);
+  int icut = 0;
+  for (auto& cut : cuts) {
+    std::fill(selected.begin(), selected.end(), 1);
+    cut.IsSelectedBatch(values, nCand, selected.data());
+    for (int i = 0; i < nCand; ++i) {
+      filterMaps[i] |= (static_cast<TMap>(selected[i]) << icut);
+    }
+    icut++;
+  }
+}
+
 #endif
@@ -20,15 +20,182 @@
 
 #include <RtypesCore.h>
 
+#include <functional>
 #include <iostream>
+#include <memory>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 using std::cout;
 using std::endl;
 
+namespace o2::aod::dqcuts
+{
+// registries of the predefined cuts, mapping each cut name to the function which configures it
+// NOTE: the registries are filled once, on the first request; the names generated with Form() are registered by running their loops
+using CompositeCutFactories = std::unordered_map<std::string, std::function<AnalysisCompositeCut*(AnalysisCompositeCut*)>>;
+using AnalysisCutFactories = std::unordered_map<std::string, std::function<AnalysisCut*(AnalysisCut*)>>;
+void RegisterCompositeCuts(CompositeCutFactories& factories);
+void RegisterAnalysisCuts(AnalysisCutFactories& factories);
+
+// builders of the predefined cuts, resolved by name in the registries
+// NOTE: these are called only once per cut name, the GetXXX() functions serve copies of the cached results
+AnalysisCompositeCut* BuildCompositeCut(const char* cutName);
+AnalysisCut* BuildAnalysisCut(const char* cutName);
+std::vector<AnalysisCut*> BuildCutsFromJSON(const char* json);
+} // namespace o2::aod::dqcuts
+
+namespace
+{
+AnalysisCut* CloneCut(const AnalysisCut* cut)
+{
+  // copy preserving the dynamic type, since composite cuts can be returned also as AnalysisCut*
+  if (cut->IsA() == AnalysisCompositeCut::Class()) {
+    return new AnalysisCompositeCut(*static_cast<const AnalysisCompositeCut*>(cut));
+  }
+  return new AnalysisCut(*cut);
+}
+
+const o2::aod::dqcuts::CompositeCutFactories& CompositeCutRegistry()
+{
+  static const o2::aod::dqcuts::CompositeCutFactories factories = [] {
+    o2::aod::dqcuts::CompositeCutFactories registered;
+    o2::aod::dqcuts::RegisterCompositeCuts(registered);
+    return registered;
+  }();
+  return factories;
+}
+
+const o2::aod::dqcuts::AnalysisCutFactories& AnalysisCutRegistry()
+{
+  static const o2::aod::dqcuts::AnalysisCutFactories factories = [] {
+    o2::aod::dqcuts::AnalysisCutFactories registered;
+    o2::aod::dqcuts::RegisterAnalysisCuts(registered);
+    return registered;
+  }();
+  return factories;
+}
+
+std::unordered_map<std::string, std::unique_ptr<AnalysisCompositeCut>> gCompositeCutsCache; // composite cuts already built, by name
+std::unordered_map<std::string, std::unique_ptr<AnalysisCut>> gAnalysisCutsCache;           // analysis cuts already built, by name
+std::unordered_map<std::string, std::vector<std::unique_ptr<AnalysisCut>>> gJSONCutsCache;  // cuts already parsed, by JSON string
+} // namespace
+
+//________________________________________________________________________________________________
 AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
+{
+  //
+  // get a predefined composite cut, which is built only on the first request
+  //  The caller takes ownership of the returned copy
+  //
+  // NOTE: the name is copied, since names passed from Form() are overwritten by the Form() calls made while building the cut
+  const std::string name = cutName;
+  auto cached = gCompositeCutsCache.find(name);
+  if (cached == gCompositeCutsCache.end()) {
+    AnalysisCompositeCut* cut = BuildCompositeCut(name.c_str());
+    if (cut == nullptr) {
+      return nullptr;
+    }
+    cached = gCompositeCutsCache.emplace(name, std::unique_ptr<AnalysisCompositeCut>(cut)).first;
+  }
+  return new AnalysisCompositeCut(*(cached->second));
+}
+
+//________________________________________________________________________________________________
+AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
+{
+  //
+  // get a predefined cut, which is built only on the first request
+  //  The caller takes ownership of the returned copy
+  //
+  // NOTE: the name is copied, since names passed from Form() are overwritten by the Form() calls made while building the cut
+  const std::string name = cutName;
+  auto cached = gAnalysisCutsCache.find(name);
+  if (cached == gAnalysisCutsCache.end()) {
+    AnalysisCut* cut = BuildAnalysisCut(name.c_str());
+    if (cut == nullptr) {
+      return nullptr;
+    }
+    cached = gAnalysisCutsCache.emplace(name, std::unique_ptr<AnalysisCut>(cut)).first;
+  }
+  return CloneCut(cached->second.get());
+}
+
+//________________________________________________________________________________________________
+std::vector<AnalysisCut*> o2::aod::dqcuts::GetCutsFromJSON(const char* json)
+{
+  //
+  // get the cuts defined in a json string, which is parsed only on the first request
+  //  The caller takes ownership of the returned copies
+  //
+  auto cached = gJSONCutsCache.find(json);
+  if (cached == gJSONCutsCache.end()) {
+    std::vector<std::unique_ptr<AnalysisCut>> parsedCuts;
+    for (auto* cut : BuildCutsFromJSON(json)) {
+      parsedCuts.emplace_back(cut);
+    }
+    cached = gJSONCutsCache.emplace(json, std::move(parsedCuts)).first;
+  }
+  std::vector<AnalysisCut*> cuts;
+  for (const auto& cut : cached->second) {
+    cuts.push_back(CloneCut(cut.get()));
+  }
+  return cuts;
+}
+
+//________________________________________________________________________________________________
+AnalysisCompositeCut* o2::aod::dqcuts::BuildCompositeCut(const char* cutName)
+{
+  //
+  // configure a new composite cut with the function registered for its name
+  //
+  auto factory = CompositeCutRegistry().find(cutName);
+  if (factory == CompositeCutRegistry().end()) {
+    LOGF(fatal, Form("Did not find cut %s. Returning nullptr", cutName));
+    return nullptr;
+  }
+  return factory->second(new AnalysisCompositeCut(cutName, cutName));
+}
+
+//________________________________________________________________________________________________
+AnalysisCut* o2::aod::dqcuts::BuildAnalysisCut(const char* cutName)
+{
+  //
+  // configure a new cut with the function registered for its name
+  //
+  auto factory = AnalysisCutRegistry().find(cutName);
+  if (factory == AnalysisCutRegistry().end()) {
+    LOGF(fatal, Form("Did not find cut %s", cutName));
+    return nullptr;
+  }
+  return factory->second(new AnalysisCut(cutName, cutName));
+}
+
+//________________________________________________________________________________________________
+std::vector<std::string> o2::aod::dqcuts::GetCutNames()
+{
+  //
+  // list the names of all the predefined cuts and of the json-defined cuts parsed so far
+  //
+  std::vector<std::string> names;
+  for (const auto& [name, factory] : AnalysisCutRegistry()) {
+    names.push_back(name);
+  }
+  for (const auto& [name, factory] : CompositeCutRegistry()) {
+    names.push_back(name);
+  }
+  for (const auto& [json, cuts] : gJSONCutsCache) {
+    for (const auto& cut : cuts) {
+      names.push_back(cut->GetName());
+    }
+  }
+  return names;
+}
+
+//________________________________________________________________________________________________
+void o2::aod::dqcuts::RegisterCompositeCuts(CompositeCutFactories& factories)
 {
   //
   // define composie cuts, typically combinations of all the ingredients needed for a full cut
@@ -36,28 +203,25 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
   // TODO: Agree on some conventions for the naming
   //       Think of possible customization of the predefined cuts via names
 
-  AnalysisCompositeCut* cut = new AnalysisCompositeCut(cutName, cutName);
-  std::string nameStr = cutName;
-
   // ///////////////////////////////////////////////
   //   These are the Cuts used in the CEFP Task   //
   //   to select tracks in the event selection    //
   //                                              //
   //    see CutsLubrary.h for the description     //
   // ///////////////////////////////////////////////
-  if (!nameStr.compare("Electron2022")) {
+  factories.emplace("Electron2022", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
     cut->AddCut(GetAnalysisCut("jpsi_TPCPID_debug5"));
     return cut;
-  }
-  if (!nameStr.compare("Electron2023")) {
+  });
+  factories.emplace("Electron2023", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
     cut->AddCut(GetAnalysisCut("jpsi_TPCPID_debug5_noCorr"));
     return cut;
-  }
-  if (!nameStr.compare("Electron2025_1")) {
+  });
+  factories.emplace("Electron2025_1", [](AnalysisCompositeCut* cut) {
     AnalysisCut* kineCut = new AnalysisCut("kineCut", "kine cut");
     kineCut->AddCut(VarManager::kP, 1.0, 1000.0);
     kineCut->AddCut(VarManager::kEta, -0.9, 0.9);
@@ -78,9 +242,9 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
     cut->AddCut(qualityCuts);
     cut->AddCut(pidCuts);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("Electron2025_2")) {
+  factories.emplace("Electron2025_2", [](AnalysisCompositeCut* cut) {
     AnalysisCut* kineCut = new AnalysisCut("kineCut", "kine cut");
     kineCut->AddCut(VarManager::kP, 1.0, 1000.0);
     kineCut->AddCut(VarManager::kEta, -0.9, 0.9);
@@ -101,9 +265,9 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
     cut->AddCut(qualityCuts);
     cut->AddCut(pidCuts);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("Electron2025_3")) {
+  factories.emplace("Electron2025_3", [](AnalysisCompositeCut* cut) {
     AnalysisCut* kineCut = new AnalysisCut("kineCut", "kine cut");
     kineCut->AddCut(VarManager::kP, 1.0, 1000.0);
     kineCut->AddCut(VarManager::kEta, -0.9, 0.9);
@@ -123,9 +287,9 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
     cut->AddCut(qualityCuts);
     cut->AddCut(pidCuts);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("Electron2025_4")) {
+  factories.emplace("Electron2025_4", [](AnalysisCompositeCut* cut) {
     AnalysisCut* kineCut = new AnalysisCut("kineCut", "kine cut");
     kineCut->AddCut(VarManager::kP, 1.0, 1000.0);
     kineCut->AddCut(VarManager::kEta, -0.9, 0.9);
@@ -146,9 +310,9 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
     cut->AddCut(qualityCuts);
     cut->AddCut(pidCuts);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("Electron2025_5")) {
+  factories.emplace("Electron2025_5", [](AnalysisCompositeCut* cut) {
     AnalysisCut* kineCut = new AnalysisCut("kineCut", "kine cut");
     kineCut->AddCut(VarManager::kP, 1.0, 1000.0);
     kineCut->AddCut(VarManager::kEta, -0.9, 0.9);
@@ -169,151 +333,151 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
     cut->AddCut(qualityCuts);
     cut->AddCut(pidCuts);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("LowMassElectron2023")) {
+  factories.emplace("LowMassElectron2023", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("lmeeStandardKine"));
     cut->AddCut(GetAnalysisCut("LooseGlobalTrackRun3"));
     cut->AddCut(GetAnalysisCut("lmee_pp_502TeV_TOFloose_pionrej"));
     return cut;
-  }
-  if (!nameStr.compare("MuonLow2022")) {
+  });
+  factories.emplace("MuonLow2022", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("muonLowPt2"));
     cut->AddCut(GetAnalysisCut("muonQualityCuts"));
     return cut;
-  }
-  if (!nameStr.compare("MuonHigh2022")) {
+  });
+  factories.emplace("MuonHigh2022", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("muonHighPt2"));
     cut->AddCut(GetAnalysisCut("muonQualityCuts"));
     return cut;
-  }
-  if (!nameStr.compare("MuonLow2023")) {
+  });
+  factories.emplace("MuonLow2023", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("muonLowPt2"));
     cut->AddCut(GetAnalysisCut("muonQualityCuts10SigmaPDCA"));
     cut->AddCut(GetAnalysisCut("MCHMID"));
     return cut;
-  }
-  if (!nameStr.compare("MuonHigh2023")) {
+  });
+  factories.emplace("MuonHigh2023", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("muonHighPt6"));
     cut->AddCut(GetAnalysisCut("muonQualityCuts"));
     cut->AddCut(GetAnalysisCut("MCHMID"));
     return cut;
-  }
-  if (!nameStr.compare("ElectronForEMu")) {
+  });
+  factories.emplace("ElectronForEMu", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiKineSkimmed"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug4"));
     cut->AddCut(GetAnalysisCut("electronPIDnsigmaLoose"));
     return cut;
-  }
-  if (!nameStr.compare("MuonForEMu")) {
+  });
+  factories.emplace("MuonForEMu", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("muonLowPt5"));
     cut->AddCut(GetAnalysisCut("muonQualityCuts"));
     cut->AddCut(GetAnalysisCut("MCHMID"));
     return cut;
-  }
+  });
   // ///////////////////////////////////////////////
   //           End of Cuts for CEFP               //
   // ///////////////////////////////////////////////
 
-  if (!nameStr.compare("jpsiO2MCdebugCuts")) {
+  factories.emplace("jpsiO2MCdebugCuts", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
     cut->AddCut(GetAnalysisCut("electronPID1"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsiBenchmarkCuts")) {
+  factories.emplace("jpsiBenchmarkCuts", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityBenchmark"));
     cut->AddCut(GetAnalysisCut("standardPrimaryTrack"));
     cut->AddCut(GetAnalysisCut("electronPIDnsigmaOpen"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsiO2MCdebugCuts2")) {
+  factories.emplace("jpsiO2MCdebugCuts2", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
     cut->AddCut(GetAnalysisCut("electronPIDnsigma"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsiO2MCdebugCuts2_Corr")) {
+  factories.emplace("jpsiO2MCdebugCuts2_Corr", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
     cut->AddCut(GetAnalysisCut("jpsi_TPCPID_debug2"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsiO2MCdebugCuts2_prefiltered1")) {
+  factories.emplace("jpsiO2MCdebugCuts2_prefiltered1", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
     cut->AddCut(GetAnalysisCut("electronPIDnsigma"));
     cut->AddCut(GetAnalysisCut("notDalitzLeg1"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsiO2MCdebugCuts3")) {
+  factories.emplace("jpsiO2MCdebugCuts3", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
     cut->AddCut(GetAnalysisCut("electronPIDnsigmaMedium"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsiO2MCdebugCuts4")) {
+  factories.emplace("jpsiO2MCdebugCuts4", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
     cut->AddCut(GetAnalysisCut("electronPIDnsigmaLoose"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("electronSelection1_ionut")) {
+  factories.emplace("electronSelection1_ionut", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
     cut->AddCut(GetAnalysisCut("dcaCut1_ionut"));
     cut->AddCut(GetAnalysisCut("electronPIDnsigmaMedium"));
     return cut;
-  }
-  if (!nameStr.compare("electronSelection1_ionut_withTOFPID")) {
+  });
+  factories.emplace("electronSelection1_ionut_withTOFPID", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
     cut->AddCut(GetAnalysisCut("dcaCut1_ionut"));
     cut->AddCut(GetAnalysisCut("electronPIDnsigmaMedium_withLargeTOFPID"));
     return cut;
-  }
-  if (!nameStr.compare("electronSelection1_idstoreh")) { // same as electronSelection1_ionut, but with kIsSPDAny -> kIsITSibAny
+  });
+  factories.emplace("electronSelection1_idstoreh", [](AnalysisCompositeCut* cut) { // same as electronSelection1_ionut, but with kIsSPDAny -> kIsITSibAny
     cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug4"));
     cut->AddCut(GetAnalysisCut("dcaCut1_ionut"));
     cut->AddCut(GetAnalysisCut("electronPIDnsigmaMedium"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("electronSelection1pos_ionut")) {
+  factories.emplace("electronSelection1pos_ionut", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("posTrack"));
     cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
     cut->AddCut(GetAnalysisCut("dcaCut1_ionut"));
     cut->AddCut(GetAnalysisCut("electronPIDnsigmaMedium"));
     return cut;
-  }
-  if (!nameStr.compare("electronSelection1neg_ionut")) {
+  });
+  factories.emplace("electronSelection1neg_ionut", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("negTrack"));
     cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
     cut->AddCut(GetAnalysisCut("dcaCut1_ionut"));
     cut->AddCut(GetAnalysisCut("electronPIDnsigmaMedium"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("electronSelection2_ionut")) {
+  factories.emplace("electronSelection2_ionut", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
     cut->AddCut(GetAnalysisCut("dcaCut1_ionut"));
     cut->AddCut(GetAnalysisCut("electronPIDnsigmaMedium"));
     cut->AddCut(GetAnalysisCut("insideTPCsector"));
     return cut;
-  }
-  if (!nameStr.compare("electronSelection2pos_ionut")) {
+  });
+  factories.emplace("electronSelection2pos_ionut", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("posTrack"));
     cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
@@ -321,8 +485,8 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
     cut->AddCut(GetAnalysisCut("electronPIDnsigmaMedium"));
     cut->AddCut(GetAnalysisCut("insideTPCsector"));
     return cut;
-  }
-  if (!nameStr.compare("electronSelection2neg_ionut")) {
+  });
+  factories.emplace("electronSelection2neg_ionut", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("negTrack"));
     cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
@@ -330,115 +494,115 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
     cut->AddCut(GetAnalysisCut("electronPIDnsigmaMedium"));
     cut->AddCut(GetAnalysisCut("insideTPCsector"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsiO2MCdebugCuts4_Corr")) {
+  factories.emplace("jpsiO2MCdebugCuts4_Corr", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
     cut->AddCut(GetAnalysisCut("jpsi_TPCPID_debug1"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsiO2MCdebugCuts5")) {
+  factories.emplace("jpsiO2MCdebugCuts5", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
     cut->AddCut(GetAnalysisCut("electronPIDnsigmaVeryLoose"));
 
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsiO2MCdebugCuts6")) {
+  factories.emplace("jpsiO2MCdebugCuts6", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
     cut->AddCut(GetAnalysisCut("electronPIDnsigmaVeryVeryLoose"));
 
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsiO2MCdebugCuts7")) {
+  factories.emplace("jpsiO2MCdebugCuts7", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
     cut->AddCut(GetAnalysisCut("electronPIDnsigmaOpen"));
 
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsiO2MCdebugCuts7_Corr")) {
+  factories.emplace("jpsiO2MCdebugCuts7_Corr", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
     cut->AddCut(GetAnalysisCut("jpsi_TPCPID_debug5"));
 
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsiO2MCdebugCuts7_noCorr")) {
+  factories.emplace("jpsiO2MCdebugCuts7_noCorr", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
     cut->AddCut(GetAnalysisCut("jpsi_TPCPID_debug5_noCorr"));
 
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsiO2MCdebugCuts7_Corr_2")) {
+  factories.emplace("jpsiO2MCdebugCuts7_Corr_2", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiStandardKine2"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
     cut->AddCut(GetAnalysisCut("jpsi_TPCPID_debug5"));
 
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsiO2MCdebugCuts7_Corr_3")) {
+  factories.emplace("jpsiO2MCdebugCuts7_Corr_3", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiStandardKine3"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
     cut->AddCut(GetAnalysisCut("jpsi_TPCPID_debug5"));
 
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsiO2MCdebugCuts8")) {
+  factories.emplace("jpsiO2MCdebugCuts8", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
     cut->AddCut(GetAnalysisCut("electronPID1shiftUp"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsiO2MCdebugCuts9")) {
+  factories.emplace("jpsiO2MCdebugCuts9", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
     cut->AddCut(GetAnalysisCut("electronPID1shiftDown"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsiO2MCdebugCuts10_Corr")) {
+  factories.emplace("jpsiO2MCdebugCuts10_Corr", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityTPCOnly")); // no cut on ITS clusters
     cut->AddCut(GetAnalysisCut("jpsi_TPCPID_debug2"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsiO2MCdebugCuts10_Corr_Amb")) {
+  factories.emplace("jpsiO2MCdebugCuts10_Corr_Amb", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityTPCOnly")); // no cut on ITS clusters
     cut->AddCut(GetAnalysisCut("jpsi_TPCPID_debug2"));
     cut->AddCut(GetAnalysisCut("ambiguousTrack")); // IsAmbiguous
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsiO2MCdebugCuts11_Corr")) {
+  factories.emplace("jpsiO2MCdebugCuts11_Corr", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug3")); // cut on 1 ITS cluster
     cut->AddCut(GetAnalysisCut("jpsi_TPCPID_debug2"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsiO2MCdebugCuts12")) {
+  factories.emplace("jpsiO2MCdebugCuts12", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityTPCOnly")); // no cut on ITS clusters
     cut->AddCut(GetAnalysisCut("electronPIDnsigmaVeryLoose"));     // with 3 sigma El TOF
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsiO2MCdebugCuts_Pdependent_Corr")) {
+  factories.emplace("jpsiO2MCdebugCuts_Pdependent_Corr", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiStandardKine4"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
     cut->AddCut(GetAnalysisCut("pidCut_lowP_Corr"));
@@ -448,9 +612,9 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
     pidCut_highP->AddCut(GetAnalysisCut("PionExclusion_highP_Corr"));
     cut->AddCut(pidCut_highP);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsiO2MCdebugCuts_Pdependent")) {
+  factories.emplace("jpsiO2MCdebugCuts_Pdependent", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiStandardKine4"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
     cut->AddCut(GetAnalysisCut("pidCut_lowP"));
@@ -460,8 +624,8 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
     pidCut_highP->AddCut(GetAnalysisCut("PionExclusion_highP"));
     cut->AddCut(pidCut_highP);
     return cut;
-  }
-  if (!nameStr.compare("jpsiO2MCdebugCuts_Pdependent2_Corr")) {
+  });
+  factories.emplace("jpsiO2MCdebugCuts_Pdependent2_Corr", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiStandardKine4"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
     cut->AddCut(GetAnalysisCut("pidCut_lowP_Corr"));
@@ -471,9 +635,9 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
     pidCut_highP->AddCut(GetAnalysisCut("PionExclusion_highP_Corr"));
     cut->AddCut(pidCut_highP);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsiO2MCdebugCuts_Pdependent2")) {
+  factories.emplace("jpsiO2MCdebugCuts_Pdependent2", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiStandardKine4"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
     cut->AddCut(GetAnalysisCut("pidCut_lowP"));
@@ -483,255 +647,255 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
     pidCut_highP->AddCut(GetAnalysisCut("PionExclusion_highP"));
     cut->AddCut(pidCut_highP);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("JpsiPWGSkimmedCuts1")) { // please do not remove or modify, this is used for the common Skimmed tree production, (Xiaozhi Bai)
+  factories.emplace("JpsiPWGSkimmedCuts1", [](AnalysisCompositeCut* cut) { // please do not remove or modify, this is used for the common Skimmed tree production, (Xiaozhi Bai)
     cut->AddCut(GetAnalysisCut("jpsiKineSkimmed"));
     cut->AddCut(GetAnalysisCut("electronTrackQualitySkimmed"));
     cut->AddCut(GetAnalysisCut("electronPIDLooseSkimmed"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("JpsiPWGSkimmedCuts1")) { // please do not remove or modify, this is used for the common Skimmed tree production, (Xiaozhi Bai)
+  factories.emplace("JpsiPWGSkimmedCuts1", [](AnalysisCompositeCut* cut) { // please do not remove or modify, this is used for the common Skimmed tree production, (Xiaozhi Bai)
     cut->AddCut(GetAnalysisCut("jpsiKineSkimmed"));
     cut->AddCut(GetAnalysisCut("electronTrackQualitySkimmed"));
     cut->AddCut(GetAnalysisCut("electronPIDLooseSkimmed"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("JpsiPWGSkimmedCuts2")) {
+  factories.emplace("JpsiPWGSkimmedCuts2", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiKineSkimmed"));
     cut->AddCut(GetAnalysisCut("electronTrackQualitySkimmed"));
     cut->AddCut(GetAnalysisCut("electronPIDLooseSkimmed2"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("JpsiPWGSkimmedCuts3")) {
+  factories.emplace("JpsiPWGSkimmedCuts3", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiKineSkimmed"));
     cut->AddCut(GetAnalysisCut("electronTrackQualitySkimmed2"));
     cut->AddCut(GetAnalysisCut("electronPIDLooseSkimmed2"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("JpsiPWGSkimmedCuts4")) {
+  factories.emplace("JpsiPWGSkimmedCuts4", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiKineSkimmed"));
     cut->AddCut(GetAnalysisCut("electronTrackQualitySkimmed2"));
     cut->AddCut(GetAnalysisCut("jpsi_TPCPID_debug9")); // loose cut
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("JpsiPWGSkimmedCuts5")) {
+  factories.emplace("JpsiPWGSkimmedCuts5", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("electronTrackQualitySkimmed3"));
     cut->AddCut(GetAnalysisCut("jpsi_TPCPID_debug8"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pidElectron_ionut")) {
+  factories.emplace("pidElectron_ionut", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pidcalib_ele"));
     cut->AddCut(GetAnalysisCut("jpsiStandardKine3"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pidElectron_ionut_posEta")) {
+  factories.emplace("pidElectron_ionut_posEta", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pidcalib_ele"));
     cut->AddCut(GetAnalysisCut("jpsiPIDcalibKine_posEta"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pidElectron_ionut_negEta")) {
+  factories.emplace("pidElectron_ionut_negEta", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pidcalib_ele"));
     cut->AddCut(GetAnalysisCut("jpsiPIDcalibKine_negEta"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pidPion_ionut")) {
+  factories.emplace("pidPion_ionut", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pidcalib_pion"));
     cut->AddCut(GetAnalysisCut("jpsiStandardKine3"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsiO2MCdebugCuts13_Corr")) {
+  factories.emplace("jpsiO2MCdebugCuts13_Corr", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityTPCOnly")); // no cut on ITS clusters
     cut->AddCut(GetAnalysisCut("jpsi_TPCPID_debug2"));
     cut->AddCut(GetAnalysisCut("standardPrimaryTrackDCA")); // with DCA cut
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsiO2MCdebugCuts14")) {
+  factories.emplace("jpsiO2MCdebugCuts14", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
     cut->AddCut(GetAnalysisCut("electronPIDnsigmaSkewed"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsiO2MCdebugCuts14andDCA")) {
+  factories.emplace("jpsiO2MCdebugCuts14andDCA", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
     cut->AddCut(GetAnalysisCut("electronPIDnsigmaSkewed"));
     cut->AddCut(GetAnalysisCut("PrimaryTrack_DCAz"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("emu_electronCuts")) {
+  factories.emplace("emu_electronCuts", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug4"));
     cut->AddCut(GetAnalysisCut("electronPIDnsigmaSkewed"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("emu_electronCuts_tof")) {
+  factories.emplace("emu_electronCuts_tof", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug4"));
     cut->AddCut(GetAnalysisCut("electronPIDnsigmaSkewed"));
     cut->AddCut(GetAnalysisCut("tof_electron_sigma_2"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("emu_electronCuts_tightTPC")) {
+  factories.emplace("emu_electronCuts_tightTPC", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug4"));
     cut->AddCut(GetAnalysisCut("electronPIDnsigmaSkewed_2"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("emu_electronCuts_tof_tightTPC")) {
+  factories.emplace("emu_electronCuts_tof_tightTPC", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug4"));
     cut->AddCut(GetAnalysisCut("electronPIDnsigmaSkewed_2"));
     cut->AddCut(GetAnalysisCut("tof_electron_sigma_2"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsiKineAndQuality")) {
+  factories.emplace("jpsiKineAndQuality", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQuality"));
     cut->AddCut(GetAnalysisCut("standardPrimaryTrack"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsiPID1")) {
+  factories.emplace("jpsiPID1", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiStandardKine")); // standard kine cuts usually are applied via Filter in the task
     cut->AddCut(GetAnalysisCut("electronStandardQuality"));
     cut->AddCut(GetAnalysisCut("standardPrimaryTrack"));
     cut->AddCut(GetAnalysisCut("electronPID1"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsiPID2")) {
+  factories.emplace("jpsiPID2", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQuality"));
     cut->AddCut(GetAnalysisCut("standardPrimaryTrack"));
     cut->AddCut(GetAnalysisCut("electronPID2"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsiPIDnsigma")) {
+  factories.emplace("jpsiPIDnsigma", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQuality"));
     cut->AddCut(GetAnalysisCut("standardPrimaryTrack"));
     cut->AddCut(GetAnalysisCut("electronPIDnsigma"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pionPIDCut1")) {
+  factories.emplace("pionPIDCut1", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pionQualityCut1"));
     cut->AddCut(GetAnalysisCut("pionPIDnsigma"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pionPIDCut2")) {
+  factories.emplace("pionPIDCut2", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pionQualityCut2"));
     cut->AddCut(GetAnalysisCut("pionPIDnsigma"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("PIDCalibElectron")) {
+  factories.emplace("PIDCalibElectron", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pidcalib_ele"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("PIDCalibPion")) {
+  factories.emplace("PIDCalibPion", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pidcalib_pion"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("PIDCalibKaon")) {
+  factories.emplace("PIDCalibKaon", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pidcalib_kaon"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("PIDCalibProton")) {
+  factories.emplace("PIDCalibProton", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pidcalib_proton"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("PIDCalib_basic")) {
+  factories.emplace("PIDCalib_basic", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pidbasic"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("PIDefficiency_wPID")) {
+  factories.emplace("PIDefficiency_wPID", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQuality"));
     cut->AddCut(GetAnalysisCut("standardPrimaryTrack"));
     cut->AddCut(GetAnalysisCut("pidcalib_ele"));
     cut->AddCut(GetAnalysisCut("jpsi_TPCPID_debug2"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("PIDefficiency_woPID")) {
+  factories.emplace("PIDefficiency_woPID", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQuality"));
     cut->AddCut(GetAnalysisCut("standardPrimaryTrack"));
     cut->AddCut(GetAnalysisCut("pidcalib_ele"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("highPtHadron")) {
+  factories.emplace("highPtHadron", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("highPtHadron"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("rho0Cuts")) {
+  factories.emplace("rho0Cuts", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("rho0Kine"));
     cut->AddCut(GetAnalysisCut("pionQuality"));
     cut->AddCut(GetAnalysisCut("pionPIDnsigma"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("rho0Kine")) {
+  factories.emplace("rho0Kine", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("rho0Kine"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("openEtaSel")) {
+  factories.emplace("openEtaSel", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("openEtaSel"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("hasTOF")) {
+  factories.emplace("hasTOF", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("hasTOF"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("singleGapTrackCuts1")) {
+  factories.emplace("singleGapTrackCuts1", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("muonLowPt"));
     cut->AddCut(GetAnalysisCut("SPDany"));
     cut->AddCut(GetAnalysisCut("openEtaSel"));
     cut->AddCut(GetAnalysisCut("pionQuality"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("singleGapTrackCuts2")) {
+  factories.emplace("singleGapTrackCuts2", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("muonLowPt3"));
     cut->AddCut(GetAnalysisCut("ITSiball"));
     cut->AddCut(GetAnalysisCut("openEtaSel"));
     cut->AddCut(GetAnalysisCut("pionQuality"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("singleGapTrackCuts3")) {
+  factories.emplace("singleGapTrackCuts3", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("PIDStandardKine2"));
     cut->AddCut(GetAnalysisCut("SPDany"));
 
@@ -746,9 +910,9 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
     cut_OR->AddCut(cut_tpcpid);
     cut->AddCut(cut_OR);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("singleGapTrackCuts4")) {
+  factories.emplace("singleGapTrackCuts4", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("PIDStandardKine2"));
     cut->AddCut(GetAnalysisCut("ITSibany"));
 
@@ -763,83 +927,83 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
     cut_OR->AddCut(cut_tpcpid);
     cut->AddCut(cut_OR);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("PIDCalib")) {
+  factories.emplace("PIDCalib", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("PIDStandardKine")); // standard kine cuts usually are applied via Filter in the task
     cut->AddCut(GetAnalysisCut("electronStandardQuality"));
     cut->AddCut(GetAnalysisCut("standardPrimaryTrack"));
     cut->AddCut(GetAnalysisCut("pidcalib_ele"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("NoPID")) {
+  factories.emplace("NoPID", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("PIDStandardKine2")); // standard kine cuts usually are applied via Filter in the task
     cut->AddCut(GetAnalysisCut("electronStandardQualityTPCOnly2"));
     cut->AddCut(GetAnalysisCut("dcaCut1_ionut"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("KineCutOnly")) {
+  factories.emplace("KineCutOnly", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("PIDStandardKine")); // standard kine cuts usually are applied via Filter in the task
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("KineCutOnly2")) {
+  factories.emplace("KineCutOnly2", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("PIDStandardKine2")); // standard kine cuts usually are applied via Filter in the task
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("KineCutOnly3")) {
+  factories.emplace("KineCutOnly3", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("PIDStandardKine3")); // standard kine cuts usually are applied via Filter in the task
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("kaonPID")) {
+  factories.emplace("kaonPID", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("PIDStandardKine")); // standard kine cuts usually are applied via Filter in the task
     cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
     cut->AddCut(GetAnalysisCut("kaonPIDnsigma"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("kaonPID2")) {
+  factories.emplace("kaonPID2", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("PIDStandardKine")); // standard kine cuts usually are applied via Filter in the task
     cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
     cut->AddCut(GetAnalysisCut("kaonPIDnsigma2"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("kaonPID3")) {
+  factories.emplace("kaonPID3", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("AssocKine")); // standard kine cuts usually are applied via Filter in the task
     cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
     cut->AddCut(GetAnalysisCut("kaonPID_TPCnTOF"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("kaonPID3_withDCA")) { // same as kaonPID3 but with cut on DCA and SPDAny->ITSAny
+  factories.emplace("kaonPID3_withDCA", [](AnalysisCompositeCut* cut) { // same as kaonPID3 but with cut on DCA and SPDAny->ITSAny
     cut->AddCut(GetAnalysisCut("AssocKine")); // standard kine cuts usually are applied via Filter in the task
     cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug4"));
     cut->AddCut(GetAnalysisCut("dcaCut1_ionut"));
     cut->AddCut(GetAnalysisCut("kaonPID_TPCnTOF"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("kaonPID4")) {
+  factories.emplace("kaonPID4", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("kaonPID_TPCnTOF"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("kaonPID5")) {
+  factories.emplace("kaonPID5", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("kaonPIDnsigma"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("kaonPID6")) {
+  factories.emplace("kaonPID6", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("kaonPIDnsigma700"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("kaonPIDTPCTOForTPC")) {
+  factories.emplace("kaonPIDTPCTOForTPC", [](AnalysisCompositeCut* cut) {
     AnalysisCompositeCut* cut_tpctof_nSigma = new AnalysisCompositeCut("pid_TPCTOFnSigma", "pid_TPCTOFnSigma", kTRUE);
     cut_tpctof_nSigma->AddCut(GetAnalysisCut("hasTOF"));
     cut_tpctof_nSigma->AddCut(GetAnalysisCut("kaonPID_TPCnTOF"));
@@ -853,9 +1017,9 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
     cut_pid_OR->AddCut(cut_tpc_nSigma);
     cut->AddCut(cut_pid_OR);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("kaonPIDTPCTOForTPC700")) {
+  factories.emplace("kaonPIDTPCTOForTPC700", [](AnalysisCompositeCut* cut) {
     AnalysisCompositeCut* cut_tpctof_nSigma = new AnalysisCompositeCut("pid_TPCTOFnSigma", "pid_TPCTOFnSigma", kTRUE);
     cut_tpctof_nSigma->AddCut(GetAnalysisCut("hasTOF"));
     cut_tpctof_nSigma->AddCut(GetAnalysisCut("kaonPID_TPCnTOF"));
@@ -869,45 +1033,45 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
     cut_pid_OR->AddCut(cut_tpc_nSigma);
     cut->AddCut(cut_pid_OR);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("kaonPosPID4")) {
+  factories.emplace("kaonPosPID4", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("kaonPID_TPCnTOF"));
     cut->AddCut(GetAnalysisCut("posTrack"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("kaonPosPID4Pt05")) {
+  factories.emplace("kaonPosPID4Pt05", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("kaonPID_TPCnTOF"));
     cut->AddCut(GetAnalysisCut("posTrack"));
     cut->AddCut(GetAnalysisCut("muonLowPt"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("kaonNegPID4")) {
+  factories.emplace("kaonNegPID4", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("kaonPID_TPCnTOF"));
     cut->AddCut(GetAnalysisCut("negTrack"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("kaonNegPID4Pt05")) {
+  factories.emplace("kaonNegPID4Pt05", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("kaonPID_TPCnTOF"));
     cut->AddCut(GetAnalysisCut("negTrack"));
     cut->AddCut(GetAnalysisCut("muonLowPt"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pionPID")) {
+  factories.emplace("pionPID", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pionPID_TPCnTOF"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pionPID2")) {
+  factories.emplace("pionPID2", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pionPIDnsigma"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pionPIDTPCTOForTPC")) {
+  factories.emplace("pionPIDTPCTOForTPC", [](AnalysisCompositeCut* cut) {
     AnalysisCompositeCut* cut_tpctof_nSigma = new AnalysisCompositeCut("pid_TPCTOFnSigma", "pid_TPCTOFnSigma", kTRUE);
     cut_tpctof_nSigma->AddCut(GetAnalysisCut("pionPID_TPCnTOF"));
 
@@ -919,519 +1083,519 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
     cut_pid_OR->AddCut(cut_tpc_nSigma);
     cut->AddCut(cut_pid_OR);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pionPosPID")) {
+  factories.emplace("pionPosPID", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pionPID_TPCnTOF"));
     cut->AddCut(GetAnalysisCut("posTrack"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pionPosPID2")) {
+  factories.emplace("pionPosPID2", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pionPIDnsigma"));
     cut->AddCut(GetAnalysisCut("posTrack"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pionNegPID")) {
+  factories.emplace("pionNegPID", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pionPID_TPCnTOF"));
     cut->AddCut(GetAnalysisCut("negTrack"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pionNegPID2")) {
+  factories.emplace("pionNegPID2", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pionPIDnsigma"));
     cut->AddCut(GetAnalysisCut("negTrack"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("protonPosPID")) {
+  factories.emplace("protonPosPID", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("protonPID_TPCnTOF"));
     cut->AddCut(GetAnalysisCut("posTrack"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("protonPosPIDPt05")) {
+  factories.emplace("protonPosPIDPt05", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("protonPID_TPCnTOF"));
     cut->AddCut(GetAnalysisCut("posTrack"));
     cut->AddCut(GetAnalysisCut("muonLowPt"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("protonNegPID")) {
+  factories.emplace("protonNegPID", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("protonPID_TPCnTOF"));
     cut->AddCut(GetAnalysisCut("negTrack"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("protonNegPIDPt05")) {
+  factories.emplace("protonNegPIDPt05", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("protonPID_TPCnTOF"));
     cut->AddCut(GetAnalysisCut("negTrack"));
     cut->AddCut(GetAnalysisCut("muonLowPt"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("protonPIDPV")) {
+  factories.emplace("protonPIDPV", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("protonPID_TPCnTOF2"));
     cut->AddCut(GetAnalysisCut("protonPVcut"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("protonPIDPV2")) {
+  factories.emplace("protonPIDPV2", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("protonPID_TPCnTOF2"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("PrimaryTrack_DCAz")) {
+  factories.emplace("PrimaryTrack_DCAz", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("PrimaryTrack_DCAz"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("posPrimaryTrack_DCAz")) {
+  factories.emplace("posPrimaryTrack_DCAz", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("PrimaryTrack_DCAz"));
     cut->AddCut(GetAnalysisCut("posTrack"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("negPrimaryTrack_DCAz")) {
+  factories.emplace("negPrimaryTrack_DCAz", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("PrimaryTrack_DCAz"));
     cut->AddCut(GetAnalysisCut("negTrack"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("posStandardPrimaryTrackDCA")) {
+  factories.emplace("posStandardPrimaryTrackDCA", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("standardPrimaryTrackDCA"));
     cut->AddCut(GetAnalysisCut("posTrack"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("negStandardPrimaryTrackDCA")) {
+  factories.emplace("negStandardPrimaryTrackDCA", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("standardPrimaryTrackDCA"));
     cut->AddCut(GetAnalysisCut("negTrack"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("posTrack")) {
+  factories.emplace("posTrack", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("posTrack"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("negTrack")) {
+  factories.emplace("negTrack", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("negTrack"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("posTrackKaonRej")) {
+  factories.emplace("posTrackKaonRej", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("posTrack"));
     cut->AddCut(GetAnalysisCut("kaonRejNsigma"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("negTrackKaonRej")) {
+  factories.emplace("negTrackKaonRej", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("negTrack"));
     cut->AddCut(GetAnalysisCut("kaonRejNsigma"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pTLow05")) {
+  factories.emplace("pTLow05", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("muonLowPt"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pTLow04")) {
+  factories.emplace("pTLow04", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pTLow04"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pTLow03")) {
+  factories.emplace("pTLow03", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pTLow03"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pTLow02")) {
+  factories.emplace("pTLow02", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pTLow02"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pTLow05DCAzHigh03")) {
+  factories.emplace("pTLow05DCAzHigh03", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("muonLowPt"));
     cut->AddCut(GetAnalysisCut("PrimaryTrack_DCAz"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pTLow04DCAzHigh03")) {
+  factories.emplace("pTLow04DCAzHigh03", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pTLow04"));
     cut->AddCut(GetAnalysisCut("PrimaryTrack_DCAz"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pTLow03DCAzHigh03")) {
+  factories.emplace("pTLow03DCAzHigh03", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pTLow03"));
     cut->AddCut(GetAnalysisCut("PrimaryTrack_DCAz"));
     return cut;
-  }
+  });
 
   // NOTE Below there are several TPC pid cuts used for studies of the Run3 TPC post PID calib.
-  if (!nameStr.compare("Jpsi_TPCPost_calib_debug1")) {
+  factories.emplace("Jpsi_TPCPost_calib_debug1", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsi_trackCut_debug"));
     cut->AddCut(GetAnalysisCut("jpsi_TPCPID_debug1"));
     return cut;
-  }
-  if (!nameStr.compare("Jpsi_TPCPost_calib_debug2")) {
+  });
+  factories.emplace("Jpsi_TPCPost_calib_debug2", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsi_trackCut_debug"));
     cut->AddCut(GetAnalysisCut("jpsi_TPCPID_debug2"));
     return cut;
-  }
-  if (!nameStr.compare("Jpsi_TPCPost_calib_noITSCuts_debug2")) {
+  });
+  factories.emplace("Jpsi_TPCPost_calib_noITSCuts_debug2", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsi_trackCut_noITSCuts_debug"));
     cut->AddCut(GetAnalysisCut("jpsi_TPCPID_debug2"));
     return cut;
-  }
-  if (!nameStr.compare("Jpsi_TPCPost_calib_debug3")) {
+  });
+  factories.emplace("Jpsi_TPCPost_calib_debug3", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsi_trackCut_debug"));
     cut->AddCut(GetAnalysisCut("jpsi_TPCPID_debug3"));
     return cut;
-  }
-  if (!nameStr.compare("Jpsi_TPCPost_calib_debug4")) {
+  });
+  factories.emplace("Jpsi_TPCPost_calib_debug4", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsi_trackCut_debug"));
     cut->AddCut(GetAnalysisCut("jpsi_TPCPID_debug4"));
     return cut;
-  }
-  if (!nameStr.compare("Jpsi_TPCPost_calib_noITSCuts_debug4")) {
+  });
+  factories.emplace("Jpsi_TPCPost_calib_noITSCuts_debug4", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsi_trackCut_noITSCuts_debug"));
     cut->AddCut(GetAnalysisCut("jpsi_TPCPID_debug4"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("Jpsi_TPCPost_calib_debug6")) {
+  factories.emplace("Jpsi_TPCPost_calib_debug6", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsi_trackCut_debug2"));
     cut->AddCut(GetAnalysisCut("jpsi_TPCPID_debug6"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("Jpsi_TPCPost_calib_debug7")) {
+  factories.emplace("Jpsi_TPCPost_calib_debug7", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsi_trackCut_debug2"));
     cut->AddCut(GetAnalysisCut("jpsi_TPCPID_debug7"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("Jpsi_TPCPost_calib_debug8")) {
+  factories.emplace("Jpsi_TPCPost_calib_debug8", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsi_trackCut_debug5"));
     cut->AddCut(GetAnalysisCut("jpsi_TPCPID_debug8"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("Jpsi_TPCPost_calib_debug9")) {
+  factories.emplace("Jpsi_TPCPost_calib_debug9", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsi_trackCut_debug4"));
     cut->AddCut(GetAnalysisCut("electronPIDLooseSkimmed3"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("Jpsi_TPCPost_calib_debug10")) {
+  factories.emplace("Jpsi_TPCPost_calib_debug10", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiKineSkimmed"));
     cut->AddCut(GetAnalysisCut("jpsi_trackCut_debug6"));
     cut->AddCut(GetAnalysisCut("jpsi_TPCPID_debug10"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("LMee_TPCPost_calib_debug1")) {
+  factories.emplace("LMee_TPCPost_calib_debug1", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("lmee_trackCut_debug"));
     cut->AddCut(GetAnalysisCut("lmee_TPCPID_debug1"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("ITSalone_prefilter")) {
+  factories.emplace("ITSalone_prefilter", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("lmeePrefilterKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityITSOnly"));
     cut->AddCut(GetAnalysisCut("PrimaryTrack_looseDCA"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("ITSalonebAny_prefilter")) {
+  factories.emplace("ITSalonebAny_prefilter", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("lmeePrefilterKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQualitybAnyITSOnly"));
     cut->AddCut(GetAnalysisCut("PrimaryTrack_looseDCA"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("TPCalone_prefilter")) {
+  factories.emplace("TPCalone_prefilter", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("lmeePrefilterKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityTPCOnly"));
     cut->AddCut(GetAnalysisCut("PrimaryTrack_looseDCA"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("ITSTPC_prefilter")) {
+  factories.emplace("ITSTPC_prefilter", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("lmeePrefilterKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityITSOnly"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityTPCOnly"));
     cut->AddCut(GetAnalysisCut("PrimaryTrack_looseDCA"));
     return cut;
-  }
+  });
 
   for (int iCut = 0; iCut < 10; iCut++) {
-    if (!nameStr.compare(Form("jpsiEleSel%d_ionut", iCut))) {
+    factories.emplace(Form("jpsiEleSel%d_ionut", iCut), [=](AnalysisCompositeCut* cut) {
       cut->AddCut(GetAnalysisCut("kineJpsiEle_ionut"));
       cut->AddCut(GetAnalysisCut("dcaCut1_ionut"));
       cut->AddCut(GetAnalysisCut("trackQuality_ionut"));
       cut->AddCut(GetAnalysisCut(Form("pidJpsiEle%d_ionut", iCut)));
       return cut;
-    }
+    });
 
-    if (!nameStr.compare(Form("jpsiEleSelTight%d_ionut", iCut))) {
+    factories.emplace(Form("jpsiEleSelTight%d_ionut", iCut), [=](AnalysisCompositeCut* cut) {
       cut->AddCut(GetAnalysisCut("kineJpsiEle_ionut"));
       cut->AddCut(GetAnalysisCut("dcaCut1_ionut"));
       cut->AddCut(GetAnalysisCut("trackQualityTight_ionut"));
       cut->AddCut(GetAnalysisCut(Form("pidJpsiEle%d_ionut", iCut)));
       return cut;
-    }
+    });
   }
 
   // Magnus composite cuts -----------------------------------------------------------------------------------------------------------------
 
-  AnalysisCompositeCut* magnus_PID111 = new AnalysisCompositeCut("magnus_PID111", "");
-  magnus_PID111->AddCut(GetAnalysisCut("pidJpsi_magnus_ele1"));
-  magnus_PID111->AddCut(GetAnalysisCut("pidJpsi_magnus_pion1"));
-  magnus_PID111->AddCut(GetAnalysisCut("pidJpsi_magnus_prot1"));
-  if (!nameStr.compare("MagnussOptimization111")) {
+  factories.emplace("MagnussOptimization111", [](AnalysisCompositeCut* cut) {
+    AnalysisCompositeCut* magnus_PID111 = new AnalysisCompositeCut("magnus_PID111", "");
+    magnus_PID111->AddCut(GetAnalysisCut("pidJpsi_magnus_ele1"));
+    magnus_PID111->AddCut(GetAnalysisCut("pidJpsi_magnus_pion1"));
+    magnus_PID111->AddCut(GetAnalysisCut("pidJpsi_magnus_prot1"));
     cut->AddCut(GetAnalysisCut("kineJpsiEle_ionut"));
     cut->AddCut(GetAnalysisCut("dcaCut1_ionut"));
     cut->AddCut(GetAnalysisCut("trackQuality_ionut"));
     cut->AddCut(magnus_PID111);
     return cut;
-  }
+  });
 
-  AnalysisCompositeCut* magnus_PID211 = new AnalysisCompositeCut("magnus_PID211", "");
-  magnus_PID211->AddCut(GetAnalysisCut("pidJpsi_magnus_ele2"));
-  magnus_PID211->AddCut(GetAnalysisCut("pidJpsi_magnus_pion1"));
-  magnus_PID211->AddCut(GetAnalysisCut("pidJpsi_magnus_prot1"));
-  if (!nameStr.compare("MagnussOptimization211")) {
+  factories.emplace("MagnussOptimization211", [](AnalysisCompositeCut* cut) {
+    AnalysisCompositeCut* magnus_PID211 = new AnalysisCompositeCut("magnus_PID211", "");
+    magnus_PID211->AddCut(GetAnalysisCut("pidJpsi_magnus_ele2"));
+    magnus_PID211->AddCut(GetAnalysisCut("pidJpsi_magnus_pion1"));
+    magnus_PID211->AddCut(GetAnalysisCut("pidJpsi_magnus_prot1"));
     cut->AddCut(GetAnalysisCut("kineJpsiEle_ionut"));
     cut->AddCut(GetAnalysisCut("dcaCut1_ionut"));
     cut->AddCut(GetAnalysisCut("trackQuality_ionut"));
     cut->AddCut(magnus_PID211);
     return cut;
-  }
+  });
 
-  AnalysisCompositeCut* magnus_PID311 = new AnalysisCompositeCut("magnus_PID311", "");
-  magnus_PID311->AddCut(GetAnalysisCut("pidJpsi_magnus_ele3"));
-  magnus_PID311->AddCut(GetAnalysisCut("pidJpsi_magnus_pion1"));
-  magnus_PID311->AddCut(GetAnalysisCut("pidJpsi_magnus_prot1"));
-  if (!nameStr.compare("MagnussOptimization311")) {
+  factories.emplace("MagnussOptimization311", [](AnalysisCompositeCut* cut) {
+    AnalysisCompositeCut* magnus_PID311 = new AnalysisCompositeCut("magnus_PID311", "");
+    magnus_PID311->AddCut(GetAnalysisCut("pidJpsi_magnus_ele3"));
+    magnus_PID311->AddCut(GetAnalysisCut("pidJpsi_magnus_pion1"));
+    magnus_PID311->AddCut(GetAnalysisCut("pidJpsi_magnus_prot1"));
     cut->AddCut(GetAnalysisCut("kineJpsiEle_ionut"));
     cut->AddCut(GetAnalysisCut("dcaCut1_ionut"));
     cut->AddCut(GetAnalysisCut("trackQuality_ionut"));
     cut->AddCut(magnus_PID311);
     return cut;
-  }
+  });
 
-  AnalysisCompositeCut* magnus_PID121 = new AnalysisCompositeCut("magnus_PID121", "");
-  magnus_PID121->AddCut(GetAnalysisCut("pidJpsi_magnus_ele1"));
-  magnus_PID121->AddCut(GetAnalysisCut("pidJpsi_magnus_pion2"));
-  magnus_PID121->AddCut(GetAnalysisCut("pidJpsi_magnus_prot1"));
-  if (!nameStr.compare("MagnussOptimization121")) {
+  factories.emplace("MagnussOptimization121", [](AnalysisCompositeCut* cut) {
+    AnalysisCompositeCut* magnus_PID121 = new AnalysisCompositeCut("magnus_PID121", "");
+    magnus_PID121->AddCut(GetAnalysisCut("pidJpsi_magnus_ele1"));
+    magnus_PID121->AddCut(GetAnalysisCut("pidJpsi_magnus_pion2"));
+    magnus_PID121->AddCut(GetAnalysisCut("pidJpsi_magnus_prot1"));
     cut->AddCut(GetAnalysisCut("kineJpsiEle_ionut"));
     cut->AddCut(GetAnalysisCut("dcaCut1_ionut"));
     cut->AddCut(GetAnalysisCut("trackQuality_ionut"));
     cut->AddCut(magnus_PID121);
     return cut;
-  }
+  });
 
-  AnalysisCompositeCut* magnus_PID112 = new AnalysisCompositeCut("magnus_PID112", "");
-  magnus_PID112->AddCut(GetAnalysisCut("pidJpsi_magnus_ele1"));
-  magnus_PID112->AddCut(GetAnalysisCut("pidJpsi_magnus_pion1"));
-  magnus_PID112->AddCut(GetAnalysisCut("pidJpsi_magnus_prot2"));
-  if (!nameStr.compare("MagnussOptimization112")) {
+  factories.emplace("MagnussOptimization112", [](AnalysisCompositeCut* cut) {
+    AnalysisCompositeCut* magnus_PID112 = new AnalysisCompositeCut("magnus_PID112", "");
+    magnus_PID112->AddCut(GetAnalysisCut("pidJpsi_magnus_ele1"));
+    magnus_PID112->AddCut(GetAnalysisCut("pidJpsi_magnus_pion1"));
+    magnus_PID112->AddCut(GetAnalysisCut("pidJpsi_magnus_prot2"));
     cut->AddCut(GetAnalysisCut("kineJpsiEle_ionut"));
     cut->AddCut(GetAnalysisCut("dcaCut1_ionut"));
     cut->AddCut(GetAnalysisCut("trackQuality_ionut"));
     cut->AddCut(magnus_PID112);
     return cut;
-  }
+  });
 
-  AnalysisCompositeCut* magnus_PID122 = new AnalysisCompositeCut("magnus_PID122", "");
-  magnus_PID122->AddCut(GetAnalysisCut("pidJpsi_magnus_ele1"));
-  magnus_PID122->AddCut(GetAnalysisCut("pidJpsi_magnus_pion2"));
-  magnus_PID122->AddCut(GetAnalysisCut("pidJpsi_magnus_prot2"));
-  if (!nameStr.compare("MagnussOptimization122")) {
+  factories.emplace("MagnussOptimization122", [](AnalysisCompositeCut* cut) {
+    AnalysisCompositeCut* magnus_PID122 = new AnalysisCompositeCut("magnus_PID122", "");
+    magnus_PID122->AddCut(GetAnalysisCut("pidJpsi_magnus_ele1"));
+    magnus_PID122->AddCut(GetAnalysisCut("pidJpsi_magnus_pion2"));
+    magnus_PID122->AddCut(GetAnalysisCut("pidJpsi_magnus_prot2"));
     cut->AddCut(GetAnalysisCut("kineJpsiEle_ionut"));
     cut->AddCut(GetAnalysisCut("dcaCut1_ionut"));
     cut->AddCut(GetAnalysisCut("trackQuality_ionut"));
     cut->AddCut(magnus_PID122);
     return cut;
-  }
+  });
 
-  AnalysisCompositeCut* magnus_PID222 = new AnalysisCompositeCut("magnus_PID222", "");
-  magnus_PID222->AddCut(GetAnalysisCut("pidJpsi_magnus_ele2"));
-  magnus_PID222->AddCut(GetAnalysisCut("pidJpsi_magnus_pion2"));
-  magnus_PID222->AddCut(GetAnalysisCut("pidJpsi_magnus_prot2"));
-  if (!nameStr.compare("MagnussOptimization222")) {
+  factories.emplace("MagnussOptimization222", [](AnalysisCompositeCut* cut) {
+    AnalysisCompositeCut* magnus_PID222 = new AnalysisCompositeCut("magnus_PID222", "");
+    magnus_PID222->AddCut(GetAnalysisCut("pidJpsi_magnus_ele2"));
+    magnus_PID222->AddCut(GetAnalysisCut("pidJpsi_magnus_pion2"));
+    magnus_PID222->AddCut(GetAnalysisCut("pidJpsi_magnus_prot2"));
     cut->AddCut(GetAnalysisCut("kineJpsiEle_ionut"));
     cut->AddCut(GetAnalysisCut("dcaCut1_ionut"));
     cut->AddCut(GetAnalysisCut("trackQuality_ionut"));
     cut->AddCut(magnus_PID222);
     return cut;
-  }
+  });
 
-  AnalysisCompositeCut* magnus_PID212 = new AnalysisCompositeCut("magnus_PID212", "");
-  magnus_PID212->AddCut(GetAnalysisCut("pidJpsi_magnus_ele2"));
-  magnus_PID212->AddCut(GetAnalysisCut("pidJpsi_magnus_pion1"));
-  magnus_PID212->AddCut(GetAnalysisCut("pidJpsi_magnus_prot2"));
-  if (!nameStr.compare("MagnussOptimization212")) {
+  factories.emplace("MagnussOptimization212", [](AnalysisCompositeCut* cut) {
+    AnalysisCompositeCut* magnus_PID212 = new AnalysisCompositeCut("magnus_PID212", "");
+    magnus_PID212->AddCut(GetAnalysisCut("pidJpsi_magnus_ele2"));
+    magnus_PID212->AddCut(GetAnalysisCut("pidJpsi_magnus_pion1"));
+    magnus_PID212->AddCut(GetAnalysisCut("pidJpsi_magnus_prot2"));
     cut->AddCut(GetAnalysisCut("kineJpsiEle_ionut"));
     cut->AddCut(GetAnalysisCut("dcaCut1_ionut"));
     cut->AddCut(GetAnalysisCut("trackQuality_ionut"));
     cut->AddCut(magnus_PID212);
     return cut;
-  }
+  });
 
-  AnalysisCompositeCut* magnus_PID221 = new AnalysisCompositeCut("magnus_PID221", "");
-  magnus_PID221->AddCut(GetAnalysisCut("pidJpsi_magnus_ele2"));
-  magnus_PID221->AddCut(GetAnalysisCut("pidJpsi_magnus_pion2"));
-  magnus_PID221->AddCut(GetAnalysisCut("pidJpsi_magnus_prot1"));
-  if (!nameStr.compare("MagnussOptimization221")) {
+  factories.emplace("MagnussOptimization221", [](AnalysisCompositeCut* cut) {
+    AnalysisCompositeCut* magnus_PID221 = new AnalysisCompositeCut("magnus_PID221", "");
+    magnus_PID221->AddCut(GetAnalysisCut("pidJpsi_magnus_ele2"));
+    magnus_PID221->AddCut(GetAnalysisCut("pidJpsi_magnus_pion2"));
+    magnus_PID221->AddCut(GetAnalysisCut("pidJpsi_magnus_prot1"));
     cut->AddCut(GetAnalysisCut("kineJpsiEle_ionut"));
     cut->AddCut(GetAnalysisCut("dcaCut1_ionut"));
     cut->AddCut(GetAnalysisCut("trackQuality_ionut"));
     cut->AddCut(magnus_PID221);
     return cut;
-  }
+  });
 
-  AnalysisCompositeCut* magnus_PID321 = new AnalysisCompositeCut("magnus_PID321", "");
-  magnus_PID321->AddCut(GetAnalysisCut("pidJpsi_magnus_ele3"));
-  magnus_PID321->AddCut(GetAnalysisCut("pidJpsi_magnus_pion2"));
-  magnus_PID321->AddCut(GetAnalysisCut("pidJpsi_magnus_prot1"));
-  if (!nameStr.compare("MagnussOptimization321")) {
+  factories.emplace("MagnussOptimization321", [](AnalysisCompositeCut* cut) {
+    AnalysisCompositeCut* magnus_PID321 = new AnalysisCompositeCut("magnus_PID321", "");
+    magnus_PID321->AddCut(GetAnalysisCut("pidJpsi_magnus_ele3"));
+    magnus_PID321->AddCut(GetAnalysisCut("pidJpsi_magnus_pion2"));
+    magnus_PID321->AddCut(GetAnalysisCut("pidJpsi_magnus_prot1"));
     cut->AddCut(GetAnalysisCut("kineJpsiEle_ionut"));
     cut->AddCut(GetAnalysisCut("dcaCut1_ionut"));
     cut->AddCut(GetAnalysisCut("trackQuality_ionut"));
     cut->AddCut(magnus_PID321);
     return cut;
-  }
+  });
 
-  AnalysisCompositeCut* magnus_PID312 = new AnalysisCompositeCut("magnus_PID312", "");
-  magnus_PID312->AddCut(GetAnalysisCut("pidJpsi_magnus_ele3"));
-  magnus_PID312->AddCut(GetAnalysisCut("pidJpsi_magnus_pion1"));
-  magnus_PID312->AddCut(GetAnalysisCut("pidJpsi_magnus_prot2"));
-  if (!nameStr.compare("MagnussOptimization312")) {
+  factories.emplace("MagnussOptimization312", [](AnalysisCompositeCut* cut) {
+    AnalysisCompositeCut* magnus_PID312 = new AnalysisCompositeCut("magnus_PID312", "");
+    magnus_PID312->AddCut(GetAnalysisCut("pidJpsi_magnus_ele3"));
+    magnus_PID312->AddCut(GetAnalysisCut("pidJpsi_magnus_pion1"));
+    magnus_PID312->AddCut(GetAnalysisCut("pidJpsi_magnus_prot2"));
     cut->AddCut(GetAnalysisCut("kineJpsiEle_ionut"));
     cut->AddCut(GetAnalysisCut("dcaCut1_ionut"));
     cut->AddCut(GetAnalysisCut("trackQuality_ionut"));
     cut->AddCut(magnus_PID312);
     return cut;
-  }
+  });
 
-  AnalysisCompositeCut* magnus_PID322 = new AnalysisCompositeCut("magnus_PID322", "");
-  magnus_PID322->AddCut(GetAnalysisCut("pidJpsi_magnus_ele1"));
-  magnus_PID322->AddCut(GetAnalysisCut("pidJpsi_magnus_pion2"));
-  magnus_PID322->AddCut(GetAnalysisCut("pidJpsi_magnus_prot2"));
-  if (!nameStr.compare("MagnussOptimization322")) {
+  factories.emplace("MagnussOptimization322", [](AnalysisCompositeCut* cut) {
+    AnalysisCompositeCut* magnus_PID322 = new AnalysisCompositeCut("magnus_PID322", "");
+    magnus_PID322->AddCut(GetAnalysisCut("pidJpsi_magnus_ele1"));
+    magnus_PID322->AddCut(GetAnalysisCut("pidJpsi_magnus_pion2"));
+    magnus_PID322->AddCut(GetAnalysisCut("pidJpsi_magnus_prot2"));
     cut->AddCut(GetAnalysisCut("kineJpsiEle_ionut"));
     cut->AddCut(GetAnalysisCut("dcaCut1_ionut"));
     cut->AddCut(GetAnalysisCut("trackQuality_ionut"));
     cut->AddCut(magnus_PID322);
     return cut;
-  }
+  });
   //-------------------------------------------------------------------------------------------------------
 
   //---------------------------------------------------------------
   // Cuts for the selection of legs from dalitz decay
   //
-  if (!nameStr.compare("DalitzCut1")) {
+  factories.emplace("DalitzCut1", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("dalitzStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityITSOnly"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityTPCOnly"));
     cut->AddCut(GetAnalysisCut("electronPIDOnly"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("DalitzCut2")) {
+  factories.emplace("DalitzCut2", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("dalitzStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityITSOnly"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityTPCOnly"));
     cut->AddCut(GetAnalysisCut("electronPIDPrKaPiRej"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("DalitzCut2_Corr")) {
+  factories.emplace("DalitzCut2_Corr", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("dalitzStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityITSOnly"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityTPCOnly"));
     cut->AddCut(GetAnalysisCut("electronPIDPrKaPiRej_Corr"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("DalitzCut3")) {
+  factories.emplace("DalitzCut3", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("dalitzStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityITSOnly"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityTPCOnly"));
     cut->AddCut(GetAnalysisCut("electronPIDPrKaPiRejLoose"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("DalitzCut3_Corr")) {
+  factories.emplace("DalitzCut3_Corr", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("dalitzStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityITSOnly"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityTPCOnly"));
     cut->AddCut(GetAnalysisCut("electronPIDPrKaPiRejLoose_Corr"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("DalitzCut1SPDfirst")) {
+  factories.emplace("DalitzCut1SPDfirst", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("dalitzStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityITSOnly"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityTPCOnly"));
     cut->AddCut(GetAnalysisCut("SPDfirst"));
     cut->AddCut(GetAnalysisCut("electronPIDOnly"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("DalitzCut1SPDfirst_Corr")) {
+  factories.emplace("DalitzCut1SPDfirst_Corr", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("dalitzStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityITSOnly"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityTPCOnly"));
     cut->AddCut(GetAnalysisCut("SPDfirst"));
     cut->AddCut(GetAnalysisCut("electronPIDOnly_Corr"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("DalitzCut2SPDfirst")) {
+  factories.emplace("DalitzCut2SPDfirst", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("dalitzStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityITSOnly"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityTPCOnly"));
     cut->AddCut(GetAnalysisCut("SPDfirst"));
     cut->AddCut(GetAnalysisCut("electronPIDPrKaPiRej"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("DalitzCut2SPDfirst_Corr")) {
+  factories.emplace("DalitzCut2SPDfirst_Corr", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("dalitzStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityITSOnly"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityTPCOnly"));
     cut->AddCut(GetAnalysisCut("SPDfirst"));
     cut->AddCut(GetAnalysisCut("electronPIDPrKaPiRej_Corr"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("DalitzCut3SPDfirst")) {
+  factories.emplace("DalitzCut3SPDfirst", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("dalitzStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityITSOnly"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityTPCOnly"));
     cut->AddCut(GetAnalysisCut("SPDfirst"));
     cut->AddCut(GetAnalysisCut("electronPIDPrKaPiRejLoose"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("DalitzCut3SPDfirst_Corr")) {
+  factories.emplace("DalitzCut3SPDfirst_Corr", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("dalitzStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityITSOnly"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityTPCOnly"));
     cut->AddCut(GetAnalysisCut("SPDfirst"));
     cut->AddCut(GetAnalysisCut("electronPIDPrKaPiRejLoose_Corr"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("Dalitz_WithTOF_SPDfirst")) {
+  factories.emplace("Dalitz_WithTOF_SPDfirst", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("dalitzStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityITSOnly"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityTPCOnly"));
@@ -1448,9 +1612,9 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
     cut_pid_OR->AddCut(cut_tof_nSigma);
     cut->AddCut(cut_pid_OR);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("Dalitz_WithTOF_SPDfirst_Corr")) {
+  factories.emplace("Dalitz_WithTOF_SPDfirst_Corr", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("dalitzStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityITSOnly"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityTPCOnly"));
@@ -1467,60 +1631,60 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
     cut_pid_OR->AddCut(cut_tof_nSigma);
     cut->AddCut(cut_pid_OR);
     return cut;
-  }
+  });
 
   for (int i = 1; i <= 8; i++) {
-    if (!nameStr.compare(Form("dalitzSelected%d", i))) {
+    factories.emplace(Form("dalitzSelected%d", i), [=](AnalysisCompositeCut* cut) {
       cut->AddCut(GetAnalysisCut(Form("dalitzLeg%d", i)));
       return cut;
-    }
+    });
   }
 
-  if (!nameStr.compare("jpsiPIDworseRes")) {
+  factories.emplace("jpsiPIDworseRes", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQuality"));
     cut->AddCut(GetAnalysisCut("standardPrimaryTrack"));
     cut->AddCut(GetAnalysisCut("electronPIDworseRes"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsiPIDshift")) {
+  factories.emplace("jpsiPIDshift", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQuality"));
     cut->AddCut(GetAnalysisCut("standardPrimaryTrack"));
     cut->AddCut(GetAnalysisCut("electronPIDshift"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsiPID1shiftUp")) {
+  factories.emplace("jpsiPID1shiftUp", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQuality"));
     cut->AddCut(GetAnalysisCut("standardPrimaryTrack"));
     cut->AddCut(GetAnalysisCut("electronPID1shiftUp"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsiPID1shiftDown")) {
+  factories.emplace("jpsiPID1shiftDown", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQuality"));
     cut->AddCut(GetAnalysisCut("standardPrimaryTrack"));
     cut->AddCut(GetAnalysisCut("electronPID1shiftDown"));
     return cut;
-  }
+  });
   // -------------------------------------------------------------------------------------------------
   //
   // LMee cuts
   // List of cuts used for low mass dielectron analyses
   //
   // Skimming cuts:
-  if (!nameStr.compare("lmee_skimming")) {
+  factories.emplace("lmee_skimming", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("lmee_skimming_cuts"));
     return cut;
-  }
+  });
 
   // LMee Run2 PID cuts
 
-  if (!nameStr.compare("lmeePID_TPChadrejTOFrec")) {
+  factories.emplace("lmeePID_TPChadrejTOFrec", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("lmeeStandardKine"));
     cut->AddCut(GetAnalysisCut("TightGlobalTrack"));
     cut->AddCut(GetAnalysisCut("standardPrimaryTrack"));
@@ -1540,9 +1704,9 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
     cut_pid_OR->AddCut(cut_tof_rec);
     cut->AddCut(cut_pid_OR);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("lmeePID_TPChadrej")) {
+  factories.emplace("lmeePID_TPChadrej", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("lmeeStandardKine"));
     cut->AddCut(GetAnalysisCut("TightGlobalTrack"));
     cut->AddCut(GetAnalysisCut("standardPrimaryTrack"));
@@ -1554,9 +1718,9 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
     cut_tpc_hadrej->AddCut(GetAnalysisCut("tpc_proton_rejection"));
     cut->AddCut(cut_tpc_hadrej);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("lmee_eNSigmaRun2")) {
+  factories.emplace("lmee_eNSigmaRun2", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("lmeeStandardKine"));
     cut->AddCut(GetAnalysisCut("TightGlobalTrack"));
     cut->AddCut(GetAnalysisCut("standardPrimaryTrack"));
@@ -1572,9 +1736,9 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
     cut_pid_OR->AddCut(cut_tof_nSigma);
     cut->AddCut(cut_pid_OR);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("lmeePID_TOFrec")) {
+  factories.emplace("lmeePID_TOFrec", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("lmeeStandardKine"));
     cut->AddCut(GetAnalysisCut("TightGlobalTrack"));
     cut->AddCut(GetAnalysisCut("standardPrimaryTrack"));
@@ -1585,39 +1749,39 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
 
     cut->AddCut(cut_tof_rec);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("lmee_GlobalTrackRun2")) {
+  factories.emplace("lmee_GlobalTrackRun2", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("lmeeStandardKine"));
     cut->AddCut(GetAnalysisCut("TightGlobalTrack"));
     cut->AddCut(GetAnalysisCut("standardPrimaryTrack"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("lmee_GlobalTrackRun2_lowPt")) {
+  factories.emplace("lmee_GlobalTrackRun2_lowPt", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("lmeeLowBKine"));
     cut->AddCut(GetAnalysisCut("TightGlobalTrack"));
     cut->AddCut(GetAnalysisCut("standardPrimaryTrack"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("lmee_TPCTrackRun2_lowPt")) {
+  factories.emplace("lmee_TPCTrackRun2_lowPt", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("lmeeLowBKine"));
     cut->AddCut(GetAnalysisCut("TightTPCTrack"));
     cut->AddCut(GetAnalysisCut("standardPrimaryTrack"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("lmee_TPCTrackRun2")) {
+  factories.emplace("lmee_TPCTrackRun2", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("lmeeStandardKine"));
     cut->AddCut(GetAnalysisCut("TightTPCTrack"));
     cut->AddCut(GetAnalysisCut("standardPrimaryTrack"));
     return cut;
-  }
+  });
 
   // LMee Run3 PID cuts
 
-  if (!nameStr.compare("lmeePID_TPChadrejTOFrecRun3")) {
+  factories.emplace("lmeePID_TPChadrejTOFrecRun3", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("lmeeStandardKine"));
     cut->AddCut(GetAnalysisCut("TightGlobalTrackRun3"));
     cut->AddCut(GetAnalysisCut("PrimaryTrack_looseDCA"));
@@ -1639,59 +1803,59 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
     cut_pid_OR->AddCut(cut_tof_rec);
     cut->AddCut(cut_pid_OR);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("lmee_Run3_TPCelectron")) {
+  factories.emplace("lmee_Run3_TPCelectron", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("lmeeStandardKine"));
     cut->AddCut(GetAnalysisCut("TightGlobalTrackRun3"));
     cut->AddCut(GetAnalysisCut("standardPrimaryTrackDCAz"));
     cut->AddCut(GetAnalysisCut("lmee_pp_502TeV_TPCPbPbnopkrej"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("lmee_Run3_TOFelectron")) {
+  factories.emplace("lmee_Run3_TOFelectron", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("lmeeStandardKine"));
     cut->AddCut(GetAnalysisCut("TightGlobalTrackRun3"));
     cut->AddCut(GetAnalysisCut("standardPrimaryTrackDCAz"));
     cut->AddCut(GetAnalysisCut("tof_electron_sigma"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("lmee_Run3_posTrack_TPCelectron")) {
+  factories.emplace("lmee_Run3_posTrack_TPCelectron", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("lmeeStandardKine"));
     cut->AddCut(GetAnalysisCut("posTrack"));
     cut->AddCut(GetAnalysisCut("TightGlobalTrackRun3"));
     cut->AddCut(GetAnalysisCut("standardPrimaryTrackDCAz"));
     cut->AddCut(GetAnalysisCut("lmee_pp_502TeV_TPCPbPbnopkrej"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("lmee_Run3_posTrack_TOFelectron")) {
+  factories.emplace("lmee_Run3_posTrack_TOFelectron", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("lmeeStandardKine"));
     cut->AddCut(GetAnalysisCut("posTrack"));
     cut->AddCut(GetAnalysisCut("TightGlobalTrackRun3"));
     cut->AddCut(GetAnalysisCut("standardPrimaryTrackDCAz"));
     cut->AddCut(GetAnalysisCut("tof_electron_sigma"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("lmee_Run3_negTrack_TPCelectron")) {
+  factories.emplace("lmee_Run3_negTrack_TPCelectron", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("lmeeStandardKine"));
     cut->AddCut(GetAnalysisCut("negTrack"));
     cut->AddCut(GetAnalysisCut("TightGlobalTrackRun3"));
     cut->AddCut(GetAnalysisCut("standardPrimaryTrackDCAz"));
     cut->AddCut(GetAnalysisCut("lmee_pp_502TeV_TPCPbPbnopkrej"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("lmee_Run3_negTrack_TOFelectron")) {
+  factories.emplace("lmee_Run3_negTrack_TOFelectron", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("lmeeStandardKine"));
     cut->AddCut(GetAnalysisCut("negTrack"));
     cut->AddCut(GetAnalysisCut("TightGlobalTrackRun3"));
     cut->AddCut(GetAnalysisCut("standardPrimaryTrackDCAz"));
     cut->AddCut(GetAnalysisCut("tof_electron_sigma"));
     return cut;
-  }
+  });
 
   std::vector<TString> vecTypetrack;
   vecTypetrack.emplace_back("");                  // default TightGlobalTrackRun3
@@ -1708,126 +1872,126 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
   // loop to define PID cuts with and without post calibration
   for (size_t icase = 0; icase < vecTypetrack.size(); icase++) {
     // Tracking cuts of Pb--Pb analysis
-    if (!nameStr.compare(Form("lmee%s_PbPb_selection", vecTypetrack.at(icase).Data()))) {
+    factories.emplace(Form("lmee%s_PbPb_selection", vecTypetrack.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
       cut->AddCut(GetAnalysisCut("lmeeStandardKine"));
       cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrack.at(icase).Data())));
       cut->AddCut(GetAnalysisCut("standardPrimaryTrackDCAz"));
       return cut;
-    }
+    });
 
-    if (!nameStr.compare(Form("lmee%s_PbPb_selection_pt04", vecTypetrack.at(icase).Data()))) {
+    factories.emplace(Form("lmee%s_PbPb_selection_pt04", vecTypetrack.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
       cut->AddCut(GetAnalysisCut("lmeeStandardKine_pt04"));
       cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrack.at(icase).Data())));
       cut->AddCut(GetAnalysisCut("standardPrimaryTrackDCAz"));
       return cut;
-    }
+    });
 
-    if (!nameStr.compare(Form("lmee%s_TrackCuts_Resol", vecTypetrack.at(icase).Data()))) {
+    factories.emplace(Form("lmee%s_TrackCuts_Resol", vecTypetrack.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
       cut->AddCut(GetAnalysisCut("openEtaSel")); // No pt cut and wider eta cut to produce resolution maps
       cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrack.at(icase).Data())));
       cut->AddCut(GetAnalysisCut("PrimaryTrack_looseDCA"));
       return cut;
-    }
+    });
 
     // 4 cuts to separate pos & neg tracks in pos & neg eta range
-    if (!nameStr.compare(Form("lmee_posTrack_posEta_selection%s", vecTypetrack.at(icase).Data()))) {
+    factories.emplace(Form("lmee_posTrack_posEta_selection%s", vecTypetrack.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
       cut->AddCut(GetAnalysisCut("posTrack"));
       cut->AddCut(GetAnalysisCut("posEtaSel"));
       cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrack.at(icase).Data())));
       cut->AddCut(GetAnalysisCut("PrimaryTrack_looseDCA"));
       return cut;
-    }
+    });
 
-    if (!nameStr.compare(Form("lmee_negTrack_posEta_selection%s", vecTypetrack.at(icase).Data()))) {
+    factories.emplace(Form("lmee_negTrack_posEta_selection%s", vecTypetrack.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
       cut->AddCut(GetAnalysisCut("negTrack"));
       cut->AddCut(GetAnalysisCut("posEtaSel"));
       cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrack.at(icase).Data())));
       cut->AddCut(GetAnalysisCut("PrimaryTrack_looseDCA"));
       return cut;
-    }
+    });
 
-    if (!nameStr.compare(Form("lmee_posTrack_negEta_selection%s", vecTypetrack.at(icase).Data()))) {
+    factories.emplace(Form("lmee_posTrack_negEta_selection%s", vecTypetrack.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
       cut->AddCut(GetAnalysisCut("posTrack"));
       cut->AddCut(GetAnalysisCut("negEtaSel"));
       cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrack.at(icase).Data())));
       cut->AddCut(GetAnalysisCut("PrimaryTrack_looseDCA"));
       return cut;
-    }
+    });
 
-    if (!nameStr.compare(Form("lmee_negTrack_negEta_selection%s", vecTypetrack.at(icase).Data()))) {
+    factories.emplace(Form("lmee_negTrack_negEta_selection%s", vecTypetrack.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
       cut->AddCut(GetAnalysisCut("negTrack"));
       cut->AddCut(GetAnalysisCut("negEtaSel"));
       cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrack.at(icase).Data())));
       cut->AddCut(GetAnalysisCut("PrimaryTrack_looseDCA"));
       return cut;
-    }
+    });
 
     // 2 cuts to separate pos & neg tracks
-    if (!nameStr.compare(Form("lmee_posTrack_selection%s", vecTypetrack.at(icase).Data()))) {
+    factories.emplace(Form("lmee_posTrack_selection%s", vecTypetrack.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
       cut->AddCut(GetAnalysisCut("posTrack"));
       cut->AddCut(GetAnalysisCut("etaSel"));
       cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrack.at(icase).Data())));
       cut->AddCut(GetAnalysisCut("PrimaryTrack_looseDCA"));
       return cut;
-    }
+    });
 
-    if (!nameStr.compare(Form("lmee_negTrack_selection%s", vecTypetrack.at(icase).Data()))) {
+    factories.emplace(Form("lmee_negTrack_selection%s", vecTypetrack.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
       cut->AddCut(GetAnalysisCut("negTrack"));
       cut->AddCut(GetAnalysisCut("etaSel"));
       cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrack.at(icase).Data())));
       cut->AddCut(GetAnalysisCut("PrimaryTrack_looseDCA"));
       return cut;
-    }
+    });
 
     // 4 cuts to separate pos & neg tracks in pos & neg eta range low B field
-    if (!nameStr.compare(Form("lmee_lowB_posTrack_posEta_selection%s", vecTypetrack.at(icase).Data()))) {
+    factories.emplace(Form("lmee_lowB_posTrack_posEta_selection%s", vecTypetrack.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
       cut->AddCut(GetAnalysisCut("posTrack"));
       cut->AddCut(GetAnalysisCut("posEtaSel"));
       cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrack.at(icase).Data())));
       cut->AddCut(GetAnalysisCut("standardPrimaryTrackDCAz"));
       return cut;
-    }
+    });
 
-    if (!nameStr.compare(Form("lmee_lowB_negTrack_posEta_selection%s", vecTypetrack.at(icase).Data()))) {
+    factories.emplace(Form("lmee_lowB_negTrack_posEta_selection%s", vecTypetrack.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
       cut->AddCut(GetAnalysisCut("negTrack"));
       cut->AddCut(GetAnalysisCut("posEtaSel"));
       cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrack.at(icase).Data())));
       cut->AddCut(GetAnalysisCut("standardPrimaryTrackDCAz"));
       return cut;
-    }
+    });
 
-    if (!nameStr.compare(Form("lmee_lowB_posTrack_negEta_selection%s", vecTypetrack.at(icase).Data()))) {
+    factories.emplace(Form("lmee_lowB_posTrack_negEta_selection%s", vecTypetrack.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
       cut->AddCut(GetAnalysisCut("posTrack"));
       cut->AddCut(GetAnalysisCut("negEtaSel"));
       cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrack.at(icase).Data())));
       cut->AddCut(GetAnalysisCut("standardPrimaryTrackDCAz"));
       return cut;
-    }
+    });
 
-    if (!nameStr.compare(Form("lmee_lowB_negTrack_negEta_selection%s", vecTypetrack.at(icase).Data()))) {
+    factories.emplace(Form("lmee_lowB_negTrack_negEta_selection%s", vecTypetrack.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
       cut->AddCut(GetAnalysisCut("negTrack"));
       cut->AddCut(GetAnalysisCut("negEtaSel"));
       cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrack.at(icase).Data())));
       cut->AddCut(GetAnalysisCut("standardPrimaryTrackDCAz"));
       return cut;
-    }
+    });
 
     // 2 cuts to separate pos & neg tracks in low B field
-    if (!nameStr.compare(Form("lmee_lowB_posTrack_selection%s", vecTypetrack.at(icase).Data()))) {
+    factories.emplace(Form("lmee_lowB_posTrack_selection%s", vecTypetrack.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
       cut->AddCut(GetAnalysisCut("posTrack"));
       cut->AddCut(GetAnalysisCut("etaSel"));
       cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrack.at(icase).Data())));
       cut->AddCut(GetAnalysisCut("standardPrimaryTrackDCAz"));
       return cut;
-    }
+    });
 
-    if (!nameStr.compare(Form("lmee_lowB_negTrack_selection%s", vecTypetrack.at(icase).Data()))) {
+    factories.emplace(Form("lmee_lowB_negTrack_selection%s", vecTypetrack.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
       cut->AddCut(GetAnalysisCut("negTrack"));
       cut->AddCut(GetAnalysisCut("etaSel"));
       cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrack.at(icase).Data())));
       cut->AddCut(GetAnalysisCut("standardPrimaryTrackDCAz"));
       return cut;
-    }
+    });
   }
 
   std::vector<TString> vecPIDcase;
@@ -1844,21 +2008,21 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
 
   // loop to define PID cuts with and without post calibration
   for (size_t icase = 0; icase < vecPIDcase.size(); icase++) {
-    if (!nameStr.compare(Form("lmee_onlyTPCPID%s", vecPIDcase.at(icase).Data()))) {
+    factories.emplace(Form("lmee_onlyTPCPID%s", vecPIDcase.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
       cut->AddCut(GetAnalysisCut(Form("electronPIDOnly%s", vecPIDcase.at(icase).Data())));
       return cut;
-    }
+    });
 
-    if (!nameStr.compare(Form("ITSTPC_TPCPID%s_prefilter", vecPIDcase.at(icase).Data()))) {
+    factories.emplace(Form("ITSTPC_TPCPID%s_prefilter", vecPIDcase.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
       cut->AddCut(GetAnalysisCut("lmeePrefilterKine"));
       cut->AddCut(GetAnalysisCut("electronStandardQualityITSOnly"));
       cut->AddCut(GetAnalysisCut("electronStandardQualityTPCOnly"));
       cut->AddCut(GetAnalysisCut("PrimaryTrack_looseDCA"));
       cut->AddCut(GetAnalysisCut(Form("electronPIDOnly%s", vecPIDcase.at(icase).Data())));
       return cut;
-    }
+    });
 
-    if (!nameStr.compare(Form("ITS_ifTPC_TPCPID%s_prefilter", vecPIDcase.at(icase).Data()))) {
+    factories.emplace(Form("ITS_ifTPC_TPCPID%s_prefilter", vecPIDcase.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
       cut->AddCut(GetAnalysisCut("lmeePrefilterKine"));
       cut->AddCut(GetAnalysisCut("electronStandardQualityITSOnly"));
       cut->AddCut(GetAnalysisCut("PrimaryTrack_looseDCA"));
@@ -1875,9 +2039,9 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
       cut_OR->AddCut(cut_tpcpid);
       cut->AddCut(cut_OR);
       return cut;
-    }
+    });
 
-    if (!nameStr.compare(Form("ITS_ifTPCStandard_TPCPID%s_prefilter", vecPIDcase.at(icase).Data()))) {
+    factories.emplace(Form("ITS_ifTPCStandard_TPCPID%s_prefilter", vecPIDcase.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
       cut->AddCut(GetAnalysisCut("lmeePrefilterKine"));
       cut->AddCut(GetAnalysisCut("electronStandardQualityITSOnly"));
       cut->AddCut(GetAnalysisCut("PrimaryTrack_looseDCA"));
@@ -1894,18 +2058,18 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
       cut_OR->AddCut(cut_tpcpid);
       cut->AddCut(cut_OR);
       return cut;
-    }
+    });
 
-    if (!nameStr.compare(Form("ITSTPCbAny_TPCPID%s_prefilter", vecPIDcase.at(icase).Data()))) {
+    factories.emplace(Form("ITSTPCbAny_TPCPID%s_prefilter", vecPIDcase.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
       cut->AddCut(GetAnalysisCut("lmeePrefilterKine"));
       cut->AddCut(GetAnalysisCut("electronStandardQualitybAnyITSOnly"));
       cut->AddCut(GetAnalysisCut("electronStandardQualityTPCOnly"));
       cut->AddCut(GetAnalysisCut("PrimaryTrack_looseDCA"));
       cut->AddCut(GetAnalysisCut(Form("electronPIDOnly%s", vecPIDcase.at(icase).Data())));
       return cut;
-    }
+    });
 
-    if (!nameStr.compare(Form("ITSbAny_ifTPC_TPCPID%s_prefilter", vecPIDcase.at(icase).Data()))) {
+    factories.emplace(Form("ITSbAny_ifTPC_TPCPID%s_prefilter", vecPIDcase.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
       cut->AddCut(GetAnalysisCut("lmeePrefilterKine"));
       cut->AddCut(GetAnalysisCut("electronStandardQualitybAnyITSOnly"));
       cut->AddCut(GetAnalysisCut("PrimaryTrack_looseDCA"));
@@ -1922,9 +2086,9 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
       cut_OR->AddCut(cut_tpcpid);
       cut->AddCut(cut_OR);
       return cut;
-    }
+    });
 
-    if (!nameStr.compare(Form("ITSbAny_ifTPCStandard_TPCPID%s_prefilter", vecPIDcase.at(icase).Data()))) {
+    factories.emplace(Form("ITSbAny_ifTPCStandard_TPCPID%s_prefilter", vecPIDcase.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
       cut->AddCut(GetAnalysisCut("lmeePrefilterKine"));
       cut->AddCut(GetAnalysisCut("electronStandardQualitybAnyITSOnly"));
       cut->AddCut(GetAnalysisCut("PrimaryTrack_looseDCA"));
@@ -1941,10 +2105,10 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
       cut_OR->AddCut(cut_tpcpid);
       cut->AddCut(cut_OR);
       return cut;
-    }
+    });
 
     for (unsigned int i = 0; i < 30; i++) {
-      if (!nameStr.compare(Form("ElSelCutVar%s%i", vecPIDcase.at(icase).Data(), i))) {
+      factories.emplace(Form("ElSelCutVar%s%i", vecPIDcase.at(icase).Data(), i), [=](AnalysisCompositeCut* cut) {
         cut->AddCut(GetAnalysisCut("lmeeStandardKine"));
         cut->AddCut(GetAnalysisCut(Form("lmeeCutVarTrackCuts%i", i)));
         cut->AddCut(GetAnalysisCut("PrimaryTrack_looseDCA"));
@@ -1960,20 +2124,20 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
         cut_pid_OR->AddCut(cut_tof_nSigma);
         cut->AddCut(cut_pid_OR);
         return cut;
-      }
+      });
     }
 
     for (size_t jcase = 0; jcase < vecTypetrackWithPID.size(); jcase++) {
       // All previous cut with TightGlobalTrackRun3
-      if (!nameStr.compare(Form("ITSTPC%s_TPCPIDalone%s_PbPb", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()))) {
+      factories.emplace(Form("ITSTPC%s_TPCPIDalone%s_PbPb", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
         cut->AddCut(GetAnalysisCut("lmeeStandardKine"));
         cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrackWithPID.at(jcase).Data())));
         cut->AddCut(GetAnalysisCut("standardPrimaryTrackDCAz"));
         cut->AddCut(GetAnalysisCut(Form("electronPIDOnly%s", vecPIDcase.at(icase).Data())));
         return cut;
-      }
+      });
 
-      if (!nameStr.compare(Form("lmee%s_eNSigmaRun3%s_loose", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()))) {
+      factories.emplace(Form("lmee%s_eNSigmaRun3%s_loose", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
         cut->AddCut(GetAnalysisCut("lmeeStandardKine"));
         cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrackWithPID.at(jcase).Data())));
         cut->AddCut(GetAnalysisCut("PrimaryTrack_looseDCA"));
@@ -1989,9 +2153,9 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
         cut_pid_OR->AddCut(cut_tof_nSigma);
         cut->AddCut(cut_pid_OR);
         return cut;
-      }
+      });
 
-      if (!nameStr.compare(Form("lmee%s_eNSigmaRun3%s", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()))) {
+      factories.emplace(Form("lmee%s_eNSigmaRun3%s", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
         cut->AddCut(GetAnalysisCut("lmeeStandardKine"));
         cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrackWithPID.at(jcase).Data())));
         cut->AddCut(GetAnalysisCut("PrimaryTrack_looseDCA"));
@@ -2007,9 +2171,9 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
         cut_pid_OR->AddCut(cut_tof_nSigma);
         cut->AddCut(cut_pid_OR);
         return cut;
-      }
+      });
 
-      if (!nameStr.compare(Form("lmee%s_eNSigmaRun3%s_strongHadRej", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()))) {
+      factories.emplace(Form("lmee%s_eNSigmaRun3%s_strongHadRej", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
         cut->AddCut(GetAnalysisCut("lmeeStandardKine"));
         cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrackWithPID.at(jcase).Data())));
         cut->AddCut(GetAnalysisCut("PrimaryTrack_looseDCA"));
@@ -2025,9 +2189,9 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
         cut_pid_OR->AddCut(cut_tof_nSigma);
         cut->AddCut(cut_pid_OR);
         return cut;
-      }
+      });
 
-      if (!nameStr.compare(Form("lmee%s_eNSigmaRun3%s_strongNSigE", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()))) {
+      factories.emplace(Form("lmee%s_eNSigmaRun3%s_strongNSigE", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
         cut->AddCut(GetAnalysisCut("lmeeStandardKine"));
         cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrackWithPID.at(jcase).Data())));
         cut->AddCut(GetAnalysisCut("PrimaryTrack_looseDCA"));
@@ -2043,9 +2207,9 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
         cut_pid_OR->AddCut(cut_tof_nSigma);
         cut->AddCut(cut_pid_OR);
         return cut;
-      }
+      });
 
-      if (!nameStr.compare(Form("lmee%s_eNSigmaRun3%s_strongNSigE_rejBadTOF", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()))) {
+      factories.emplace(Form("lmee%s_eNSigmaRun3%s_strongNSigE_rejBadTOF", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
         cut->AddCut(GetAnalysisCut("lmeeStandardKine"));
         cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrackWithPID.at(jcase).Data())));
         cut->AddCut(GetAnalysisCut("PrimaryTrack_looseDCA"));
@@ -2061,17 +2225,17 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
         cut_pid_OR->AddCut(cut_tof_nSigma);
         cut->AddCut(cut_pid_OR);
         return cut;
-      }
+      });
 
-      if (!nameStr.compare(Form("lmee%s_eNSigmaRun3%s_TOFreq", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()))) {
+      factories.emplace(Form("lmee%s_eNSigmaRun3%s_TOFreq", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
         cut->AddCut(GetAnalysisCut("lmeeStandardKine"));
         cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrackWithPID.at(jcase).Data())));
         cut->AddCut(GetAnalysisCut("PrimaryTrack_looseDCA"));
         cut->AddCut(GetAnalysisCut(Form("electronPID_TPC_TOFnsigma%s", vecPIDcase.at(icase).Data())));
         return cut;
-      }
+      });
 
-      if (!nameStr.compare(Form("lmee%s_eNSigmaRun3%s_Resol", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()))) {
+      factories.emplace(Form("lmee%s_eNSigmaRun3%s_Resol", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
         cut->AddCut(GetAnalysisCut("openEtaSel")); // No pt cut and wider eta cut to produce resolution maps
         cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrackWithPID.at(jcase).Data())));
         cut->AddCut(GetAnalysisCut("PrimaryTrack_looseDCA"));
@@ -2087,9 +2251,9 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
         cut_pid_OR->AddCut(cut_tof_nSigma);
         cut->AddCut(cut_pid_OR);
         return cut;
-      }
+      });
 
-      if (!nameStr.compare(Form("lmee%s_eNSigmaRun3%s_tightNSigEPbPb_rejBadTOF", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()))) {
+      factories.emplace(Form("lmee%s_eNSigmaRun3%s_tightNSigEPbPb_rejBadTOF", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
         cut->AddCut(GetAnalysisCut("lmeeStandardKine"));
         cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrackWithPID.at(jcase).Data())));
         cut->AddCut(GetAnalysisCut("standardPrimaryTrackDCAz"));
@@ -2105,9 +2269,9 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
         cut_pid_OR->AddCut(cut_tof_nSigma);
         cut->AddCut(cut_pid_OR);
         return cut;
-      }
+      });
 
-      if (!nameStr.compare(Form("lmee%s_eNSigmaRun3%s_strongNSigEPbPb_rejBadTOF", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()))) {
+      factories.emplace(Form("lmee%s_eNSigmaRun3%s_strongNSigEPbPb_rejBadTOF", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
         cut->AddCut(GetAnalysisCut("lmeeStandardKine"));
         cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrackWithPID.at(jcase).Data())));
         cut->AddCut(GetAnalysisCut("standardPrimaryTrackDCAz"));
@@ -2123,9 +2287,9 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
         cut_pid_OR->AddCut(cut_tof_nSigma);
         cut->AddCut(cut_pid_OR);
         return cut;
-      }
+      });
 
-      if (!nameStr.compare(Form("lmee%s_eNSigmaRun3%s_tightNSigEPbPb_rejBadTOF_pt04", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()))) {
+      factories.emplace(Form("lmee%s_eNSigmaRun3%s_tightNSigEPbPb_rejBadTOF_pt04", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
         cut->AddCut(GetAnalysisCut("lmeeStandardKine_pt04"));
         cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrackWithPID.at(jcase).Data())));
         cut->AddCut(GetAnalysisCut("standardPrimaryTrackDCAz"));
@@ -2141,9 +2305,9 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
         cut_pid_OR->AddCut(cut_tof_nSigma);
         cut->AddCut(cut_pid_OR);
         return cut;
-      }
+      });
 
-      if (!nameStr.compare(Form("lmee%s_eNSigmaRun3%s_strongNSigEPbPb_rejBadTOF_pt04", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()))) {
+      factories.emplace(Form("lmee%s_eNSigmaRun3%s_strongNSigEPbPb_rejBadTOF_pt04", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
         cut->AddCut(GetAnalysisCut("lmeeStandardKine_pt04"));
         cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrackWithPID.at(jcase).Data())));
         cut->AddCut(GetAnalysisCut("standardPrimaryTrackDCAz"));
@@ -2159,9 +2323,9 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
         cut_pid_OR->AddCut(cut_tof_nSigma);
         cut->AddCut(cut_pid_OR);
         return cut;
-      }
+      });
 
-      if (!nameStr.compare(Form("lmee%s_lowB_eNSigmaRun3%s_strongNSigE", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()))) {
+      factories.emplace(Form("lmee%s_lowB_eNSigmaRun3%s_strongNSigE", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
         cut->AddCut(GetAnalysisCut("lmeeLowBKine"));
         cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrackWithPID.at(jcase).Data())));
         cut->AddCut(GetAnalysisCut("standardPrimaryTrackDCAz")); // to reject looper using DCAz
@@ -2177,9 +2341,9 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
         cut_pid_OR->AddCut(cut_tof_nSigma);
         cut->AddCut(cut_pid_OR);
         return cut;
-      }
+      });
 
-      if (!nameStr.compare(Form("lmee%s_lowB_eNSigmaRun3%s_strongNSigE_rejBadTOF", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()))) {
+      factories.emplace(Form("lmee%s_lowB_eNSigmaRun3%s_strongNSigE_rejBadTOF", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
         cut->AddCut(GetAnalysisCut("lmeeLowBKine"));
         cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrackWithPID.at(jcase).Data())));
         cut->AddCut(GetAnalysisCut("standardPrimaryTrackDCAz")); // to reject looper using DCAz
@@ -2195,26 +2359,26 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
         cut_pid_OR->AddCut(cut_tof_nSigma);
         cut->AddCut(cut_pid_OR);
         return cut;
-      }
+      });
 
-      if (!nameStr.compare(Form("lmee%s_TOFreqRun3%s_strongNSigEPbPb_rejBadTOF_pt04", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()))) {
+      factories.emplace(Form("lmee%s_TOFreqRun3%s_strongNSigEPbPb_rejBadTOF_pt04", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
         cut->AddCut(GetAnalysisCut("lmeeStandardKine_pt04"));
         cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrackWithPID.at(jcase).Data())));
         cut->AddCut(GetAnalysisCut("standardPrimaryTrackDCAz"));
         cut->AddCut(GetAnalysisCut(Form("electronPID_TOFreq%s_strongNSigEPbPb_rejBadTOF", vecPIDcase.at(icase).Data())));
         return cut;
-      }
+      });
 
-      if (!nameStr.compare(Form("lmee%s_TOFreqRun3%s_tightNSigEPbPb_rejBadTOF_pt04", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()))) {
+      factories.emplace(Form("lmee%s_TOFreqRun3%s_tightNSigEPbPb_rejBadTOF_pt04", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
         cut->AddCut(GetAnalysisCut("lmeeStandardKine_pt04"));
         cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrackWithPID.at(jcase).Data())));
         cut->AddCut(GetAnalysisCut("standardPrimaryTrackDCAz"));
         cut->AddCut(GetAnalysisCut(Form("electronPID_TOFreq%s_tightNSigEPbPb_rejBadTOF", vecPIDcase.at(icase).Data())));
         return cut;
-      }
+      });
 
       // 8 cuts for QC
-      if (!nameStr.compare(Form("lmee%s_NSigmaRun3_posEta%s_strongNSigEPbPb_rejBadTOF", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()))) {
+      factories.emplace(Form("lmee%s_NSigmaRun3_posEta%s_strongNSigEPbPb_rejBadTOF", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
         cut->AddCut(GetAnalysisCut("pt02Sel"));
         cut->AddCut(GetAnalysisCut("posEtaSel"));
         cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrackWithPID.at(jcase).Data())));
@@ -2231,9 +2395,9 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
         cut_pid_OR->AddCut(cut_tof_nSigma);
         cut->AddCut(cut_pid_OR);
         return cut;
-      }
+      });
 
-      if (!nameStr.compare(Form("lmee%s_NSigmaRun3_negEta%s_strongNSigEPbPb_rejBadTOF", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()))) {
+      factories.emplace(Form("lmee%s_NSigmaRun3_negEta%s_strongNSigEPbPb_rejBadTOF", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
         cut->AddCut(GetAnalysisCut("pt02Sel"));
         cut->AddCut(GetAnalysisCut("negEtaSel"));
         cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrackWithPID.at(jcase).Data())));
@@ -2250,9 +2414,9 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
         cut_pid_OR->AddCut(cut_tof_nSigma);
         cut->AddCut(cut_pid_OR);
         return cut;
-      }
+      });
 
-      if (!nameStr.compare(Form("lmee%s_NSigmaRun3_posEta%s_strongNSigEPbPb_rejBadTOF_pt04", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()))) {
+      factories.emplace(Form("lmee%s_NSigmaRun3_posEta%s_strongNSigEPbPb_rejBadTOF_pt04", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
         cut->AddCut(GetAnalysisCut("pt04Sel"));
         cut->AddCut(GetAnalysisCut("posEtaSel"));
         cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrackWithPID.at(jcase).Data())));
@@ -2269,9 +2433,9 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
         cut_pid_OR->AddCut(cut_tof_nSigma);
         cut->AddCut(cut_pid_OR);
         return cut;
-      }
+      });
 
-      if (!nameStr.compare(Form("lmee%s_NSigmaRun3_negEta%s_strongNSigEPbPb_rejBadTOF_pt04", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()))) {
+      factories.emplace(Form("lmee%s_NSigmaRun3_negEta%s_strongNSigEPbPb_rejBadTOF_pt04", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
         cut->AddCut(GetAnalysisCut("pt04Sel"));
         cut->AddCut(GetAnalysisCut("negEtaSel"));
         cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrackWithPID.at(jcase).Data())));
@@ -2288,9 +2452,9 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
         cut_pid_OR->AddCut(cut_tof_nSigma);
         cut->AddCut(cut_pid_OR);
         return cut;
-      }
+      });
 
-      if (!nameStr.compare(Form("lmee%s_posNSigmaRun3_posEta%s_strongNSigEPbPb_rejBadTOF", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()))) {
+      factories.emplace(Form("lmee%s_posNSigmaRun3_posEta%s_strongNSigEPbPb_rejBadTOF", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
         cut->AddCut(GetAnalysisCut("posTrack"));
         cut->AddCut(GetAnalysisCut("posEtaSel"));
         cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrackWithPID.at(jcase).Data())));
@@ -2307,9 +2471,9 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
         cut_pid_OR->AddCut(cut_tof_nSigma);
         cut->AddCut(cut_pid_OR);
         return cut;
-      }
+      });
 
-      if (!nameStr.compare(Form("lmee%s_posNSigmaRun3_negEta%s_strongNSigEPbPb_rejBadTOF", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()))) {
+      factories.emplace(Form("lmee%s_posNSigmaRun3_negEta%s_strongNSigEPbPb_rejBadTOF", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
         cut->AddCut(GetAnalysisCut("posTrack"));
         cut->AddCut(GetAnalysisCut("negEtaSel"));
         cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrackWithPID.at(jcase).Data())));
@@ -2326,9 +2490,9 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
         cut_pid_OR->AddCut(cut_tof_nSigma);
         cut->AddCut(cut_pid_OR);
         return cut;
-      }
+      });
 
-      if (!nameStr.compare(Form("lmee%s_negNSigmaRun3_posEta%s_strongNSigEPbPb_rejBadTOF", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()))) {
+      factories.emplace(Form("lmee%s_negNSigmaRun3_posEta%s_strongNSigEPbPb_rejBadTOF", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
         cut->AddCut(GetAnalysisCut("negTrack"));
         cut->AddCut(GetAnalysisCut("posEtaSel"));
         cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrackWithPID.at(jcase).Data())));
@@ -2345,9 +2509,9 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
         cut_pid_OR->AddCut(cut_tof_nSigma);
         cut->AddCut(cut_pid_OR);
         return cut;
-      }
+      });
 
-      if (!nameStr.compare(Form("lmee%s_negNSigmaRun3_negEta%s_strongNSigEPbPb_rejBadTOF", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()))) {
+      factories.emplace(Form("lmee%s_negNSigmaRun3_negEta%s_strongNSigEPbPb_rejBadTOF", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
         cut->AddCut(GetAnalysisCut("negTrack"));
         cut->AddCut(GetAnalysisCut("negEtaSel"));
         cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrackWithPID.at(jcase).Data())));
@@ -2364,64 +2528,64 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
         cut_pid_OR->AddCut(cut_tof_nSigma);
         cut->AddCut(cut_pid_OR);
         return cut;
-      }
+      });
 
       // 6 cuts for QC
-      if (!nameStr.compare(Form("lmee%s_posTOFreqRun3_posEta%s_strongNSigEPbPb_rejBadTOF", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()))) {
+      factories.emplace(Form("lmee%s_posTOFreqRun3_posEta%s_strongNSigEPbPb_rejBadTOF", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
         cut->AddCut(GetAnalysisCut("posTrack"));
         cut->AddCut(GetAnalysisCut("posEtaSel"));
         cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrackWithPID.at(jcase).Data())));
         cut->AddCut(GetAnalysisCut("standardPrimaryTrackDCAz"));
         cut->AddCut(GetAnalysisCut(Form("electronPID_TOFreq%s_strongNSigEPbPb_rejBadTOF", vecPIDcase.at(icase).Data())));
         return cut;
-      }
+      });
 
-      if (!nameStr.compare(Form("lmee%s_posTOFreqRun3_negEta%s_strongNSigEPbPb_rejBadTOF", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()))) {
+      factories.emplace(Form("lmee%s_posTOFreqRun3_negEta%s_strongNSigEPbPb_rejBadTOF", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
         cut->AddCut(GetAnalysisCut("posTrack"));
         cut->AddCut(GetAnalysisCut("negEtaSel"));
         cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrackWithPID.at(jcase).Data())));
         cut->AddCut(GetAnalysisCut("standardPrimaryTrackDCAz"));
         cut->AddCut(GetAnalysisCut(Form("electronPID_TOFreq%s_strongNSigEPbPb_rejBadTOF", vecPIDcase.at(icase).Data())));
         return cut;
-      }
+      });
 
-      if (!nameStr.compare(Form("lmee%s_TOFreqRun3_posEta%s_strongNSigEPbPb_rejBadTOF_pt04", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()))) {
+      factories.emplace(Form("lmee%s_TOFreqRun3_posEta%s_strongNSigEPbPb_rejBadTOF_pt04", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
         cut->AddCut(GetAnalysisCut("pt04Sel"));
         cut->AddCut(GetAnalysisCut("posEtaSel"));
         cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrackWithPID.at(jcase).Data())));
         cut->AddCut(GetAnalysisCut("standardPrimaryTrackDCAz"));
         cut->AddCut(GetAnalysisCut(Form("electronPID_TOFreq%s_strongNSigEPbPb_rejBadTOF", vecPIDcase.at(icase).Data())));
         return cut;
-      }
+      });
 
-      if (!nameStr.compare(Form("lmee%s_TOFreqRun3_negEta%s_strongNSigEPbPb_rejBadTOF_pt04", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()))) {
+      factories.emplace(Form("lmee%s_TOFreqRun3_negEta%s_strongNSigEPbPb_rejBadTOF_pt04", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
         cut->AddCut(GetAnalysisCut("pt04Sel"));
         cut->AddCut(GetAnalysisCut("negEtaSel"));
         cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrackWithPID.at(jcase).Data())));
         cut->AddCut(GetAnalysisCut("standardPrimaryTrackDCAz"));
         cut->AddCut(GetAnalysisCut(Form("electronPID_TOFreq%s_strongNSigEPbPb_rejBadTOF", vecPIDcase.at(icase).Data())));
         return cut;
-      }
+      });
 
-      if (!nameStr.compare(Form("lmee%s_negTOFreqRun3_posEta%s_strongNSigEPbPb_rejBadTOF", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()))) {
+      factories.emplace(Form("lmee%s_negTOFreqRun3_posEta%s_strongNSigEPbPb_rejBadTOF", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
         cut->AddCut(GetAnalysisCut("negTrack"));
         cut->AddCut(GetAnalysisCut("posEtaSel"));
         cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrackWithPID.at(jcase).Data())));
         cut->AddCut(GetAnalysisCut("standardPrimaryTrackDCAz"));
         cut->AddCut(GetAnalysisCut(Form("electronPID_TOFreq%s_strongNSigEPbPb_rejBadTOF", vecPIDcase.at(icase).Data())));
         return cut;
-      }
+      });
 
-      if (!nameStr.compare(Form("lmee%s_negTOFreqRun3_negEta%s_strongNSigEPbPb_rejBadTOF", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()))) {
+      factories.emplace(Form("lmee%s_negTOFreqRun3_negEta%s_strongNSigEPbPb_rejBadTOF", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
         cut->AddCut(GetAnalysisCut("negTrack"));
         cut->AddCut(GetAnalysisCut("negEtaSel"));
         cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrackWithPID.at(jcase).Data())));
         cut->AddCut(GetAnalysisCut("standardPrimaryTrackDCAz"));
         cut->AddCut(GetAnalysisCut(Form("electronPID_TOFreq%s_strongNSigEPbPb_rejBadTOF", vecPIDcase.at(icase).Data())));
         return cut;
-      }
+      });
 
-      if (!nameStr.compare(Form("lmee%s_eNSigmaRun3%s_TPC_PID", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()))) {
+      factories.emplace(Form("lmee%s_eNSigmaRun3%s_TPC_PID", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
         cut->AddCut(GetAnalysisCut("lmeeStandardKine"));
         cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrackWithPID.at(jcase).Data())));
         cut->AddCut(GetAnalysisCut("PrimaryTrack_looseDCA"));
@@ -2431,9 +2595,9 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
 
         cut->AddCut(cut_tpc_nSigma);
         return cut;
-      }
+      });
 
-      if (!nameStr.compare(Form("lmee%s_eNSigmaRun3%s_TOF_PID", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()))) {
+      factories.emplace(Form("lmee%s_eNSigmaRun3%s_TOF_PID", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
         cut->AddCut(GetAnalysisCut("lmeeStandardKine"));
         cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrackWithPID.at(jcase).Data())));
         cut->AddCut(GetAnalysisCut("PrimaryTrack_looseDCA"));
@@ -2443,9 +2607,9 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
 
         cut->AddCut(cut_tof_nSigma);
         return cut;
-      }
+      });
 
-      if (!nameStr.compare(Form("lmee%s_eNSigmaRun3%s_strongNSigE_DCA05", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()))) {
+      factories.emplace(Form("lmee%s_eNSigmaRun3%s_strongNSigE_DCA05", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
         cut->AddCut(GetAnalysisCut("lmeeStandardKine"));
         cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrackWithPID.at(jcase).Data())));
         cut->AddCut(GetAnalysisCut("PrimaryTrack_DCA05"));
@@ -2461,10 +2625,10 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
         cut_pid_OR->AddCut(cut_tof_nSigma);
         cut->AddCut(cut_pid_OR);
         return cut;
-      }
+      });
 
       // 4 cuts to separate pos & neg tracks in pos & neg eta range applying electron PID
-      if (!nameStr.compare(Form("lmee%s_posNSigmaRun3_posEta%s_strongNSigE", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()))) {
+      factories.emplace(Form("lmee%s_posNSigmaRun3_posEta%s_strongNSigE", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
         cut->AddCut(GetAnalysisCut("posTrack"));
         cut->AddCut(GetAnalysisCut("posEtaSel"));
         cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrackWithPID.at(jcase).Data())));
@@ -2481,9 +2645,9 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
         cut_pid_OR->AddCut(cut_tof_nSigma);
         cut->AddCut(cut_pid_OR);
         return cut;
-      }
+      });
 
-      if (!nameStr.compare(Form("lmee%s_negNSigmaRun3_posEta%s_strongNSigE", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()))) {
+      factories.emplace(Form("lmee%s_negNSigmaRun3_posEta%s_strongNSigE", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
         cut->AddCut(GetAnalysisCut("negTrack"));
         cut->AddCut(GetAnalysisCut("posEtaSel"));
         cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrackWithPID.at(jcase).Data())));
@@ -2500,9 +2664,9 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
         cut_pid_OR->AddCut(cut_tof_nSigma);
         cut->AddCut(cut_pid_OR);
         return cut;
-      }
+      });
 
-      if (!nameStr.compare(Form("lmee%s_posNSigmaRun3_negEta%s_strongNSigE", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()))) {
+      factories.emplace(Form("lmee%s_posNSigmaRun3_negEta%s_strongNSigE", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
         cut->AddCut(GetAnalysisCut("posTrack"));
         cut->AddCut(GetAnalysisCut("negEtaSel"));
         cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrackWithPID.at(jcase).Data())));
@@ -2519,9 +2683,9 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
         cut_pid_OR->AddCut(cut_tof_nSigma);
         cut->AddCut(cut_pid_OR);
         return cut;
-      }
+      });
 
-      if (!nameStr.compare(Form("lmee%s_negNSigmaRun3_negEta%s_strongNSigE", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()))) {
+      factories.emplace(Form("lmee%s_negNSigmaRun3_negEta%s_strongNSigE", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
         cut->AddCut(GetAnalysisCut("negTrack"));
         cut->AddCut(GetAnalysisCut("negEtaSel"));
         cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrackWithPID.at(jcase).Data())));
@@ -2538,10 +2702,10 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
         cut_pid_OR->AddCut(cut_tof_nSigma);
         cut->AddCut(cut_pid_OR);
         return cut;
-      }
+      });
 
       // 4 cuts to separate pos & neg tracks in pos & neg eta range applying electron PID for low B field
-      if (!nameStr.compare(Form("lmee%s_lowB_posNSigmaRun3_posEta%s_strongNSigE", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()))) {
+      factories.emplace(Form("lmee%s_lowB_posNSigmaRun3_posEta%s_strongNSigE", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
         cut->AddCut(GetAnalysisCut("posTrack"));
         cut->AddCut(GetAnalysisCut("posEtaSel"));
         cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrackWithPID.at(jcase).Data())));
@@ -2558,9 +2722,9 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
         cut_pid_OR->AddCut(cut_tof_nSigma);
         cut->AddCut(cut_pid_OR);
         return cut;
-      }
+      });
 
-      if (!nameStr.compare(Form("lmee%s_lowB_negNSigmaRun3_posEta%s_strongNSigE", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()))) {
+      factories.emplace(Form("lmee%s_lowB_negNSigmaRun3_posEta%s_strongNSigE", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
         cut->AddCut(GetAnalysisCut("negTrack"));
         cut->AddCut(GetAnalysisCut("posEtaSel"));
         cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrackWithPID.at(jcase).Data())));
@@ -2577,9 +2741,9 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
         cut_pid_OR->AddCut(cut_tof_nSigma);
         cut->AddCut(cut_pid_OR);
         return cut;
-      }
+      });
 
-      if (!nameStr.compare(Form("lmee%s_lowB_posNSigmaRun3_negEta%s_strongNSigE", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()))) {
+      factories.emplace(Form("lmee%s_lowB_posNSigmaRun3_negEta%s_strongNSigE", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
         cut->AddCut(GetAnalysisCut("posTrack"));
         cut->AddCut(GetAnalysisCut("negEtaSel"));
         cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrackWithPID.at(jcase).Data())));
@@ -2596,9 +2760,9 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
         cut_pid_OR->AddCut(cut_tof_nSigma);
         cut->AddCut(cut_pid_OR);
         return cut;
-      }
+      });
 
-      if (!nameStr.compare(Form("lmee%s_lowB_negNSigmaRun3_negEta%s_strongNSigE", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()))) {
+      factories.emplace(Form("lmee%s_lowB_negNSigmaRun3_negEta%s_strongNSigE", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
         cut->AddCut(GetAnalysisCut("negTrack"));
         cut->AddCut(GetAnalysisCut("negEtaSel"));
         cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrackWithPID.at(jcase).Data())));
@@ -2615,10 +2779,10 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
         cut_pid_OR->AddCut(cut_tof_nSigma);
         cut->AddCut(cut_pid_OR);
         return cut;
-      }
+      });
 
       // 4 cuts to separate pos & neg tracks in pos & neg eta range applying electron PID for low B field with bad TOF rejection
-      if (!nameStr.compare(Form("lmee%s_lowB_posNSigmaRun3_posEta%s_strongNSigE_rejBadTOF", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()))) {
+      factories.emplace(Form("lmee%s_lowB_posNSigmaRun3_posEta%s_strongNSigE_rejBadTOF", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
         cut->AddCut(GetAnalysisCut("posTrack"));
         cut->AddCut(GetAnalysisCut("posEtaSel"));
         cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrackWithPID.at(jcase).Data())));
@@ -2635,9 +2799,9 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
         cut_pid_OR->AddCut(cut_tof_nSigma);
         cut->AddCut(cut_pid_OR);
         return cut;
-      }
+      });
 
-      if (!nameStr.compare(Form("lmee%s_lowB_negNSigmaRun3_posEta%s_strongNSigE_rejBadTOF", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()))) {
+      factories.emplace(Form("lmee%s_lowB_negNSigmaRun3_posEta%s_strongNSigE_rejBadTOF", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
         cut->AddCut(GetAnalysisCut("negTrack"));
         cut->AddCut(GetAnalysisCut("posEtaSel"));
         cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrackWithPID.at(jcase).Data())));
@@ -2654,9 +2818,9 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
         cut_pid_OR->AddCut(cut_tof_nSigma);
         cut->AddCut(cut_pid_OR);
         return cut;
-      }
+      });
 
-      if (!nameStr.compare(Form("lmee%s_lowB_posNSigmaRun3_negEta%s_strongNSigE_rejBadTOF", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()))) {
+      factories.emplace(Form("lmee%s_lowB_posNSigmaRun3_negEta%s_strongNSigE_rejBadTOF", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
         cut->AddCut(GetAnalysisCut("posTrack"));
         cut->AddCut(GetAnalysisCut("negEtaSel"));
         cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrackWithPID.at(jcase).Data())));
@@ -2673,9 +2837,9 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
         cut_pid_OR->AddCut(cut_tof_nSigma);
         cut->AddCut(cut_pid_OR);
         return cut;
-      }
+      });
 
-      if (!nameStr.compare(Form("lmee%s_lowB_negNSigmaRun3_negEta%s_strongNSigE_rejBadTOF", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()))) {
+      factories.emplace(Form("lmee%s_lowB_negNSigmaRun3_negEta%s_strongNSigE_rejBadTOF", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
         cut->AddCut(GetAnalysisCut("negTrack"));
         cut->AddCut(GetAnalysisCut("negEtaSel"));
         cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrackWithPID.at(jcase).Data())));
@@ -2692,10 +2856,10 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
         cut_pid_OR->AddCut(cut_tof_nSigma);
         cut->AddCut(cut_pid_OR);
         return cut;
-      }
+      });
 
       // some older cuts
-      if (!nameStr.compare(Form("lmee%s_pp502TeV_PID%s", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()))) {
+      factories.emplace(Form("lmee%s_pp502TeV_PID%s", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
         cut->AddCut(GetAnalysisCut("lmeeStandardKine"));
         cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrackWithPID.at(jcase).Data())));
         cut->AddCut(GetAnalysisCut("PrimaryTrack_looseDCA"));
@@ -2711,10 +2875,10 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
         cut_pid_OR->AddCut(cut_tof_nSigma);
         cut->AddCut(cut_pid_OR);
         return cut;
-      }
+      });
 
       for (int i = 1; i <= 8; i++) {
-        if (!nameStr.compare(Form("lmee%s_pp502TeV_PID%s_UsePrefilter%d", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data(), i))) {
+        factories.emplace(Form("lmee%s_pp502TeV_PID%s_UsePrefilter%d", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data(), i), [=](AnalysisCompositeCut* cut) {
           cut->AddCut(GetAnalysisCut(Form("notDalitzLeg%d", i)));
           cut->AddCut(GetAnalysisCut("lmeeStandardKine"));
           cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrackWithPID.at(jcase).Data())));
@@ -2731,10 +2895,10 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
           cut_pid_OR->AddCut(cut_tof_nSigma);
           cut->AddCut(cut_pid_OR);
           return cut;
-        }
+        });
       }
 
-      if (!nameStr.compare(Form("lmee%s_pp502TeV_lowB_PID%s", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()))) {
+      factories.emplace(Form("lmee%s_pp502TeV_lowB_PID%s", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
         cut->AddCut(GetAnalysisCut("lmeeLowBKine"));
         cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrackWithPID.at(jcase).Data())));
         cut->AddCut(GetAnalysisCut("standardPrimaryTrackDCAz")); // DCAz to reject loopers
@@ -2750,9 +2914,9 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
         cut_pid_OR->AddCut(cut_tof_nSigma);
         cut->AddCut(cut_pid_OR);
         return cut;
-      }
+      });
 
-      if (!nameStr.compare(Form("lmee%s_eNSigmaRun3%s_pt04", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()))) {
+      factories.emplace(Form("lmee%s_eNSigmaRun3%s_pt04", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
         cut->AddCut(GetAnalysisCut("lmeeStandardKine_pt04"));
         cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrackWithPID.at(jcase).Data())));
         cut->AddCut(GetAnalysisCut("PrimaryTrack_looseDCA"));
@@ -2768,10 +2932,10 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
         cut_pid_OR->AddCut(cut_tof_nSigma);
         cut->AddCut(cut_pid_OR);
         return cut;
-      }
+      });
 
       for (int i = 1; i <= 8; i++) {
-        if (!nameStr.compare(Form("lmee%s_eNSigmaRun3%s_UsePrefilter%d", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data(), i))) {
+        factories.emplace(Form("lmee%s_eNSigmaRun3%s_UsePrefilter%d", vecTypetrackWithPID.at(jcase).Data(), vecPIDcase.at(icase).Data(), i), [=](AnalysisCompositeCut* cut) {
           cut->AddCut(GetAnalysisCut(Form("notDalitzLeg%d", i)));
           cut->AddCut(GetAnalysisCut("lmeeStandardKine"));
           cut->AddCut(GetAnalysisCut(Form("lmeeQCTrackCuts%s", vecTypetrackWithPID.at(jcase).Data())));
@@ -2788,11 +2952,11 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
           cut_pid_OR->AddCut(cut_tof_nSigma);
           cut->AddCut(cut_pid_OR);
           return cut;
-        }
+        });
       }
     }
 
-    if (!nameStr.compare(Form("lmee_eNSigmaRun3%s_strongTPC", vecPIDcase.at(icase).Data()))) {
+    factories.emplace(Form("lmee_eNSigmaRun3%s_strongTPC", vecPIDcase.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
       cut->AddCut(GetAnalysisCut("lmeeStandardKine"));
       cut->AddCut(GetAnalysisCut("TightGlobalTrackRun3_strongTPC"));
       cut->AddCut(GetAnalysisCut("PrimaryTrack_looseDCA"));
@@ -2808,9 +2972,9 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
       cut_pid_OR->AddCut(cut_tof_nSigma);
       cut->AddCut(cut_pid_OR);
       return cut;
-    }
+    });
 
-    if (!nameStr.compare(Form("lmee_skimmingtesta_PID%s", vecPIDcase.at(icase).Data()))) {
+    factories.emplace(Form("lmee_skimmingtesta_PID%s", vecPIDcase.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
       cut->AddCut(GetAnalysisCut("lmeeStandardKine"));
       cut->AddCut(GetAnalysisCut("LooseGlobalTrackRun3"));
       cut->AddCut(GetAnalysisCut("PrimaryTrack_looseDCA"));
@@ -2826,9 +2990,9 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
       cut_pid_OR->AddCut(cut_tof_nSigma);
       cut->AddCut(cut_pid_OR);
       return cut;
-    }
+    });
 
-    if (!nameStr.compare(Form("lmee_skimmingtestb_PID%s", vecPIDcase.at(icase).Data()))) {
+    factories.emplace(Form("lmee_skimmingtestb_PID%s", vecPIDcase.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
       cut->AddCut(GetAnalysisCut("lmeeStandardKine"));
       cut->AddCut(GetAnalysisCut("LooseGlobalTrackRun3"));
       cut->AddCut(GetAnalysisCut("PrimaryTrack_looseDCA"));
@@ -2838,68 +3002,68 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
 
       cut->AddCut(cut_tpc_nSigma);
       return cut;
-    }
+    });
 
-    if (!nameStr.compare(Form("lmee_skimmingtesta_TOF%s", vecPIDcase.at(icase).Data()))) {
+    factories.emplace(Form("lmee_skimmingtesta_TOF%s", vecPIDcase.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
       cut->AddCut(GetAnalysisCut("lmeeStandardKine"));
       cut->AddCut(GetAnalysisCut("LooseGlobalTrackRun3"));
       cut->AddCut(GetAnalysisCut("PrimaryTrack_looseDCA"));
       cut->AddCut(GetAnalysisCut(Form("lmee_pp_502TeV_TOFloose%s", vecPIDcase.at(icase).Data())));
       return cut;
-    }
+    });
 
-    if (!nameStr.compare(Form("lmee_skimmingtesta_TOF_pionrej%s", vecPIDcase.at(icase).Data()))) {
+    factories.emplace(Form("lmee_skimmingtesta_TOF_pionrej%s", vecPIDcase.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
       cut->AddCut(GetAnalysisCut("lmeeStandardKine"));
       cut->AddCut(GetAnalysisCut("LooseGlobalTrackRun3"));
       cut->AddCut(GetAnalysisCut("PrimaryTrack_looseDCA"));
       cut->AddCut(GetAnalysisCut(Form("lmee_pp_502TeV_TOFloose_pionrej%s", vecPIDcase.at(icase).Data())));
       return cut;
-    }
+    });
 
-    if (!nameStr.compare(Form("lmee_skimmingtesta_TOF_pionrej_noDCA%s", vecPIDcase.at(icase).Data()))) {
+    factories.emplace(Form("lmee_skimmingtesta_TOF_pionrej_noDCA%s", vecPIDcase.at(icase).Data()), [=](AnalysisCompositeCut* cut) {
       cut->AddCut(GetAnalysisCut("lmeeStandardKine"));
       cut->AddCut(GetAnalysisCut("LooseGlobalTrackRun3"));
       cut->AddCut(GetAnalysisCut(Form("lmee_pp_502TeV_TOFloose_pionrej%s", vecPIDcase.at(icase).Data())));
       return cut;
-    }
+    });
   }
 
-  if (!nameStr.compare("testCut_chic")) {
+  factories.emplace("testCut_chic", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiStandardKine5"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
     cut->AddCut(GetAnalysisCut("electronPIDnsigma"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("lmee_GlobalTrackRun3")) {
+  factories.emplace("lmee_GlobalTrackRun3", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("lmeeStandardKine"));
     cut->AddCut(GetAnalysisCut("TightGlobalTrackRun3"));
     cut->AddCut(GetAnalysisCut("PrimaryTrack_looseDCA"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("lmee_GlobalTrackRun3_lowPt")) {
+  factories.emplace("lmee_GlobalTrackRun3_lowPt", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("lmeeLowBKine"));
     cut->AddCut(GetAnalysisCut("TightGlobalTrackRun3"));
     cut->AddCut(GetAnalysisCut("PrimaryTrack_looseDCA"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("lmee_TPCTrackRun3_lowPt")) {
+  factories.emplace("lmee_TPCTrackRun3_lowPt", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("lmeeLowBKine"));
     cut->AddCut(GetAnalysisCut("TightTPCTrackRun3"));
     cut->AddCut(GetAnalysisCut("PrimaryTrack_looseDCA"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("lmee_TPCTrackRun3")) {
+  factories.emplace("lmee_TPCTrackRun3", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("lmeeStandardKine"));
     cut->AddCut(GetAnalysisCut("TightTPCTrackRun3"));
     cut->AddCut(GetAnalysisCut("PrimaryTrack_looseDCA"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("trackCut_compareDQEMframework")) { // cut setting to check least common factor between reduced data sets of PWGEM and PWGDQ
+  factories.emplace("trackCut_compareDQEMframework", [](AnalysisCompositeCut* cut) { // cut setting to check least common factor between reduced data sets of PWGEM and PWGDQ
     cut->AddCut(GetAnalysisCut("lmeeStandardKine"));
     cut->AddCut(GetAnalysisCut("trackQuality_compareDQEMframework"));
     cut->AddCut(GetAnalysisCut("trackDCA1cm"));
@@ -2913,889 +3077,883 @@ AnalysisCompositeCut* o2::aod::dqcuts::GetCompositeCut(const char* cutName)
     cut_pid_OR->AddCut(cut_tpc_nSigma);
     cut_pid_OR->AddCut(cut_tof_nSigma);
     return cut;
-  }
+  });
 
   // -------------------------------------------------------------------------------------------------
   // lmee pair cuts
 
-  if (!nameStr.compare("pairPhiV")) {
+  factories.emplace("pairPhiV", [](AnalysisCompositeCut* cut) {
     AnalysisCompositeCut* cut_pairPhiV = new AnalysisCompositeCut("cut_pairPhiV", "cut_pairPhiV", kTRUE);
     cut_pairPhiV->AddCut(GetAnalysisCut("pairLowMass"));
     cut_pairPhiV->AddCut(GetAnalysisCut("pairPhiV"));
     cut->AddCut(cut_pairPhiV);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("excludePairPhiV")) {
+  factories.emplace("excludePairPhiV", [](AnalysisCompositeCut* cut) {
     AnalysisCompositeCut* cut_pairlowPhiV = new AnalysisCompositeCut("cut_pairlowPhiV", "cut_pairlowPhiV", kFALSE);
     cut_pairlowPhiV->AddCut(GetAnalysisCut("excludePairLowMass"));
     cut_pairlowPhiV->AddCut(GetAnalysisCut("excludePairPhiV"));
     cut->AddCut(cut_pairlowPhiV);
     return cut;
-  }
+  });
 
   // -------------------------------------------------------------------------------------------------
   // Muon cuts
 
-  if (!nameStr.compare("muonQualityCutsMatchingOnly")) {
+  factories.emplace("muonQualityCutsMatchingOnly", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("muonQualityCutsMatchingOnly"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("muonMinimalCuts")) {
+  factories.emplace("muonMinimalCuts", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("muonMinimalCuts"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("muonQualityCuts")) {
+  factories.emplace("muonQualityCuts", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("muonQualityCuts"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("matchedQualityCuts")) {
+  factories.emplace("matchedQualityCuts", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("matchedQualityCuts"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("matchedQualityCutsMFTeta")) {
+  factories.emplace("matchedQualityCutsMFTeta", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("matchedQualityCutsMFTeta"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("muonQualityCuts5SigmaPDCA_Run3")) {
+  factories.emplace("muonQualityCuts5SigmaPDCA_Run3", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("muonQualityCuts5SigmaPDCA_Run3"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("muonLowPt5SigmaPDCA_Run3")) {
+  factories.emplace("muonLowPt5SigmaPDCA_Run3", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("muonLowPt"));
     cut->AddCut(GetAnalysisCut("muonQualityCuts5SigmaPDCA_Run3"));
     cut->AddCut(GetAnalysisCut("MCHMID"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("muonQualityCuts10SigmaPDCA_MCHMID")) {
+  factories.emplace("muonQualityCuts10SigmaPDCA_MCHMID", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("muonQualityCuts10SigmaPDCA"));
     cut->AddCut(GetAnalysisCut("MCHMID"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("muonLowPt10SigmaPDCA")) {
+  factories.emplace("muonLowPt10SigmaPDCA", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("muonLowPt"));
     cut->AddCut(GetAnalysisCut("muonQualityCuts10SigmaPDCA"));
     cut->AddCut(GetAnalysisCut("MCHMID"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("muonLowPt210SigmaPDCA")) {
+  factories.emplace("muonLowPt210SigmaPDCA", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("muonLowPt2"));
     cut->AddCut(GetAnalysisCut("muonQualityCuts10SigmaPDCA"));
     cut->AddCut(GetAnalysisCut("MCHMID"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("muonLowPt510SigmaPDCA")) {
+  factories.emplace("muonLowPt510SigmaPDCA", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("muonLowPt5"));
     cut->AddCut(GetAnalysisCut("muonQualityCuts10SigmaPDCA"));
     cut->AddCut(GetAnalysisCut("MCHMID"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("muonLowPt610SigmaPDCA")) {
+  factories.emplace("muonLowPt610SigmaPDCA", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("muonLowPt6"));
     cut->AddCut(GetAnalysisCut("muonQualityCuts10SigmaPDCA"));
     cut->AddCut(GetAnalysisCut("MCHMID"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("muonLowPt")) {
+  factories.emplace("muonLowPt", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("muonLowPt"));
     cut->AddCut(GetAnalysisCut("muonQualityCuts"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("muonLowPt2")) {
+  factories.emplace("muonLowPt2", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("muonLowPt2"));
     cut->AddCut(GetAnalysisCut("muonQualityCuts"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("muonLowPt3")) {
+  factories.emplace("muonLowPt3", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("muonLowPt3"));
     cut->AddCut(GetAnalysisCut("muonQualityCuts"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("muonLowPt4")) {
+  factories.emplace("muonLowPt4", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("muonLowPt4"));
     cut->AddCut(GetAnalysisCut("muonQualityCuts"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("muonLowPt5")) {
+  factories.emplace("muonLowPt5", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("muonLowPt5"));
     cut->AddCut(GetAnalysisCut("muonQualityCuts"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("muonLowPt6")) {
+  factories.emplace("muonLowPt6", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("muonLowPt6"));
     cut->AddCut(GetAnalysisCut("muonQualityCuts"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("muonLowPtMatchingOnly")) {
+  factories.emplace("muonLowPtMatchingOnly", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("muonLowPt"));
     cut->AddCut(GetAnalysisCut("muonQualityCutsMatchingOnly"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("muonLowPtMatchingOnly2")) {
+  factories.emplace("muonLowPtMatchingOnly2", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("muonLowPt2"));
     cut->AddCut(GetAnalysisCut("muonQualityCutsMatchingOnly"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("muonLowPtMatchingOnly3")) {
+  factories.emplace("muonLowPtMatchingOnly3", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("muonLowPt3"));
     cut->AddCut(GetAnalysisCut("muonQualityCutsMatchingOnly"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("muonLowPtMatchingOnly4")) {
+  factories.emplace("muonLowPtMatchingOnly4", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("muonLowPt4"));
     cut->AddCut(GetAnalysisCut("muonQualityCutsMatchingOnly"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("muonLowPtMatchingOnly5")) {
+  factories.emplace("muonLowPtMatchingOnly5", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("muonLowPt5"));
     cut->AddCut(GetAnalysisCut("muonQualityCutsMatchingOnly"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("muonLowPtMatchingOnly6")) {
+  factories.emplace("muonLowPtMatchingOnly6", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("muonLowPt6"));
     cut->AddCut(GetAnalysisCut("muonQualityCutsMatchingOnly"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("muonHighPt")) {
+  factories.emplace("muonHighPt", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("muonHighPt"));
     cut->AddCut(GetAnalysisCut("muonQualityCuts"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("muonHighPt2")) {
+  factories.emplace("muonHighPt2", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("muonHighPt2"));
     cut->AddCut(GetAnalysisCut("muonQualityCuts"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("muonHighPt3")) {
+  factories.emplace("muonHighPt3", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("muonHighPt3"));
     cut->AddCut(GetAnalysisCut("muonQualityCuts"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("muonHighPt4")) {
+  factories.emplace("muonHighPt4", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("muonHighPt4"));
     cut->AddCut(GetAnalysisCut("muonQualityCuts"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("muonHighPt5")) {
+  factories.emplace("muonHighPt5", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("muonHighPt5"));
     cut->AddCut(GetAnalysisCut("muonQualityCuts"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("muonHighPt6")) {
+  factories.emplace("muonHighPt6", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("muonHighPt6"));
     cut->AddCut(GetAnalysisCut("muonQualityCuts"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("muonHighPtMatchingOnly2")) {
+  factories.emplace("muonHighPtMatchingOnly2", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("muonHighPt2"));
     cut->AddCut(GetAnalysisCut("muonQualityCutsMatchingOnly"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("muonHighPtMatchingOnly3")) {
+  factories.emplace("muonHighPtMatchingOnly3", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("muonHighPt3"));
     cut->AddCut(GetAnalysisCut("muonQualityCutsMatchingOnly"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("muonTightQualityCutsForTests")) {
+  factories.emplace("muonTightQualityCutsForTests", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("muonTightQualityCutsForTests"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("mchTrack")) {
+  factories.emplace("mchTrack", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("mchTrack"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("matchedMchMid")) {
+  factories.emplace("matchedMchMid", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("matchedMchMid"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("matchedFwd")) {
+  factories.emplace("matchedFwd", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("matchedFwd"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("matchedGlobal")) {
+  factories.emplace("matchedGlobal", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("matchedGlobal"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("Chi2MCHMFTCut1")) {
+  factories.emplace("Chi2MCHMFTCut1", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("Chi2MCHMFTCut1"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("Chi2MCHMFTCut2")) {
+  factories.emplace("Chi2MCHMFTCut2", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("Chi2MCHMFTCut2"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("Chi2MCHMFTCut3")) {
+  factories.emplace("Chi2MCHMFTCut3", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("Chi2MCHMFTCut3"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("Chi2MCHMFTCut4")) {
+  factories.emplace("Chi2MCHMFTCut4", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("Chi2MCHMFTCut4"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("muonQualityCutsMUONStandalone")) {
+  factories.emplace("muonQualityCutsMUONStandalone", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("matchedMchMid"));
     cut->AddCut(GetAnalysisCut("muonQualityCuts"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("muonQualityCutsGlobal")) {
+  factories.emplace("muonQualityCutsGlobal", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("matchedGlobal"));
     cut->AddCut(GetAnalysisCut("muonQualityCuts"));
     return cut;
-  }
+  });
   // -----------------------------------------------------------
   // Pair cuts
-  if (!nameStr.compare("pairNoCut")) {
+  factories.emplace("pairNoCut", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairNoCut"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairMassLow1")) {
+  factories.emplace("pairMassLow1", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairMassLow1"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairMassLow2")) {
+  factories.emplace("pairMassLow2", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairMassLow2"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairPtLow3")) {
+  factories.emplace("pairPtLow3", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairPtLow3"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairPtLow4")) {
+  factories.emplace("pairPtLow4", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairPtLow4"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairPtLow5")) {
+  factories.emplace("pairPtLow5", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairPtLow5"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairMassLow3")) {
+  factories.emplace("pairMassLow3", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairMassLow3"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairMassLow4")) {
+  factories.emplace("pairMassLow4", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairMassLow4"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairMassLow5")) {
+  factories.emplace("pairMassLow5", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairMassLow5"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairMassLow6")) {
+  factories.emplace("pairMassLow6", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairMassLow6"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairMassLow7")) {
+  factories.emplace("pairMassLow7", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairMassLow7"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairMassLow8")) {
+  factories.emplace("pairMassLow8", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairMassLow8"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairMassLow9")) {
+  factories.emplace("pairMassLow9", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairMassLow9"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairMassLow10")) {
+  factories.emplace("pairMassLow10", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairMassLow10"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairMassLow11")) {
+  factories.emplace("pairMassLow11", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairMassLow11"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairMassLow12")) {
+  factories.emplace("pairMassLow12", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairMassLow12"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairMass1to2")) {
+  factories.emplace("pairMass1to2", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairMass1to2"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairMassIMR")) {
+  factories.emplace("pairMassIMR", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairMassIMR"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairMass1_5to2_7")) {
+  factories.emplace("pairMass1_5to2_7", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairMass1_5to2_7"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairMass1_3to3_5")) {
+  factories.emplace("pairMass1_3to3_5", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairMass1_3to3_5"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairMass1_3")) {
+  factories.emplace("pairMass1_3", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairMass1_3"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairMass1_5to3_5")) {
+  factories.emplace("pairMass1_5to3_5", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairMass1_5to3_5"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairDalitz1")) {
+  factories.emplace("pairDalitz1", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairDalitz1"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairDalitz1Strong")) {
+  factories.emplace("pairDalitz1Strong", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairDalitz1Strong"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairDalitz2")) {
+  factories.emplace("pairDalitz2", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairDalitz2"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairDalitz3")) {
+  factories.emplace("pairDalitz3", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairDalitz3"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("paira_prefilter1")) {
+  factories.emplace("paira_prefilter1", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("paira_prefilter1"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("paira_prefilter2")) {
+  factories.emplace("paira_prefilter2", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("paira_prefilter2"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("paira_prefilter3")) {
+  factories.emplace("paira_prefilter3", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("paira_prefilter3"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("paira_prefilter4")) {
+  factories.emplace("paira_prefilter4", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("paira_prefilter4"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("paira_prefilter5")) {
+  factories.emplace("paira_prefilter5", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("paira_prefilter5"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("paira_prefilter6")) {
+  factories.emplace("paira_prefilter6", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("paira_prefilter6"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("paira_prefilter7")) {
+  factories.emplace("paira_prefilter7", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("paira_prefilter7"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairb_prefilter1")) {
+  factories.emplace("pairb_prefilter1", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairb_prefilter1"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairb_prefilter2")) {
+  factories.emplace("pairb_prefilter2", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairb_prefilter2"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairb_prefilter3")) {
+  factories.emplace("pairb_prefilter3", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairb_prefilter3"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairb_prefilter4")) {
+  factories.emplace("pairb_prefilter4", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairb_prefilter4"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairb_prefilter5")) {
+  factories.emplace("pairb_prefilter5", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairb_prefilter5"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairb_prefilter6")) {
+  factories.emplace("pairb_prefilter6", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairb_prefilter6"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairb_prefilter7")) {
+  factories.emplace("pairb_prefilter7", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairb_prefilter7"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairc_prefilter1")) {
+  factories.emplace("pairc_prefilter1", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairc_prefilter1"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairc_prefilter2")) {
+  factories.emplace("pairc_prefilter2", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairc_prefilter2"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairc_prefilter3")) {
+  factories.emplace("pairc_prefilter3", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairc_prefilter3"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairc_prefilter4")) {
+  factories.emplace("pairc_prefilter4", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairc_prefilter4"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairc_prefilter5")) {
+  factories.emplace("pairc_prefilter5", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairc_prefilter5"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairc_prefilter6")) {
+  factories.emplace("pairc_prefilter6", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairc_prefilter6"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairc_prefilter7")) {
+  factories.emplace("pairc_prefilter7", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairc_prefilter7"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("paird_prefilter1")) {
+  factories.emplace("paird_prefilter1", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("paird_prefilter1"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("paire_prefilter1")) {
+  factories.emplace("paire_prefilter1", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("paire_prefilter1"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairf_prefilter1")) {
+  factories.emplace("pairf_prefilter1", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairf_prefilter1"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairg_prefilter1")) {
+  factories.emplace("pairg_prefilter1", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairg_prefilter1"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairh_prefilter1")) {
+  factories.emplace("pairh_prefilter1", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairh_prefilter1"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairi_prefilter1")) {
+  factories.emplace("pairi_prefilter1", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairi_prefilter1"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairJpsi")) {
+  factories.emplace("pairJpsi", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairJpsi"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairJpsi2")) {
+  factories.emplace("pairJpsi2", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairJpsi2"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairJpsi3")) {
+  factories.emplace("pairJpsi3", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairJpsi3"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairPsi2S")) {
+  factories.emplace("pairPsi2S", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairPsi2S"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairUpsilon")) {
+  factories.emplace("pairUpsilon", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairUpsilon"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairX3872Cut1")) {
+  factories.emplace("pairX3872Cut1", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairX3872"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairX3872Cut2")) {
+  factories.emplace("pairX3872Cut2", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairX3872_2"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairX3872Cut3")) {
+  factories.emplace("pairX3872Cut3", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairX3872_3"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("DipionPairCut1")) {
+  factories.emplace("DipionPairCut1", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("DipionMassCut1"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("DipionPairCut2")) {
+  factories.emplace("DipionPairCut2", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("DipionMassCut2"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairRapidityForward")) {
+  factories.emplace("pairRapidityForward", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairRapidityForward"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairJpsiLowPt1")) {
+  factories.emplace("pairJpsiLowPt1", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairJpsi"));
     cut->AddCut(GetAnalysisCut("pairPtLow1"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairJpsiLowPt2")) {
+  factories.emplace("pairJpsiLowPt2", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairJpsi"));
     cut->AddCut(GetAnalysisCut("pairPtLow2"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairCoherentRho0")) {
+  factories.emplace("pairCoherentRho0", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairPtLow3"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairD0HighPt1")) {
+  factories.emplace("pairD0HighPt1", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairLxyzProjected3sigma"));
     cut->AddCut(GetAnalysisCut("pairPtLow5"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairD0HighPt2")) {
+  factories.emplace("pairD0HighPt2", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairTauxyzProjected1"));
     cut->AddCut(GetAnalysisCut("pairPtLow5"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairD0HighPt3")) {
+  factories.emplace("pairD0HighPt3", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairTauxyzProjected1sigma"));
     cut->AddCut(GetAnalysisCut("pairPtLow5"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairTauxyzProjected1")) {
+  factories.emplace("pairTauxyzProjected1", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairTauxyzProjected1"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairLxyProjected3sigmaLambdacCand")) {
+  factories.emplace("pairLxyProjected3sigmaLambdacCand", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairLxyProjected3sigmaLambdacCand"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairLxyProjected3sigmaDplusCand")) {
+  factories.emplace("pairLxyProjected3sigmaDplusCand", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairLxyProjected3sigmaDplusCand"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairCosPointingPos")) {
+  factories.emplace("pairCosPointingPos", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairCosPointingPos"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairCosPointingNeg90")) {
+  factories.emplace("pairCosPointingNeg90", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairCosPointingNeg90"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairCosPointingNeg85")) {
+  factories.emplace("pairCosPointingNeg85", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairCosPointingNeg85"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairTauxyzProjectedCosPointing1")) {
+  factories.emplace("pairTauxyzProjectedCosPointing1", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("pairCosPointingNeg"));
     cut->AddCut(GetAnalysisCut("pairTauxyzProjected1"));
     return cut;
-  }
+  });
 
   // -------------------------------------------------------------------------------------------------
   //
   // Below are a list of single electron single muon and in order or optimize the trigger
   // trigger selection cuts
 
-  if (!nameStr.compare("jpsiO2TriggerTestCuts_LooseNsigma")) {
+  factories.emplace("jpsiO2TriggerTestCuts_LooseNsigma", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityTriggerTest"));
     cut->AddCut(GetAnalysisCut("electronPIDnsigmaOpen"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsiO2TriggerTestCuts_LooseNsigma_corr")) {
+  factories.emplace("jpsiO2TriggerTestCuts_LooseNsigma_corr", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityTriggerTest"));
     cut->AddCut(GetAnalysisCut("jpsi_TPCPID_debug5"));
     return cut;
-  }
-  if (!nameStr.compare("jpsiO2TriggerTestCuts_MediumNsigma")) {
+  });
+  factories.emplace("jpsiO2TriggerTestCuts_MediumNsigma", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityTriggerTest"));
     cut->AddCut(GetAnalysisCut("electronPIDnsigmaOpen"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsiO2TriggerTestCuts_MediumNsigma_corr")) {
+  factories.emplace("jpsiO2TriggerTestCuts_MediumNsigma_corr", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityTriggerTest"));
     cut->AddCut(GetAnalysisCut("jpsi_TPCPID_debug1"));
     return cut;
-  }
-  if (!nameStr.compare("jpsiO2TriggerTestCuts_TightNsigma")) {
+  });
+  factories.emplace("jpsiO2TriggerTestCuts_TightNsigma", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityTriggerTest"));
     cut->AddCut(GetAnalysisCut("electronPIDnsigma"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsiO2TriggerTestCuts_TightNsigma_corr")) {
+  factories.emplace("jpsiO2TriggerTestCuts_TightNsigma_corr", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityTriggerTest"));
     cut->AddCut(GetAnalysisCut("jpsi_TPCPID_debug2"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsiO2TriggerTestCuts_TPCPID1")) {
+  factories.emplace("jpsiO2TriggerTestCuts_TPCPID1", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityTriggerTest"));
     cut->AddCut(GetAnalysisCut("jpsi_TPCPID_TriggerTest1"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsiO2TriggerTestCuts_TPCPID2")) {
+  factories.emplace("jpsiO2TriggerTestCuts_TPCPID2", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityTriggerTest"));
     cut->AddCut(GetAnalysisCut("jpsi_TPCPID_TriggerTest2"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsiO2TriggerTestCuts_TPCPID3")) {
+  factories.emplace("jpsiO2TriggerTestCuts_TPCPID3", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityTriggerTest"));
     cut->AddCut(GetAnalysisCut("jpsi_TPCPID_TriggerTest3"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsiO2TriggerTestCuts_TPCPID4")) {
+  factories.emplace("jpsiO2TriggerTestCuts_TPCPID4", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
     cut->AddCut(GetAnalysisCut("electronStandardQualityTriggerTest"));
     cut->AddCut(GetAnalysisCut("jpsi_TPCPID_TriggerTest4"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("emu_electron_test")) {
+  factories.emplace("emu_electron_test", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
     cut->AddCut(GetAnalysisCut("electronTrackQuality_Maolin"));
     cut->AddCut(GetAnalysisCut("electronPIDnsigmaEMu"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("muonLooseTriggerTestCuts")) {
+  factories.emplace("muonLooseTriggerTestCuts", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("muonLooseTriggerTestCuts"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("muonLooseTriggerTestCuts_LowPt")) {
+  factories.emplace("muonLooseTriggerTestCuts_LowPt", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("muonLowPt"));
     cut->AddCut(GetAnalysisCut("muonLooseTriggerTestCuts"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("muonLooseTriggerTestCuts_HighPt2")) {
+  factories.emplace("muonLooseTriggerTestCuts_HighPt2", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("muonHighPt2"));
     cut->AddCut(GetAnalysisCut("muonLooseTriggerTestCuts"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("muonLooseTriggerTestCuts_HighPt3")) {
+  factories.emplace("muonLooseTriggerTestCuts_HighPt3", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("muonHighPt3"));
     cut->AddCut(GetAnalysisCut("muonLooseTriggerTestCuts"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("muonHighPtMatchingOnly2")) {
+  factories.emplace("muonHighPtMatchingOnly2", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("muonHighPt2"));
     cut->AddCut(GetAnalysisCut("muonQualityCutsMatchingOnly"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("muonHighPtMatchingOnly3")) {
+  factories.emplace("muonHighPtMatchingOnly3", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("muonHighPt3"));
     cut->AddCut(GetAnalysisCut("muonQualityCutsMatchingOnly"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("muonMatchingMFTMCHTriggerTestCuts")) {
+  factories.emplace("muonMatchingMFTMCHTriggerTestCuts", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("muonMatchingMFTMCHTriggerTestCuts"));
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("muonMatchingMFTMCHTriggerTestCuts_LowPt")) {
+  factories.emplace("muonMatchingMFTMCHTriggerTestCuts_LowPt", [](AnalysisCompositeCut* cut) {
     cut->AddCut(GetAnalysisCut("muonLowPt"));
     cut->AddCut(GetAnalysisCut("muonMatchingMFTMCHTriggerTestCuts"));
     return cut;
-  }
-
-  delete cut;
-  LOGF(fatal, Form("Did not find cut %s. Returning nullptr", cutName));
-  return nullptr;
+  });
 }
 
-AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
+void o2::aod::dqcuts::RegisterAnalysisCuts(AnalysisCutFactories& factories)
 {
   //
   // define here cuts which are likely to be used often
   //
-  AnalysisCut* cut = new AnalysisCut(cutName, cutName);
-  std::string nameStr = cutName;
   // ---------------------------------------------------------------
   // Event cuts
-  if (!nameStr.compare("noEventCut")) {
+  factories.emplace("noEventCut", [](AnalysisCut* cut) {
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("eventNoTFBorder")) {
+  factories.emplace("eventNoTFBorder", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kIsNoTFBorder, 0.5, 1.5);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("eventStandard")) {
+  factories.emplace("eventStandard", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kVtxZ, -10.0, 10.0);
     cut->AddCut(VarManager::kIsINT7, 0.5, 1.5);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("eventStandardNoINT7")) {
+  factories.emplace("eventStandardNoINT7", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kVtxZ, -10.0, 10.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("eventStandardtest")) {
+  factories.emplace("eventStandardtest", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kVtxZ, -30.0, 30.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("eventSel8")) { // kIsSel8 = kIsTriggerTVX && kNoITSROFrameBorder && kNoTimeFrameBorder
+  factories.emplace("eventSel8", [](AnalysisCut* cut) { // kIsSel8 = kIsTriggerTVX && kNoITSROFrameBorder && kNoTimeFrameBorder
     cut->AddCut(VarManager::kIsSel8, 0.5, 1.5);
     return cut;
-  }
-  if (!nameStr.compare("eventStandardSel8")) { // kIsSel8 = kIsTriggerTVX && kNoITSROFrameBorder && kNoTimeFrameBorder
+  });
+  factories.emplace("eventStandardSel8", [](AnalysisCut* cut) { // kIsSel8 = kIsTriggerTVX && kNoITSROFrameBorder && kNoTimeFrameBorder
     cut->AddCut(VarManager::kVtxZ, -10.0, 10.0);
     cut->AddCut(VarManager::kIsSel8, 0.5, 1.5);
     return cut;
-  }
-  if (!nameStr.compare("eventStandardSel8WithITSROFRecomputedCut")) {
+  });
+  factories.emplace("eventStandardSel8WithITSROFRecomputedCut", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kVtxZ, -10.0, 10.0);
     cut->AddCut(VarManager::kIsSel8, 0.5, 1.5);
     cut->AddCut(VarManager::kIsNoTFBorder, 0.5, 1.5);
     cut->AddCut(VarManager::kIsNoITSROFBorderRecomputed, 0.5, 1.5);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("eventStandardSel8NoTFBorder")) { // Redundant w.r.t. eventStandardSel8, to be removed
+  factories.emplace("eventStandardSel8NoTFBorder", [](AnalysisCut* cut) { // Redundant w.r.t. eventStandardSel8, to be removed
     cut->AddCut(VarManager::kVtxZ, -10.0, 10.0);
     cut->AddCut(VarManager::kIsSel8, 0.5, 1.5);
     cut->AddCut(VarManager::kIsNoTFBorder, 0.5, 1.5);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("eventStandardSel8NoTFBNoITSROFB")) { // Redundant w.r.t. eventStandardSel8, to be removed
+  factories.emplace("eventStandardSel8NoTFBNoITSROFB", [](AnalysisCut* cut) { // Redundant w.r.t. eventStandardSel8, to be removed
     cut->AddCut(VarManager::kVtxZ, -10.0, 10.0);
     cut->AddCut(VarManager::kIsSel8, 0.5, 1.5);
     cut->AddCut(VarManager::kIsNoTFBorder, 0.5, 1.5);
     cut->AddCut(VarManager::kIsNoITSROFBorder, 0.5, 1.5);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("eventStandardSel8NoTFBNoITSROFBrecomp")) {
+  factories.emplace("eventStandardSel8NoTFBNoITSROFBrecomp", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kVtxZ, -10.0, 10.0);
     cut->AddCut(VarManager::kIsSel8, 0.5, 1.5);
     cut->AddCut(VarManager::kIsNoTFBorder, 0.5, 1.5);
     cut->AddCut(VarManager::kIsNoITSROFBorderRecomputed, 0.5, 1.5);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("eventSel8NoSameBunch")) {
+  factories.emplace("eventSel8NoSameBunch", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kIsSel8, 0.5, 1.5);
     cut->AddCut(VarManager::kIsNoSameBunch, 0.5, 1.5);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("eventSel8NoSameBunchGoodZvtx")) {
+  factories.emplace("eventSel8NoSameBunchGoodZvtx", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kIsSel8, 0.5, 1.5);
     cut->AddCut(VarManager::kIsNoSameBunch, 0.5, 1.5);
     cut->AddCut(VarManager::kIsGoodZvtxFT0vsPV, 0.5, 1.5);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("eventStandardSel8PbPbQuality")) {
+  factories.emplace("eventStandardSel8PbPbQuality", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kVtxZ, -10.0, 10.0);
     cut->AddCut(VarManager::kIsSel8, 0.5, 1.5);
     cut->AddCut(VarManager::kIsNoTFBorder, 0.5, 1.5);
@@ -3803,9 +3961,9 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
     cut->AddCut(VarManager::kIsNoSameBunch, 0.5, 1.5);
     cut->AddCut(VarManager::kIsGoodZvtxFT0vsPV, 0.5, 1.5);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("eventStandardSel8PbPbQualityGoodITSLayersAll")) { // kIsSel8 = kIsTriggerTVX && kNoITSROFrameBorder && kNoTimeFrameBorder
+  factories.emplace("eventStandardSel8PbPbQualityGoodITSLayersAll", [](AnalysisCut* cut) { // kIsSel8 = kIsTriggerTVX && kNoITSROFrameBorder && kNoTimeFrameBorder
     cut->AddCut(VarManager::kVtxZ, -10.0, 10.0);
     cut->AddCut(VarManager::kIsSel8, 0.5, 1.5);
     cut->AddCut(VarManager::kIsNoTFBorder, 0.5, 1.5);
@@ -3814,9 +3972,9 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
     cut->AddCut(VarManager::kIsGoodZvtxFT0vsPV, 0.5, 1.5);
     cut->AddCut(VarManager::kIsGoodITSLayersAll, 0.5, 1.5);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("eventStandardSel8PbPbQualityTightTrackOccupancy")) {
+  factories.emplace("eventStandardSel8PbPbQualityTightTrackOccupancy", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kVtxZ, -10.0, 10.0);
     cut->AddCut(VarManager::kIsSel8, 0.5, 1.5);
     cut->AddCut(VarManager::kIsNoTFBorder, 0.5, 1.5);
@@ -3826,9 +3984,9 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
     cut->AddCut(VarManager::kCentFT0C, 0.0, 90.0);
     cut->AddCut(VarManager::kTrackOccupancyInTimeRange, 0., 1000);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("eventStandardSel8PbPbQualityFirmTrackOccupancy")) {
+  factories.emplace("eventStandardSel8PbPbQualityFirmTrackOccupancy", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kVtxZ, -10.0, 10.0);
     cut->AddCut(VarManager::kIsSel8, 0.5, 1.5);
     cut->AddCut(VarManager::kIsNoTFBorder, 0.5, 1.5);
@@ -3839,9 +3997,9 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
     cut->AddCut(VarManager::kTrackOccupancyInTimeRange, 0., 2000);
 
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("eventStandardSel8PbPbQualityLooseTrackOccupancy")) {
+  factories.emplace("eventStandardSel8PbPbQualityLooseTrackOccupancy", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kVtxZ, -10.0, 10.0);
     cut->AddCut(VarManager::kIsSel8, 0.5, 1.5);
     cut->AddCut(VarManager::kIsNoTFBorder, 0.5, 1.5);
@@ -3852,9 +4010,9 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
     cut->AddCut(VarManager::kTrackOccupancyInTimeRange, 0., 5000);
 
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("eventStandardSel8PbPbQualityTightTrackOccupancyCollInTime")) {
+  factories.emplace("eventStandardSel8PbPbQualityTightTrackOccupancyCollInTime", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kVtxZ, -10.0, 10.0);
     cut->AddCut(VarManager::kIsSel8, 0.5, 1.5);
     cut->AddCut(VarManager::kIsNoTFBorder, 0.5, 1.5);
@@ -3866,9 +4024,9 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
     cut->AddCut(VarManager::kNoCollInTimeRangeStandard, 0.5, 1.5);
 
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("eventStandardSel8PbPbQualityTightTrackOccupancyCollInTime")) {
+  factories.emplace("eventStandardSel8PbPbQualityTightTrackOccupancyCollInTime", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kVtxZ, -10.0, 10.0);
     cut->AddCut(VarManager::kIsSel8, 0.5, 1.5);
     cut->AddCut(VarManager::kIsNoTFBorder, 0.5, 1.5);
@@ -3880,7 +4038,7 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
     cut->AddCut(VarManager::kNoCollInTimeRangeStandard, 0.5, 1.5);
 
     return cut;
-  }
+  });
 
   std::vector<double> vecOccupancies = {0.,
                                         250.,
@@ -3897,7 +4055,7 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
                                         50000.};
 
   for (size_t icase = 0; icase < vecOccupancies.size() - 1; icase++) {
-    if (!nameStr.compare(Form("eventStandardSel8PbPbQualityTrackOccupancySlice%lu", icase))) {
+    factories.emplace(Form("eventStandardSel8PbPbQualityTrackOccupancySlice%lu", icase), [=](AnalysisCut* cut) {
       cut->AddCut(VarManager::kVtxZ, -10.0, 10.0);
       cut->AddCut(VarManager::kIsSel8, 0.5, 1.5);
       cut->AddCut(VarManager::kIsNoTFBorder, 0.5, 1.5);
@@ -3908,11 +4066,11 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
       cut->AddCut(VarManager::kTrackOccupancyInTimeRange, vecOccupancies[icase], vecOccupancies[icase + 1]);
 
       return cut;
-    }
+    });
   }
 
   for (size_t icase = 0; icase < vecOccupancies.size() - 1; icase++) {
-    if (!nameStr.compare(Form("eventStandardSel8PbPbQualityTrackOccupancySlice_0_%lu", icase))) {
+    factories.emplace(Form("eventStandardSel8PbPbQualityTrackOccupancySlice_0_%lu", icase), [=](AnalysisCut* cut) {
       cut->AddCut(VarManager::kVtxZ, -10.0, 10.0);
       cut->AddCut(VarManager::kIsSel8, 0.5, 1.5);
       cut->AddCut(VarManager::kIsNoTFBorder, 0.5, 1.5);
@@ -3923,10 +4081,10 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
       cut->AddCut(VarManager::kTrackOccupancyInTimeRange, 0, vecOccupancies[icase]);
 
       return cut;
-    }
+    });
   }
 
-  if (!nameStr.compare("eventStandardSel8ppQuality")) {
+  factories.emplace("eventStandardSel8ppQuality", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kVtxZ, -10.0, 10.0);
     cut->AddCut(VarManager::kIsSel8, 0.5, 1.5);
     cut->AddCut(VarManager::kIsNoTFBorder, 0.5, 1.5);
@@ -3936,9 +4094,9 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
     cut->AddCut(VarManager::kIsVertexITSTPC, 0.5, 1.5);
     cut->AddCut(VarManager::kIsVertexTOFmatched, 0.5, 1.5);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("eventStandardSel8ppQualityNoVtxZ")) {
+  factories.emplace("eventStandardSel8ppQualityNoVtxZ", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kIsSel8, 0.5, 1.5);
     cut->AddCut(VarManager::kIsNoTFBorder, 0.5, 1.5);
     cut->AddCut(VarManager::kIsNoITSROFBorder, 0.5, 1.5);
@@ -3947,9 +4105,9 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
     cut->AddCut(VarManager::kIsVertexITSTPC, 0.5, 1.5);
     cut->AddCut(VarManager::kIsVertexTOFmatched, 0.5, 1.5);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("eventStandardSel8multAnalysis")) {
+  factories.emplace("eventStandardSel8multAnalysis", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kVtxZ, -10.0, 10.0);
     cut->AddCut(VarManager::kIsSel8, 0.5, 1.5);
     cut->AddCut(VarManager::kIsNoTFBorder, 0.5, 1.5);
@@ -3957,18 +4115,18 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
     cut->AddCut(VarManager::kIsNoSameBunch, 0.5, 1.5);
     cut->AddCut(VarManager::kIsVertexITSTPC, 0.5, 1.5);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("eventStandardSel8VtxQuality1")) { // kIsSel8 = kIsTriggerTVX && kNoITSROFrameBorder && kNoTimeFrameBorder
+  factories.emplace("eventStandardSel8VtxQuality1", [](AnalysisCut* cut) { // kIsSel8 = kIsTriggerTVX && kNoITSROFrameBorder && kNoTimeFrameBorder
     cut->AddCut(VarManager::kVtxZ, -10.0, 10.0);
     cut->AddCut(VarManager::kIsSel8, 0.5, 1.5);
     cut->AddCut(VarManager::kIsNoSameBunch, 0.5, 1.5);
     cut->AddCut(VarManager::kIsVertexITSTPC, 0.5, 1.5);
     cut->AddCut(VarManager::kIsVertexTOFmatched, 0.5, 1.5);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("eventStandardSel8PbPbMultCorr")) {
+  factories.emplace("eventStandardSel8PbPbMultCorr", [](AnalysisCut* cut) {
     TF1* fMultPVCutLow = new TF1("fMultPVCutLow", "[0]+[1]*x+[2]*x*x+[3]*x*x*x+[4]*x*x*x*x - 3.5*([5]+[6]*x+[7]*x*x+[8]*x*x*x+[9]*x*x*x*x)", 0, 100);
     fMultPVCutLow->SetParameters(3257.29, -121.848, 1.98492, -0.0172128, 6.47528e-05, 154.756, -1.86072, -0.0274713, 0.000633499, -3.37757e-06);
     TF1* fMultPVCutHigh = new TF1("fMultPVCutHigh", "[0]+[1]*x+[2]*x*x+[3]*x*x*x+[4]*x*x*x*x + 3.5*([5]+[6]*x+[7]*x*x+[8]*x*x*x+[9]*x*x*x*x)", 0, 100);
@@ -3985,79 +4143,79 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
     cut->AddCut(VarManager::kIsNoSameBunch, 0.5, 1.5);
     cut->AddCut(VarManager::kIsGoodZvtxFT0vsPV, 0.5, 1.5);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("eventDimuonStandard")) {
+  factories.emplace("eventDimuonStandard", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kIsMuonUnlikeLowPt7, 0.5, 1.5);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("eventMuonStandard")) {
+  factories.emplace("eventMuonStandard", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kIsMuonSingleLowPt7, 0.5, 1.5);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("eventTPCMultLow")) {
+  factories.emplace("eventTPCMultLow", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMultTPC, 0, 50);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("eventExclusivePair")) {
+  factories.emplace("eventExclusivePair", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kVtxNcontrib, 2, 2);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("eventVtxNContrib")) {
+  factories.emplace("eventVtxNContrib", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kVtxNcontrib, 0, 10);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("eventTPCMult3")) {
+  factories.emplace("eventTPCMult3", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMultTPC, 3, 3);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("int7vtxZ5")) {
+  factories.emplace("int7vtxZ5", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kVtxZ, -5.0, 5.0);
     cut->AddCut(VarManager::kIsINT7, 0.5, 1.5);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("eventDoubleGap")) {
+  factories.emplace("eventDoubleGap", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kIsDoubleGap, 0.5, 1.5);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("eventSingleGap")) {
+  factories.emplace("eventSingleGap", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kIsSingleGap, 0.5, 1.5);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("eventSingleGapA")) {
+  factories.emplace("eventSingleGapA", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kIsSingleGapA, 0.5, 1.5);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("eventSingleGapAZDC")) {
+  factories.emplace("eventSingleGapAZDC", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kIsSingleGapA, 0.5, 1.5);
     cut->AddCut(VarManager::kEnergyCommonZNA, -1000., 1.);
     cut->AddCut(VarManager::kEnergyCommonZNC, 1., 1000.);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("eventSingleGapC")) {
+  factories.emplace("eventSingleGapC", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kIsSingleGapC, 0.5, 1.5);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("eventSingleGapCZDC")) {
+  factories.emplace("eventSingleGapCZDC", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kIsSingleGapC, 0.5, 1.5);
     cut->AddCut(VarManager::kEnergyCommonZNC, -1000., 1.);
     cut->AddCut(VarManager::kEnergyCommonZNA, 1., 1000.);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("eventSingleGapACZDC")) {
+  factories.emplace("eventSingleGapACZDC", [](AnalysisCut* cut) {
     AnalysisCompositeCut* cutA = new AnalysisCompositeCut("singleGapAZDC", "singleGapAZDC", kTRUE);
     cutA->AddCut(GetAnalysisCut("eventSingleGapAZDC"));
 
@@ -4068,14 +4226,14 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
     cutAorC->AddCut(cutA);
     cutAorC->AddCut(cutC);
     return cutAorC;
-  }
+  });
 
-  if (!nameStr.compare("eventUPCMode")) {
+  factories.emplace("eventUPCMode", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kIsITSUPCMode, 0.5, 1.5);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("eventSingleGapACZDC_UPCMode")) {
+  factories.emplace("eventSingleGapACZDC_UPCMode", [](AnalysisCut* cut) {
     AnalysisCompositeCut* cutA = new AnalysisCompositeCut("singleGapAZDC", "singleGapAZDC", kTRUE);
     cutA->AddCut(GetAnalysisCut("eventSingleGapAZDC"));
     cutA->AddCut(GetAnalysisCut("eventUPCMode"));
@@ -4088,218 +4246,218 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
     cutAorC->AddCut(cutA);
     cutAorC->AddCut(cutC);
     return cutAorC;
-  }
+  });
 
   // Event cuts based on centrality
-  if (!nameStr.compare("eventStandardNoINT7Cent090")) {
+  factories.emplace("eventStandardNoINT7Cent090", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kVtxZ, -10.0, 10.0);
     cut->AddCut(VarManager::kCentFT0C, 0.0, 90.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("eventStandardNoINT7Cent7090")) {
+  factories.emplace("eventStandardNoINT7Cent7090", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kVtxZ, -10.0, 10.0);
     cut->AddCut(VarManager::kCentFT0C, 70.0, 90.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("eventStandardNoINT7Cent5070")) {
+  factories.emplace("eventStandardNoINT7Cent5070", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kVtxZ, -10.0, 10.0);
     cut->AddCut(VarManager::kCentFT0C, 50.0, 70.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("eventStandardNoINT7Cent3050")) {
+  factories.emplace("eventStandardNoINT7Cent3050", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kVtxZ, -10.0, 10.0);
     cut->AddCut(VarManager::kCentFT0C, 30.0, 50.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("eventStandardNoINT7Cent1030")) {
+  factories.emplace("eventStandardNoINT7Cent1030", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kVtxZ, -10.0, 10.0);
     cut->AddCut(VarManager::kCentFT0C, 10.0, 30.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("eventStandardNoINT7Cent010")) {
+  factories.emplace("eventStandardNoINT7Cent010", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kVtxZ, -10.0, 10.0);
     cut->AddCut(VarManager::kCentFT0C, 0.0, 10.0);
     return cut;
-  }
+  });
 
   // ---------------------------------------------------
   // Barrel track kine cuts
-  if (!nameStr.compare("negTrack")) {
+  factories.emplace("negTrack", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kCharge, -99., 0.);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("posTrack")) {
+  factories.emplace("posTrack", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kCharge, 0., 99.);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("posEtaSel")) {
+  factories.emplace("posEtaSel", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kEta, 0., 0.8);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("negEtaSel")) {
+  factories.emplace("negEtaSel", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kEta, -0.8, 0.);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("etaSel")) {
+  factories.emplace("etaSel", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kEta, -0.8, 0.8);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pt02Sel")) {
+  factories.emplace("pt02Sel", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kPt, 0.2, 20.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pt04Sel")) {
+  factories.emplace("pt04Sel", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kPt, 0.4, 20.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("openEtaSel")) {
+  factories.emplace("openEtaSel", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kEta, -0.9, 0.9);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("insideTPCsector")) {
+  factories.emplace("insideTPCsector", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTrackIsInsideTPCModule, 0.5, 1.5);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("rho0Kine")) {
+  factories.emplace("rho0Kine", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kPt, 0.1, 1000.0);
     cut->AddCut(VarManager::kEta, -1.1, 1.1);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pionQuality")) {
+  factories.emplace("pionQuality", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCncls, 50.0, 1000.);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("primaryVertexContributor")) {
+  factories.emplace("primaryVertexContributor", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kPVContributor, 0.5, 1.5);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsiStandardKine")) {
+  factories.emplace("jpsiStandardKine", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kPt, 1.0, 1000.0);
     cut->AddCut(VarManager::kEta, -0.9, 0.9);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsiStandardKine2")) {
+  factories.emplace("jpsiStandardKine2", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kPt, 0.9, 1000.0);
     cut->AddCut(VarManager::kEta, -0.9, 0.9);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsiStandardKine3")) {
+  factories.emplace("jpsiStandardKine3", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kP, 1.2, 1000.0);
     cut->AddCut(VarManager::kEta, -0.9, 0.9);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsiPIDcalibKine_posEta")) {
+  factories.emplace("jpsiPIDcalibKine_posEta", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kPin, 1.0, 1000.0);
     cut->AddCut(VarManager::kEta, 0.0, 0.9);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsiPIDcalibKine_negEta")) {
+  factories.emplace("jpsiPIDcalibKine_negEta", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kPin, 1.0, 1000.0);
     cut->AddCut(VarManager::kEta, -0.9, 0.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsiStandardKine4")) {
+  factories.emplace("jpsiStandardKine4", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kP, 1.5, 1000.0);
     cut->AddCut(VarManager::kEta, -0.9, 0.9);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsiKineSkimmed")) {
+  factories.emplace("jpsiKineSkimmed", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kPt, 0.7, 1000.0);
     cut->AddCut(VarManager::kEta, -0.9, 0.9);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsiKineSkimmed")) {
+  factories.emplace("jpsiKineSkimmed", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kPt, 0.7, 1000.0);
     cut->AddCut(VarManager::kEta, -0.9, 0.9);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("lmeePrefilterKine")) {
+  factories.emplace("lmeePrefilterKine", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kPt, 0., 20.0);
     cut->AddCut(VarManager::kEta, -1.2, 1.2);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("lmeeStandardKine")) {
+  factories.emplace("lmeeStandardKine", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kPt, 0.2, 20.0);
     cut->AddCut(VarManager::kEta, -0.8, 0.8);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("lmeeStandardKine_pt04")) {
+  factories.emplace("lmeeStandardKine_pt04", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kPt, 0.4, 20.0);
     cut->AddCut(VarManager::kEta, -0.8, 0.8);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("lmeeLowBKine")) {
+  factories.emplace("lmeeLowBKine", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kPt, 0.075, 20.0);
     cut->AddCut(VarManager::kEta, -0.8, 0.8);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("dalitzStandardKine")) {
+  factories.emplace("dalitzStandardKine", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kPt, 0.15, 1000.0);
     cut->AddCut(VarManager::kEta, -0.9, 0.9);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("PIDStandardKine")) {
+  factories.emplace("PIDStandardKine", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kEta, -0.9, 0.9);
     cut->AddCut(VarManager::kPt, 1.0, 1000.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("PIDStandardKine2")) {
+  factories.emplace("PIDStandardKine2", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kEta, -0.9, 0.9);
     cut->AddCut(VarManager::kPt, 0.1, 1000.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("PIDStandardKine3")) {
+  factories.emplace("PIDStandardKine3", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kEta, -0.9, 0.9);
     cut->AddCut(VarManager::kPt, 0.5, 1000.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pTLow04")) {
+  factories.emplace("pTLow04", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kPt, 0.4, 1000.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pTLow03")) {
+  factories.emplace("pTLow03", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kPt, 0.3, 1000.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pTLow02")) {
+  factories.emplace("pTLow02", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kPt, 0.2, 1000.0);
     return cut;
-  }
+  });
 
   // -----------------------------------------------
   // Barrel track quality cuts
@@ -4307,22 +4465,22 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
   // ---------------------------------------------------
   // MC generated particle acceptance cuts
 
-  if (!nameStr.compare("rapidity08")) {
+  factories.emplace("rapidity08", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMCY, -0.8, 0.8);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("rapidity09")) {
+  factories.emplace("rapidity09", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMCY, -0.9, 0.9);
     return cut;
-  }
+  });
 
   // ---------------------------------------------------
   // MC generated particle acceptance cuts
 
   // Run 2 only
 
-  if (!nameStr.compare("highPtHadron")) {
+  factories.emplace("highPtHadron", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kPt, 4.0, 1000.0);
     cut->AddCut(VarManager::kEta, -0.9, 0.9);
     cut->AddCut(VarManager::kIsITSrefit, 0.5, 1.5);
@@ -4331,9 +4489,9 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
     cut->AddCut(VarManager::kITSchi2, 0.1, 36.0);
     cut->AddCut(VarManager::kTPCncls, 70.0, 161.);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("TightGlobalTrack")) {
+  factories.emplace("TightGlobalTrack", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kIsSPDfirst, 0.5, 1.5);
     cut->AddCut(VarManager::kIsITSrefit, 0.5, 1.5);
     cut->AddCut(VarManager::kIsTPCrefit, 0.5, 1.5);
@@ -4343,9 +4501,9 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
     cut->AddCut(VarManager::kTPCncls, 60.0, 170.);
     cut->AddCut(VarManager::kITSncls, 3.5, 7.5);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("electronStandardQuality")) {
+  factories.emplace("electronStandardQuality", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kIsSPDany, 0.5, 1.5);
     cut->AddCut(VarManager::kIsITSrefit, 0.5, 1.5);
     cut->AddCut(VarManager::kIsTPCrefit, 0.5, 1.5);
@@ -4353,35 +4511,35 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
     cut->AddCut(VarManager::kITSchi2, 0.1, 36.0);
     cut->AddCut(VarManager::kTPCncls, 100.0, 161.);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("electronStandardQualityBenchmark")) {
+  factories.emplace("electronStandardQualityBenchmark", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kIsITSrefit, 0.5, 1.5);
     cut->AddCut(VarManager::kIsTPCrefit, 0.5, 1.5);
     cut->AddCut(VarManager::kTPCchi2, 0.0, 4.0);
     cut->AddCut(VarManager::kITSchi2, 0.1, 36.0);
     cut->AddCut(VarManager::kTPCncls, 70.0, 161.);
     return cut;
-  }
+  });
 
   // Run 2 or run 3
 
-  if (!nameStr.compare("jpsi_trackCut_debug")) {
+  factories.emplace("jpsi_trackCut_debug", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kEta, -0.9, 0.9);
     cut->AddCut(VarManager::kTPCchi2, 0.0, 4.0);
     cut->AddCut(VarManager::kTPCncls, 90., 159);
     cut->AddCut(VarManager::kITSncls, 2.5, 7.5);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsi_trackCut_noITSCuts_debug")) {
+  factories.emplace("jpsi_trackCut_noITSCuts_debug", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kEta, -0.9, 0.9);
     cut->AddCut(VarManager::kTPCchi2, 0.0, 4.0);
     cut->AddCut(VarManager::kTPCncls, 90., 159);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsi_trackCut_debug2")) {
+  factories.emplace("jpsi_trackCut_debug2", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kEta, -0.9, 0.9);
     cut->AddCut(VarManager::kTPCchi2, 0.0, 4.0);
     cut->AddCut(VarManager::kTPCncls, 90., 159);
@@ -4390,9 +4548,9 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
     cut->AddCut(VarManager::kTrackDCAxy, -1, 1);
     cut->AddCut(VarManager::kTrackDCAz, -3.0, 3.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsi_trackCut_debug3")) {
+  factories.emplace("jpsi_trackCut_debug3", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kEta, -0.9, 0.9);
     cut->AddCut(VarManager::kTPCchi2, 0.0, 4.0);
     cut->AddCut(VarManager::kTPCncls, 90., 159);
@@ -4404,9 +4562,9 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
     cut->AddCut(VarManager::kTrackDCAxy, -0.05, 0.05);
     cut->AddCut(VarManager::kTrackDCAz, -1.0, 1.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsi_trackCut_debug4")) {
+  factories.emplace("jpsi_trackCut_debug4", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kEta, -0.9, 0.9);
     cut->AddCut(VarManager::kTPCchi2, 0.0, 4.0);
     cut->AddCut(VarManager::kTPCncls, 90., 159);
@@ -4415,43 +4573,43 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
     cut->AddCut(VarManager::kTrackDCAxy, -1, 1);
     cut->AddCut(VarManager::kTrackDCAz, -3.0, 3.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsi_trackCut_debug5")) {
+  factories.emplace("jpsi_trackCut_debug5", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kEta, -0.9, 0.9);
     cut->AddCut(VarManager::kTPCchi2, 0.0, 4.0);
     cut->AddCut(VarManager::kTPCncls, 70., 159);
     cut->AddCut(VarManager::kIsITSibAny, 0.5, 1.5);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsi_trackCut_debug6")) {
+  factories.emplace("jpsi_trackCut_debug6", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCchi2, 0.0, 4.0);
     cut->AddCut(VarManager::kTPCncls, 120., 159);
     cut->AddCut(VarManager::kTPCnclsCR, 140., 159);
     cut->AddCut(VarManager::kIsITSibAny, 0.5, 1.5);
     cut->AddCut(VarManager::kIsSPDfirst, 0.5, 1.5);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("lmee_trackCut_debug")) {
+  factories.emplace("lmee_trackCut_debug", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kEta, -0.9, 0.9);
     cut->AddCut(VarManager::kTPCchi2, 0.0, 4.0);
     cut->AddCut(VarManager::kTPCncls, 80., 159);
     cut->AddCut(VarManager::kITSncls, 0.0, 7.5);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("lmee_skimming_cuts")) {
+  factories.emplace("lmee_skimming_cuts", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kEta, -0.9, 0.9);
     cut->AddCut(VarManager::kIsSPDfirst, 0.5, 1.5);
     cut->AddCut(VarManager::kTPCchi2, 0.0, 4.0);
     cut->AddCut(VarManager::kTPCnclsCR, 60.0, 161.);
     cut->AddCut(VarManager::kTPCnSigmaEl_Corr, -5.0, 5.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("trackQuality_compareDQEMframework")) { // cut setting to check least common factor between reduced data sets of PWGEM and PWGDQ
+  factories.emplace("trackQuality_compareDQEMframework", [](AnalysisCut* cut) { // cut setting to check least common factor between reduced data sets of PWGEM and PWGDQ
     cut->AddCut(VarManager::kIsSPDfirst, 0.5, 1.5);
     cut->AddCut(VarManager::kITSchi2, 0.0, 5.0);
     cut->AddCut(VarManager::kITSncls, 4.5, 7.5);
@@ -4460,9 +4618,9 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
     cut->AddCut(VarManager::kTPCnCRoverFindCls, 0.8, 1e+10);
     cut->AddCut(VarManager::kTPCncls, 90.0, 170.);
     return cut;
-  }
+  });
 
-  if ((!nameStr.compare("TightGlobalTrackRun3")) || (!nameStr.compare("lmeeQCTrackCuts"))) {
+  const auto tightGlobalTrackRun3 = [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kIsSPDfirst, 0.5, 1.5);
     cut->AddCut(VarManager::kTPCchi2, 0.0, 4.0);
     cut->AddCut(VarManager::kITSchi2, 0.0, 5.0);
@@ -4470,7 +4628,9 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
     cut->AddCut(VarManager::kTPCnclsCR, 80.0, 161.);
     cut->AddCut(VarManager::kTPCncls, 90.0, 170.);
     return cut;
-  }
+  };
+  factories.emplace("TightGlobalTrackRun3", tightGlobalTrackRun3);
+  factories.emplace("lmeeQCTrackCuts", tightGlobalTrackRun3);
 
   std::vector<TString> vecTypetrack;
   vecTypetrack.emplace_back("");                  // default TightGlobalTrackRun3 as above
@@ -4486,7 +4646,7 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
 
   // loop to define PID cuts with and without post calibration
   for (size_t icase = 1; icase < vecTypetrack.size(); icase++) {
-    if (!nameStr.compare(Form("lmeeQCTrackCuts%s", vecTypetrack.at(icase).Data()))) {
+    factories.emplace(Form("lmeeQCTrackCuts%s", vecTypetrack.at(icase).Data()), [=](AnalysisCut* cut) {
       if (icase == 1) {
         cut->AddCut(VarManager::kIsSPDfirst, 0.5, 1.5);
         cut->AddCut(VarManager::kTPCchi2, 0.0, 4.0);
@@ -4540,19 +4700,19 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
         cut->AddCut(VarManager::kTPCncls, 90.0, 170.);
       }
       return cut;
-    }
+    });
   }
 
-  if (!nameStr.compare("LooseGlobalTrackRun3")) {
+  factories.emplace("LooseGlobalTrackRun3", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kIsSPDfirst, 0.5, 1.5);
     cut->AddCut(VarManager::kTPCchi2, 0.0, 4.0);
     cut->AddCut(VarManager::kITSchi2, 0.0, 6.0);
     cut->AddCut(VarManager::kITSncls, 3.5, 7.5);
     cut->AddCut(VarManager::kTPCncls, 70.0, 170.);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("TightGlobalTrackRun3_strongTPC")) {
+  factories.emplace("TightGlobalTrackRun3_strongTPC", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kIsSPDfirst, 0.5, 1.5);
     cut->AddCut(VarManager::kTPCchi2, 0.0, 4.0);
     cut->AddCut(VarManager::kITSchi2, 0.0, 5.0);
@@ -4560,45 +4720,45 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
     cut->AddCut(VarManager::kTPCnclsCR, 140.0, 161.);
     cut->AddCut(VarManager::kTPCncls, 120.0, 170.);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("TightTPCTrackRun3")) {
+  factories.emplace("TightTPCTrackRun3", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCchi2, 0.0, 4.0);
     cut->AddCut(VarManager::kTPCnclsCR, 80.0, 161.);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("TightTPCTrack")) {
+  factories.emplace("TightTPCTrack", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCchi2, 0.0, 4.0);
     cut->AddCut(VarManager::kTPCnclsCR, 80.0, 161.);
     cut->AddCut(VarManager::kIsTPCrefit, 0.5, 1.5);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("SPDfirst")) {
+  factories.emplace("SPDfirst", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kIsSPDfirst, 0.5, 1.5);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("noTPC")) {
+  factories.emplace("noTPC", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kHasTPC, -0.5, 0.5);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("SPDany")) {
+  factories.emplace("SPDany", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kIsSPDany, 0.5, 1.5);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("ITSiball")) {
+  factories.emplace("ITSiball", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kIsITSibAll, 0.5, 1.5);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("ITSibany")) {
+  factories.emplace("ITSibany", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kIsITSibAny, 0.5, 1.5);
     return cut;
-  }
+  });
 
   // List of 30 variations in ITS and TPC parameters
   std::vector<double> cutVar_ITSchi2 = {6., 6., 5., 4., 4., 6., 6., 5., 4., 5., 4., 5., 6., 5., 6., 5., 6., 5., 5., 4., 6., 4., 6., 5., 6., 4., 4., 6., 4., 5.};
@@ -4608,7 +4768,7 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
   std::vector<double> cutVar_TPCnCls = {80., 100., 80., 90., 90., 80., 80., 80., 80., 90., 100., 100., 80., 80., 80., 80., 100., 90., 100., 90., 90., 100., 100., 80., 100., 90., 90., 100., 90., 90.};
 
   for (unsigned int i = 0; i < cutVar_ITSchi2.size(); i++) {
-    if (!nameStr.compare(Form("lmeeCutVarTrackCuts%i", i))) {
+    factories.emplace(Form("lmeeCutVarTrackCuts%i", i), [=](AnalysisCut* cut) {
       cut->AddCut(VarManager::kIsSPDfirst, 0.5, 1.5);
       cut->AddCut(VarManager::kITSchi2, 0.0, cutVar_ITSchi2.at(i));
       cut->AddCut(VarManager::kTPCchi2, 0.0, cutVar_TPCchi2.at(i));
@@ -4616,94 +4776,94 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
       cut->AddCut(VarManager::kTPCnclsCR, cutVar_TPCnClsCR.at(i), 161.);
       cut->AddCut(VarManager::kTPCncls, cutVar_TPCnCls.at(i), 170.);
       return cut;
-    }
+    });
   }
 
-  if (!nameStr.compare("electronStandardQualityForO2MCdebug")) {
+  factories.emplace("electronStandardQualityForO2MCdebug", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kIsSPDany, 0.5, 1.5);
     cut->AddCut(VarManager::kTPCchi2, 0.0, 4.0);
     cut->AddCut(VarManager::kTPCncls, 70, 161.);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("electronStandardQualityForO2MCdebug2")) {
+  factories.emplace("electronStandardQualityForO2MCdebug2", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kIsSPDany, 0.5, 1.5);
     cut->AddCut(VarManager::kTPCchi2, 0.0, 4.0);
     cut->AddCut(VarManager::kTPCncls, 100.0, 161.);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("electronStandardQualityForO2MCdebug3")) {
+  factories.emplace("electronStandardQualityForO2MCdebug3", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kITSncls, 0.5, 10);
     cut->AddCut(VarManager::kTPCchi2, 0.0, 4.0);
     cut->AddCut(VarManager::kTPCncls, 70, 161.);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("electronStandardQualityForO2MCdebug4")) {
+  factories.emplace("electronStandardQualityForO2MCdebug4", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kIsITSibAny, 0.5, 1.5);
     cut->AddCut(VarManager::kTPCchi2, 0.0, 4.0);
     cut->AddCut(VarManager::kTPCncls, 70, 161.);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("electronStandardQualityITSOnly")) {
+  factories.emplace("electronStandardQualityITSOnly", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kIsSPDany, 0.5, 1.5);
     cut->AddCut(VarManager::kITSchi2, 0.0, 5.0);
     cut->AddCut(VarManager::kITSncls, 3.5, 7.5);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("electronStandardQualitybAnyITSOnly")) {
+  factories.emplace("electronStandardQualitybAnyITSOnly", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kIsITSibAny, 0.5, 1.5);
     cut->AddCut(VarManager::kITSchi2, 0.0, 5.0);
     cut->AddCut(VarManager::kITSncls, 3.5, 7.5);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("electronStandardQualityTPCOnly")) {
+  factories.emplace("electronStandardQualityTPCOnly", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCchi2, 0.0, 4.0);
     cut->AddCut(VarManager::kTPCncls, 70, 161.);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("electronStandardQualityTPCOnly2")) {
+  factories.emplace("electronStandardQualityTPCOnly2", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCchi2, 0.0, 4.0);
     cut->AddCut(VarManager::kTPCncls, 100, 161.);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("NoelectronStandardQualityTPCOnly")) {
+  factories.emplace("NoelectronStandardQualityTPCOnly", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCchi2, 0.0, 4.0, true, VarManager::kTPCncls, 70, 161.);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("electronTrackQualitySkimmed")) {
+  factories.emplace("electronTrackQualitySkimmed", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kIsITSibAny, 0.5, 1.5);
     cut->AddCut(VarManager::kITSchi2, 0.0, 5.0);
     cut->AddCut(VarManager::kTPCncls, 60, 161);
     cut->AddCut(VarManager::kTrackDCAxy, -1.5, 1.5);
     cut->AddCut(VarManager::kTrackDCAz, -1.5, 1.5);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("electronTrackQualitySkimmed2")) {
+  factories.emplace("electronTrackQualitySkimmed2", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kIsITSibAny, 0.5, 1.5);
     cut->AddCut(VarManager::kITSchi2, 0.0, 5.0);
     cut->AddCut(VarManager::kTPCncls, 60, 161);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("electronTrackQualitySkimmed3")) {
+  factories.emplace("electronTrackQualitySkimmed3", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kPt, 1.0, 1000.0);
     cut->AddCut(VarManager::kEta, -0.9, 0.9);
     cut->AddCut(VarManager::kIsITSibAny, 0.5, 1.5);
     cut->AddCut(VarManager::kTPCnclsCR, 70, 161);
     cut->AddCut(VarManager::kTPCncls, 70, 161);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("electronTrackQuality_Maolin")) {
+  factories.emplace("electronTrackQuality_Maolin", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kIsITSibAny, 0.5, 1.5);
     cut->AddCut(VarManager::kITSchi2, 0.0, 15.0);
     cut->AddCut(VarManager::kTPCchi2, 0.0, 4.0);
@@ -4712,25 +4872,25 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
     cut->AddCut(VarManager::kTrackDCAxy, -2.0, 2.0);
     cut->AddCut(VarManager::kTrackDCAz, -2.0, 2.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pionQualityCut1")) {
+  factories.emplace("pionQualityCut1", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kPt, 0.15, 1000.0);
     cut->AddCut(VarManager::kIsITSibAny, 0.5, 1.5);
     cut->AddCut(VarManager::kTPCncls, 70, 161);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pionQualityCut2")) {
+  factories.emplace("pionQualityCut2", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kPt, 0.15, 1000.0);
     cut->AddCut(VarManager::kEta, -0.9, 0.9);
     cut->AddCut(VarManager::kIsITSibAny, 0.5, 1.5);
     cut->AddCut(VarManager::kTPCncls, 90, 161);
     cut->AddCut(VarManager::kTPCnclsCR, 70, 161);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("protonPVcut")) {
+  factories.emplace("protonPVcut", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTrackDCAxy, -0.1, 0.1);
     cut->AddCut(VarManager::kTrackDCAz, -0.15, 0.15);
     cut->AddCut(VarManager::kPt, 0.4, 3);
@@ -4739,439 +4899,443 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
     cut->AddCut(VarManager::kTPCchi2, 0.0, 4.0);
     cut->AddCut(VarManager::kTPCncls, 80, 161.);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pidbasic")) {
+  factories.emplace("pidbasic", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kEta, -0.9, 0.9);
     cut->AddCut(VarManager::kTPCncls, 60, 161.);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("standardPrimaryTrack")) {
+  factories.emplace("standardPrimaryTrack", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTrackDCAxy, -1.0, 1.0);
     cut->AddCut(VarManager::kTrackDCAz, -3.0, 3.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("trackDCA1cm")) { // cut setting to check least common factor between reduced data sets of PWGEM and PWGDQ
+  factories.emplace("trackDCA1cm", [](AnalysisCut* cut) { // cut setting to check least common factor between reduced data sets of PWGEM and PWGDQ
     cut->AddCut(VarManager::kTrackDCAxy, -1.0, 1.0);
     cut->AddCut(VarManager::kTrackDCAz, -1.0, 1.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("dcaCut1_ionut")) {
+  factories.emplace("dcaCut1_ionut", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTrackDCAxy, -0.5, 0.5);
     cut->AddCut(VarManager::kTrackDCAz, -0.5, 0.5);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("trackQuality_ionut")) {
+  factories.emplace("trackQuality_ionut", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kIsITSibAny, 0.5, 1.5);
     cut->AddCut(VarManager::kTPCncls, 70, 161);
     cut->AddCut(VarManager::kITSchi2, 0.0, 5.0);
     cut->AddCut(VarManager::kTPCchi2, 0.0, 2.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("trackQualityTight_ionut")) {
+  factories.emplace("trackQualityTight_ionut", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kIsITSibAny, 0.5, 1.5);
     cut->AddCut(VarManager::kTPCncls, 100, 161);
     cut->AddCut(VarManager::kITSchi2, 0.0, 3.0);
     cut->AddCut(VarManager::kTPCchi2, 0.0, 2.0);
     cut->AddCut(VarManager::kITSncls, 5.0, 8.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("kineJpsiEle_ionut")) {
+  factories.emplace("kineJpsiEle_ionut", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kP, 1.0, 15.0);
     cut->AddCut(VarManager::kEta, -0.9, 0.9);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pidJpsiEle0_ionut")) {
+  factories.emplace("pidJpsiEle0_ionut", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaEl, -2.0, 4.0, false, VarManager::kPin, 1.0, 4.0);
     cut->AddCut(VarManager::kTPCnSigmaEl, -1.0, 4.0, false, VarManager::kPin, 4.0, 150.0);
     cut->AddCut(VarManager::kTPCnSigmaEl, 98.1, 98.11, false, VarManager::kPin, 0.0, 1.0);
     cut->AddCut(VarManager::kTPCnSigmaPr, -4.0, 4.0, true);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pidJpsiEle1_ionut")) {
+  factories.emplace("pidJpsiEle1_ionut", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaEl, -1.5, 4.0, false, VarManager::kPin, 1.0, 4.0);
     cut->AddCut(VarManager::kTPCnSigmaEl, -1.0, 4.0, false, VarManager::kPin, 4.0, 150.0);
     cut->AddCut(VarManager::kTPCnSigmaEl, 98.1, 98.11, false, VarManager::kPin, 0.0, 1.0);
     cut->AddCut(VarManager::kTPCnSigmaPr, -4.0, 4.0, true);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pidJpsiEle2_ionut")) {
+  factories.emplace("pidJpsiEle2_ionut", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaEl, -1.0, 4.0);
     cut->AddCut(VarManager::kTPCnSigmaPr, -4.0, 4.0, true);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pidJpsiEle3_ionut")) {
+  factories.emplace("pidJpsiEle3_ionut", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaEl, -0.5, 4.0);
     cut->AddCut(VarManager::kTPCnSigmaPr, -4.0, 4.0, true);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pidJpsiEle4_ionut")) {
+  factories.emplace("pidJpsiEle4_ionut", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaEl, 0.0, 4.0);
     cut->AddCut(VarManager::kTPCnSigmaPr, -4.0, 4.0, true);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pidJpsiEle5_ionut")) {
+  factories.emplace("pidJpsiEle5_ionut", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaEl, 0.5, 4.0);
     cut->AddCut(VarManager::kTPCnSigmaPr, -4.0, 4.0, true);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pidJpsiEle6_ionut")) {
+  factories.emplace("pidJpsiEle6_ionut", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaEl, -1.0, 4.0);
     cut->AddCut(VarManager::kTOFnSigmaEl, -1.0, 4.0);
     cut->AddCut(VarManager::kTPCnSigmaPr, -4.0, 4.0, true);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pidJpsiEle7_ionut")) {
+  factories.emplace("pidJpsiEle7_ionut", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTOFnSigmaEl, -3.0, 4.0);
     cut->AddCut(VarManager::kTPCnSigmaEl, -1.0, 4.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pidJpsiEle8_ionut")) {
+  factories.emplace("pidJpsiEle8_ionut", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTOFnSigmaEl, -3.0, 4.0);
     cut->AddCut(VarManager::kTPCnSigmaEl, -1.5, 4.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pidJpsiEle9_ionut")) {
+  factories.emplace("pidJpsiEle9_ionut", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTOFnSigmaEl, -3.0, 4.0);
     cut->AddCut(VarManager::kTPCnSigmaEl, -2.0, 4.0);
     return cut;
-  }
+  });
 
   // Magnus cuts ----------------------------------------------------------
 
-  if (!nameStr.compare("pidJpsi_magnus_ele1")) {
+  factories.emplace("pidJpsi_magnus_ele1", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaEl, -3.0, 4.0);
     return cut;
-  }
-  if (!nameStr.compare("pidJpsi_magnus_ele2")) {
+  });
+  factories.emplace("pidJpsi_magnus_ele2", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaEl, -2.0, 4.0);
     return cut;
-  }
-  if (!nameStr.compare("pidJpsi_magnus_ele3")) {
+  });
+  factories.emplace("pidJpsi_magnus_ele3", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaEl, -1.0, 4.0);
     return cut;
-  }
-  if (!nameStr.compare("pidJpsi_magnus_prot1")) {
+  });
+  factories.emplace("pidJpsi_magnus_prot1", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaPr, 3.0, 1000.0);
     return cut;
-  }
-  if (!nameStr.compare("pidJpsi_magnus_prot2")) {
+  });
+  factories.emplace("pidJpsi_magnus_prot2", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaPr, 3.5, 1000.0);
     return cut;
-  }
-  if (!nameStr.compare("pidJpsi_magnus_pion1")) {
+  });
+  factories.emplace("pidJpsi_magnus_pion1", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaPi, 3.0, 1000.0);
     return cut;
-  }
-  if (!nameStr.compare("pidJpsi_magnus_pion2")) {
+  });
+  factories.emplace("pidJpsi_magnus_pion2", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaPi, 3.5, 1000.0);
     return cut;
-  }
+  });
 
   // ----------------------------------------------------------------------------------
 
-  if (!nameStr.compare("standardPrimaryTrackDCAz")) {
+  factories.emplace("standardPrimaryTrackDCAz", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTrackDCAxy, -3.0, 3.0);
     cut->AddCut(VarManager::kTrackDCAz, -1.0, 1.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("standardPrimaryTrackDCA")) {
+  factories.emplace("standardPrimaryTrackDCA", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTrackDCAxy, -0.1, 0.1);
     cut->AddCut(VarManager::kTrackDCAz, -0.15, 0.15);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("PrimaryTrack_looseDCA")) {
+  factories.emplace("PrimaryTrack_looseDCA", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTrackDCAxy, -3.0, 3.0);
     cut->AddCut(VarManager::kTrackDCAz, -3.0, 3.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("tightPrimaryTrack")) {
+  factories.emplace("tightPrimaryTrack", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTrackDCAsigXY, -3.0, 3.0);
     cut->AddCut(VarManager::kTrackDCAsigZ, -3.0, 3.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("PrimaryTrack_DCA05")) {
+  factories.emplace("PrimaryTrack_DCA05", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTrackDCAsigXY, -0.5, 0.5);
     cut->AddCut(VarManager::kTrackDCAsigZ, -0.5, 0.5);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("PrimaryTrack_DCAz")) {
+  factories.emplace("PrimaryTrack_DCAz", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTrackDCAz, -0.3, 0.3);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("hasTOF")) {
+  factories.emplace("hasTOF", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kHasTOF, 0.5, 1.5);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("noTOF")) {
+  factories.emplace("noTOF", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kHasTOF, -0.5, 0.5);
     return cut;
-  }
+  });
 
   // -----------------------------------------------------
   // V0 and Dalitz legs selections
 
   for (int i = 1; i <= 8; i++) {
-    if (!nameStr.compare(Form("dalitzLeg%d", i))) {
+    factories.emplace(Form("dalitzLeg%d", i), [=](AnalysisCut* cut) {
       cut->AddCut(VarManager::kIsDalitzLeg + i - 1, 0.5, 1.5);
       return cut;
-    }
+    });
 
-    if (!nameStr.compare(Form("notDalitzLeg%d", i))) {
+    factories.emplace(Form("notDalitzLeg%d", i), [=](AnalysisCut* cut) {
       cut->AddCut(VarManager::kIsDalitzLeg + i - 1, -0.5, 0.5);
       return cut;
-    }
+    });
   }
 
-  if (!nameStr.compare("pidcalib_ele")) {
+  factories.emplace("pidcalib_ele", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kIsLegFromGamma, 0.5, 1.5, false);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pidcalib_pion")) {
+  factories.emplace("pidcalib_pion", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kIsLegFromK0S, 0.5, 1.5, false);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pidcalib_proton")) {
+  factories.emplace("pidcalib_proton", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kIsProtonFromLambdaAndAntiLambda, 0.5, 1.5, false);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pidcalib_kaon")) {
+  factories.emplace("pidcalib_kaon", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTOFnSigmaKa, -2.0, 2.0);
     cut->AddCut(VarManager::kTOFnSigmaPi, -2.0, 2.0, true);
     cut->AddCut(VarManager::kITSncls, 1.5, 7.5);
     return cut;
-  }
+  });
 
   // ------------------------------------------------
   // Barrel PID cuts
-  if (!nameStr.compare("jpsi_TPCPID_debug1")) {
+  factories.emplace("jpsi_TPCPID_debug1", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaEl_Corr, -3.0, 3.0);
     cut->AddCut(VarManager::kTPCnSigmaPi_Corr, 2.5, 999);
     cut->AddCut(VarManager::kTPCnSigmaPr_Corr, 2.5, 999);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsi_TPCPID_debug2")) {
+  factories.emplace("jpsi_TPCPID_debug2", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaEl_Corr, -3.0, 3.0);
     cut->AddCut(VarManager::kTPCnSigmaPi_Corr, 3.0, 999);
     cut->AddCut(VarManager::kTPCnSigmaPr_Corr, 3.0, 999);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsi_TPCPID_debug3")) {
+  factories.emplace("jpsi_TPCPID_debug3", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaEl_Corr, -3.0, 3.0);
     cut->AddCut(VarManager::kTPCnSigmaPi_Corr, 3.5, 999);
     cut->AddCut(VarManager::kTPCnSigmaPr_Corr, 3.5, 999);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsi_TPCPID_debug4")) {
+  factories.emplace("jpsi_TPCPID_debug4", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaEl, -3.0, 3.0);
     cut->AddCut(VarManager::kTPCnSigmaPi, 3.0, 999);
     cut->AddCut(VarManager::kTPCnSigmaPr, 3.0, 999);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsi_TPCPID_debug5")) {
+  factories.emplace("jpsi_TPCPID_debug5", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaEl_Corr, -4.0, 4.0);
     cut->AddCut(VarManager::kTPCnSigmaPi_Corr, 2.5, 999);
     cut->AddCut(VarManager::kTPCnSigmaPr_Corr, 2.5, 999);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsi_TPCPID_debug5_noCorr")) {
+  factories.emplace("jpsi_TPCPID_debug5_noCorr", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaEl, -4.0, 4.0);
     cut->AddCut(VarManager::kTPCnSigmaPi, 2.5, 999);
     cut->AddCut(VarManager::kTPCnSigmaPr, 2.5, 999);
     return cut;
-  }
-  if (!nameStr.compare("electronPIDLooseSkimmed")) {
+  });
+  factories.emplace("electronPIDLooseSkimmed", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaEl, -4.0, 4.0);
     cut->AddCut(VarManager::kTPCnSigmaPi, 2.5, 999);
     cut->AddCut(VarManager::kTPCnSigmaPr, 2.5, 999);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("electronPIDLooseSkimmed2")) {
+  factories.emplace("electronPIDLooseSkimmed2", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaEl, -4.0, 4.0);
     cut->AddCut(VarManager::kTPCnSigmaPi, 2.5, 999, false, VarManager::kPin, 0, 3.0);
     cut->AddCut(VarManager::kTPCnSigmaPi, 1.5, 999, false, VarManager::kPin, 3.0, 999);
     cut->AddCut(VarManager::kTPCnSigmaPr, 2.5, 999, false, VarManager::kPin, 0, 3.0);
     cut->AddCut(VarManager::kTPCnSigmaPr, 1.5, 999, false, VarManager::kPin, 3.0, 999);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("electronPIDLooseSkimmed3")) {
+  factories.emplace("electronPIDLooseSkimmed3", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaEl, -3.0, 3.0);
     cut->AddCut(VarManager::kTPCnSigmaPi, 3.0, 999, false, VarManager::kPin, 0, 3.0);
     cut->AddCut(VarManager::kTPCnSigmaPr, 3.0, 999, false, VarManager::kPin, 0, 3.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsi_TPCPID_debug6")) {
+  factories.emplace("jpsi_TPCPID_debug6", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaEl, -2.0, 3.0);
     cut->AddCut(VarManager::kTPCnSigmaPi, 3.0, 999);
     cut->AddCut(VarManager::kTPCnSigmaPr, 3.0, 999);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsi_TPCPID_debug7")) {
+  factories.emplace("jpsi_TPCPID_debug7", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaEl, -2.0, 3.0);
     cut->AddCut(VarManager::kTPCnSigmaPi, 3.5, 999);
     cut->AddCut(VarManager::kTPCnSigmaPr, 3.5, 999);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsi_TPCPID_debug8")) {
+  factories.emplace("jpsi_TPCPID_debug8", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaEl, -2.0, 3.0, false, VarManager::kPin, 0.0, 3.0);
     cut->AddCut(VarManager::kTPCnSigmaEl, -3.0, 3.0, false, VarManager::kPin, 3.0, 999.0);
     cut->AddCut(VarManager::kTPCnSigmaPi, 3.0, 999, false, VarManager::kPin, 0.0, 3.0);
     cut->AddCut(VarManager::kTPCnSigmaPi, 2.0, 999, false, VarManager::kPin, 5.0, 999.0);
     cut->AddCut(VarManager::kTPCnSigmaPr, 3.0, 999, false, VarManager::kPin, 3.0, 999.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsi_TPCPID_debug9")) {
+  factories.emplace("jpsi_TPCPID_debug9", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaEl, -2.5, 4.0);
     cut->AddCut(VarManager::kTPCnSigmaPi, 1.0, 999, false, VarManager::kPin, 3.0, 999.0);
     cut->AddCut(VarManager::kTPCnSigmaPr, 2.0, 999);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsi_TPCPID_debug10")) {
+  factories.emplace("jpsi_TPCPID_debug10", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaEl, -1.5, 2.0);
     cut->AddCut(VarManager::kTPCnSigmaPi, 4.0, 999);
     cut->AddCut(VarManager::kTPCnSigmaPr, 3.5, 999);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pidCut_lowP_Corr")) {
+  factories.emplace("pidCut_lowP_Corr", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaEl_Corr, -3.0, 3.0, false, VarManager::kP, 0.0, 5.0);
     cut->AddCut(VarManager::kTPCnSigmaPi_Corr, 3.0, 999, false, VarManager::kP, 0.0, 5.0);
     cut->AddCut(VarManager::kTPCnSigmaPr_Corr, 2.5, 999, false, VarManager::kP, 0.0, 5.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("EleInclusion_highP_Corr")) {
+  factories.emplace("EleInclusion_highP_Corr", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaEl_Corr, -1.0, 4.0, false, VarManager::kP, 5.0, 999.0);
     return cut;
-  }
-  if (!nameStr.compare("EleInclusion_highP2_Corr")) {
+  });
+  factories.emplace("EleInclusion_highP2_Corr", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaEl_Corr, -0.5, 4.0, false, VarManager::kP, 5.0, 999.0);
     return cut;
-  }
-  if (!nameStr.compare("PionExclusion_highP_Corr")) {
+  });
+  factories.emplace("PionExclusion_highP_Corr", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaPi_Corr, 2.0, 999, false, VarManager::kP, 5.0, 999.0);
     return cut;
-  }
-  if (!nameStr.compare("pidCut_lowP")) {
+  });
+  factories.emplace("pidCut_lowP", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaEl, -3.0, 3.0, false, VarManager::kP, 0.0, 5.0);
     cut->AddCut(VarManager::kTPCnSigmaPi, 3.0, 999, false, VarManager::kP, 0.0, 5.0);
     cut->AddCut(VarManager::kTPCnSigmaPr, 2.5, 999, false, VarManager::kP, 0.0, 5.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("EleInclusion_highP")) {
+  factories.emplace("EleInclusion_highP", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaEl, -1.0, 4.0, false, VarManager::kP, 5.0, 999.0);
     return cut;
-  }
-  if (!nameStr.compare("EleInclusion_highP2")) {
+  });
+  factories.emplace("EleInclusion_highP2", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaEl, -0.5, 4.0, false, VarManager::kP, 5.0, 999.0);
     return cut;
-  }
-  if (!nameStr.compare("PionExclusion_highP")) {
+  });
+  factories.emplace("PionExclusion_highP", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaPi, 2.0, 999, false, VarManager::kP, 5.0, 999.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("lmee_TPCPID_debug1")) {
+  factories.emplace("lmee_TPCPID_debug1", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaEl_Corr, -5.0, 5.0);
     return cut;
-  }
+  });
 
-  TF1* cutLow1 = new TF1("cutLow1", "pol1", 0., 10.);
-  if (!nameStr.compare("electronPID1")) {
+  factories.emplace("electronPID1", [](AnalysisCut* cut) {
+    TF1* cutLow1 = new TF1("cutLow1", "pol1", 0., 10.);
     cutLow1->SetParameters(130., -40.0);
     cut->AddCut(VarManager::kTPCsignal, 70., 100.);
     cut->AddCut(VarManager::kTPCsignal, cutLow1, 100.0, false, VarManager::kPin, 0.5, 3.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("electronPID1shiftUp")) {
+  factories.emplace("electronPID1shiftUp", [](AnalysisCut* cut) {
+    TF1* cutLow1 = new TF1("cutLow1", "pol1", 0., 10.);
     cut->AddCut(VarManager::kTPCsignal, 70. - 0.85, 100. - 0.85);
     cutLow1->SetParameters(130. - 0.85, -40.0);
     cut->AddCut(VarManager::kTPCsignal, cutLow1, 100.0 - 0.85, false, VarManager::kPin, 0.5, 3.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("electronPID1shiftDown")) {
+  factories.emplace("electronPID1shiftDown", [](AnalysisCut* cut) {
+    TF1* cutLow1 = new TF1("cutLow1", "pol1", 0., 10.);
     cut->AddCut(VarManager::kTPCsignal, 70.0 + 0.85, 100.0 + 0.85);
     cutLow1->SetParameters(130. + 0.85, -40.0);
     cut->AddCut(VarManager::kTPCsignal, cutLow1, 100.0 + 0.85, false, VarManager::kPin, 0.5, 3.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("electronPID2")) {
+  factories.emplace("electronPID2", [](AnalysisCut* cut) {
+    TF1* cutLow1 = new TF1("cutLow1", "pol1", 0., 10.);
     cutLow1->SetParameters(130., -40.0);
     cut->AddCut(VarManager::kTPCsignal, 73., 100.);
     cut->AddCut(VarManager::kTPCsignal, cutLow1, 100.0, false, VarManager::kPin, 0.5, 3.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("electronPID3")) {
+  factories.emplace("electronPID3", [](AnalysisCut* cut) {
+    TF1* cutLow1 = new TF1("cutLow1", "pol1", 0., 10.);
     cutLow1->SetParameters(130., -40.0);
     cut->AddCut(VarManager::kTPCsignal, 60., 110.);
     cut->AddCut(VarManager::kTPCsignal, cutLow1, 100.0, false, VarManager::kPin, 0.5, 3.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("electronPIDnsigma")) {
+  factories.emplace("electronPIDnsigma", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaEl, -3.0, 3.0);
     cut->AddCut(VarManager::kTPCnSigmaPr, 3.0, 3000.0);
     cut->AddCut(VarManager::kTPCnSigmaPi, 3.0, 3000.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("lmee_commonDQEM_PID_TPC")) { // cut setting to check least common factor between reduced data sets of PWGEM and PWGDQ
+  factories.emplace("lmee_commonDQEM_PID_TPC", [](AnalysisCut* cut) { // cut setting to check least common factor between reduced data sets of PWGEM and PWGDQ
     cut->AddCut(VarManager::kTPCnSigmaEl, -2.5, 3., false, VarManager::kPin, 0.0, 1e+10, false);
     cut->AddCut(VarManager::kTPCnSigmaPi, -1e12, 3.5, true, VarManager::kPin, 0.0, 1e+10, false);
     cut->AddCut(VarManager::kTPCnSigmaKa, -3., 3., true, VarManager::kPin, 0.0, 1e+10, false);
     cut->AddCut(VarManager::kTPCnSigmaPr, -3., 3., true, VarManager::kPin, 0.0, 1e+10, false);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("lmee_commonDQEM_PID_TOF")) { // cut setting to check least common factor between reduced data sets of PWGEM and PWGDQ
+  factories.emplace("lmee_commonDQEM_PID_TOF", [](AnalysisCut* cut) { // cut setting to check least common factor between reduced data sets of PWGEM and PWGDQ
     cut->AddCut(VarManager::kTPCnSigmaEl, -2.5, 3., false, VarManager::kPin, 0.0, 1e+10, false);
     cut->AddCut(VarManager::kTPCnSigmaPi, -3., 3.5, true, VarManager::kPin, 0.0, 1e+10, false);
     cut->AddCut(VarManager::kTOFnSigmaEl, -3., 3., false, VarManager::kPin, 0.3, 1e+10, false);
     return cut;
-  }
+  });
 
   std::vector<TString> vecPIDcase;
   vecPIDcase.emplace_back("");              // without post calibration
@@ -5180,16 +5344,16 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
 
   // loop to define TPC PID cuts with and without post calibration
   for (size_t icase = 0; icase < vecPIDcase.size(); icase++) {
-    if (!nameStr.compare(Form("electronPIDOnly%s", vecPIDcase.at(icase).Data()))) {
+    factories.emplace(Form("electronPIDOnly%s", vecPIDcase.at(icase).Data()), [=](AnalysisCut* cut) {
       if (icase == 0) {
         cut->AddCut(VarManager::kTPCnSigmaEl, -3.0, 3.0);
       } else if (icase == 1 || icase == 2) {
         cut->AddCut(VarManager::kTPCnSigmaEl_Corr, -3.0, 3.0);
       }
       return cut;
-    }
+    });
 
-    if (!nameStr.compare(Form("electronPID_TPCnsigma%s_loose", vecPIDcase.at(icase).Data()))) {
+    factories.emplace(Form("electronPID_TPCnsigma%s_loose", vecPIDcase.at(icase).Data()), [=](AnalysisCut* cut) {
       if (icase == 0) {
         cut->AddCut(VarManager::kTPCnSigmaEl, -3., 3., false, VarManager::kPin, 0.0, 1e+10, false);
         cut->AddCut(VarManager::kTPCnSigmaPi, -3., 3.5, true, VarManager::kPin, 0.0, 1e+10, false);
@@ -5207,9 +5371,9 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
         cut->AddCut(VarManager::kTPCnSigmaPr_Corr, -3., 3., true, VarManager::kPin, 0.0, 1e+10, false);
       }
       return cut;
-    }
+    });
 
-    if (!nameStr.compare(Form("electronPID_TPCnsigma%s", vecPIDcase.at(icase).Data()))) {
+    factories.emplace(Form("electronPID_TPCnsigma%s", vecPIDcase.at(icase).Data()), [=](AnalysisCut* cut) {
       if (icase == 0) { // previously known as electronPID_TPCnsigma_tight
         cut->AddCut(VarManager::kTPCnSigmaEl, -3., 2., false, VarManager::kPin, 0.0, 1e+10, false);
         cut->AddCut(VarManager::kTPCnSigmaPi, -3., 3.5, true, VarManager::kPin, 0.0, 1e+10, false);
@@ -5227,9 +5391,9 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
         cut->AddCut(VarManager::kTPCnSigmaPr_Corr, -3., 4., true, VarManager::kPin, 0.0, 1e+10, false);
       }
       return cut;
-    }
+    });
 
-    if (!nameStr.compare(Form("electronPID_TPCnsigma%s_strongHadRej", vecPIDcase.at(icase).Data()))) {
+    factories.emplace(Form("electronPID_TPCnsigma%s_strongHadRej", vecPIDcase.at(icase).Data()), [=](AnalysisCut* cut) {
       if (icase == 0) {
         cut->AddCut(VarManager::kTPCnSigmaEl, -3., 2., false, VarManager::kPin, 0.0, 1e+10, false);
         cut->AddCut(VarManager::kTPCnSigmaPi, -3., 4., true, VarManager::kPin, 0.0, 1e+10, false);
@@ -5247,9 +5411,9 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
         cut->AddCut(VarManager::kTPCnSigmaPr_Corr, -3., 4., true, VarManager::kPin, 0.0, 1e+10, false);
       }
       return cut;
-    }
+    });
 
-    if (!nameStr.compare(Form("electronPID_TPCnsigma%s_strongNSigE", vecPIDcase.at(icase).Data()))) {
+    factories.emplace(Form("electronPID_TPCnsigma%s_strongNSigE", vecPIDcase.at(icase).Data()), [=](AnalysisCut* cut) {
       if (icase == 0) {
         cut->AddCut(VarManager::kTPCnSigmaEl, -2., 2., false, VarManager::kPin, 0.0, 1e+10, false);
         cut->AddCut(VarManager::kTPCnSigmaPi, -3., 4., true, VarManager::kPin, 0.0, 1e+10, false);
@@ -5267,9 +5431,9 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
         cut->AddCut(VarManager::kTPCnSigmaPr_Corr, -3., 4., true, VarManager::kPin, 0.0, 1e+10, false);
       }
       return cut;
-    }
+    });
 
-    if (!nameStr.compare(Form("electronPID_lowB_TPCnsigma%s_strongNSigE", vecPIDcase.at(icase).Data()))) {
+    factories.emplace(Form("electronPID_lowB_TPCnsigma%s_strongNSigE", vecPIDcase.at(icase).Data()), [=](AnalysisCut* cut) {
       if (icase == 0) {
         cut->AddCut(VarManager::kTPCnSigmaEl, -2., 2., false, VarManager::kPin, 0.0, 1e+10, false);
         cut->AddCut(VarManager::kTPCnSigmaPi, -3., 4., true, VarManager::kPin, 0.0, 1e+10, false);
@@ -5290,9 +5454,9 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
         cut->AddCut(VarManager::kTPCnSigmaPr_Corr, -3., 4., true, VarManager::kPin, 0.0, 1e+10, false);
       }
       return cut;
-    }
+    });
 
-    if (!nameStr.compare(Form("electronPID_lowB_TPCnsigma%s_strongNSigE_rejBadTOF", vecPIDcase.at(icase).Data()))) {
+    factories.emplace(Form("electronPID_lowB_TPCnsigma%s_strongNSigE_rejBadTOF", vecPIDcase.at(icase).Data()), [=](AnalysisCut* cut) {
       if (icase == 0) {
         cut->AddCut(VarManager::kTPCnSigmaEl, -2., 2., false, VarManager::kPin, 0.0, 1e+10, false);
         cut->AddCut(VarManager::kTPCnSigmaPi, -3., 4., true, VarManager::kPin, 0.0, 1e+10, false);
@@ -5315,9 +5479,9 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
       cut->AddCut(VarManager::kTOFbeta, 0.0, 0.985, true, VarManager::kPin, 0.0, 1e+10, false);
       cut->AddCut(VarManager::kTOFbeta, 1.015, 999999999., true, VarManager::kPin, 0.0, 1e+10, false);
       return cut;
-    }
+    });
 
-    if (!nameStr.compare(Form("electronPID_TPCnsigma%s_strongNSigE_rejBadTOF", vecPIDcase.at(icase).Data()))) {
+    factories.emplace(Form("electronPID_TPCnsigma%s_strongNSigE_rejBadTOF", vecPIDcase.at(icase).Data()), [=](AnalysisCut* cut) {
       if (icase == 0) {
         cut->AddCut(VarManager::kTPCnSigmaEl, -2., 2., false, VarManager::kPin, 0.0, 1e+10, false);
         cut->AddCut(VarManager::kTPCnSigmaPi, -3., 4., true, VarManager::kPin, 0.0, 1e+10, false);
@@ -5337,9 +5501,9 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
       cut->AddCut(VarManager::kTOFbeta, 0.0, 0.985, true, VarManager::kPin, 0.0, 1e+10, false);
       cut->AddCut(VarManager::kTOFbeta, 1.015, 999999999., true, VarManager::kPin, 0.0, 1e+10, false);
       return cut;
-    }
+    });
 
-    if (!nameStr.compare(Form("electronPID_TPCnsigma%s_strongNSigEPbPb_rejBadTOF", vecPIDcase.at(icase).Data()))) {
+    factories.emplace(Form("electronPID_TPCnsigma%s_strongNSigEPbPb_rejBadTOF", vecPIDcase.at(icase).Data()), [=](AnalysisCut* cut) {
       if (icase == 0) {
         cut->AddCut(VarManager::kTPCnSigmaEl, -1., 2., false, VarManager::kPin, 0.0, 1e+10, false);
         cut->AddCut(VarManager::kTPCnSigmaPi, -3., 4., true, VarManager::kPin, 0.0, 1e+10, false);
@@ -5359,9 +5523,9 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
       cut->AddCut(VarManager::kTOFbeta, 0.0, 0.985, true, VarManager::kPin, 0.0, 1e+10, false);
       cut->AddCut(VarManager::kTOFbeta, 1.015, 999999999., true, VarManager::kPin, 0.0, 1e+10, false);
       return cut;
-    }
+    });
 
-    if (!nameStr.compare(Form("electronPID_TPCnsigma%s_tightNSigEPbPb_rejBadTOF", vecPIDcase.at(icase).Data()))) {
+    factories.emplace(Form("electronPID_TPCnsigma%s_tightNSigEPbPb_rejBadTOF", vecPIDcase.at(icase).Data()), [=](AnalysisCut* cut) {
       if (icase == 0) {
         cut->AddCut(VarManager::kTPCnSigmaEl, 0., 3., false, VarManager::kPin, 0.0, 1e+10, false);
         cut->AddCut(VarManager::kTPCnSigmaPi, -3., 4., true, VarManager::kPin, 0.0, 1e+10, false);
@@ -5381,7 +5545,7 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
       cut->AddCut(VarManager::kTOFbeta, 0.0, 0.985, true, VarManager::kPin, 0.0, 1e+10, false);
       cut->AddCut(VarManager::kTOFbeta, 1.015, 999999999., true, VarManager::kPin, 0.0, 1e+10, false);
       return cut;
-    }
+    });
 
     // List of nSigma values for lower and upper edge of El, Pi, Ka, Pr, TPC PID selections/rejection
     std::vector<double> cutVar_TPCnSigmaEl_low = {-4., -4., -4., -2., -3., -2., -3., -4., -2., -4., -3., -3., -3., -4., -3., -3., -4., -3., -4., -4., -3., -4., -3., -3., -2., -4., -4., -3., -4., -2};
@@ -5394,7 +5558,7 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
     std::vector<double> cutVar_TPCnSigmaPr_up = {2., 2., 3., 2., 3., 3., 3., 2., 4., 3., 3., 4., 4., 3., 4., 4., 3., 4., 2., 3., 4., 4., 3., 4., 3., 2., 3., 3., 2., 3};
 
     for (unsigned int i = 0; i < cutVar_TPCnSigmaEl_low.size(); i++) {
-      if (!nameStr.compare(Form("electronPID_TPCnsigma_cutVar%s%i", vecPIDcase.at(icase).Data(), i))) {
+      factories.emplace(Form("electronPID_TPCnsigma_cutVar%s%i", vecPIDcase.at(icase).Data(), i), [=](AnalysisCut* cut) {
         if (icase == 0) {
           cut->AddCut(VarManager::kTPCnSigmaEl, cutVar_TPCnSigmaEl_low.at(i), cutVar_TPCnSigmaEl_up.at(i), false, VarManager::kPin, 0.0, 1e+10, false);
           cut->AddCut(VarManager::kTPCnSigmaPi, cutVar_TPCnSigmaPi_low.at(i), cutVar_TPCnSigmaPi_up.at(i), true, VarManager::kPin, 0.0, 1e+10, false);
@@ -5412,10 +5576,10 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
           cut->AddCut(VarManager::kTPCnSigmaPr_Corr, cutVar_TPCnSigmaPr_low.at(i), cutVar_TPCnSigmaPr_up.at(i), true, VarManager::kPin, 0.0, 1e+10, false);
         }
         return cut;
-      }
+      });
     }
 
-    if (!nameStr.compare(Form("lmee_pp_502TeV_TPC%s", vecPIDcase.at(icase).Data()))) {
+    factories.emplace(Form("lmee_pp_502TeV_TPC%s", vecPIDcase.at(icase).Data()), [=](AnalysisCut* cut) {
       if (icase == 0) {
         cut->AddCut(VarManager::kTPCnSigmaEl, -3., 3., false, VarManager::kPin, 0.0, 1e+10, false);
         cut->AddCut(VarManager::kTPCnSigmaPi, -99., 3.5, true, VarManager::kPin, 0.0, 1e+10, false);
@@ -5433,9 +5597,9 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
         cut->AddCut(VarManager::kTPCnSigmaPr_Corr, -3., 3., true, VarManager::kPin, 0.0, 1e+10, false);
       }
       return cut;
-    }
+    });
 
-    if (!nameStr.compare(Form("lmee_pp_502TeV_lowB_TPC%s", vecPIDcase.at(icase).Data()))) {
+    factories.emplace(Form("lmee_pp_502TeV_lowB_TPC%s", vecPIDcase.at(icase).Data()), [=](AnalysisCut* cut) {
       if (icase == 0) {
         cut->AddCut(VarManager::kTPCnSigmaEl, -3., 3., false, VarManager::kPin, 0.0, 1e+10, false);
         cut->AddCut(VarManager::kTPCnSigmaPi, -3.5, 3.5, true, VarManager::kPin, 0.0, 1e+10, false);
@@ -5456,9 +5620,9 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
         cut->AddCut(VarManager::kTPCnSigmaPr_Corr, -3., 3., true, VarManager::kPin, 0.0, 1e+10, false);
       }
       return cut;
-    }
+    });
 
-    if (!nameStr.compare(Form("lmee_pp_502TeV_TPCloosenopkrej%s", vecPIDcase.at(icase).Data()))) {
+    factories.emplace(Form("lmee_pp_502TeV_TPCloosenopkrej%s", vecPIDcase.at(icase).Data()), [=](AnalysisCut* cut) {
       if (icase == 0) {
         cut->AddCut(VarManager::kTPCnSigmaEl, -4., 4., false, VarManager::kPin, 0.0, 1e+10, false);
         cut->AddCut(VarManager::kTPCnSigmaPi, -99., 2.5, true, VarManager::kPin, 0.0, 1e+10, false);
@@ -5467,9 +5631,9 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
         cut->AddCut(VarManager::kTPCnSigmaPi_Corr, -99., 2.5, true, VarManager::kPin, 0.0, 1e+10, false);
       }
       return cut;
-    }
+    });
 
-    if (!nameStr.compare(Form("lmee_pp_502TeV_TPCPbPbnopkrej%s", vecPIDcase.at(icase).Data()))) {
+    factories.emplace(Form("lmee_pp_502TeV_TPCPbPbnopkrej%s", vecPIDcase.at(icase).Data()), [=](AnalysisCut* cut) {
       if (icase == 0) {
         cut->AddCut(VarManager::kTPCnSigmaEl, -1., 2., false, VarManager::kPin, 0.0, 1e+10, false);
         cut->AddCut(VarManager::kTPCnSigmaPi, -3., 4., true, VarManager::kPin, 0.0, 1e+10, false);
@@ -5478,9 +5642,9 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
         cut->AddCut(VarManager::kTPCnSigmaPi_Corr, -3., 4., true, VarManager::kPin, 0.0, 1e+10, false);
       }
       return cut;
-    }
+    });
 
-    if (!nameStr.compare(Form("lmee_pp_502TeV_TPCloose%s", vecPIDcase.at(icase).Data()))) {
+    factories.emplace(Form("lmee_pp_502TeV_TPCloose%s", vecPIDcase.at(icase).Data()), [=](AnalysisCut* cut) {
       if (icase == 0) {
         cut->AddCut(VarManager::kTPCnSigmaEl, -4., 4., false, VarManager::kPin, 0.0, 1e+10, false);
         cut->AddCut(VarManager::kTPCnSigmaPi, -99., 2.5, true, VarManager::kPin, 0.0, 1e+10, false);
@@ -5498,254 +5662,254 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
         cut->AddCut(VarManager::kTPCnSigmaPr_Corr, -2., 2., true, VarManager::kPin, 0.0, 1e+10, false);
       }
       return cut;
-    }
+    });
   }
 
-  if (!nameStr.compare("electronPIDnsigmaOpen")) {
+  factories.emplace("electronPIDnsigmaOpen", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaEl, -4.0, 4.0);
     cut->AddCut(VarManager::kTPCnSigmaPr, 2.0, 3000.0);
     cut->AddCut(VarManager::kTPCnSigmaPi, 2.0, 3000.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("electronPIDnsigmaVeryVeryLoose")) {
+  factories.emplace("electronPIDnsigmaVeryVeryLoose", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaEl, -4.0, 4.0);
     cut->AddCut(VarManager::kTPCnSigmaPr, 2.5, 3000.0);
     cut->AddCut(VarManager::kTPCnSigmaPi, 2.0, 3000.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("electronPIDnsigmaVeryLoose")) {
+  factories.emplace("electronPIDnsigmaVeryLoose", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaEl, -4.0, 4.0);
     cut->AddCut(VarManager::kTPCnSigmaPr, 2.5, 3000.0);
     cut->AddCut(VarManager::kTPCnSigmaPi, 2.5, 3000.0);
     cut->AddCut(VarManager::kTOFnSigmaEl, -3., 3., false, VarManager::kPin, 0.4, 1e+10, false);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("electronPIDnsigmaLoose")) {
+  factories.emplace("electronPIDnsigmaLoose", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaEl, -3.0, 3.0);
     cut->AddCut(VarManager::kTPCnSigmaPr, 2.5, 3000.0);
     cut->AddCut(VarManager::kTPCnSigmaPi, 2.5, 3000.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("electronPIDnsigmaMedium")) {
+  factories.emplace("electronPIDnsigmaMedium", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaEl, -3.0, 3.0);
     cut->AddCut(VarManager::kTPCnSigmaPr, 2.7, 3000.0);
     cut->AddCut(VarManager::kTPCnSigmaPi, 2.7, 3000.0);
     return cut;
-  }
-  if (!nameStr.compare("electronPIDnsigmaMedium_withLargeTOFPID")) {
+  });
+  factories.emplace("electronPIDnsigmaMedium_withLargeTOFPID", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaEl, -3.0, 3.0);
     cut->AddCut(VarManager::kTPCnSigmaPr, 2.7, 3000.0);
     cut->AddCut(VarManager::kTPCnSigmaPi, 2.7, 3000.0);
     cut->AddCut(VarManager::kTOFnSigmaEl, -5.0, 5.0);
     return cut;
-  }
-  if (!nameStr.compare("electronPIDnsigmaSkewed")) {
+  });
+  factories.emplace("electronPIDnsigmaSkewed", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaEl, -2.0, 3.0);
     cut->AddCut(VarManager::kTPCnSigmaPr, 3.5, 3000.0);
     cut->AddCut(VarManager::kTPCnSigmaPi, 3.5, 3000.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("electronPIDnsigmaSkewed_2")) {
+  factories.emplace("electronPIDnsigmaSkewed_2", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaEl, -0.0, 3.0);
     cut->AddCut(VarManager::kTPCnSigmaPr, 3.5, 3000.0);
     cut->AddCut(VarManager::kTPCnSigmaPi, 3.5, 3000.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("electronPIDPrKaPiRej")) {
+  factories.emplace("electronPIDPrKaPiRej", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaEl, -3.0, 3.0);
     cut->AddCut(VarManager::kTPCnSigmaPr, -3.0, 3.0, true);
     cut->AddCut(VarManager::kTPCnSigmaPi, -3.0, 3.0, true);
     cut->AddCut(VarManager::kTPCnSigmaKa, -3.0, 3.0, true);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("electronPIDPrKaPiRej_Corr")) {
+  factories.emplace("electronPIDPrKaPiRej_Corr", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaEl_Corr, -3.0, 3.0);
     cut->AddCut(VarManager::kTPCnSigmaPr_Corr, -3.0, 3.0, true);
     cut->AddCut(VarManager::kTPCnSigmaPi_Corr, -3.0, 3.0, true);
     cut->AddCut(VarManager::kTPCnSigmaKa, -3.0, 3.0, true);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("electronPIDPrKaPiRejLoose")) {
+  factories.emplace("electronPIDPrKaPiRejLoose", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaEl, -3.0, 3.0);
     cut->AddCut(VarManager::kTPCnSigmaPr, -2.0, 2.0, true);
     cut->AddCut(VarManager::kTPCnSigmaPi, -3.0, 3.0, true, VarManager::kPin, 0.0, 1.0, false);
     cut->AddCut(VarManager::kTPCnSigmaPi, -3.0, 2.0, true, VarManager::kPin, 0.0, 1.0, true);
     cut->AddCut(VarManager::kTPCnSigmaKa, -3.0, 3.0, true);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("electronPIDPrKaPiRejLoose_Corr")) {
+  factories.emplace("electronPIDPrKaPiRejLoose_Corr", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaEl_Corr, -3.0, 3.0);
     cut->AddCut(VarManager::kTPCnSigmaPr_Corr, -2.0, 2.0, true);
     cut->AddCut(VarManager::kTPCnSigmaPi_Corr, -3.0, 3.0, true, VarManager::kPin, 0.0, 1.0, false);
     cut->AddCut(VarManager::kTPCnSigmaPi_Corr, -3.0, 2.0, true, VarManager::kPin, 0.0, 1.0, true);
     cut->AddCut(VarManager::kTPCnSigmaKa, -3.0, 3.0, true);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("electronPIDnsigmaEMu")) {
+  factories.emplace("electronPIDnsigmaEMu", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaEl, -1.0, 3.0);
     cut->AddCut(VarManager::kTPCnSigmaPr, 3.5, 3000.0);
     cut->AddCut(VarManager::kTPCnSigmaPi, 3.5, 3000.0);
     cut->AddCut(VarManager::kTPCnSigmaKa, 3.5, 3000.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("kaonPIDnsigma")) {
+  factories.emplace("kaonPIDnsigma", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaKa, -3.0, 3.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("kaonRejNsigma")) {
+  factories.emplace("kaonRejNsigma", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaKa, -3.0, 3.0, true);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("kaonPIDnsigma2")) {
+  factories.emplace("kaonPIDnsigma2", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaKa, -2.0, 2.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("kaonPID_TPCnTOF")) {
+  factories.emplace("kaonPID_TPCnTOF", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaKa, -3.0, 3.0);
     cut->AddCut(VarManager::kTOFnSigmaKa, -3.0, 3.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("kaonPIDnsigma700")) {
+  factories.emplace("kaonPIDnsigma700", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaKa, -3.0, 3.0);
     cut->AddCut(VarManager::kPin, 0.0, 0.7);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("AssocKine")) {
+  factories.emplace("AssocKine", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kPt, 1.0, 1000.0);
     cut->AddCut(VarManager::kEta, -0.9, 0.9);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("electronPIDworseRes")) {
+  factories.emplace("electronPIDworseRes", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaEl, -3.0, 3.0);
     cut->AddCut(VarManager::kTPCnSigmaPr, 3.0 * 0.8, 3000.0); // emulates a 20% degradation in PID resolution
     cut->AddCut(VarManager::kTPCnSigmaPi, 3.0 * 0.8, 3000.0); // proton and pion rejections are effectively relaxed by 20%
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("electronPIDshift")) {
+  factories.emplace("electronPIDshift", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaEl, -3.0, 3.0);
     cut->AddCut(VarManager::kTPCnSigmaPr, 3.0 - 0.2, 3000.0);
     cut->AddCut(VarManager::kTPCnSigmaPi, 3.0 - 0.2, 3000.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pionPIDnsigma")) {
+  factories.emplace("pionPIDnsigma", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaPi, -3.0, 3.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pionPID_TPCnTOF")) {
+  factories.emplace("pionPID_TPCnTOF", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaPi, -3.0, 3.0);
     cut->AddCut(VarManager::kTOFnSigmaPi, -3.0, 3.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("protonPID_TPCnTOF")) {
+  factories.emplace("protonPID_TPCnTOF", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaPr, -3.0, 3.0);
     cut->AddCut(VarManager::kTOFnSigmaPr, -3.0, 3.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("protonPID_TPCnTOF2")) {
+  factories.emplace("protonPID_TPCnTOF2", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaPr, -2.5, 2.5);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("tpc_pion_rejection")) {
+  factories.emplace("tpc_pion_rejection", [](AnalysisCut* cut) {
     TF1* f1maxPi = new TF1("f1maxPi", "[0]+[1]*x", 0, 10);
     f1maxPi->SetParameters(85, -50);
     cut->AddCut(VarManager::kTPCsignal, 70, f1maxPi, true, VarManager::kPin, 0.0, 0.4, false);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("tpc_pion_band_rejection")) {
+  factories.emplace("tpc_pion_band_rejection", [](AnalysisCut* cut) {
     TF1* f1minPi = new TF1("f1minPi", "[0]+[1]*log(x)", 0, 10);
     f1minPi->SetParameters(-115, -90);
     TF1* f1maxPi = new TF1("f1maxPi", "[0]+[1]*log(x)", 0, 10);
     f1maxPi->SetParameters(-70, -90);
     cut->AddCut(VarManager::kTPCsignal, f1minPi, f1maxPi, true, VarManager::kPin, 0.05, 0.3, false);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("tpc_pion_muon_band_rejection")) {
+  factories.emplace("tpc_pion_muon_band_rejection", [](AnalysisCut* cut) {
     TF1* f1minPi = new TF1("f1minPi", "[0]+exp([1]*x+[2])", 0, 10);
     f1minPi->SetParameters(37, -18, 5.5);
     TF1* f1maxPi = new TF1("f1maxPi", "[0]+exp([1]*x+[2])", 0, 10);
     f1maxPi->SetParameters(67, -17, 5.9);
     cut->AddCut(VarManager::kTPCsignal, f1minPi, f1maxPi, true, VarManager::kPin, 0.0, 10, false);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("tpc_pion_rejection_highp")) {
+  factories.emplace("tpc_pion_rejection_highp", [](AnalysisCut* cut) {
     TF1* f1minPi = new TF1("f1minPi", "[0]+[1]*x", 0, 10);
     f1minPi->SetParameters(65, 4.);
     cut->AddCut(VarManager::kTPCsignal, f1minPi, 110., false, VarManager::kPin, 0.0, 10, false);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("tpc_kaon_rejection")) {
+  factories.emplace("tpc_kaon_rejection", [](AnalysisCut* cut) {
     TF1* f1minKa = new TF1("f1minKa", "[0]+exp([1]*x+[2])", 0, 10);
     f1minKa->SetParameters(37, -4, 5.6);
     TF1* f1maxKa = new TF1("f1maxKa", "[0]+exp([1]*x+[2])", 0, 10);
     f1maxKa->SetParameters(60, -4.1, 6.);
     cut->AddCut(VarManager::kTPCsignal, f1minKa, f1maxKa, true, VarManager::kPin, 0.0, 10.0, false);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("tpc_proton_rejection")) {
+  factories.emplace("tpc_proton_rejection", [](AnalysisCut* cut) {
     TF1* f1minPr = new TF1("f1minPr", "[0]+exp([1]*x+[2])", 0, 10);
     f1minPr->SetParameters(37, -2.6, 6.1);
     TF1* f1maxPr = new TF1("f1maxPr", "[0]+exp([1]*x+[2])", 0, 10);
     f1maxPr->SetParameters(60, -2.4, 6.2);
     cut->AddCut(VarManager::kTPCsignal, f1minPr, f1maxPr, true, VarManager::kPin, 0.0, 10, false);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("tpc_electron")) {
+  factories.emplace("tpc_electron", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCsignal, 60, 110, false, VarManager::kPin, 0.0, 1e+10, false);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("tof_electron")) {
+  factories.emplace("tof_electron", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTOFbeta, 0.99, 1.01, false, VarManager::kPin, 0.0, 1e+10, false);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("tof_electron_sigma")) {
+  factories.emplace("tof_electron_sigma", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTOFnSigmaEl, -2., 2., false, VarManager::kPin, 0.0, 1e+10, false);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("tof_electron_sigma_2")) {
+  factories.emplace("tof_electron_sigma_2", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTOFnSigmaEl, -3., 3.);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("tof_electron_loose")) {
+  factories.emplace("tof_electron_loose", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTOFbeta, 0.95, 1.05, false, VarManager::kPin, 0.0, 1e+10, false);
     return cut;
-  }
+  });
 
   // loop to define TOF PID cuts with and without post calibration
   for (size_t icase = 0; icase < vecPIDcase.size(); icase++) {
-    if (!nameStr.compare(Form("electronPID_TOFnsigma%s_loose", vecPIDcase.at(icase).Data()))) {
+    factories.emplace(Form("electronPID_TOFnsigma%s_loose", vecPIDcase.at(icase).Data()), [=](AnalysisCut* cut) {
       if (icase == 0) {
         cut->AddCut(VarManager::kTPCnSigmaEl, -3., 3., false, VarManager::kPin, 0.0, 1e+10, false);
         cut->AddCut(VarManager::kTPCnSigmaPi, -3., 3.5, true, VarManager::kPin, 0.0, 1e+10, false);
@@ -5756,9 +5920,9 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
         cut->AddCut(VarManager::kTOFnSigmaEl, -3., 3., false, VarManager::kPin, 0.3, 1e+10, false);
       }
       return cut;
-    }
+    });
 
-    if (!nameStr.compare(Form("electronPID_TOFnsigma%s", vecPIDcase.at(icase).Data()))) {
+    factories.emplace(Form("electronPID_TOFnsigma%s", vecPIDcase.at(icase).Data()), [=](AnalysisCut* cut) {
       if (icase == 0) { // previously known as electronPID_TOFnsigma_tight
         cut->AddCut(VarManager::kTPCnSigmaEl, -3., 2., false, VarManager::kPin, 0.0, 1e+10, false);
         cut->AddCut(VarManager::kTPCnSigmaPi, -3., 3.5, true, VarManager::kPin, 0.0, 1e+10, false);
@@ -5769,9 +5933,9 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
         cut->AddCut(VarManager::kTOFnSigmaEl, -3., 3., false, VarManager::kPin, 0.3, 1e+10, false);
       }
       return cut;
-    }
+    });
 
-    if (!nameStr.compare(Form("electronPID_TOFnsigma%s_strongHadRej", vecPIDcase.at(icase).Data()))) {
+    factories.emplace(Form("electronPID_TOFnsigma%s_strongHadRej", vecPIDcase.at(icase).Data()), [=](AnalysisCut* cut) {
       if (icase == 0) {
         cut->AddCut(VarManager::kTPCnSigmaEl, -3., 2., false, VarManager::kPin, 0.0, 1e+10, false);
         cut->AddCut(VarManager::kTPCnSigmaPi, -3., 4., true, VarManager::kPin, 0.0, 1e+10, false);
@@ -5782,9 +5946,9 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
         cut->AddCut(VarManager::kTOFnSigmaEl, -3., 3., false, VarManager::kPin, 0.3, 1e+10, false);
       }
       return cut;
-    }
+    });
 
-    if (!nameStr.compare(Form("electronPID_TOFnsigma%s_strongNSigE", vecPIDcase.at(icase).Data()))) {
+    factories.emplace(Form("electronPID_TOFnsigma%s_strongNSigE", vecPIDcase.at(icase).Data()), [=](AnalysisCut* cut) {
       if (icase == 0) {
         cut->AddCut(VarManager::kTPCnSigmaEl, -2., 2., false, VarManager::kPin, 0.0, 1e+10, false);
         cut->AddCut(VarManager::kTPCnSigmaPi, -3., 4., true, VarManager::kPin, 0.0, 1e+10, false);
@@ -5795,7 +5959,7 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
         cut->AddCut(VarManager::kTOFnSigmaEl, -2., 2., false, VarManager::kPin, 0.3, 1e+10, false);
       }
       return cut;
-    }
+    });
 
     // List of nSigma values for lower and upper edge of TPC: El, Pi and TOF: El PID selections/rejection
     std::vector<double> cutVar_TPCnSigmaEl_low = {-4., -4., -4., -2., -3., -2., -3., -4., -2., -4., -3., -3., -3., -4., -3., -3., -4., -3., -4., -4., -3., -4., -3., -3., -2., -4., -4., -3., -4., -2};
@@ -5806,7 +5970,7 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
     std::vector<double> cutVar_TOFnSigmaEl_up = {4., 2., 4., 2., 4., 3., 2., 3., 3., 3., 4., 3., 2., 3., 4., 3., 3., 3., 4., 4., 2., 2., 2., 3., 3., 3., 2., 3., 2., 4};
 
     for (unsigned int i = 0; i < cutVar_TOFnSigmaEl_low.size(); i++) {
-      if (!nameStr.compare(Form("electronPID_TOFnsigma_cutVar%s%i", vecPIDcase.at(icase).Data(), i))) {
+      factories.emplace(Form("electronPID_TOFnsigma_cutVar%s%i", vecPIDcase.at(icase).Data(), i), [=](AnalysisCut* cut) {
         if (icase == 0) {
           cut->AddCut(VarManager::kTPCnSigmaEl, cutVar_TPCnSigmaEl_low.at(i), cutVar_TPCnSigmaEl_up.at(i), false, VarManager::kPin, 0.0, 1e+10, false);
           cut->AddCut(VarManager::kTPCnSigmaPi, cutVar_TPCnSigmaPi_low.at(i), cutVar_TPCnSigmaPi_up.at(i), true, VarManager::kPin, 0.0, 1e+10, false);
@@ -5817,10 +5981,10 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
           cut->AddCut(VarManager::kTOFnSigmaEl, cutVar_TOFnSigmaEl_low.at(i), cutVar_TOFnSigmaEl_up.at(i), false, VarManager::kPin, 0.3, 1e+10, false);
         }
         return cut;
-      }
+      });
     }
 
-    if (!nameStr.compare(Form("electronPID_TPC_TOFnsigma%s", vecPIDcase.at(icase).Data()))) {
+    factories.emplace(Form("electronPID_TPC_TOFnsigma%s", vecPIDcase.at(icase).Data()), [=](AnalysisCut* cut) {
       if (icase == 0) { // previously known as electronPID_TOFnsigma_tight
         cut->AddCut(VarManager::kTPCnSigmaEl, -3., 2., false, VarManager::kPin, 0.0, 1e+10, false);
         cut->AddCut(VarManager::kTPCnSigmaPi, -3., 3.5, true, VarManager::kPin, 0.0, 1e+10, false);
@@ -5835,9 +5999,9 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
         cut->AddCut(VarManager::kTOFnSigmaEl, -3., 3., false, VarManager::kPin, 0.0, 1e+10, false);
       }
       return cut;
-    }
+    });
 
-    if (!nameStr.compare(Form("electronPID_lowB_TOFnsigma%s_strongNSigE", vecPIDcase.at(icase).Data()))) {
+    factories.emplace(Form("electronPID_lowB_TOFnsigma%s_strongNSigE", vecPIDcase.at(icase).Data()), [=](AnalysisCut* cut) {
       if (icase == 0) {
         cut->AddCut(VarManager::kTPCnSigmaEl, -2., 2., false, VarManager::kPin, 0.0, 1e+10, false);
         cut->AddCut(VarManager::kTPCnSigmaPi, -3., 4., true, VarManager::kPin, 0.3, 1e+10, false);
@@ -5850,9 +6014,9 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
         cut->AddCut(VarManager::kTOFnSigmaEl, -2., 2., false, VarManager::kPin, 0.0, 1e+10, false);
       }
       return cut;
-    }
+    });
 
-    if (!nameStr.compare(Form("electronPID_lowB_TOFnsigma%s_strongNSigE_rejBadTOF", vecPIDcase.at(icase).Data()))) {
+    factories.emplace(Form("electronPID_lowB_TOFnsigma%s_strongNSigE_rejBadTOF", vecPIDcase.at(icase).Data()), [=](AnalysisCut* cut) {
       if (icase == 0) {
         cut->AddCut(VarManager::kTPCnSigmaEl, -2., 2., false, VarManager::kPin, 0.0, 1e+10, false);
         cut->AddCut(VarManager::kTPCnSigmaPi, -3., 4., true, VarManager::kPin, 0.3, 1e+10, false);
@@ -5867,9 +6031,9 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
       cut->AddCut(VarManager::kTOFbeta, 0.0, 0.985, true, VarManager::kPin, 0.0, 1e+10, false);
       cut->AddCut(VarManager::kTOFbeta, 1.015, 999999999., true, VarManager::kPin, 0.0, 1e+10, false);
       return cut;
-    }
+    });
 
-    if (!nameStr.compare(Form("electronPID_TOFnsigma%s_strongNSigE_rejBadTOF", vecPIDcase.at(icase).Data()))) {
+    factories.emplace(Form("electronPID_TOFnsigma%s_strongNSigE_rejBadTOF", vecPIDcase.at(icase).Data()), [=](AnalysisCut* cut) {
       if (icase == 0) {
         cut->AddCut(VarManager::kTPCnSigmaEl, -2., 2., false, VarManager::kPin, 0.0, 1e+10, false);
         cut->AddCut(VarManager::kTPCnSigmaPi, -3., 4., true, VarManager::kPin, 0.0, 1e+10, false);
@@ -5882,9 +6046,9 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
       cut->AddCut(VarManager::kTOFbeta, 0., 0.985, true, VarManager::kPin, 0.0, 1e+10, false);
       cut->AddCut(VarManager::kTOFbeta, 1.015, 999999999., true, VarManager::kPin, 0.0, 1e+10, false);
       return cut;
-    }
+    });
 
-    if (!nameStr.compare(Form("electronPID_TOFnsigma%s_strongNSigEPbPb_rejBadTOF", vecPIDcase.at(icase).Data()))) {
+    factories.emplace(Form("electronPID_TOFnsigma%s_strongNSigEPbPb_rejBadTOF", vecPIDcase.at(icase).Data()), [=](AnalysisCut* cut) {
       if (icase == 0) {
         cut->AddCut(VarManager::kTPCnSigmaEl, -1., 2., false, VarManager::kPin, 0.0, 1e+10, false);
         cut->AddCut(VarManager::kTPCnSigmaPi, -3., 4., true, VarManager::kPin, 0.0, 1e+10, false);
@@ -5897,9 +6061,9 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
       cut->AddCut(VarManager::kTOFbeta, 0., 0.985, true, VarManager::kPin, 0.0, 1e+10, false);
       cut->AddCut(VarManager::kTOFbeta, 1.015, 999999999., true, VarManager::kPin, 0.0, 1e+10, false);
       return cut;
-    }
+    });
 
-    if (!nameStr.compare(Form("electronPID_TOFnsigma%s_tightNSigEPbPb_rejBadTOF", vecPIDcase.at(icase).Data()))) {
+    factories.emplace(Form("electronPID_TOFnsigma%s_tightNSigEPbPb_rejBadTOF", vecPIDcase.at(icase).Data()), [=](AnalysisCut* cut) {
       if (icase == 0) {
         cut->AddCut(VarManager::kTPCnSigmaEl, 0., 3., false, VarManager::kPin, 0.0, 1e+10, false);
         cut->AddCut(VarManager::kTPCnSigmaPi, -3., 4., true, VarManager::kPin, 0.0, 1e+10, false);
@@ -5912,9 +6076,9 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
       cut->AddCut(VarManager::kTOFbeta, 0., 0.985, true, VarManager::kPin, 0.0, 1e+10, false);
       cut->AddCut(VarManager::kTOFbeta, 1.015, 999999999., true, VarManager::kPin, 0.0, 1e+10, false);
       return cut;
-    }
+    });
 
-    if (!nameStr.compare(Form("electronPID_TOFreq%s_strongNSigEPbPb_rejBadTOF", vecPIDcase.at(icase).Data()))) {
+    factories.emplace(Form("electronPID_TOFreq%s_strongNSigEPbPb_rejBadTOF", vecPIDcase.at(icase).Data()), [=](AnalysisCut* cut) {
       if (icase == 0) {
         cut->AddCut(VarManager::kTPCnSigmaEl, -1., 2., false, VarManager::kPin, 0.0, 1e+10, false);
         cut->AddCut(VarManager::kTPCnSigmaPi, -3., 4., true, VarManager::kPin, 0.0, 1e+10, false);
@@ -5925,9 +6089,9 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
         cut->AddCut(VarManager::kTOFnSigmaEl, -2., 2., false, VarManager::kPin, 0.0, 1e+10, false);
       }
       return cut;
-    }
+    });
 
-    if (!nameStr.compare(Form("electronPID_TOFreq%s_tightNSigEPbPb_rejBadTOF", vecPIDcase.at(icase).Data()))) {
+    factories.emplace(Form("electronPID_TOFreq%s_tightNSigEPbPb_rejBadTOF", vecPIDcase.at(icase).Data()), [=](AnalysisCut* cut) {
       if (icase == 0) {
         cut->AddCut(VarManager::kTPCnSigmaEl, 0., 3., false, VarManager::kPin, 0.0, 1e+10, false);
         cut->AddCut(VarManager::kTPCnSigmaPi, -3., 4., true, VarManager::kPin, 0.0, 1e+10, false);
@@ -5938,9 +6102,9 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
         cut->AddCut(VarManager::kTOFnSigmaEl, -3., 1., false, VarManager::kPin, 0.0, 1e+10, false);
       }
       return cut;
-    }
+    });
 
-    if (!nameStr.compare(Form("lmee_pp_502TeV_TOF%s", vecPIDcase.at(icase).Data()))) {
+    factories.emplace(Form("lmee_pp_502TeV_TOF%s", vecPIDcase.at(icase).Data()), [=](AnalysisCut* cut) {
       if (icase == 0) {
         cut->AddCut(VarManager::kTPCnSigmaEl, -3., 3., false, VarManager::kPin, 0.0, 1e+10, false);
         cut->AddCut(VarManager::kTPCnSigmaPi, -99., 3.5, true, VarManager::kPin, 0.0, 1e+10, false);
@@ -5951,9 +6115,9 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
         cut->AddCut(VarManager::kTOFnSigmaEl, -3., 3., false, VarManager::kPin, 0.3, 1e+10, false);
       }
       return cut;
-    }
+    });
 
-    if (!nameStr.compare(Form("lmee_pp_502TeV_lowB_TOF%s", vecPIDcase.at(icase).Data()))) {
+    factories.emplace(Form("lmee_pp_502TeV_lowB_TOF%s", vecPIDcase.at(icase).Data()), [=](AnalysisCut* cut) {
       if (icase == 0) {
         cut->AddCut(VarManager::kTPCnSigmaEl, -3., 3., false, VarManager::kPin, 0.0, 1e+10, false);
         cut->AddCut(VarManager::kTPCnSigmaPi, -3., 3.5, true, VarManager::kPin, 0.0, 1e+10, false);
@@ -5966,9 +6130,9 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
         cut->AddCut(VarManager::kTOFnSigmaEl, -3., 3., false, VarManager::kPin, 0.0, 1e+10, false);
       }
       return cut;
-    }
+    });
 
-    if (!nameStr.compare(Form("lmee_pp_502TeV_TOFloose%s", vecPIDcase.at(icase).Data()))) {
+    factories.emplace(Form("lmee_pp_502TeV_TOFloose%s", vecPIDcase.at(icase).Data()), [=](AnalysisCut* cut) {
       if (icase == 0) {
         cut->AddCut(VarManager::kTPCnSigmaEl, -4., 4., false, VarManager::kPin, 0.0, 1e+10, false);
         cut->AddCut(VarManager::kTPCnSigmaPi, -99., 3., true, VarManager::kPin, 0.0, 4.0, false);
@@ -5981,9 +6145,9 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
         cut->AddCut(VarManager::kTOFnSigmaEl, -4., 4., false, VarManager::kPin, 0.3, 1e+10, false);
       }
       return cut;
-    }
+    });
 
-    if (!nameStr.compare(Form("lmee_pp_502TeV_TOFloose_pionrej%s", vecPIDcase.at(icase).Data()))) {
+    factories.emplace(Form("lmee_pp_502TeV_TOFloose_pionrej%s", vecPIDcase.at(icase).Data()), [=](AnalysisCut* cut) {
       if (icase == 0) {
         cut->AddCut(VarManager::kTPCnSigmaEl, -4., 4., false, VarManager::kPin, 0.0, 1e+10, false);
         cut->AddCut(VarManager::kTPCnSigmaPi, -99., 3.5, true, VarManager::kPin, 0.0, 2.0, false);
@@ -5996,40 +6160,40 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
         cut->AddCut(VarManager::kTOFnSigmaEl, -4., 4., false, VarManager::kPin, 0.3, 1e+10, false);
       }
       return cut;
-    }
+    });
   }
 
   // -------------------------------------------------------------------------------------------------
   // Muon cuts
-  if (!nameStr.compare("GlobalMuonTrack")) {
+  factories.emplace("GlobalMuonTrack", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMuonTrackType, -0.5, 0.5);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("MFTMCH")) {
+  factories.emplace("MFTMCH", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMuonTrackType, 1.5, 2.5);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("MCHMID")) {
+  factories.emplace("MCHMID", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMuonTrackType, 2.5, 3.5);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("MCHStandalone")) {
+  factories.emplace("MCHStandalone", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMuonTrackType, 3.5, 4.5);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("muonMinimalCuts")) {
+  factories.emplace("muonMinimalCuts", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kEta, -4.0, -2.5);
     cut->AddCut(VarManager::kMuonRAtAbsorberEnd, 17.6, 89.5);
     cut->AddCut(VarManager::kMuonPDca, 0.0, 594.0, false, VarManager::kMuonRAtAbsorberEnd, 17.6, 26.5);
     cut->AddCut(VarManager::kMuonPDca, 0.0, 324.0, false, VarManager::kMuonRAtAbsorberEnd, 26.5, 89.5);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("muonQualityCuts")) {
+  factories.emplace("muonQualityCuts", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kEta, -4.0, -2.5);
     cut->AddCut(VarManager::kMuonRAtAbsorberEnd, 17.6, 89.5);
     cut->AddCut(VarManager::kMuonPDca, 0.0, 594.0, false, VarManager::kMuonRAtAbsorberEnd, 17.6, 26.5);
@@ -6037,9 +6201,9 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
     cut->AddCut(VarManager::kMuonChi2, 0.0, 1e6);
     cut->AddCut(VarManager::kMuonChi2MatchMCHMID, 0.0, 1e6); // matching MCH-MID
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("muonQualityCuts5SigmaPDCA_Run3")) {
+  factories.emplace("muonQualityCuts5SigmaPDCA_Run3", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kEta, -4.0, -2.5);
     cut->AddCut(VarManager::kMuonRAtAbsorberEnd, 17.6, 89.5);
     cut->AddCut(VarManager::kMuonPDca, 0.0, 500.0, false, VarManager::kMuonRAtAbsorberEnd, 17.6, 26.5);
@@ -6047,9 +6211,9 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
     cut->AddCut(VarManager::kMuonChi2, 0.0, 1e6);
     cut->AddCut(VarManager::kMuonChi2MatchMCHMID, 0.0, 1e6); // matching MCH-MID
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("muonQualityCuts10SigmaPDCA")) {
+  factories.emplace("muonQualityCuts10SigmaPDCA", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kEta, -4.0, -2.5);
     cut->AddCut(VarManager::kMuonRAtAbsorberEnd, 17.6, 89.5);
     cut->AddCut(VarManager::kMuonPDca, 0.0, 990.0, false, VarManager::kMuonRAtAbsorberEnd, 17.6, 26.5);
@@ -6057,9 +6221,9 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
     cut->AddCut(VarManager::kMuonChi2, 0.0, 1e6);
     cut->AddCut(VarManager::kMuonChi2MatchMCHMID, 0.0, 1e6); // matching MCH-MID
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("matchedQualityCuts")) {
+  factories.emplace("matchedQualityCuts", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kEta, -4.0, -2.5);
     cut->AddCut(VarManager::kMuonRAtAbsorberEnd, 17.6, 89.5);
     cut->AddCut(VarManager::kMuonPDca, 0.0, 594.0, false, VarManager::kMuonRAtAbsorberEnd, 17.6, 26.5);
@@ -6068,9 +6232,9 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
     cut->AddCut(VarManager::kMuonChi2MatchMCHMID, 0.0, 1e6); // matching MCH-MID
     cut->AddCut(VarManager::kMuonChi2MatchMCHMFT, 0.0, 1e6); // matching MFT-MCH
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("matchedQualityCutsMFTeta")) {
+  factories.emplace("matchedQualityCutsMFTeta", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kEta, -3.6, -2.5);
     cut->AddCut(VarManager::kMuonRAtAbsorberEnd, 17.6, 89.5);
     cut->AddCut(VarManager::kMuonPDca, 0.0, 594.0, false, VarManager::kMuonRAtAbsorberEnd, 17.6, 26.5);
@@ -6079,127 +6243,127 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
     cut->AddCut(VarManager::kMuonChi2MatchMCHMID, 0.0, 1e6); // matching MCH-MID
     cut->AddCut(VarManager::kMuonChi2MatchMCHMFT, 0.0, 1e6); // matching MFT-MCH
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("muonQualityCutsMatchingOnly")) {
+  factories.emplace("muonQualityCutsMatchingOnly", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kEta, -4.0, -2.5);
     cut->AddCut(VarManager::kMuonChi2, 0.0, 1e6);
     cut->AddCut(VarManager::kMuonChi2MatchMCHMID, 0.0, 1e6); // matching MCH-MID
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("muonLowPt")) {
+  factories.emplace("muonLowPt", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kPt, 0.5, 1000.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("muonLowPt2")) {
+  factories.emplace("muonLowPt2", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kPt, 0.7, 1000.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("muonLowPt3")) {
+  factories.emplace("muonLowPt3", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kPt, 0.8, 1000.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("muonLowPt4")) {
+  factories.emplace("muonLowPt4", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kPt, 0.9, 1000.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("muonLowPt5")) {
+  factories.emplace("muonLowPt5", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kPt, 1.0, 1000.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("muonLowPt6")) {
+  factories.emplace("muonLowPt6", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kPt, 2.0, 1000.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("muonHighPt")) {
+  factories.emplace("muonHighPt", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kPt, 3.0, 1000.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("muonHighPt2")) {
+  factories.emplace("muonHighPt2", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kPt, 4.0, 1000.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("muonHighPt3")) {
+  factories.emplace("muonHighPt3", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kPt, 6.0, 1000.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("muonHighPt4")) {
+  factories.emplace("muonHighPt4", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kPt, 8.0, 1000.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("muonHighPt5")) {
+  factories.emplace("muonHighPt5", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kPt, 10.0, 1000.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("muonHighPt6")) {
+  factories.emplace("muonHighPt6", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kPt, 20.0, 1000.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("muonTightQualityCutsForTests")) {
+  factories.emplace("muonTightQualityCutsForTests", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kEta, -4.0, -2.5);
     cut->AddCut(VarManager::kMuonRAtAbsorberEnd, 20.0, 60.0);
     cut->AddCut(VarManager::kMuonPDca, 0.0, 594.0, false, VarManager::kMuonRAtAbsorberEnd, 17.6, 26.5);
     cut->AddCut(VarManager::kMuonPDca, 0.0, 324.0, false, VarManager::kMuonRAtAbsorberEnd, 26.5, 89.5);
     cut->AddCut(VarManager::kMuonChi2, 0.0, 1e6);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("mchTrack")) {
+  factories.emplace("mchTrack", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMuonTrackType, 3.5, 4.5);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("matchedMchMid")) {
+  factories.emplace("matchedMchMid", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMuonTrackType, 2.5, 3.5);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("matchedFwd")) {
+  factories.emplace("matchedFwd", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMuonTrackType, 1.5, 2.5);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("matchedGlobal")) {
+  factories.emplace("matchedGlobal", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMuonTrackType, -0.5, 0.5);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("Chi2MCHMFTCut1")) {
+  factories.emplace("Chi2MCHMFTCut1", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMuonChi2MatchMCHMFT, 0, 30);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("Chi2MCHMFTCut2")) {
+  factories.emplace("Chi2MCHMFTCut2", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMuonChi2MatchMCHMFT, 0, 40);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("Chi2MCHMFTCut3")) {
+  factories.emplace("Chi2MCHMFTCut3", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMuonChi2MatchMCHMFT, 0, 50);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("Chi2MCHMFTCut4")) {
+  factories.emplace("Chi2MCHMFTCut4", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMuonChi2MatchMCHMFT, 0, 60);
     return cut;
-  }
+  });
 
   // -----------------------------------------------------------------------------------------------
   // Pair cuts
-  if (!nameStr.compare("pairDalitz1")) {
+  factories.emplace("pairDalitz1", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMass, 0.0, 0.015, false, VarManager::kPt, 0., 1.);
     cut->AddCut(VarManager::kMass, 0.0, 0.035, false, VarManager::kPt, 0., 1., true);
     TF1* fcutHigh = new TF1("f1", "[0] - [0]/[1]*x", -1.5, 1.5);
@@ -6208,438 +6372,438 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
     fcutLow->SetParameters(0.6, 0.12);
     cut->AddCut(VarManager::kPsiPair, fcutLow, fcutHigh, true, VarManager::kDeltaPhiPair, 0, 0.12);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairDalitz1Strong")) {
+  factories.emplace("pairDalitz1Strong", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMass, 0.0, 0.015, false, VarManager::kPt, 0., 1.);
     cut->AddCut(VarManager::kMass, 0.0, 0.035, false, VarManager::kPt, 0., 1., true);
     cut->AddCut(VarManager::kDeltaPhiPair, -1., 0.);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairDalitz2")) {
+  factories.emplace("pairDalitz2", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMass, 0.0, 0.015, false, VarManager::kPt, 0., 1.);
     cut->AddCut(VarManager::kMass, 0.0, 0.035, false, VarManager::kPt, 0., 1., true);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairDalitz3")) {
+  factories.emplace("pairDalitz3", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMass, 0.0, 0.15);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("paira_prefilter1")) {
+  factories.emplace("paira_prefilter1", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMass, 0.0, 0.06);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("paira_prefilter2")) {
+  factories.emplace("paira_prefilter2", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMass, 0.0, 0.06);
     cut->AddCut(VarManager::kOpeningAngle, 0.0, 0.025);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("paira_prefilter3")) {
+  factories.emplace("paira_prefilter3", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMass, 0.0, 0.06);
     cut->AddCut(VarManager::kOpeningAngle, 0.0, 0.05);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("paira_prefilter4")) {
+  factories.emplace("paira_prefilter4", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMass, 0.0, 0.06);
     cut->AddCut(VarManager::kOpeningAngle, 0.0, 0.075);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("paira_prefilter5")) {
+  factories.emplace("paira_prefilter5", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMass, 0.0, 0.06);
     cut->AddCut(VarManager::kOpeningAngle, 0.0, 0.1);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("paira_prefilter6")) {
+  factories.emplace("paira_prefilter6", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMass, 0.0, 0.06);
     cut->AddCut(VarManager::kOpeningAngle, 0.0, 0.125);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("paira_prefilter7")) {
+  factories.emplace("paira_prefilter7", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMass, 0.0, 0.06);
     cut->AddCut(VarManager::kOpeningAngle, 0.0, 0.15);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairb_prefilter1")) {
+  factories.emplace("pairb_prefilter1", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMass, 0.0, 0.05);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairb_prefilter2")) {
+  factories.emplace("pairb_prefilter2", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMass, 0.0, 0.05);
     cut->AddCut(VarManager::kOpeningAngle, 0.0, 0.025);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairb_prefilter3")) {
+  factories.emplace("pairb_prefilter3", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMass, 0.0, 0.05);
     cut->AddCut(VarManager::kOpeningAngle, 0.0, 0.05);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairb_prefilter4")) {
+  factories.emplace("pairb_prefilter4", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMass, 0.0, 0.05);
     cut->AddCut(VarManager::kOpeningAngle, 0.0, 0.075);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairb_prefilter5")) {
+  factories.emplace("pairb_prefilter5", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMass, 0.0, 0.05);
     cut->AddCut(VarManager::kOpeningAngle, 0.0, 0.1);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairb_prefilter6")) {
+  factories.emplace("pairb_prefilter6", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMass, 0.0, 0.05);
     cut->AddCut(VarManager::kOpeningAngle, 0.0, 0.125);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairb_prefilter7")) {
+  factories.emplace("pairb_prefilter7", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMass, 0.0, 0.05);
     cut->AddCut(VarManager::kOpeningAngle, 0.0, 0.15);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairc_prefilter1")) {
+  factories.emplace("pairc_prefilter1", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMass, 0.0, 0.04);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairc_prefilter2")) {
+  factories.emplace("pairc_prefilter2", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMass, 0.0, 0.04);
     cut->AddCut(VarManager::kOpeningAngle, 0.0, 0.025);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairc_prefilter3")) {
+  factories.emplace("pairc_prefilter3", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMass, 0.0, 0.04);
     cut->AddCut(VarManager::kOpeningAngle, 0.0, 0.05);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairc_prefilter4")) {
+  factories.emplace("pairc_prefilter4", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMass, 0.0, 0.04);
     cut->AddCut(VarManager::kOpeningAngle, 0.0, 0.075);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairc_prefilter5")) {
+  factories.emplace("pairc_prefilter5", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMass, 0.0, 0.04);
     cut->AddCut(VarManager::kOpeningAngle, 0.0, 0.1);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairc_prefilter6")) {
+  factories.emplace("pairc_prefilter6", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMass, 0.0, 0.04);
     cut->AddCut(VarManager::kOpeningAngle, 0.0, 0.125);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairc_prefilter7")) {
+  factories.emplace("pairc_prefilter7", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMass, 0.0, 0.04);
     cut->AddCut(VarManager::kOpeningAngle, 0.0, 0.15);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("paird_prefilter1")) {
+  factories.emplace("paird_prefilter1", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kOpeningAngle, 0.0, 0.025);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("paire_prefilter1")) {
+  factories.emplace("paire_prefilter1", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kOpeningAngle, 0.0, 0.05);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairf_prefilter1")) {
+  factories.emplace("pairf_prefilter1", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kOpeningAngle, 0.0, 0.075);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairg_prefilter1")) {
+  factories.emplace("pairg_prefilter1", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kOpeningAngle, 0.0, 0.1);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairh_prefilter1")) {
+  factories.emplace("pairh_prefilter1", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kOpeningAngle, 0.0, 0.125);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairi_prefilter1")) {
+  factories.emplace("pairi_prefilter1", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kOpeningAngle, 0.0, 0.15);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairNoCut")) {
+  factories.emplace("pairNoCut", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMass, 0.0, 1000.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("DipionMassCut1")) {
+  factories.emplace("DipionMassCut1", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMass, 0.5, 1.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("DipionMassCut2")) {
+  factories.emplace("DipionMassCut2", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMass, 0.0, 1.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairMassLow1")) {
+  factories.emplace("pairMassLow1", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMass, 1.0, 1000.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairMassLow2")) {
+  factories.emplace("pairMassLow2", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMass, 1.5, 1000.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairMassLow3")) {
+  factories.emplace("pairMassLow3", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMass, 1.6, 1000.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairMassLow4")) {
+  factories.emplace("pairMassLow4", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMass, 1.7, 1000.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairMassLow5")) {
+  factories.emplace("pairMassLow5", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMass, 1.8, 1000.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairMassLow6")) {
+  factories.emplace("pairMassLow6", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMass, 1.85, 1000.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairMassLow7")) {
+  factories.emplace("pairMassLow7", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMass, 1.9, 1000.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairMassLow8")) {
+  factories.emplace("pairMassLow8", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMass, 2.0, 1000.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairMassLow9")) {
+  factories.emplace("pairMassLow9", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMass, 2.2, 1000.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairMassLow10")) {
+  factories.emplace("pairMassLow10", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMass, 2.5, 1000.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairMassLow11")) {
+  factories.emplace("pairMassLow11", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMass, 3.0, 1000.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairMassLow12")) {
+  factories.emplace("pairMassLow12", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMass, 3.5, 1000.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairMass1to2")) {
+  factories.emplace("pairMass1to2", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMass, 1., 2.);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairMassIMR")) {
+  factories.emplace("pairMassIMR", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMass, 1.1, 2.7);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairMass1_5to2_7")) {
+  factories.emplace("pairMass1_5to2_7", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMass, 1.5, 2.7);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairMass1_3to3_5")) {
+  factories.emplace("pairMass1_3to3_5", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMass, 1.3, 3.5);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairMass1_3")) {
+  factories.emplace("pairMass1_3", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMass, 1.3, 1000.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairMass1_5to3_5")) {
+  factories.emplace("pairMass1_5to3_5", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMass, 1.5, 3.5);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairJpsi")) {
+  factories.emplace("pairJpsi", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMass, 2.8, 3.3);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairJpsi2")) {
+  factories.emplace("pairJpsi2", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMass, 2.72, 3.2);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairJpsi3")) {
+  factories.emplace("pairJpsi3", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMass, 2.92, 3.14);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairPsi2S")) {
+  factories.emplace("pairPsi2S", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMass, 3.4, 3.9);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairUpsilon")) {
+  factories.emplace("pairUpsilon", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMass, 8.0, 11.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairX3872")) {
+  factories.emplace("pairX3872", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kQ, 0.0, 0.3);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairX3872_2")) {
+  factories.emplace("pairX3872_2", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kQuadDefaultDileptonMass, 3.0, 5.0);
     cut->AddCut(VarManager::kQ, 0.0, 0.5);
     cut->AddCut(VarManager::kDeltaR, 0.0, 5.0);
     cut->AddCut(VarManager::kQuadPt, 5.0, 40.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairX3872_3")) {
+  factories.emplace("pairX3872_3", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kQuadDefaultDileptonMass, 3.0, 5.0);
     cut->AddCut(VarManager::kQ, 0.0, 0.5);
     cut->AddCut(VarManager::kDeltaR, 0.0, 5.0);
     cut->AddCut(VarManager::kQuadPt, 0.0, 1000.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairPtLow1")) {
+  factories.emplace("pairPtLow1", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kPt, 2.0, 1000.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairPtLow2")) {
+  factories.emplace("pairPtLow2", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kPt, 5.0, 1000.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairPtLow3")) {
+  factories.emplace("pairPtLow3", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kPt, 0, 0.15);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairPtLow4")) {
+  factories.emplace("pairPtLow4", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kPt, 0, 10.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairPtLow5")) {
+  factories.emplace("pairPtLow5", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kPt, 0.8, 1000.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairRapidityForward")) {
+  factories.emplace("pairRapidityForward", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kRap, 2.5, 4.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairDCA")) {
+  factories.emplace("pairDCA", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kQuadDCAabsXY, .0, .50);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("singleDCA")) {
+  factories.emplace("singleDCA", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTrackDCAsigXY, 0.0, 5.);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairPhiV")) {
+  factories.emplace("pairPhiV", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kPairPhiv, 2., 3.2);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("excludePairPhiV")) {
+  factories.emplace("excludePairPhiV", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kPairPhiv, 2., 3.2, true);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairLowMass")) {
+  factories.emplace("pairLowMass", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMass, 0., 0.1);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("excludePairLowMass")) {
+  factories.emplace("excludePairLowMass", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kMass, 0., 0.1, true);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairLxyzProjected3sigma")) {
+  factories.emplace("pairLxyzProjected3sigma", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kVertexingLxyzProjected, 0.015, 10.);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairTauxyzProjected1")) {
+  factories.emplace("pairTauxyzProjected1", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kVertexingTauxyzProjected, 0.0005, 10.);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairTauxyzProjected1sigma")) {
+  factories.emplace("pairTauxyzProjected1sigma", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kVertexingTauxyzProjected, 0.003, 10.);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairLxyProjected3sigmaLambdacCand")) {
+  factories.emplace("pairLxyProjected3sigmaLambdacCand", [](AnalysisCut* cut) {
     TF1* f1minLxyProjected = new TF1("f1minLxyProjected", "[0]+[1]*x", 0., 20.);
     f1minLxyProjected->SetParameters(0.0065, -0.00023);
     cut->AddCut(VarManager::kVertexingLxyProjected, f1minLxyProjected, 1., false, VarManager::kPt, 0., 20.);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairLxyProjected3sigmaDplusCand")) {
+  factories.emplace("pairLxyProjected3sigmaDplusCand", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kVertexingLxyProjected, 0.009, 10.);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairCosPointingPos")) {
+  factories.emplace("pairCosPointingPos", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kCosPointingAngle, 0.9, 1000.);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairCosPointingNeg90")) {
+  factories.emplace("pairCosPointingNeg90", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kCosPointingAngle, -1000., -0.9);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("pairCosPointingNeg85")) {
+  factories.emplace("pairCosPointingNeg85", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kCosPointingAngle, -1000., -0.85);
     return cut;
-  }
+  });
 
   // -------------------------------------------------------------------------------------------------
   //
   // Below are a list of single electron single muon and pair selection in order or optimize the trigger
   // trigger selection cuts
 
-  if (!nameStr.compare("electronStandardQualityTriggerTest")) {
+  factories.emplace("electronStandardQualityTriggerTest", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kIsSPDany, 0.5, 1.5);
     cut->AddCut(VarManager::kIsITSrefit, 0.5, 1.5);
     cut->AddCut(VarManager::kIsTPCrefit, 0.5, 1.5);
@@ -6647,9 +6811,9 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
     cut->AddCut(VarManager::kITSchi2, 0.1, 36.0);
     cut->AddCut(VarManager::kTPCncls, 50.0, 161.);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("muonLooseTriggerTestCuts")) {
+  factories.emplace("muonLooseTriggerTestCuts", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kEta, -4.5, -2.0);
     cut->AddCut(VarManager::kMuonRAtAbsorberEnd, 10, 100);
     cut->AddCut(VarManager::kMuonPDca, 0.0, 1500, false, VarManager::kMuonRAtAbsorberEnd, 10, 26.5);
@@ -6657,9 +6821,9 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
     cut->AddCut(VarManager::kMuonChi2, 0.0, 1e6);
     cut->AddCut(VarManager::kMuonChi2MatchMCHMID, 0.0, 1e6); // matching MCH-MID
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("muonMatchingMFTMCHTriggerTestCuts")) {
+  factories.emplace("muonMatchingMFTMCHTriggerTestCuts", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kEta, -4.5, -2.0);
     cut->AddCut(VarManager::kMuonRAtAbsorberEnd, 10, 100);
     cut->AddCut(VarManager::kMuonPDca, 0.0, 1500, false, VarManager::kMuonRAtAbsorberEnd, 10, 26.5);
@@ -6668,47 +6832,43 @@ AnalysisCut* o2::aod::dqcuts::GetAnalysisCut(const char* cutName)
     cut->AddCut(VarManager::kMuonChi2MatchMCHMID, 0.0, 1e6); // matching MCH-MID
     cut->AddCut(VarManager::kMuonChi2MatchMCHMFT, 0.0, 1e6); // matching MFT-MCH
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsi_TPCPID_TriggerTest1")) {
+  factories.emplace("jpsi_TPCPID_TriggerTest1", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaEl_Corr, -3.0, 4.0, false, VarManager::kPin, 0, 2.0);
     cut->AddCut(VarManager::kTPCnSigmaEl_Corr, -2.0, 4.0, false, VarManager::kPin, 2.0, 9999.0);
     cut->AddCut(VarManager::kTPCnSigmaPi_Corr, 3.0, 999, false, VarManager::kPin, 0, 2.0);
     cut->AddCut(VarManager::kTPCnSigmaPr_Corr, 3.0, 999, false, VarManager::kPin, 0, 2.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsi_TPCPID_TriggerTest2")) {
+  factories.emplace("jpsi_TPCPID_TriggerTest2", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaEl_Corr, -3.0, 4.0, false, VarManager::kPin, 0, 2.0);
     cut->AddCut(VarManager::kTPCnSigmaEl_Corr, -2.0, 4.0, false, VarManager::kPin, 2.0, 9999.0);
     cut->AddCut(VarManager::kTPCnSigmaPi_Corr, 2.5, 999, false, VarManager::kPin, 0, 2.0);
     cut->AddCut(VarManager::kTPCnSigmaPr_Corr, 2.5, 999, false, VarManager::kPin, 0, 2.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsi_TPCPID_TriggerTest3")) {
+  factories.emplace("jpsi_TPCPID_TriggerTest3", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaEl_Corr, -3.0, 4.0, false, VarManager::kPin, 0, 3.0);
     cut->AddCut(VarManager::kTPCnSigmaEl_Corr, -2.0, 4.0, false, VarManager::kPin, 3.0, 9999.0);
     cut->AddCut(VarManager::kTPCnSigmaPi_Corr, 3.0, 999, false, VarManager::kPin, 0, 2.0);
     cut->AddCut(VarManager::kTPCnSigmaPr_Corr, 3.0, 999, false, VarManager::kPin, 0, 2.0);
     return cut;
-  }
+  });
 
-  if (!nameStr.compare("jpsi_TPCPID_TriggerTest4")) {
+  factories.emplace("jpsi_TPCPID_TriggerTest4", [](AnalysisCut* cut) {
     cut->AddCut(VarManager::kTPCnSigmaEl_Corr, -3.0, 4.0, false, VarManager::kPin, 0, 3.0);
     cut->AddCut(VarManager::kTPCnSigmaEl_Corr, -2.0, 4.0, false, VarManager::kPin, 3.0, 9999.0);
     cut->AddCut(VarManager::kTPCnSigmaPi_Corr, 2.5, 999, false, VarManager::kPin, 0, 2.0);
     cut->AddCut(VarManager::kTPCnSigmaPr_Corr, 2.5, 999, false, VarManager::kPin, 0, 2.0);
     return cut;
-  }
-
-  delete cut;
-  LOGF(fatal, Form("Did not find cut %s", cutName));
-  return nullptr;
+  });
 }
 
 //________________________________________________________________________________________________
-std::vector<AnalysisCut*> o2::aod::dqcuts::GetCutsFromJSON(const char* json)
+std::vector<AnalysisCut*> o2::aod::dqcuts::BuildCutsFromJSON(const char* json)
 {
   //
   // configure cuts using a json file
@@ -104,10 +104,12 @@ namespace o2::aod
 {
 namespace dqcuts
 {
+// NOTE: cuts are built only on the first request for a given name (or json string) and copies are returned afterwards
 AnalysisCompositeCut* GetCompositeCut(const char* cutName);
 AnalysisCut* GetAnalysisCut(const char* cutName);
 
 std::vector<AnalysisCut*> GetCutsFromJSON(const char* json);
+std::vector<std::string> GetCutNames();
 // AnalysisCut** GetCutsFromJSON(const char* json);
 template <typename T>
 bool ValidateJSONAnalysisCut(T cut);
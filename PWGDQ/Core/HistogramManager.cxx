@@ -100,22 +100,42 @@ void HistogramManager::SetDefaultVarNames(TString* vars, TString* units)
 };
 
 //__________________________________________________________________
-void HistogramManager::AddHistClass(const char* histClass)
+int HistogramManager::AddHistClass(const char* histClass)
 {
   //
   // Add a new histogram list
+  //  Returns the index of the histogram class, to be used for filling
   //
-  if (fMainList->FindObject(histClass)) {
+  auto* existingList = reinterpret_cast<TList*>(fMainList->FindObject(histClass));
+  if (existingList) {
     LOG(warn) << "HistogramManager::AddHistClass(): Cannot add histogram class " << histClass
               << " because it already exists.";
-    return;
+    return static_cast<int>(existingList->GetUniqueID());
   }
   auto* hList = new TList;
   hList->SetOwner(kTRUE);
   hList->SetName(histClass);
+  hList->SetUniqueID(fFillPlans.size());
   fMainList->Add(hList);
   std::list<std::vector<int>> varList;
   fVariablesMap[histClass] = varList;
+  FillPlan plan;
+  plan.fList = hList;
+  fFillPlans.push_back(plan);
+  return static_cast<int>(hList->GetUniqueID());
+}
+
+//__________________________________________________________________
+int HistogramManager::GetHistClassIndex(const char* histClass) const
+{
+  //
+  // Get the index of a histogram class, -1 if not found
+  //
+  auto* hList = reinterpret_cast<TList*>(fMainList->FindObject(histClass));
+  if (!hList || hList->GetUniqueID() >= fFillPlans.size() || fFillPlans[hList->GetUniqueID()].fList != hList) {
+    return kNothing;
+  }
+  return static_cast<int>(hList->GetUniqueID());
 }
 
 //_________________________________________________________________
@@ -187,6 +207,7 @@ void HistogramManager::AddHistogram(const char* histClass, const char* hname, co
   std::list varList = fVariablesMap[histClass];
   varList.push_back(varVector);
   fVariablesMap[histClass] = varList;
+  fFillPlans[hList->GetUniqueID()].fCompiled = false;
 
   // create and configure histograms according to required options
   TH1* h = nullptr;
@@ -397,6 +418,7 @@ void HistogramManager::AddHistogram(const char* histClass, const char* hname, co
   std::list varList = fVariablesMap[histClass];
   varList.push_back(varVector);
   fVariablesMap[histClass] = varList;
+  fFillPlans[hList->GetUniqueID()].fCompiled = false;
 
   TH1* h = nullptr;
   switch (dimension) {
@@ -582,6 +604,7 @@ void HistogramManager::AddHistogram(const char* histClass, const char* hname, co
   std::list varList = fVariablesMap[histClass];
   varList.push_back(varVector);
   fVariablesMap[histClass] = varList;
+  fFillPlans[hList->GetUniqueID()].fCompiled = false;
 
   uint32_t nbins = 1;
   THnBase* h = nullptr;
@@ -675,6 +698,7 @@ void HistogramManager::AddHistogram(const char* histClass, const char* hname, co
   std::list varList = fVariablesMap[histClass];
   varList.push_back(varVector);
   fVariablesMap[histClass] = varList;
+  fFillPlans[hList->GetUniqueID()].fCompiled = false;
 
   // get the min and max for each axis
   auto* xmin = new double[nDimensions];
@@ -755,144 +779,205 @@ void HistogramManager::FillHistClass(const char* className, Float_t* values)
     LOG(warn) << "         Histogram list not filled" << endl; */
     return;
   }
+  if (hList->GetUniqueID() >= fFillPlans.size() || fFillPlans[hList->GetUniqueID()].fList != hList) {
+    return;
+  }
+  FillHistClass(static_cast<int>(hList->GetUniqueID()), values);
+}
 
-  // get the corresponding std::list containng identifiers to the needed variables to be filled
-  auto const& varList = fVariablesMap[className];
-
-  TIter next(hList);
+//__________________________________________________________________
+void HistogramManager::FillHistClass(int classIndex, Float_t* values)
+{
+  //
+  //  fill a class of histograms using its precompiled fill plan
+  //
+  if (classIndex < 0 || classIndex >= static_cast<int>(fFillPlans.size())) {
+    return;
+  }
+  auto& plan = fFillPlans[classIndex];
+  if (!plan.fCompiled) {
+    CompileFillPlan(plan);
+  }
 
-  TObject* h = nullptr;
-  bool isProfile;
-  bool isTHn;
-  int dimension = 0;
-  bool isSparse = kFALSE;
-  bool isFillLabelx = kFALSE;
   // TODO: At the moment, maximum 20 dimensions are foreseen for the THn histograms. We should make this more dynamic
   //       But maybe its better to have it like to avoid dynamically allocating this array in the histogram loop
   double fillValues[20] = {0.0};
-  int varX = -1, varY = -1, varZ = -1, varT = -1, varW = -1;
 
-  // loop over the histogram and std::list
-  // NOTE: these two should contain the same number of elements and be synchronized, otherwise its a mess
-  for (auto varIter = varList.begin(); varIter != varList.end(); varIter++) {
-    h = next(); // get the histogram
-    // decode information from the vector of indices
-    isProfile = ((*varIter)[0] == 1 ? true : false);
-    isTHn = ((*varIter)[1] > 0 ? true : false);
-    if (isTHn) {
-      dimension = (*varIter)[1];
-    } else {
-      dimension = (reinterpret_cast<TH1*>(h))->GetDimension();
-    }
+  for (auto& entry : plan.fEntries) {
+    TObject* h = entry.fHist;
+    const int varX = entry.fVarX, varY = entry.fVarY, varZ = entry.fVarZ, varT = entry.fVarT, varW = entry.fVarW;
 
-    // get the various variable indices
-    varW = (*varIter)[2];
-    if (isTHn) {
-      for (int i = 0; i < dimension; i++) {
-        fillValues[i] = values[(*varIter)[3 + i]];
+    // for label filling, the x value is replaced by the center of the bin with the corresponding label
+    double x = (varX > kNothing ? values[varX] : 0.0);
+    if (entry.fFillLabelX) {
+      int bin = FindLabelBin(entry, (reinterpret_cast<TH1*>(h))->GetXaxis(), values[varX]);
+      if (bin < 0) {
+        FillLabelFallback(entry, values);
+        continue;
       }
-    } else {
-      varX = (*varIter)[3];
-      varY = (*varIter)[4];
-      varZ = (*varIter)[5];
-      varT = (*varIter)[6];
-      isFillLabelx = ((*varIter)[7] == 1 ? true : false);
+      x = (reinterpret_cast<TH1*>(h))->GetXaxis()->GetBinCenter(bin);
     }
 
-    if (!isTHn) {
-      switch (dimension) {
-        case 1:
-          if (isProfile) {
-            if (varW > kNothing) {
-              if (isFillLabelx) {
-                (reinterpret_cast<TProfile*>(h))->Fill(Form("%d", static_cast<int>(values[varX])), values[varY], values[varW]);
-              } else {
-                (reinterpret_cast<TProfile*>(h))->Fill(values[varX], values[varY], values[varW]);
-              }
-            } else {
-              if (isFillLabelx) {
-                (reinterpret_cast<TProfile*>(h))->Fill(Form("%d", static_cast<int>(values[varX])), values[varY]);
-              } else {
-                (reinterpret_cast<TProfile*>(h))->Fill(values[varX], values[varY]);
-              }
-            }
-          } else {
-            if (varW > kNothing) {
-              if (isFillLabelx) {
-                (reinterpret_cast<TH1*>(h))->Fill(Form("%d", static_cast<int>(values[varX])), values[varW]);
-              } else {
-                (reinterpret_cast<TH1*>(h))->Fill(values[varX], values[varW]);
-              }
-            } else {
-              if (isFillLabelx) {
-                (reinterpret_cast<TH1*>(h))->Fill(Form("%d", static_cast<int>(values[varX])), 1.);
-              } else {
-                (reinterpret_cast<TH1*>(h))->Fill(values[varX]);
-              }
-            }
-          }
-          break;
-        case 2:
-          if (isProfile) {
-            if (varW > kNothing) {
-              (reinterpret_cast<TProfile2D*>(h))->Fill(values[varX], values[varY], values[varZ], values[varW]);
-            } else {
-              (reinterpret_cast<TProfile2D*>(h))->Fill(values[varX], values[varY], values[varZ]);
-            }
-          } else {
-            if (varW > kNothing) {
-              if (isFillLabelx) {
-                (reinterpret_cast<TH2*>(h))->Fill(Form("%d", static_cast<int>(values[varX])), values[varY], values[varW]);
-              } else {
-                (reinterpret_cast<TH2*>(h))->Fill(values[varX], values[varY], values[varW]);
-              }
-            } else {
-              if (isFillLabelx) {
-                (reinterpret_cast<TH2*>(h))->Fill(Form("%d", static_cast<int>(values[varX])), values[varY], 1.);
-              } else {
-                (reinterpret_cast<TH2*>(h))->Fill(values[varX], values[varY]);
-              }
-            }
-          }
-          break;
-        case 3:
-          if (isProfile) {
-            if (varW > kNothing) {
-              (reinterpret_cast<TProfile3D*>(h))->Fill(values[varX], values[varY], values[varZ], values[varT], values[varW]);
-            } else {
-              (reinterpret_cast<TProfile3D*>(h))->Fill(values[varX], values[varY], values[varZ], values[varT]);
-            }
-          } else {
-            if (varW > kNothing) {
-              (reinterpret_cast<TH3*>(h))->Fill(values[varX], values[varY], values[varZ], values[varW]);
-            } else {
-              (reinterpret_cast<TH3*>(h))->Fill(values[varX], values[varY], values[varZ]);
-            }
-          }
-          break;
-
-        default:
-          break;
-      } // end switch
-      // end if(!isTHn)
-    } else {
-      if (varW > kNothing) {
-        if (isSparse) {
-          (reinterpret_cast<THnSparse*>(h))->Fill(fillValues, values[varW]);
+    switch (entry.fKind) {
+      case kFillTH1:
+        if (varW > kNothing) {
+          (reinterpret_cast<TH1*>(h))->Fill(x, values[varW]);
         } else {
-          (reinterpret_cast<THn*>(h))->Fill(fillValues, values[varW]);
+          (reinterpret_cast<TH1*>(h))->Fill(x);
         }
-      } else {
-        if (isSparse) {
-          (reinterpret_cast<THnSparse*>(h))->Fill(fillValues);
+        break;
+      case kFillTProfile:
+        if (varW > kNothing) {
+          (reinterpret_cast<TProfile*>(h))->Fill(x, values[varY], values[varW]);
         } else {
-          (reinterpret_cast<THn*>(h))->Fill(fillValues);
+          (reinterpret_cast<TProfile*>(h))->Fill(x, values[varY]);
         }
-      }
-    } // end else
+        break;
+      case kFillTH2:
+        if (varW > kNothing) {
+          (reinterpret_cast<TH2*>(h))->Fill(x, values[varY], values[varW]);
+        } else {
+          (reinterpret_cast<TH2*>(h))->Fill(x, values[varY]);
+        }
+        break;
+      case kFillTProfile2D:
+        if (varW > kNothing) {
+          (reinterpret_cast<TProfile2D*>(h))->Fill(x, values[varY], values[varZ], values[varW]);
+        } else {
+          (reinterpret_cast<TProfile2D*>(h))->Fill(x, values[varY], values[varZ]);
+        }
+        break;
+      case kFillTH3:
+        if (varW > kNothing) {
+          (reinterpret_cast<TH3*>(h))->Fill(x, values[varY], values[varZ], values[varW]);
+        } else {
+          (reinterpret_cast<TH3*>(h))->Fill(x, values[varY], values[varZ]);
+        }
+        break;
+      case kFillTProfile3D:
+        if (varW > kNothing) {
+          (reinterpret_cast<TProfile3D*>(h))->Fill(x, values[varY], values[varZ], values[varT], values[varW]);
+        } else {
+          (reinterpret_cast<TProfile3D*>(h))->Fill(x, values[varY], values[varZ], values[varT]);
+        }
+        break;
+      case kFillTHn:
+        for (int i = 0; i < entry.fNDims; i++) {
+          fillValues[i] = values[plan.fTHnVars[entry.fFirstVar + i]];
+        }
+        if (varW > kNothing) {
+          (reinterpret_cast<THnBase*>(h))->Fill(fillValues, values[varW]);
+        } else {
+          (reinterpret_cast<THnBase*>(h))->Fill(fillValues);
+        }
+        break;
+      default:
+        break;
+    } // end switch
   } // end loop over histograms
 }
 
+//__________________________________________________________________
+void HistogramManager::CompileFillPlan(FillPlan& plan)
+{
+  //
+  //  decode the variable identifiers of a histogram class into a flat array of fill instructions
+  //
+  plan.fEntries.clear();
+  plan.fTHnVars.clear();
+
+  // get the corresponding std::list containng identifiers to the needed variables to be filled
+  auto const& varList = fVariablesMap[plan.fList->GetName()];
+  plan.fEntries.reserve(varList.size());
+
+  // loop over the histogram and std::list
+  // NOTE: these two should contain the same number of elements and be synchronized, otherwise its a mess
+  TIter next(plan.fList);
+  for (auto const& vars : varList) {
+    FillPlanEntry entry;
+    entry.fHist = next(); // get the histogram
+    entry.fVarW = vars[2];
+    if (vars[1] > 0) { // THn
+      entry.fKind = kFillTHn;
+      entry.fNDims = vars[1];
+      entry.fFirstVar = plan.fTHnVars.size();
+      for (int i = 0; i < entry.fNDims; i++) {
+        plan.fTHnVars.push_back(vars[3 + i]);
+      }
+      plan.fEntries.push_back(entry);
+      continue;
+    }
+
+    const bool isProfile = (vars[0] == 1);
+    entry.fVarX = vars[3];
+    entry.fVarY = vars[4];
+    entry.fVarZ = vars[5];
+    entry.fVarT = vars[6];
+    // NOTE: the labels are used for filling only for TH1, TProfile and TH2
+    const bool isFillLabelx = (vars[7] == 1);
+    switch ((reinterpret_cast<TH1*>(entry.fHist))->GetDimension()) {
+      case 1:
+        entry.fKind = (isProfile ? kFillTProfile : kFillTH1);
+        entry.fFillLabelX = isFillLabelx;
+        break;
+      case 2:
+        entry.fKind = (isProfile ? kFillTProfile2D : kFillTH2);
+        entry.fFillLabelX = (isFillLabelx && !isProfile);
+        break;
+      case 3:
+        entry.fKind = (isProfile ? kFillTProfile3D : kFillTH3);
+        break;
+      default:
+        continue;
+    }
+    plan.fEntries.push_back(entry);
+  }
+  plan.fCompiled = true;
+}
+
+//__________________________________________________________________
+int HistogramManager::FindLabelBin(FillPlanEntry& entry, TAxis* ax, float value)
+{
+  //
+  //  find the bin whose label is the integer value, using a per-histogram cache
+  //  Returns -1 if the label does not exist (yet) on the axis
+  //
+  const int label = static_cast<int>(value);
+  auto cached = entry.fLabelBins.find(label);
+  if (cached != entry.fLabelBins.end()) {
+    return cached->second;
+  }
+  int bin = ax->FindFixBin(Form("%d", label));
+  if (bin > 0) {
+    entry.fLabelBins[label] = bin;
+  }
+  return bin > 0 ? bin : -1;
+}
+
+//__________________________________________________________________
+void HistogramManager::FillLabelFallback(const FillPlanEntry& entry, float* values)
+{
+  //
+  //  fill by label for labels not (yet) present on the axis, letting ROOT handle alphanumeric axes
+  //
+  TObject* h = entry.fHist;
+  const char* label = Form("%d", static_cast<int>(values[entry.fVarX]));
+  const double w = (entry.fVarW > kNothing ? values[entry.fVarW] : 1.);
+  switch (entry.fKind) {
+    case kFillTH1:
+      (reinterpret_cast<TH1*>(h))->Fill(label, w);
+      break;
+    case kFillTProfile:
+      (reinterpret_cast<TProfile*>(h))->Fill(label, values[entry.fVarY], w);
+      break;
+    case kFillTH2:
+      (reinterpret_cast<TH2*>(h))->Fill(label, values[entry.fVarY], w);
+      break;
+    default:
+      break;
+  }
+}
+
 //____________________________________________________________________________________
 void HistogramManager::MakeAxisLabels(TAxis* ax, const char* labels)
 {
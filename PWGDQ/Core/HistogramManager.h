@@ -26,6 +26,7 @@
 
 #include <string>
 #include <map>
+#include <unordered_map>
 #include <vector>
 #include <list>
 
@@ -50,7 +51,9 @@ class HistogramManager : public TNamed
   }
 
   // Create a new histogram class
-  void AddHistClass(const char* histClass);
+  // The returned index can be used with FillHistClass(int, float*) to fill the class without any string lookup
+  int AddHistClass(const char* histClass);
+  int GetHistClassIndex(const char* histClass) const;
   // Create a new histogram in the class <histClass> with name <name> and title <title>
   // The type of histogram is deduced from the parameters specified by the user
   // The binning for at least one dimension needs to be specified, namely: nXbins, xmin, xmax, varX which will result in a TH1F histogram
@@ -85,6 +88,7 @@ class HistogramManager : public TNamed
                     TString* axLabels = nullptr, int varW = -1, bool useSparse = kFALSE, bool isdouble = false);
 
   void FillHistClass(const char* className, float* values);
+  void FillHistClass(int classIndex, float* values);
 
   void SetUseDefaultVariableNames(bool flag) { fUseDefaultVariableNames = flag; }
   void SetDefaultVarNames(TString* vars, TString* units);
@@ -102,6 +106,34 @@ class HistogramManager : public TNamed
   bool* fUsedVars;                                                  //! flags of used variables
   std::map<std::string, std::list<std::vector<int>>> fVariablesMap; //!  map holding identifiers for all variables needed by histograms
 
+  // fill plan of a histogram class, compiled from fVariablesMap on the first fill after the last added histogram
+  // NOTE: the index of the plan is stored as the unique ID of the corresponding histogram list
+  enum FillKind {
+    kFillTH1 = 0,
+    kFillTProfile,
+    kFillTH2,
+    kFillTProfile2D,
+    kFillTH3,
+    kFillTProfile3D,
+    kFillTHn
+  };
+  struct FillPlanEntry {
+    TObject* fHist = nullptr;
+    int fKind = kFillTH1;
+    bool fFillLabelX = false;
+    int fVarX = kNothing, fVarY = kNothing, fVarZ = kNothing, fVarT = kNothing, fVarW = kNothing;
+    int fNDims = 0;                           // number of dimensions (THn only)
+    int fFirstVar = 0;                        // position of the axes variables in FillPlan::fTHnVars (THn only)
+    std::unordered_map<int, int> fLabelBins; // cache of the x-axis bin for each integer label value (label filling only)
+  };
+  struct FillPlan {
+    TList* fList = nullptr;
+    bool fCompiled = false;
+    std::vector<FillPlanEntry> fEntries;
+    std::vector<int> fTHnVars;
+  };
+  std::vector<FillPlan> fFillPlans; //! fill plans, one per histogram class
+
   // various
   bool fUseDefaultVariableNames;    //! toggle the usage of default variable names and units
   uint64_t fBinsAllocated;          //! number of allocated bins
@@ -109,6 +141,9 @@ class HistogramManager : public TNamed
   TString* fVariableUnits;          //! variable units
 
   void MakeAxisLabels(TAxis* ax, const char* labels);
+  void CompileFillPlan(FillPlan& plan);
+  int FindLabelBin(FillPlanEntry& entry, TAxis* ax, float value);
+  void FillLabelFallback(const FillPlanEntry& entry, float* values);
 
   HistogramManager& operator=(const HistogramManager& c);
   HistogramManager(const HistogramManager& c);
@@ -11,7 +11,10 @@
 //
 // Contact: iarsene@cern.ch, i.c.arsene@fys.uio.no
 //
+#include <functional>
+#include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 // #include <iostream>
 
@@ -26,823 +29,888 @@ using namespace o2::constants::physics;
 // using std::cout;
 // using std::endl;
 
+namespace o2::aod::dqmcsignals
+{
+// registry of the predefined signals, mapping each signal name to the function which defines it
+// NOTE: the registry is filled once, on the first request
+using MCSignalFactories = std::unordered_map<std::string, std::function<MCSignal*(const char*)>>;
+void RegisterMCSignals(MCSignalFactories& factories);
+
+// builder of the predefined signals, resolved by name in the registry
+MCSignal* BuildMCSignal(const char* name);
+} // namespace o2::aod::dqmcsignals
+
+namespace
+{
+const o2::aod::dqmcsignals::MCSignalFactories& MCSignalRegistry()
+{
+  static const o2::aod::dqmcsignals::MCSignalFactories factories = [] {
+    o2::aod::dqmcsignals::MCSignalFactories registered;
+    o2::aod::dqmcsignals::RegisterMCSignals(registered);
+    return registered;
+  }();
+  return factories;
+}
+
+std::unordered_map<std::string, std::unique_ptr<MCSignal>> gMCSignalsCache; // signals already built (or not found), by name
+} // namespace
+
+//_______________________________________________________________________________________________
 MCSignal* o2::aod::dqmcsignals::GetMCSignal(const char* name)
 {
-  std::string nameStr = name;
-  MCSignal* signal;
-  // 1-prong signals
-  if (!nameStr.compare("alicePrimary")) {
-    MCProng prong(1);                                  // 1-generation prong
-    prong.SetSourceBit(0, MCProng::kPhysicalPrimary);  // set source to be ALICE primary particles
-    signal = new MCSignal(1, name, "ALICE primaries"); // define a signal with one prong
-    signal->AddProng(prong);                           // add the previously defined prong to the signal
-    return signal;
+  //
+  // get a predefined MC signal, which is built only on the first request
+  //  The caller takes ownership of the returned copy, nullptr is returned for unknown signals
+  //
+  auto cached = gMCSignalsCache.find(name);
+  if (cached == gMCSignalsCache.end()) {
+    cached = gMCSignalsCache.emplace(name, std::unique_ptr<MCSignal>(BuildMCSignal(name))).first;
   }
-  if (!nameStr.compare("electron")) {
-    MCProng prong(1, {11}, {true}, {false}, {0}, {0}, {false});        // define 1-generation prong using the full constructor
-    signal = new MCSignal(name, "Inclusive electrons", {prong}, {-1}); // define the signal using the full constructor
-    return signal;
+  if (!cached->second) {
+    return nullptr;
   }
-  if (!nameStr.compare("electronPrimary")) {
-    MCProng prong(1, {11}, {true}, {false}, {0}, {0}, {false});      // define 1-generation prong using the full constructor
-    prong.SetSourceBit(0, MCProng::kPhysicalPrimary);                // set source to be ALICE primary particles
-    signal = new MCSignal(name, "Primary electrons", {prong}, {-1}); // define the signal using the full constructor
-    return signal;
+  return new MCSignal(*(cached->second));
+}
+
+//_______________________________________________________________________________________________
+MCSignal* o2::aod::dqmcsignals::BuildMCSignal(const char* name)
+{
+  auto factory = MCSignalRegistry().find(name);
+  if (factory == MCSignalRegistry().end()) {
+    return nullptr;
   }
-  if (!nameStr.compare("pionPrimary")) {
-    MCProng prong(1, {211}, {true}, {false}, {0}, {0}, {false}); // define 1-generation prong using the full constructor
-    prong.SetSourceBit(0, MCProng::kPhysicalPrimary);            // set source to be ALICE primary particles
-    signal = new MCSignal(name, "Primary pions", {prong}, {-1}); // define the signal using the full constructor
-    return signal;
+  return factory->second(name);
+}
+
+//_______________________________________________________________________________________________
+std::vector<std::string> o2::aod::dqmcsignals::GetMCSignalNames()
+{
+  //
+  // list the names of all the predefined MC signals
+  //
+  std::vector<std::string> names;
+  for (const auto& [name, factory] : MCSignalRegistry()) {
+    names.push_back(name);
   }
-  if (!nameStr.compare("pionPrimaryFromHc")) {
+  return names;
+}
+
+//_______________________________________________________________________________________________
+void o2::aod::dqmcsignals::RegisterMCSignals(MCSignalFactories& factories)
+{
+  // 1-prong signals
+  factories.emplace("alicePrimary", [](const char* name) {
+    MCProng prong(1);                                            // 1-generation prong
+    prong.SetSourceBit(0, MCProng::kPhysicalPrimary);            // set source to be ALICE primary particles
+    MCSignal* signal = new MCSignal(1, name, "ALICE primaries"); // define a signal with one prong
+    signal->AddProng(prong);                                     // add the previously defined prong to the signal
+    return signal;
+  });
+  factories.emplace("electron", [](const char* name) {
+    MCProng prong(1, {11}, {true}, {false}, {0}, {0}, {false});                  // define 1-generation prong using the full constructor
+    MCSignal* signal = new MCSignal(name, "Inclusive electrons", {prong}, {-1}); // define the signal using the full constructor
+    return signal;
+  });
+  factories.emplace("electronPrimary", [](const char* name) {
+    MCProng prong(1, {11}, {true}, {false}, {0}, {0}, {false});                // define 1-generation prong using the full constructor
+    prong.SetSourceBit(0, MCProng::kPhysicalPrimary);                          // set source to be ALICE primary particles
+    MCSignal* signal = new MCSignal(name, "Primary electrons", {prong}, {-1}); // define the signal using the full constructor
+    return signal;
+  });
+  factories.emplace("pionPrimary", [](const char* name) {
+    MCProng prong(1, {211}, {true}, {false}, {0}, {0}, {false});           // define 1-generation prong using the full constructor
+    prong.SetSourceBit(0, MCProng::kPhysicalPrimary);                      // set source to be ALICE primary particles
+    MCSignal* signal = new MCSignal(name, "Primary pions", {prong}, {-1}); // define the signal using the full constructor
+    return signal;
+  });
+  factories.emplace("pionPrimaryFromHc", [](const char* name) {
     MCProng prong(2, {211, 402}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary, false);
-    signal = new MCSignal(name, "Primary pions from open charmed hadron decays", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Primary pions from open charmed hadron decays", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("pionPrimaryFromHb")) {
+  });
+  factories.emplace("pionPrimaryFromHb", [](const char* name) {
     MCProng prong(2, {211, 502}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary, false);
-    signal = new MCSignal(name, "Primary pions from open beauty hadron decays", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Primary pions from open beauty hadron decays", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("photon")) {
-    MCProng prong(1, {22}, {true}, {false}, {0}, {0}, {false}); // define 1-generation prong using the full constructor
-    signal = new MCSignal(name, "Photon", {prong}, {-1});       // define the signal using the full constructor
+  });
+  factories.emplace("photon", [](const char* name) {
+    MCProng prong(1, {22}, {true}, {false}, {0}, {0}, {false});     // define 1-generation prong using the full constructor
+    MCSignal* signal = new MCSignal(name, "Photon", {prong}, {-1}); // define the signal using the full constructor
     return signal;
-  }
-  if (!nameStr.compare("muonPrimary")) {
-    MCProng prong(1, {13}, {true}, {false}, {0}, {0}, {false});  // define 1-generation prong using the full constructor
-    prong.SetSourceBit(0, MCProng::kPhysicalPrimary);            // set source to be ALICE primary particles
-    signal = new MCSignal(name, "Primary Muons", {prong}, {-1}); // define the signal using the full constructor
+  });
+  factories.emplace("muonPrimary", [](const char* name) {
+    MCProng prong(1, {13}, {true}, {false}, {0}, {0}, {false});            // define 1-generation prong using the full constructor
+    prong.SetSourceBit(0, MCProng::kPhysicalPrimary);                      // set source to be ALICE primary particles
+    MCSignal* signal = new MCSignal(name, "Primary Muons", {prong}, {-1}); // define the signal using the full constructor
     return signal;
-  }
-  if (!nameStr.compare("kaonFromPhi")) {
+  });
+  factories.emplace("kaonFromPhi", [](const char* name) {
     MCProng prong(2, {321, 333}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}); // define 2-generation prong using the full constructor
-    signal = new MCSignal(name, "Kaons from phi-mesons", {prong}, {-1});                        // define the signal using the full constructor
+    MCSignal* signal = new MCSignal(name, "Kaons from phi-mesons", {prong}, {-1});              // define the signal using the full constructor
     return signal;
-  }
-  if (!nameStr.compare("kaonPrimary")) {
-    MCProng prong(1, {321}, {true}, {false}, {0}, {0}, {false}); // define 1-generation prong using the full constructor
-    prong.SetSourceBit(0, MCProng::kPhysicalPrimary);            // set source to be ALICE primary particles
-    signal = new MCSignal(name, "Primary Kaons", {prong}, {-1}); // define the signal using the full constructor
+  });
+  factories.emplace("kaonPrimary", [](const char* name) {
+    MCProng prong(1, {321}, {true}, {false}, {0}, {0}, {false});           // define 1-generation prong using the full constructor
+    prong.SetSourceBit(0, MCProng::kPhysicalPrimary);                      // set source to be ALICE primary particles
+    MCSignal* signal = new MCSignal(name, "Primary Kaons", {prong}, {-1}); // define the signal using the full constructor
     return signal;
-  }
-  if (!nameStr.compare("Lambda0Baryon")) {
+  });
+  factories.emplace("Lambda0Baryon", [](const char* name) {
     MCProng prong(1, {3122}, {true}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "Lambda0 Baryon", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Lambda0 Baryon", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("SigmaPlusBaryon")) {
+  });
+  factories.emplace("SigmaPlusBaryon", [](const char* name) {
     MCProng prong(1, {3222}, {true}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "SigmaPlus Baryon", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "SigmaPlus Baryon", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("proton")) {
+  });
+  factories.emplace("proton", [](const char* name) {
     MCProng prong(1, {2212}, {true}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "proton", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "proton", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("protonPrimary")) {
-    MCProng prong(1, {2212}, {true}, {false}, {0}, {0}, {false}); // define 1-generation prong using the full constructor
-    prong.SetSourceBit(0, MCProng::kPhysicalPrimary);             // set source to be ALICE primary particles
-    signal = new MCSignal(name, "Primary Proton", {prong}, {-1}); // define the signal using the full constructor
+  });
+  factories.emplace("protonPrimary", [](const char* name) {
+    MCProng prong(1, {2212}, {true}, {false}, {0}, {0}, {false});           // define 1-generation prong using the full constructor
+    prong.SetSourceBit(0, MCProng::kPhysicalPrimary);                       // set source to be ALICE primary particles
+    MCSignal* signal = new MCSignal(name, "Primary Proton", {prong}, {-1}); // define the signal using the full constructor
     return signal;
-  }
-  if (!nameStr.compare("protonFromTransport")) {
+  });
+  factories.emplace("protonFromTransport", [](const char* name) {
     MCProng prong(1, {2212}, {true}, {false}, {0}, {0}, {false});
     prong.SetSourceBit(0, MCProng::kProducedInTransport);
-    signal = new MCSignal(name, "ProtonFromTransport", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "ProtonFromTransport", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("protonFromLambda0")) {
+  });
+  factories.emplace("protonFromLambda0", [](const char* name) {
     MCProng prong(2, {2212, 3122}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Proton from Lambda0 decays", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Proton from Lambda0 decays", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("protonFromSigmaPlus")) {
+  });
+  factories.emplace("protonFromSigmaPlus", [](const char* name) {
     MCProng prong(2, {2212, 3222}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Proton from Sigma+ decays", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Proton from Sigma+ decays", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("phiMeson")) {
-    MCProng prong(1, {333}, {true}, {false}, {0}, {0}, {false}); // define 1-generation prong using the full constructor
-    signal = new MCSignal(name, "phi meson", {prong}, {-1});     // define the signal using the full constructor
+  });
+  factories.emplace("phiMeson", [](const char* name) {
+    MCProng prong(1, {333}, {true}, {false}, {0}, {0}, {false});       // define 1-generation prong using the full constructor
+    MCSignal* signal = new MCSignal(name, "phi meson", {prong}, {-1}); // define the signal using the full constructor
     return signal;
-  }
-  if (!nameStr.compare("muon")) {
+  });
+  factories.emplace("muon", [](const char* name) {
     MCProng prong(1, {13}, {true}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "Inclusive muons", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Inclusive muons", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("electronNOTfromTransport")) {
+  });
+  factories.emplace("electronNOTfromTransport", [](const char* name) {
     MCProng prong(1);
     prong.SetPDGcode(0, 11, true);
     prong.SetSourceBit(0, MCProng::kProducedInTransport, true); // exclude particles produces in transport
-    signal = new MCSignal(name, "Electrons which are not produced during transport in detector", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Electrons which are not produced during transport in detector", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("eFromNonpromptJpsi")) {
+  });
+  factories.emplace("eFromNonpromptJpsi", [](const char* name) {
     MCProng prong(2, {11, 443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {503}, {false});
-    signal = new MCSignal(name, "Electrons from non-prompt jpsi decays with beauty in decay chain", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Electrons from non-prompt jpsi decays with beauty in decay chain", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("ePrimaryFromPromptJpsi")) {
+  });
+  factories.emplace("ePrimaryFromPromptJpsi", [](const char* name) {
     MCProng prong(2, {11, 443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {503}, {true});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Electrons from prompt jpsi decays", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Electrons from prompt jpsi decays", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("ePrimaryFromNonpromptJpsi")) {
+  });
+  factories.emplace("ePrimaryFromNonpromptJpsi", [](const char* name) {
     MCProng prong(2, {11, 443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {503}, {false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Electrons from non-prompt jpsi decays with beauty in decay chain", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Electrons from non-prompt jpsi decays with beauty in decay chain", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("Jpsi")) {
+  });
+  factories.emplace("Jpsi", [](const char* name) {
     MCProng prong(1, {443}, {true}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "Inclusive jpsi", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Inclusive jpsi", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("Helium3")) {
+  });
+  factories.emplace("Helium3", [](const char* name) {
     MCProng prong(1, {1000020030}, {true}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "Helium3", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Helium3", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("Helium3Primary")) {
+  });
+  factories.emplace("Helium3Primary", [](const char* name) {
     MCProng prong(1, {1000020030}, {true}, {false}, {0}, {0}, {false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Helium3Primary", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Helium3Primary", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("Helium3FromTransport")) {
+  });
+  factories.emplace("Helium3FromTransport", [](const char* name) {
     MCProng prong(1, {1000020030}, {true}, {false}, {0}, {0}, {false});
     prong.SetSourceBit(0, MCProng::kProducedInTransport);
-    signal = new MCSignal(name, "Helium3FromTransport", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Helium3FromTransport", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("promptJpsi")) {
+  });
+  factories.emplace("promptJpsi", [](const char* name) {
     MCProng prong(1, {443}, {true}, {false}, {0}, {0}, {false}, false, {503}, {true});
-    signal = new MCSignal(name, "Prompt jpsi (not from beauty)", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Prompt jpsi (not from beauty)", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("nonPromptJpsi")) {
+  });
+  factories.emplace("nonPromptJpsi", [](const char* name) {
     MCProng prong(1, {443}, {true}, {false}, {0}, {0}, {false}, false, {503}, {false});
-    signal = new MCSignal(name, "Non-prompt jpsi (from beauty)", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Non-prompt jpsi (from beauty)", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("nonPromptJpsiFromBeauty")) {
+  });
+  factories.emplace("nonPromptJpsiFromBeauty", [](const char* name) {
     MCProng prong(2, {443, 503}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Non-prompt jpsi directly from beauty", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Non-prompt jpsi directly from beauty", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("nonPromptJpsiNotDirectlyFromBeauty")) {
+  });
+  factories.emplace("nonPromptJpsiNotDirectlyFromBeauty", [](const char* name) {
     MCProng prong(2, {443, 503}, {true, true}, {false, true}, {0, 0}, {0, 0}, {false, false}, false, {503}, {false});
-    signal = new MCSignal(name, "Non-prompt jpsi from other but with beauty in decay chain", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Non-prompt jpsi from other but with beauty in decay chain", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("AnythingDecayToJpsi")) {
+  });
+  factories.emplace("AnythingDecayToJpsi", [](const char* name) {
     MCProng prong(2, {MCProng::kPDGCodeNotAssigned, 443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSignalInTime(true);
-    signal = new MCSignal(name, "Decay of anything into J/psi", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Decay of anything into J/psi", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("eeFromNonpromptPsi2S")) {
+  });
+  factories.emplace("eeFromNonpromptPsi2S", [](const char* name) {
     MCProng prong(2, {11, 100443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {503}, {false});
-    signal = new MCSignal(name, "ee pairs from non-prompt psi2s decays", {prong, prong}, {1, 1}); // signal at pair level
+    MCSignal* signal = new MCSignal(name, "ee pairs from non-prompt psi2s decays", {prong, prong}, {1, 1}); // signal at pair level
     return signal;
-  }
-  if (!nameStr.compare("eeFromPromptPsi2S")) {
+  });
+  factories.emplace("eeFromPromptPsi2S", [](const char* name) {
     MCProng prong(2, {11, 100443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {503}, {true});
-    signal = new MCSignal(name, "ee pairs from prompt psi2s decays", {prong, prong}, {1, 1}); // signal at pair level
+    MCSignal* signal = new MCSignal(name, "ee pairs from prompt psi2s decays", {prong, prong}, {1, 1}); // signal at pair level
     return signal;
-  }
-  if (!nameStr.compare("eFromNonpromptPsi2S")) {
+  });
+  factories.emplace("eFromNonpromptPsi2S", [](const char* name) {
     MCProng prong(2, {11, 100443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {503}, {false});
-    signal = new MCSignal(name, "Electrons from beauty psi2s decays", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Electrons from beauty psi2s decays", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("eFromPromptPsi2S")) {
+  });
+  factories.emplace("eFromPromptPsi2S", [](const char* name) {
     MCProng prong(2, {11, 100443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {503}, {true});
-    signal = new MCSignal(name, "Electrons from prompt psi2s decays", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Electrons from prompt psi2s decays", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("Psi2S")) {
+  });
+  factories.emplace("Psi2S", [](const char* name) {
     MCProng prong(1, {100443}, {true}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "Inclusive psi2s", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Inclusive psi2s", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("nonPromptPsi2S")) {
+  });
+  factories.emplace("nonPromptPsi2S", [](const char* name) {
     MCProng prong(1, {100443}, {true}, {false}, {0}, {0}, {false}, false, {503}, {false});
-    signal = new MCSignal(name, "Non-prompt psi2s", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Non-prompt psi2s", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("promptPsi2S")) {
+  });
+  factories.emplace("promptPsi2S", [](const char* name) {
     MCProng prong(1, {100443}, {true}, {false}, {0}, {0}, {false}, false, {503}, {true});
-    signal = new MCSignal(name, "Prompt psi2s (not from beauty)", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Prompt psi2s (not from beauty)", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("Chic0")) {
+  });
+  factories.emplace("Chic0", [](const char* name) {
     MCProng prong(1, {10441}, {true}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "Inclusive Chic0", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Inclusive Chic0", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("Chic1")) {
+  });
+  factories.emplace("Chic1", [](const char* name) {
     MCProng prong(1, {20443}, {true}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "Inclusive Chic1", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Inclusive Chic1", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("Chic2")) {
+  });
+  factories.emplace("Chic2", [](const char* name) {
     MCProng prong(1, {445}, {true}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "Inclusive Chic2", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Inclusive Chic2", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("Chic012")) {
+  });
+  factories.emplace("Chic012", [](const char* name) {
     MCProng prong(1, {904}, {true}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "Inclusive Chic0, Chic1 and Chic2", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Inclusive Chic0, Chic1 and Chic2", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("Upsilon1S")) {
+  });
+  factories.emplace("Upsilon1S", [](const char* name) {
     MCProng prong(1, {553}, {true}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "Inclusive Upsilon1S", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Inclusive Upsilon1S", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("Upsilon2S")) {
+  });
+  factories.emplace("Upsilon2S", [](const char* name) {
     MCProng prong(1, {100553}, {true}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "Inclusive Upsilon2S", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Inclusive Upsilon2S", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("Upsilon3S")) {
+  });
+  factories.emplace("Upsilon3S", [](const char* name) {
     MCProng prong(1, {200553}, {true}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "Inclusive Upsilon3S", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Inclusive Upsilon3S", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("allBeautyHadrons")) {
+  });
+  factories.emplace("allBeautyHadrons", [](const char* name) {
     MCProng prong(1, {503}, {true}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "All beauty hadrons", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "All beauty hadrons", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("allBeautyHadronsFS")) {
+  });
+  factories.emplace("allBeautyHadronsFS", [](const char* name) {
     MCProng prong(1, {503}, {true}, {false}, {0}, {0}, {false});
     prong.SetSourceBit(0, MCProng::kHEPMCFinalState);
-    signal = new MCSignal(name, "All beauty hadrons", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "All beauty hadrons", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("allOpenBeautyHadrons")) {
+  });
+  factories.emplace("allOpenBeautyHadrons", [](const char* name) {
     MCProng prong(1, {502}, {true}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "All open beauty hadrons", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "All open beauty hadrons", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("allOpenBeautyHadronsFS")) {
+  });
+  factories.emplace("allOpenBeautyHadronsFS", [](const char* name) {
     MCProng prong(1, {502}, {true}, {false}, {0}, {0}, {false});
     prong.SetSourceBit(0, MCProng::kHEPMCFinalState);
-    signal = new MCSignal(name, "All open beauty hadrons", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "All open beauty hadrons", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("Bc")) {
+  });
+  factories.emplace("Bc", [](const char* name) {
     MCProng prong(1, {541}, {true}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "Bc", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Bc", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("mumuFromJpsiFromBc")) {
+  });
+  factories.emplace("mumuFromJpsiFromBc", [](const char* name) {
     MCProng prong(3, {13, 443, 541}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
-    signal = new MCSignal(name, "Muon pair from jpsi from Bc decays", {prong, prong}, {1, 1});
+    MCSignal* signal = new MCSignal(name, "Muon pair from jpsi from Bc decays", {prong, prong}, {1, 1});
     return signal;
-  }
-  if (!nameStr.compare("muFromBc")) {
+  });
+  factories.emplace("muFromBc", [](const char* name) {
     MCProng prong(2, {13, 541}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Muon from Bc decays", {prong}, {1});
+    MCSignal* signal = new MCSignal(name, "Muon from Bc decays", {prong}, {1});
     return signal;
-  }
-  if (!nameStr.compare("mumumuFromBc")) {
+  });
+  factories.emplace("mumumuFromBc", [](const char* name) {
     MCProng prongMuFromJpsi(3, {13, 443, 541}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     MCProng prongMuFromBc(2, {13, 541}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Trimuon from Bc decays", {prongMuFromJpsi, prongMuFromJpsi, prongMuFromBc}, {2, 2, 1});
+    MCSignal* signal = new MCSignal(name, "Trimuon from Bc decays", {prongMuFromJpsi, prongMuFromJpsi, prongMuFromBc}, {2, 2, 1});
     return signal;
-  }
-  if (!nameStr.compare("everythingFromBeauty")) {
+  });
+  factories.emplace("everythingFromBeauty", [](const char* name) {
     MCProng prong(2, {0, 503}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Everything from beauty", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Everything from beauty", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("everythingFromBeautyFS")) {
+  });
+  factories.emplace("everythingFromBeautyFS", [](const char* name) {
     MCProng prong(2, {0, 503}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(1, MCProng::kHEPMCFinalState);
-    signal = new MCSignal(name, "Everything from beauty", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Everything from beauty", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("everythingFromEverythingFromBeauty")) {
+  });
+  factories.emplace("everythingFromEverythingFromBeauty", [](const char* name) {
     MCProng prong(3, {0, 0, 503}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
-    signal = new MCSignal(name, "Everything from everything from beauty", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Everything from everything from beauty", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("everythingFromEverythingFromBeautyFS")) {
+  });
+  factories.emplace("everythingFromEverythingFromBeautyFS", [](const char* name) {
     MCProng prong(3, {0, 0, 503}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     prong.SetSourceBit(2, MCProng::kHEPMCFinalState);
-    signal = new MCSignal(name, "Everything from everything from beauty", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Everything from everything from beauty", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("allCharmHadrons")) {
+  });
+  factories.emplace("allCharmHadrons", [](const char* name) {
     MCProng prong(1, {403}, {true}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "All charm hadrons", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "All charm hadrons", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("allOpenCharmHadrons")) {
+  });
+  factories.emplace("allOpenCharmHadrons", [](const char* name) {
     MCProng prong(1, {402}, {true}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "All open charm hadrons", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "All open charm hadrons", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("allCharmFromBeauty")) {
+  });
+  factories.emplace("allCharmFromBeauty", [](const char* name) {
     MCProng prong(2, {403, 503}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "All charm hadrons from beauty", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "All charm hadrons from beauty", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("allPromptCharm")) {
+  });
+  factories.emplace("allPromptCharm", [](const char* name) {
     MCProng prong(2, {403, 503}, {true, true}, {false, true}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "All prompt charm hadrons (not from beauty)", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "All prompt charm hadrons (not from beauty)", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("Pi0DecayToe")) {
+  });
+  factories.emplace("Pi0DecayToe", [](const char* name) {
     MCProng prong(2, {111, 11}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSignalInTime(true); // set direction to check for daughters (true, in time) or for mothers (false, back in time)
-    signal = new MCSignal(name, "Pi0 decays into an electron", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Pi0 decays into an electron", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("Pi0DecayTog")) {
+  });
+  factories.emplace("Pi0DecayTog", [](const char* name) {
     MCProng prong(2, {111, 22}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSignalInTime(true); // set direction to check for daughters (true, in time) or for mothers (false, back in time)
-    signal = new MCSignal(name, "Pi0 decays into an gamma", {prong}, {1});
+    MCSignal* signal = new MCSignal(name, "Pi0 decays into an gamma", {prong}, {1});
     return signal;
-  }
-  if (!nameStr.compare("Pi0DecayTogg")) {
+  });
+  factories.emplace("Pi0DecayTogg", [](const char* name) {
     MCProng prong(2, {111, 22}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSignalInTime(true); // set direction to check for daughters (true, in time) or for mothers (false, back in time)
-    signal = new MCSignal(name, "Pi0 decays into an gamma, gamma", {prong, prong}, {1, 1});
+    MCSignal* signal = new MCSignal(name, "Pi0 decays into an gamma, gamma", {prong, prong}, {1, 1});
     return signal;
-  }
-  if (!nameStr.compare("PromptPi0DecayToe")) {
+  });
+  factories.emplace("PromptPi0DecayToe", [](const char* name) {
     MCProng prong(2, {111, 11}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, true, {403, 503}, {true, true});
     prong.SetSignalInTime(true); // set direction to check for daughters (true, in time) or for mothers (false, back in time)
-    signal = new MCSignal(name, "Pi0 decays into an electron", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Pi0 decays into an electron", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("Pi0")) {
+  });
+  factories.emplace("Pi0", [](const char* name) {
     MCProng prong(1, {111}, {true}, {false}, {0}, {0}, {false});
     // prong.SetSourceBit(0, MCProng::kPhysicalPrimary, false);  // set source to be ALICE primary particles
-    signal = new MCSignal(name, "Pi0", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Pi0", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("LMeeLFQ")) {
+  });
+  factories.emplace("LMeeLFQ", [](const char* name) {
     MCProng prong(1, {900}, {true}, {false}, {0}, {0}, {false});
     // prong.SetSourceBit(0, MCProng::kPhysicalPrimary, false);  // set source to be ALICE primary particles
-    signal = new MCSignal(name, "light flavor mesons + quarkonia", {prong}, {-1}); // pi0,eta,eta',rho,omega,phi,jpsi,psi2s
+    MCSignal* signal = new MCSignal(name, "light flavor mesons + quarkonia", {prong}, {-1}); // pi0,eta,eta',rho,omega,phi,jpsi,psi2s
     return signal;
-  }
-  if (!nameStr.compare("LMeeLF")) {
+  });
+  factories.emplace("LMeeLF", [](const char* name) {
     MCProng prong(1, {901}, {true}, {false}, {0}, {0}, {false});
     // prong.SetSourceBit(0, MCProng::kPhysicalPrimary, false);  // set source to be ALICE primary particles
-    signal = new MCSignal(name, "ligh flavor mesons", {prong}, {-1}); // pi0,eta,eta',rho,omega,phi
+    MCSignal* signal = new MCSignal(name, "ligh flavor mesons", {prong}, {-1}); // pi0,eta,eta',rho,omega,phi
     return signal;
-  }
-  if (!nameStr.compare("PromptJpsiDecayToe")) {
+  });
+  factories.emplace("PromptJpsiDecayToe", [](const char* name) {
     MCProng prong(2, {443, 11}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, true, {503}, {true});
     prong.SetSignalInTime(true); // set direction to check for daughters (true, in time) or for mothers (false, back in time)
-    signal = new MCSignal(name, "Prompt jpsi (not from beauty) decay to electron", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Prompt jpsi (not from beauty) decay to electron", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("electronFromDs")) {
+  });
+  factories.emplace("electronFromDs", [](const char* name) {
     MCProng prong(2, {11, 431}, {true, true}, {false, false}, {0, 0}, {0, 0}, {true, true});
-    signal = new MCSignal(name, "Electrons from Ds decays", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Electrons from Ds decays", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("dsMeson")) {
+  });
+  factories.emplace("dsMeson", [](const char* name) {
     MCProng prong(1, {431}, {true}, {false}, {0}, {0}, {true});
-    signal = new MCSignal(name, "Ds mesons", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Ds mesons", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("electronFromPC")) {
+  });
+  factories.emplace("electronFromPC", [](const char* name) {
     MCProng prong(2, {11, 22}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "electron from a photon conversion", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "electron from a photon conversion", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("PowhegDYMuon1")) {
-    MCProng prong(1, {13}, {true}, {false}, {0}, {0}, {false});        // selecting muons
-    prong.SetSourceBit(0, MCProng::kIsPowhegDYMuon);                   // set source to be Muon from POWHEG
-    signal = new MCSignal(name, "POWHEG Muon singles", {prong}, {-1}); // define a signal with 1-prong
+  });
+  factories.emplace("PowhegDYMuon1", [](const char* name) {
+    MCProng prong(1, {13}, {true}, {false}, {0}, {0}, {false});                  // selecting muons
+    prong.SetSourceBit(0, MCProng::kIsPowhegDYMuon);                             // set source to be Muon from POWHEG
+    MCSignal* signal = new MCSignal(name, "POWHEG Muon singles", {prong}, {-1}); // define a signal with 1-prong
     return signal;
-  }
+  });
 
   // 2-prong signals
-  if (!nameStr.compare("dielectron")) {
+  factories.emplace("dielectron", [](const char* name) {
     MCProng prong(1, {11}, {true}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "Electron pair", {prong, prong}, {-1, -1});
+    MCSignal* signal = new MCSignal(name, "Electron pair", {prong, prong}, {-1, -1});
     return signal;
-  }
-  if (!nameStr.compare("dimuon")) {
+  });
+  factories.emplace("dimuon", [](const char* name) {
     MCProng prong(1, {13}, {true}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "Muon pair", {prong, prong}, {-1, -1});
+    MCSignal* signal = new MCSignal(name, "Muon pair", {prong, prong}, {-1, -1});
     return signal;
-  }
-  if (!nameStr.compare("electronMuonPair")) {
+  });
+  factories.emplace("electronMuonPair", [](const char* name) {
     MCProng electron(1, {11}, {true}, {false}, {0}, {0}, {false});
     MCProng muon(1, {13}, {true}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "Electron-muon pair", {electron, muon}, {-1, -1});
+    MCSignal* signal = new MCSignal(name, "Electron-muon pair", {electron, muon}, {-1, -1});
     return signal;
-  }
-  if (!nameStr.compare("dielectronFromPC")) {
+  });
+  factories.emplace("dielectronFromPC", [](const char* name) {
     MCProng prong(2, {11, 22}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "dielectron from a photon conversion", {prong, prong}, {1, 1});
+    MCSignal* signal = new MCSignal(name, "dielectron from a photon conversion", {prong, prong}, {1, 1});
     return signal;
-  }
-  if (!nameStr.compare("dielectronFromAllPC")) {
+  });
+  factories.emplace("dielectronFromAllPC", [](const char* name) {
     MCProng prong(2, {11, 22}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "dielectron from a photon conversion", {prong, prong}, {-1, -1});
+    MCSignal* signal = new MCSignal(name, "dielectron from a photon conversion", {prong, prong}, {-1, -1});
     return signal;
-  }
-  if (!nameStr.compare("dielectronPCPi0")) {
+  });
+  factories.emplace("dielectronPCPi0", [](const char* name) {
     MCProng prong(3, {11, 22, 111}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
-    signal = new MCSignal(name, "dielectron from a photon conversion from a pi0", {prong, prong}, {1, 1});
+    MCSignal* signal = new MCSignal(name, "dielectron from a photon conversion from a pi0", {prong, prong}, {1, 1});
     return signal;
-  }
-  if (!nameStr.compare("PowhegDYMuon2")) {
-    MCProng prong(1, {13}, {true}, {false}, {0}, {0}, {false});                // selecting muons
-    prong.SetSourceBit(0, MCProng::kIsPowhegDYMuon);                           // set source to be Muon from POWHEG
-    signal = new MCSignal(name, "POWHEG Muon pair", {prong, prong}, {-1, -1}); // define a signal with 2-prong
+  });
+  factories.emplace("PowhegDYMuon2", [](const char* name) {
+    MCProng prong(1, {13}, {true}, {false}, {0}, {0}, {false});                          // selecting muons
+    prong.SetSourceBit(0, MCProng::kIsPowhegDYMuon);                                     // set source to be Muon from POWHEG
+    MCSignal* signal = new MCSignal(name, "POWHEG Muon pair", {prong, prong}, {-1, -1}); // define a signal with 2-prong
     return signal;
-  }
+  });
 
   // LMEE single signals
   // electron signals with mother X: e from mother X
-  if (!nameStr.compare("eFromAnything")) {
+  factories.emplace("eFromAnything", [](const char* name) {
     MCProng prong(2, {11, MCProng::kPDGCodeNotAssigned}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Electrons from any mother", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Electrons from any mother", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("eFromPhoton")) {
+  });
+  factories.emplace("eFromPhoton", [](const char* name) {
     MCProng prong(2, {11, 22}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Electrons from photon conversion", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Electrons from photon conversion", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("eFromPi0")) {
+  });
+  factories.emplace("eFromPi0", [](const char* name) {
     MCProng prong(2, {11, 111}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Electrons from pi0 decays", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Electrons from pi0 decays", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("ePrimaryFromPromptPi0")) {
+  });
+  factories.emplace("ePrimaryFromPromptPi0", [](const char* name) {
     MCProng prong(2, {11, 111}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502, 402}, {true, true});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Electrons from prompt pi0 decays", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Electrons from prompt pi0 decays", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("eFromEta")) {
+  });
+  factories.emplace("eFromEta", [](const char* name) {
     MCProng prong(2, {11, 221}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Electrons from eta decays", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Electrons from eta decays", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("eFromEtaPrime")) {
+  });
+  factories.emplace("eFromEtaPrime", [](const char* name) {
     MCProng prong(2, {11, 331}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Electrons from eta' decays", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Electrons from eta' decays", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("eFromRho")) {
+  });
+  factories.emplace("eFromRho", [](const char* name) {
     MCProng prong(2, {11, 113}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Electrons from rho decays", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Electrons from rho decays", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("eFromOmega")) {
+  });
+  factories.emplace("eFromOmega", [](const char* name) {
     MCProng prong(2, {11, 223}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Electrons from omega decays", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Electrons from omega decays", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("eFromPhi")) {
+  });
+  factories.emplace("eFromPhi", [](const char* name) {
     MCProng prong(2, {11, 333}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Electrons from phi decays", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Electrons from phi decays", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("eFromJpsi")) {
+  });
+  factories.emplace("eFromJpsi", [](const char* name) {
     MCProng prong(2, {11, 443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Electrons from jpsi decays", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Electrons from jpsi decays", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("anythingFromJpsi")) {
+  });
+  factories.emplace("anythingFromJpsi", [](const char* name) {
     MCProng prong(2, {MCProng::kPDGCodeNotAssigned, 443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Anything from jpsi decays", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Anything from jpsi decays", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("eFromPromptJpsi")) {
+  });
+  factories.emplace("eFromPromptJpsi", [](const char* name) {
     MCProng prong(2, {11, 443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {503}, {true});
-    signal = new MCSignal(name, "Electrons from jpsi decays", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Electrons from jpsi decays", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("eFromPsi2S")) {
+  });
+  factories.emplace("eFromPsi2S", [](const char* name) {
     MCProng prong(2, {11, 100443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Electrons from psi2s decays", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Electrons from psi2s decays", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("eFromLMeeLF")) {
+  });
+  factories.emplace("eFromLMeeLF", [](const char* name) {
     MCProng prong(2, {11, 901}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Electrons from LF meson decays", {prong}, {-1}); // pi0,eta,eta',rho,omega,phi mesons
+    MCSignal* signal = new MCSignal(name, "Electrons from LF meson decays", {prong}, {-1}); // pi0,eta,eta',rho,omega,phi mesons
     return signal;
-  }
-  if (!nameStr.compare("ePrimaryFromLMeeLF")) {
+  });
+  factories.emplace("ePrimaryFromLMeeLF", [](const char* name) {
     MCProng prong(2, {11, 901}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    prong.SetSourceBit(0, MCProng::kPhysicalPrimary, false);                      // set source to be ALICE primary particles
-    signal = new MCSignal(name, "Electrons from LF meson decays", {prong}, {-1}); // pi0,eta,eta',rho,omega,phi mesons
+    prong.SetSourceBit(0, MCProng::kPhysicalPrimary, false);                                // set source to be ALICE primary particles
+    MCSignal* signal = new MCSignal(name, "Electrons from LF meson decays", {prong}, {-1}); // pi0,eta,eta',rho,omega,phi mesons
     return signal;
-  }
-  if (!nameStr.compare("eFromLMeeLFQ")) {
+  });
+  factories.emplace("eFromLMeeLFQ", [](const char* name) {
     MCProng prong(2, {11, 900}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    prong.SetSignalInTime(false);                                                             // set direction to check generation in time (true) or back in time (false)
-    signal = new MCSignal(name, "Electrons from LF meson + quarkonia decays", {prong}, {-1}); // pi0,eta,eta',rho,omega,phi,jpsi,psi2s mesons
+    prong.SetSignalInTime(false);                                                                       // set direction to check generation in time (true) or back in time (false)
+    MCSignal* signal = new MCSignal(name, "Electrons from LF meson + quarkonia decays", {prong}, {-1}); // pi0,eta,eta',rho,omega,phi,jpsi,psi2s mesons
     return signal;
-  }
-  if (!nameStr.compare("ePrimaryFromLMeeLFQ")) {
+  });
+  factories.emplace("ePrimaryFromLMeeLFQ", [](const char* name) {
     MCProng prong(2, {11, 900}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    prong.SetSourceBit(0, MCProng::kPhysicalPrimary, false);                                  // set source to be ALICE primary particles
-    prong.SetSignalInTime(false);                                                             // set direction to check generation in time (true) or back in time (false)
-    signal = new MCSignal(name, "Electrons from LF meson + quarkonia decays", {prong}, {-1}); // pi0,eta,eta',rho,omega,phi,jpsi,psi2s mesons
+    prong.SetSourceBit(0, MCProng::kPhysicalPrimary, false);                                            // set source to be ALICE primary particles
+    prong.SetSignalInTime(false);                                                                       // set direction to check generation in time (true) or back in time (false)
+    MCSignal* signal = new MCSignal(name, "Electrons from LF meson + quarkonia decays", {prong}, {-1}); // pi0,eta,eta',rho,omega,phi,jpsi,psi2s mesons
     return signal;
-  }
-  if (!nameStr.compare("eFromHc")) {
+  });
+  factories.emplace("eFromHc", [](const char* name) {
     MCProng prong(2, {11, 402}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Electrons from open charmed hadron decays", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Electrons from open charmed hadron decays", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("eFromAnyHc")) {
+  });
+  factories.emplace("eFromAnyHc", [](const char* name) {
     MCProng prong(1, {11}, {true}, {false}, {0}, {0}, {false}, false, {402}, {false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary, false);
-    signal = new MCSignal(name, "Electrons from any open charm hadron decays", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Electrons from any open charm hadron decays", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("eFromD0")) {
+  });
+  factories.emplace("eFromD0", [](const char* name) {
     MCProng prong(2, {11, Pdg::kD0}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Electrons from D0 decays", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Electrons from D0 decays", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("eFromChargedD")) {
+  });
+  factories.emplace("eFromChargedD", [](const char* name) {
     MCProng prong(2, {11, Pdg::kDPlus}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Electrons from D+/- decays", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Electrons from D+/- decays", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("eFromDs")) {
+  });
+  factories.emplace("eFromDs", [](const char* name) {
     MCProng prong(2, {11, Pdg::kDS}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Electrons from Ds +/- decays", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Electrons from Ds +/- decays", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("eFromLambdaC")) {
+  });
+  factories.emplace("eFromLambdaC", [](const char* name) {
     MCProng prong(2, {11, Pdg::kLambdaCPlus}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Electrons from Lambda_c decays", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Electrons from Lambda_c decays", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("eFromXiC0")) {
+  });
+  factories.emplace("eFromXiC0", [](const char* name) {
     MCProng prong(2, {11, Pdg::kXiC0}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Electrons from Xi_c_0 decays", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Electrons from Xi_c_0 decays", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("eFromXiCPlus")) {
+  });
+  factories.emplace("eFromXiCPlus", [](const char* name) {
     MCProng prong(2, {11, Pdg::kXiCPlus}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Electrons from Xi_c_+ decays", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Electrons from Xi_c_+ decays", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("eFromXiCPlusPlus")) {
+  });
+  factories.emplace("eFromXiCPlusPlus", [](const char* name) {
     MCProng prong(2, {11, Pdg::kXiCCPlusPlus}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Electrons from Xi_c_++ decays", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Electrons from Xi_c_++ decays", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("eFromHb")) {
+  });
+  factories.emplace("eFromHb", [](const char* name) {
     MCProng prong(2, {11, 502}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Electrons from open beauty hadron decays", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Electrons from open beauty hadron decays", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("eFromAnyHb")) {
+  });
+  factories.emplace("eFromAnyHb", [](const char* name) {
     MCProng prong(1, {11}, {true}, {false}, {0}, {0}, {false}, false, {502}, {false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary, false);
-    signal = new MCSignal(name, "Electrons from any open beauty hadron decays", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Electrons from any open beauty hadron decays", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("eFromHbc")) {
+  });
+  factories.emplace("eFromHbc", [](const char* name) {
     MCProng prong(2, {11, 902}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Electrons from open charm or beauty hadron decays", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Electrons from open charm or beauty hadron decays", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("eFromMc")) {
+  });
+  factories.emplace("eFromMc", [](const char* name) {
     MCProng prong(2, {11, 401}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Electrons from open charmed meson decays", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Electrons from open charmed meson decays", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("eFromMb")) {
+  });
+  factories.emplace("eFromMb", [](const char* name) {
     MCProng prong(2, {11, 501}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Electrons from open beauty meson decays", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Electrons from open beauty meson decays", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("eFromBc")) {
+  });
+  factories.emplace("eFromBc", [](const char* name) {
     MCProng prong(2, {11, 4001}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Electrons from open charmed baryon decays", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Electrons from open charmed baryon decays", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("eFromBb")) {
+  });
+  factories.emplace("eFromBb", [](const char* name) {
     MCProng prong(2, {11, 5001}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Electrons from open beauty baryon decays", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Electrons from open beauty baryon decays", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("eFromPromptHc")) {
+  });
+  factories.emplace("eFromPromptHc", [](const char* name) {
     MCProng prong(2, {11, 402}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Electrons from open charmed hadron decays without beauty in decay history", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Electrons from open charmed hadron decays without beauty in decay history", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("eFromHbtoHc")) {
+  });
+  factories.emplace("eFromHbtoHc", [](const char* name) {
     MCProng prong(2, {11, 402}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Electrons from open charmed hadron decays with b hadron in decay history", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Electrons from open charmed hadron decays with b hadron in decay history", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("eFromPromptLM")) {
+  });
+  factories.emplace("eFromPromptLM", [](const char* name) {
     MCProng prong(2, {11, 101}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502, 402}, {true, true});
-    signal = new MCSignal(name, "Electrons from light mesons without B/D in decay history", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Electrons from light mesons without B/D in decay history", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("eFromHbtoLM")) {
+  });
+  factories.emplace("eFromHbtoLM", [](const char* name) {
     MCProng prong(2, {11, 101}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {false});
-    signal = new MCSignal(name, "Electrons from light mesons with B hadron in decay history", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Electrons from light mesons with B hadron in decay history", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("eFromHctoLM")) {
+  });
+  factories.emplace("eFromHctoLM", [](const char* name) {
     MCProng prong(2, {11, 101, 402}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false}, false, {502}, {true});
-    signal = new MCSignal(name, "Electrons from light mesons from D hadron decays and no B in decay history", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Electrons from light mesons from D hadron decays and no B in decay history", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("eFromUpsilon1S")) {
+  });
+  factories.emplace("eFromUpsilon1S", [](const char* name) {
     MCProng prong(2, {11, 553}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Electrons from Upsilon1S decays", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Electrons from Upsilon1S decays", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("eFromUpsilon2S")) {
+  });
+  factories.emplace("eFromUpsilon2S", [](const char* name) {
     MCProng prong(2, {11, 100553}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Electrons from Upsilon2S decays", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Electrons from Upsilon2S decays", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("eFromUpsilon3S")) {
+  });
+  factories.emplace("eFromUpsilon3S", [](const char* name) {
     MCProng prong(2, {11, 200553}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Electrons from Upsilon3S decays", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Electrons from Upsilon3S decays", {prong}, {-1});
     return signal;
-  }
+  });
 
   // muon signals with mother X: mu from mother X
-  if (!nameStr.compare("muFromJpsi")) {
+  factories.emplace("muFromJpsi", [](const char* name) {
     MCProng prong(2, {13, 443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "muons from jpsi decays", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "muons from jpsi decays", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("muFromPsi2S")) {
+  });
+  factories.emplace("muFromPsi2S", [](const char* name) {
     MCProng prong(2, {13, 100443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "muons from psi2s decays", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "muons from psi2s decays", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("muFromHb")) {
+  });
+  factories.emplace("muFromHb", [](const char* name) {
     MCProng prong(2, {13, 502}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "muons from b->mu", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "muons from b->mu", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("muFromPromptHc")) {
+  });
+  factories.emplace("muFromPromptHc", [](const char* name) {
     MCProng prong(2, {13, 402}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
-    signal = new MCSignal(name, "muons from c->mu, without beauty in decay history", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "muons from c->mu, without beauty in decay history", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("muFromHbtoHc")) {
+  });
+  factories.emplace("muFromHbtoHc", [](const char* name) {
     MCProng prong(3, {13, 402, 502}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
-    signal = new MCSignal(name, "muons from b->c->mu", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "muons from b->c->mu", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("secondaryMuon")) {
+  });
+  factories.emplace("secondaryMuon", [](const char* name) {
     MCProng prong(1, {13}, {true}, {false}, {0}, {0}, {false});
     prong.SetSourceBit(0, MCProng::kProducedInTransport);
-    signal = new MCSignal(name, "muons produced during transport in detector", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "muons produced during transport in detector", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("muFromPromptLM")) {
+  });
+  factories.emplace("muFromPromptLM", [](const char* name) {
     MCProng prong(2, {13, 101}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502, 402}, {true, true});
-    signal = new MCSignal(name, "muons from light mesons without B/D in decay history", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "muons from light mesons without B/D in decay history", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("muFromHbtoLM")) {
+  });
+  factories.emplace("muFromHbtoLM", [](const char* name) {
     MCProng prong(2, {13, 101}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {false});
-    signal = new MCSignal(name, "muons from light mesons with B hadron in decay history", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "muons from light mesons with B hadron in decay history", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("muFromHctoLM")) {
+  });
+  factories.emplace("muFromHctoLM", [](const char* name) {
     MCProng prong(2, {13, 101, 402}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false}, false, {502}, {true});
-    signal = new MCSignal(name, "muons from light mesons from D hadron decays and no B in decay history", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "muons from light mesons from D hadron decays and no B in decay history", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("muFromUpsilon1S")) {
+  });
+  factories.emplace("muFromUpsilon1S", [](const char* name) {
     MCProng prong(2, {13, 553}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "muons from Upsilon1S decays", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "muons from Upsilon1S decays", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("muFromUpsilon2S")) {
+  });
+  factories.emplace("muFromUpsilon2S", [](const char* name) {
     MCProng prong(2, {13, 100553}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "muons from Upsilon2S decays", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "muons from Upsilon2S decays", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("muFromUpsilon3S")) {
+  });
+  factories.emplace("muFromUpsilon3S", [](const char* name) {
     MCProng prong(2, {13, 200553}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "muons from Upsilon3S decays", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "muons from Upsilon3S decays", {prong}, {-1});
     return signal;
-  }
+  });
 
   // Decay signal: Mother to electron: X -> e
-  if (!nameStr.compare("AnythingToE")) {
+  factories.emplace("AnythingToE", [](const char* name) {
     MCProng prong(2, {MCProng::kPDGCodeNotAssigned, 11}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     // prong.SetSourceBit(0, MCProng::kPhysicalPrimary, false);  // set source to be ALICE primary particles
-    prong.SetSignalInTime(true);                                            // set direction to check for daughters (true, in time) or for mothers (false, back in time)
-    signal = new MCSignal(name, "Decay of anything into e", {prong}, {-1}); // pi0,eta,eta',rho,omega,phi,jpsi,psi2s mesons
+    prong.SetSignalInTime(true);                                                      // set direction to check for daughters (true, in time) or for mothers (false, back in time)
+    MCSignal* signal = new MCSignal(name, "Decay of anything into e", {prong}, {-1}); // pi0,eta,eta',rho,omega,phi,jpsi,psi2s mesons
     return signal;
-  }
-  if (!nameStr.compare("LFQdecayToE")) {
+  });
+  factories.emplace("LFQdecayToE", [](const char* name) {
     MCProng prong(2, {900, 11}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     // prong.SetSourceBit(0, MCProng::kPhysicalPrimary, false);  // set source to be ALICE primary particles
-    prong.SetSignalInTime(true);                                                       // set direction to check for daughters (true, in time) or for mothers (false, back in time)
-    signal = new MCSignal(name, "LF meson  + quarkonia decays into e", {prong}, {-1}); // pi0,eta,eta',rho,omega,phi,jpsi,psi2s mesons
+    prong.SetSignalInTime(true);                                                                 // set direction to check for daughters (true, in time) or for mothers (false, back in time)
+    MCSignal* signal = new MCSignal(name, "LF meson  + quarkonia decays into e", {prong}, {-1}); // pi0,eta,eta',rho,omega,phi,jpsi,psi2s mesons
     return signal;
-  }
-  if (!nameStr.compare("HcToE")) {
+  });
+  factories.emplace("HcToE", [](const char* name) {
     MCProng prong(2, {402, 11}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSignalInTime(true); // set direction to check for daughters (true, in time) or for mothers (false, back in time)
-    signal = new MCSignal(name, "Open charmed hadron decays into e", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Open charmed hadron decays into e", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("HbToE")) {
+  });
+  factories.emplace("HbToE", [](const char* name) {
     MCProng prong(2, {502, 11}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSignalInTime(true); // set direction to check for daughters (true, in time) or for mothers (false, back in time)
-    signal = new MCSignal(name, "Open beauty hadron decays into e", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Open beauty hadron decays into e", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("McToE")) {
+  });
+  factories.emplace("McToE", [](const char* name) {
     MCProng prong(2, {401, 11}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSignalInTime(true); // set direction to check for daughters (true, in time) or for mothers (false, back in time)
-    signal = new MCSignal(name, "Open charmed meson decays into e", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Open charmed meson decays into e", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("MbToE")) {
+  });
+  factories.emplace("MbToE", [](const char* name) {
     MCProng prong(2, {501, 11}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSignalInTime(true); // set direction to check for daughters (true, in time) or for mothers (false, back in time)
-    signal = new MCSignal(name, "Open beauty meson decays into e", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Open beauty meson decays into e", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("BcToE")) {
+  });
+  factories.emplace("BcToE", [](const char* name) {
     MCProng prong(2, {4001, 11}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSignalInTime(true); // set direction to check for daughters (true, in time) or for mothers (false, back in time)
-    signal = new MCSignal(name, "Open charmed baryon decays into e", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Open charmed baryon decays into e", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("BbToE")) {
+  });
+  factories.emplace("BbToE", [](const char* name) {
     MCProng prong(2, {5001, 11}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSignalInTime(true); // set direction to check for daughters (true, in time) or for mothers (false, back in time)
-    signal = new MCSignal(name, "Open beauty baryon decay into e", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Open beauty baryon decay into e", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("PromptHcToE")) {
+  });
+  factories.emplace("PromptHcToE", [](const char* name) {
     MCProng prong(3, {502, 402, 11}, {true, true, true}, {true, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     prong.SetSignalInTime(true); // set direction to check for daughters (true, in time) or for mothers (false, back in time)
-    signal = new MCSignal(name, "Open charmed hadron decays into e", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Open charmed hadron decays into e", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("NonPromptHcToE")) {
+  });
+  factories.emplace("NonPromptHcToE", [](const char* name) {
     MCProng prong(3, {502, 402, 11}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     prong.SetSignalInTime(true); // set direction to check for daughters (true, in time) or for mothers (false, back in time)
-    signal = new MCSignal(name, "b hadron decays to open charmed hadron decays to e", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "b hadron decays to open charmed hadron decays to e", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("HFdecayToE")) {
+  });
+  factories.emplace("HFdecayToE", [](const char* name) {
     MCProng prong(2, {902, 11}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     // prong.SetSourceBit(0, MCProng::kPhysicalPrimary, false);  // set source to be ALICE primary particles
     prong.SetSignalInTime(true); // set direction to check for daughters (true, in time) or for mothers (false, back in time)
-    signal = new MCSignal(name, "Open charm and beauty to electrons", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Open charm and beauty to electrons", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("AnyHFdecayToE")) {
+  });
+  factories.emplace("AnyHFdecayToE", [](const char* name) {
     MCProng prong(1, {902}, {true}, {false}, {0}, {0}, {false}, true, {11}, {false});
     // prong.SetSourceBit(0, MCProng::kPhysicalPrimary, false);  // set source to be ALICE primary particles
     prong.SetSignalInTime(true); // set direction to check for daughters (true, in time) or for mothers (false, back in time)
-    signal = new MCSignal(name, "Open charm and beauty to electrons", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Open charm and beauty to electrons", {prong}, {-1});
     return signal;
-  }
+  });
   //   if (!nameStr.compare("LFQtoPC")) {
   //   MCProng prong(3, {900, 22, 11}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
   //   prong.SetSignalInTime(true);  // set direction to check for daughters (true, in time) or for mothers (false, back in time)
@@ -852,1153 +920,1152 @@ MCSignal* o2::aod::dqmcsignals::GetMCSignal(const char* name)
 
   //_________________________________________________________________________________________________________________________
   // LMEE pair signals for LF, same mother
-  if (!nameStr.compare("eeFromAnything")) {
+  factories.emplace("eeFromAnything", [](const char* name) {
     MCProng prong(2, {11, MCProng::kPDGCodeNotAssigned}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from any decay", {prong, prong}, {1, 1}); // signal at pair level
+    MCSignal* signal = new MCSignal(name, "ee pairs from any decay", {prong, prong}, {1, 1}); // signal at pair level
     return signal;
-  }
-  if (!nameStr.compare("eeFromPi0")) {
+  });
+  factories.emplace("eeFromPi0", [](const char* name) {
     MCProng prong(2, {11, 111}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from pi0 decays", {prong, prong}, {1, 1}); // signal at pair level
+    MCSignal* signal = new MCSignal(name, "ee pairs from pi0 decays", {prong, prong}, {1, 1}); // signal at pair level
     return signal;
-  }
-  if (!nameStr.compare("eePrimaryFromPromptPi0")) {
+  });
+  factories.emplace("eePrimaryFromPromptPi0", [](const char* name) {
     MCProng prong(2, {11, 111}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502, 402}, {true, true});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from prompt pi0 decays", {prong, prong}, {1, 1}); // signal at pair level
+    MCSignal* signal = new MCSignal(name, "ee pairs from prompt pi0 decays", {prong, prong}, {1, 1}); // signal at pair level
     return signal;
-  }
-  if (!nameStr.compare("eeFromEta")) {
+  });
+  factories.emplace("eeFromEta", [](const char* name) {
     MCProng prong(2, {11, 221}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from eta decays", {prong, prong}, {1, 1}); // signal at pair level
+    MCSignal* signal = new MCSignal(name, "ee pairs from eta decays", {prong, prong}, {1, 1}); // signal at pair level
     return signal;
-  }
-  if (!nameStr.compare("eeFromEtaprime")) {
+  });
+  factories.emplace("eeFromEtaprime", [](const char* name) {
     MCProng prong(2, {11, 331}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from eta' decays", {prong, prong}, {1, 1}); // signal at pair level
+    MCSignal* signal = new MCSignal(name, "ee pairs from eta' decays", {prong, prong}, {1, 1}); // signal at pair level
     return signal;
-  }
-  if (!nameStr.compare("eeFromRho")) {
+  });
+  factories.emplace("eeFromRho", [](const char* name) {
     MCProng prong(2, {11, 113}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from rho decays", {prong, prong}, {1, 1}); // signal at pair level
+    MCSignal* signal = new MCSignal(name, "ee pairs from rho decays", {prong, prong}, {1, 1}); // signal at pair level
     return signal;
-  }
-  if (!nameStr.compare("eeFromOmega")) {
+  });
+  factories.emplace("eeFromOmega", [](const char* name) {
     MCProng prong(2, {11, 223}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from omega decays", {prong, prong}, {1, 1}); // signal at pair level
+    MCSignal* signal = new MCSignal(name, "ee pairs from omega decays", {prong, prong}, {1, 1}); // signal at pair level
     return signal;
-  }
-  if (!nameStr.compare("eeFromPhi")) {
+  });
+  factories.emplace("eeFromPhi", [](const char* name) {
     MCProng prong(2, {11, 333}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from phi decays", {prong, prong}, {1, 1}); // signal at pair level
+    MCSignal* signal = new MCSignal(name, "ee pairs from phi decays", {prong, prong}, {1, 1}); // signal at pair level
     return signal;
-  }
-  if (!nameStr.compare("eeFromJpsi")) {
+  });
+  factories.emplace("eeFromJpsi", [](const char* name) {
     MCProng prong(2, {11, 443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from j/psi decays", {prong, prong}, {1, 1}); // signal at pair level
+    MCSignal* signal = new MCSignal(name, "ee pairs from j/psi decays", {prong, prong}, {1, 1}); // signal at pair level
     return signal;
-  }
-  if (!nameStr.compare("eeFromJpsiExclusive")) {
+  });
+  factories.emplace("eeFromJpsiExclusive", [](const char* name) {
     MCProng prong(2, {11, 443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from j/psi decays", {prong, prong}, {1, 1}); // signal at pair level
+    MCSignal* signal = new MCSignal(name, "ee pairs from j/psi decays", {prong, prong}, {1, 1}); // signal at pair level
     signal->SetDecayChannelIsExclusive(2, true);
     return signal;
-  }
-  if (!nameStr.compare("eeFromJpsiNotExclusive")) {
+  });
+  factories.emplace("eeFromJpsiNotExclusive", [](const char* name) {
     MCProng prong(2, {11, 443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from j/psi decays", {prong, prong}, {1, 1}); // signal at pair level
+    MCSignal* signal = new MCSignal(name, "ee pairs from j/psi decays", {prong, prong}, {1, 1}); // signal at pair level
     signal->SetDecayChannelIsNotExclusive(2, true);
     return signal;
-  }
-  if (!nameStr.compare("eePrimaryFromPromptJPsi")) {
+  });
+  factories.emplace("eePrimaryFromPromptJPsi", [](const char* name) {
     MCProng prong(2, {11, 443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {503}, {true});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from prompt j/psi decays", {prong, prong}, {1, 1}); // signal at pair level
+    MCSignal* signal = new MCSignal(name, "ee pairs from prompt j/psi decays", {prong, prong}, {1, 1}); // signal at pair level
     return signal;
-  }
-  if (!nameStr.compare("eePrimaryFromNonPromptJPsi")) {
+  });
+  factories.emplace("eePrimaryFromNonPromptJPsi", [](const char* name) {
     MCProng prong(2, {11, 443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {503}, {false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from non-prompt j/psi decays", {prong, prong}, {1, 1}); // signal at pair level
+    MCSignal* signal = new MCSignal(name, "ee pairs from non-prompt j/psi decays", {prong, prong}, {1, 1}); // signal at pair level
     return signal;
-  }
-  if (!nameStr.compare("mumuFromPhi")) {
+  });
+  factories.emplace("mumuFromPhi", [](const char* name) {
     MCProng prong(2, {13, 333}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "mumu pairs from phi decays", {prong, prong}, {1, 1}); // signal at pair level
+    MCSignal* signal = new MCSignal(name, "mumu pairs from phi decays", {prong, prong}, {1, 1}); // signal at pair level
     return signal;
-  }
-  if (!nameStr.compare("mumuFromJpsi")) {
+  });
+  factories.emplace("mumuFromJpsi", [](const char* name) {
     MCProng prong(2, {13, 443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "mumu pairs from j/psi decays", {prong, prong}, {1, 1}); // signal at pair level
+    MCSignal* signal = new MCSignal(name, "mumu pairs from j/psi decays", {prong, prong}, {1, 1}); // signal at pair level
     return signal;
-  }
-  if (!nameStr.compare("mumuFromPromptJpsi")) {
+  });
+  factories.emplace("mumuFromPromptJpsi", [](const char* name) {
     MCProng prong(2, {13, 443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {503}, {true});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "mumu pairs from prompt j/psi decays", {prong, prong}, {1, 1}); // signal at pair level
+    MCSignal* signal = new MCSignal(name, "mumu pairs from prompt j/psi decays", {prong, prong}, {1, 1}); // signal at pair level
     return signal;
-  }
-  if (!nameStr.compare("mumuFromNonPromptJpsi")) {
+  });
+  factories.emplace("mumuFromNonPromptJpsi", [](const char* name) {
     MCProng prong(2, {13, 443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {503}, {false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "mumu pairs from non-prompt j/psi decays", {prong, prong}, {1, 1}); // signal at pair level
+    MCSignal* signal = new MCSignal(name, "mumu pairs from non-prompt j/psi decays", {prong, prong}, {1, 1}); // signal at pair level
     return signal;
-  }
-  if (!nameStr.compare("eeFromPsi2S")) {
+  });
+  factories.emplace("eeFromPsi2S", [](const char* name) {
     MCProng prong(2, {11, 100443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from psi2s decays", {prong, prong}, {1, 1}); // signal at pair level
+    MCSignal* signal = new MCSignal(name, "ee pairs from psi2s decays", {prong, prong}, {1, 1}); // signal at pair level
     return signal;
-  }
-  if (!nameStr.compare("mumuFromPsi2S")) {
+  });
+  factories.emplace("mumuFromPsi2S", [](const char* name) {
     MCProng prong(2, {13, 100443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "mumu pairs from psi2s decays", {prong, prong}, {1, 1}); // signal at pair level
+    MCSignal* signal = new MCSignal(name, "mumu pairs from psi2s decays", {prong, prong}, {1, 1}); // signal at pair level
     return signal;
-  }
-  if (!nameStr.compare("mumuFromPromptPsi2S")) {
+  });
+  factories.emplace("mumuFromPromptPsi2S", [](const char* name) {
     MCProng prong(2, {13, 100443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {503}, {true});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "mumu pairs from prompt psi2s decays", {prong, prong}, {1, 1}); // signal at pair level
+    MCSignal* signal = new MCSignal(name, "mumu pairs from prompt psi2s decays", {prong, prong}, {1, 1}); // signal at pair level
     return signal;
-  }
-  if (!nameStr.compare("mumuFromNonPromptPsi2S")) {
+  });
+  factories.emplace("mumuFromNonPromptPsi2S", [](const char* name) {
     MCProng prong(2, {13, 100443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {503}, {false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "mumu pairs from non-prompt psi2s decays", {prong, prong}, {1, 1}); // signal at pair level
+    MCSignal* signal = new MCSignal(name, "mumu pairs from non-prompt psi2s decays", {prong, prong}, {1, 1}); // signal at pair level
     return signal;
-  }
-  if (!nameStr.compare("mumuFromUpsilon1S")) {
+  });
+  factories.emplace("mumuFromUpsilon1S", [](const char* name) {
     MCProng prong(2, {13, 553}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "mumu pairs from upsilon1s decays", {prong, prong}, {1, 1}); // signal at pair level
+    MCSignal* signal = new MCSignal(name, "mumu pairs from upsilon1s decays", {prong, prong}, {1, 1}); // signal at pair level
     return signal;
-  }
-  if (!nameStr.compare("mumuFromUpsilon2S")) {
+  });
+  factories.emplace("mumuFromUpsilon2S", [](const char* name) {
     MCProng prong(2, {13, 100553}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "mumu pairs from upsilon2s decays", {prong, prong}, {1, 1}); // signal at pair level
+    MCSignal* signal = new MCSignal(name, "mumu pairs from upsilon2s decays", {prong, prong}, {1, 1}); // signal at pair level
     return signal;
-  }
-  if (!nameStr.compare("mumuFromUpsilon3S")) {
+  });
+  factories.emplace("mumuFromUpsilon3S", [](const char* name) {
     MCProng prong(2, {13, 200553}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "mumu pairs from upsilon3s decays", {prong, prong}, {1, 1}); // signal at pair level
+    MCSignal* signal = new MCSignal(name, "mumu pairs from upsilon3s decays", {prong, prong}, {1, 1}); // signal at pair level
     return signal;
-  }
-  if (!nameStr.compare("eeFromLMeeLFQ")) {
+  });
+  factories.emplace("eeFromLMeeLFQ", [](const char* name) {
     MCProng prong(2, {11, 900}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from light flavor meson + quarkonia decays", {prong, prong}, {1, 1}); // signal at pair level
+    MCSignal* signal = new MCSignal(name, "ee pairs from light flavor meson + quarkonia decays", {prong, prong}, {1, 1}); // signal at pair level
     return signal;
-  }
-  if (!nameStr.compare("eeFromLMeeLF")) {
+  });
+  factories.emplace("eeFromLMeeLF", [](const char* name) {
     MCProng prong(2, {11, 901}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from light flavor meson decays", {prong, prong}, {1, 1}); // signal at pair level
+    MCSignal* signal = new MCSignal(name, "ee pairs from light flavor meson decays", {prong, prong}, {1, 1}); // signal at pair level
     return signal;
-  }
-  if (!nameStr.compare("eeFromLMeeNoHFLFQ")) {
+  });
+  factories.emplace("eeFromLMeeNoHFLFQ", [](const char* name) {
     MCProng prong(2, {11, 900}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502, 402}, {true, true});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from light flavor meson + quarkonia decays not from open-HF decays", {prong, prong}, {1, 1}); // signal at pair level
+    MCSignal* signal = new MCSignal(name, "ee pairs from light flavor meson + quarkonia decays not from open-HF decays", {prong, prong}, {1, 1}); // signal at pair level
     return signal;
-  }
-  if (!nameStr.compare("eeFromLMeeNoHFLF")) {
+  });
+  factories.emplace("eeFromLMeeNoHFLF", [](const char* name) {
     MCProng prong(2, {11, 901}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502, 402}, {true, true});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from light flavor meson decays not from open-HF decays", {prong, prong}, {1, 1}); // signal at pair level
+    MCSignal* signal = new MCSignal(name, "ee pairs from light flavor meson decays not from open-HF decays", {prong, prong}, {1, 1}); // signal at pair level
     return signal;
-  }
+  });
 
   // LMEE pair signals for HF
   // D0->e and D0->e
-  if (!nameStr.compare("eeFromD0")) {
+  factories.emplace("eeFromD0", [](const char* name) {
     MCProng prong(2, {kElectron, Pdg::kD0}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from D0 decays, no beauty in history", {prong, prong}, {-1, -1});
+    MCSignal* signal = new MCSignal(name, "ee pairs from D0 decays, no beauty in history", {prong, prong}, {-1, -1});
     return signal;
-  }
+  });
 
   // D0->e and D0->e
-  if (!nameStr.compare("eeFromPi0FromD0")) {
+  factories.emplace("eeFromPi0FromD0", [](const char* name) {
     MCProng prong(2, {kElectron, kPi0, Pdg::kD0}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false}, false, {502}, {true});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from D0 to Pi0 decays, no beauty in history", {prong, prong}, {1, 1});
+    MCSignal* signal = new MCSignal(name, "ee pairs from D0 to Pi0 decays, no beauty in history", {prong, prong}, {1, 1});
     return signal;
-  }
+  });
 
   // D+/- -> e and D+/- -> e
-  if (!nameStr.compare("eeFromChargedD")) {
+  factories.emplace("eeFromChargedD", [](const char* name) {
     MCProng prong(2, {kElectron, Pdg::kDPlus}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from D+/- decays, no beauty in history", {prong, prong}, {-1, -1});
+    MCSignal* signal = new MCSignal(name, "ee pairs from D+/- decays, no beauty in history", {prong, prong}, {-1, -1});
     return signal;
-  }
+  });
 
   // D0 -> e and D+/- -> e
-  if (!nameStr.compare("eeFromD0andChargedD")) {
+  factories.emplace("eeFromD0andChargedD", [](const char* name) {
     MCProng prongD0(2, {kElectron, Pdg::kD0}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     MCProng prongDch(2, {kElectron, Pdg::kDPlus}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     prongD0.SetSourceBit(0, MCProng::kPhysicalPrimary);
     prongDch.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "one e from D0 and one e from D+/- decays, no beauty in history", {prongD0, prongDch}, {-1, -1});
+    MCSignal* signal = new MCSignal(name, "one e from D0 and one e from D+/- decays, no beauty in history", {prongD0, prongDch}, {-1, -1});
     return signal;
-  }
+  });
 
   // D+/- -> e and D0 -> e
-  if (!nameStr.compare("eeFromD0andChargedDBis")) {
+  factories.emplace("eeFromD0andChargedDBis", [](const char* name) {
     MCProng prongD0(2, {kElectron, Pdg::kD0}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     MCProng prongDch(2, {kElectron, Pdg::kDPlus}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     prongD0.SetSourceBit(0, MCProng::kPhysicalPrimary);
     prongDch.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "one e from D+/- and one e from D0 decays, no beauty in history (inverse signal)", {prongDch, prongD0}, {-1, -1});
+    MCSignal* signal = new MCSignal(name, "one e from D+/- and one e from D0 decays, no beauty in history (inverse signal)", {prongDch, prongD0}, {-1, -1});
     return signal;
-  }
+  });
 
   // D_s->e and D_s->e
-  if (!nameStr.compare("eeFromDs")) {
+  factories.emplace("eeFromDs", [](const char* name) {
     MCProng prong(2, {kElectron, Pdg::kDS}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from Ds +/- decays, no beauty in history", {prong, prong}, {-1, -1});
+    MCSignal* signal = new MCSignal(name, "ee pairs from Ds +/- decays, no beauty in history", {prong, prong}, {-1, -1});
     return signal;
-  }
+  });
 
   // Lambda_c->e and Lambda_c->e
-  if (!nameStr.compare("eeFromLambdaC")) {
+  factories.emplace("eeFromLambdaC", [](const char* name) {
     MCProng prong(2, {kElectron, Pdg::kLambdaCPlus}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from Lambda_c, no beauty in history", {prong, prong}, {-1, -1});
+    MCSignal* signal = new MCSignal(name, "ee pairs from Lambda_c, no beauty in history", {prong, prong}, {-1, -1});
     return signal;
-  }
+  });
 
   // Lambda_c->e and D0->e
-  if (!nameStr.compare("eeFromLambdaCandD0")) {
+  factories.emplace("eeFromLambdaCandD0", [](const char* name) {
     MCProng prongLc(2, {kElectron, Pdg::kLambdaCPlus}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     MCProng prongD0(2, {kElectron, Pdg::kD0}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     prongLc.SetSourceBit(0, MCProng::kPhysicalPrimary);
     prongD0.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "one e from Lambda_c and one e from D0 decays, no beauty in history", {prongLc, prongD0}, {-1, -1});
+    MCSignal* signal = new MCSignal(name, "one e from Lambda_c and one e from D0 decays, no beauty in history", {prongLc, prongD0}, {-1, -1});
     return signal;
-  }
+  });
 
   // D0->e and Lambda_c->e
-  if (!nameStr.compare("eeFromLambdaCandD0Bis")) {
+  factories.emplace("eeFromLambdaCandD0Bis", [](const char* name) {
     MCProng prongLc(2, {kElectron, Pdg::kLambdaCPlus}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     MCProng prongD0(2, {kElectron, Pdg::kD0}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     prongLc.SetSourceBit(0, MCProng::kPhysicalPrimary);
     prongD0.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "one e from Lambda_c and one e from D0 decays, no beauty in history (inverse signal)", {prongD0, prongLc}, {-1, -1});
+    MCSignal* signal = new MCSignal(name, "one e from Lambda_c and one e from D0 decays, no beauty in history (inverse signal)", {prongD0, prongLc}, {-1, -1});
     return signal;
-  }
+  });
 
   // Lambda_c->e and D+/- -> e
-  if (!nameStr.compare("eeFromLambdaCandChargedD")) {
+  factories.emplace("eeFromLambdaCandChargedD", [](const char* name) {
     MCProng prongLc(2, {kElectron, Pdg::kLambdaCPlus}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     MCProng prongDch(2, {kElectron, Pdg::kDPlus}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     prongLc.SetSourceBit(0, MCProng::kPhysicalPrimary);
     prongDch.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "one e from Lambda_c and one e from D+/- decays, no beauty in history", {prongLc, prongDch}, {-1, -1});
+    MCSignal* signal = new MCSignal(name, "one e from Lambda_c and one e from D+/- decays, no beauty in history", {prongLc, prongDch}, {-1, -1});
     return signal;
-  }
+  });
 
   // D+/- -> e and Lambda_c->e
-  if (!nameStr.compare("eeFromLambdaCandChargedDBis")) {
+  factories.emplace("eeFromLambdaCandChargedDBis", [](const char* name) {
     MCProng prongLc(2, {kElectron, Pdg::kLambdaCPlus}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     MCProng prongDch(2, {kElectron, Pdg::kDPlus}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     prongLc.SetSourceBit(0, MCProng::kPhysicalPrimary);
     prongDch.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "one e from Lambda_c and one e from D+/- decays, no beauty in history (inverse signal)", {prongDch, prongLc}, {-1, -1});
+    MCSignal* signal = new MCSignal(name, "one e from Lambda_c and one e from D+/- decays, no beauty in history (inverse signal)", {prongDch, prongLc}, {-1, -1});
     return signal;
-  }
+  });
 
   // Xic0 ->e and Xic0 ->e
-  if (!nameStr.compare("eeFromXiC0")) {
+  factories.emplace("eeFromXiC0", [](const char* name) {
     MCProng prong(2, {kElectron, Pdg::kXiC0}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from Xi_c0, no beauty in history", {prong, prong}, {-1, -1});
+    MCSignal* signal = new MCSignal(name, "ee pairs from Xi_c0, no beauty in history", {prong, prong}, {-1, -1});
     return signal;
-  }
+  });
 
   // Xi_c+ ->e and Xi_c+ ->e
-  if (!nameStr.compare("eeFromXiCPlus")) {
+  factories.emplace("eeFromXiCPlus", [](const char* name) {
     MCProng prong(2, {kElectron, Pdg::kXiCPlus}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from Xi_c+, no beauty in history", {prong, prong}, {-1, -1});
+    MCSignal* signal = new MCSignal(name, "ee pairs from Xi_c+, no beauty in history", {prong, prong}, {-1, -1});
     return signal;
-  }
+  });
 
   // Xi_c0 ->e and Xi_c+ ->e
-  if (!nameStr.compare("eeFromXiC0andXiCPlus")) {
+  factories.emplace("eeFromXiC0andXiCPlus", [](const char* name) {
     MCProng prongXiCPlus(2, {kElectron, Pdg::kXiCPlus}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     MCProng prongXiC0(2, {kElectron, Pdg::kXiC0}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     prongXiCPlus.SetSourceBit(0, MCProng::kPhysicalPrimary);
     prongXiC0.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "one e from Xi_c+ and one e from Xi_c0 decays, no beauty in history", {prongXiCPlus, prongXiC0}, {-1, -1});
+    MCSignal* signal = new MCSignal(name, "one e from Xi_c+ and one e from Xi_c0 decays, no beauty in history", {prongXiCPlus, prongXiC0}, {-1, -1});
     return signal;
-  }
+  });
 
   // Xi_c+ ->e and Xi_c0 ->e
-  if (!nameStr.compare("eeFromXiC0andXiCPlusBis")) {
+  factories.emplace("eeFromXiC0andXiCPlusBis", [](const char* name) {
     MCProng prongXiCPlus(2, {kElectron, Pdg::kXiCPlus}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     MCProng prongXiC0(2, {kElectron, Pdg::kXiC0}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     prongXiCPlus.SetSourceBit(0, MCProng::kPhysicalPrimary);
     prongXiC0.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "one e from Xi_c+ and one e from Xi_c0 decays, no beauty in history (inverse signal)", {prongXiC0, prongXiCPlus}, {-1, -1});
+    MCSignal* signal = new MCSignal(name, "one e from Xi_c+ and one e from Xi_c0 decays, no beauty in history (inverse signal)", {prongXiC0, prongXiCPlus}, {-1, -1});
     return signal;
-  }
+  });
 
   // Xi_cc++ ->e and Xi_cc++ ->e
-  if (!nameStr.compare("eeFromXiCPlusPlus")) {
+  factories.emplace("eeFromXiCPlusPlus", [](const char* name) {
     MCProng prong(2, {kElectron, Pdg::kXiCCPlusPlus}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from Xi_cc++, no beauty in history", {prong, prong}, {-1, -1});
+    MCSignal* signal = new MCSignal(name, "ee pairs from Xi_cc++, no beauty in history", {prong, prong}, {-1, -1});
     return signal;
-  }
+  });
 
   // c->e and c->e (no check)
-  if (!nameStr.compare("eeFromCCNoCheck")) {
+  factories.emplace("eeFromCCNoCheck", [](const char* name) {
     MCProng prong(2, {11, 402}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from c->e and c->e without check", {prong, prong}, {-1, -1}); // signal at pair level
+    MCSignal* signal = new MCSignal(name, "ee pairs from c->e and c->e without check", {prong, prong}, {-1, -1}); // signal at pair level
     return signal;
-  }
+  });
 
   // ee from HF in general
-  if (!nameStr.compare("eeFromHF")) {
+  factories.emplace("eeFromHF", [](const char* name) {
     MCProng prong(2, {11, 902}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from b,c->e and b,c->e without check", {prong, prong}, {-1, -1}); // signal at pair level
+    MCSignal* signal = new MCSignal(name, "ee pairs from b,c->e and b,c->e without check", {prong, prong}, {-1, -1}); // signal at pair level
     return signal;
-  }
+  });
 
   // Any c in history but no b -> c -> e
-  if (!nameStr.compare("eeFromPromptCandPromptC")) {
+  factories.emplace("eeFromPromptCandPromptC", [](const char* name) {
     MCProng prong(2, {11, 402}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true}); // check if mother pdg code is in history
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs with any charm but no beauty in decay chain", {prong, prong}, {-1, -1}); // signal at pair level
+    MCSignal* signal = new MCSignal(name, "ee pairs with any charm but no beauty in decay chain", {prong, prong}, {-1, -1}); // signal at pair level
     return signal;
-  }
+  });
 
   // Any b to any c in history b -> c -> e
-  if (!nameStr.compare("eeFromAnyBtoCandAnyBtoC")) {
+  factories.emplace("eeFromAnyBtoCandAnyBtoC", [](const char* name) {
     MCProng prong(2, {11, 402}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {false}); // check if mother pdg code is in history
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs with any beauty to charm in decay chain", {prong, prong}, {-1, -1}); // signal at pair level
+    MCSignal* signal = new MCSignal(name, "ee pairs with any beauty to charm in decay chain", {prong, prong}, {-1, -1}); // signal at pair level
     return signal;
-  }
+  });
 
   // b->c->e, b->c->e
-  if (!nameStr.compare("eeFromBtoCandBtoC")) {
+  factories.emplace("eeFromBtoCandBtoC", [](const char* name) {
     MCProng prong(3, {11, 402, 502}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false}, false); // check if mother pdg code is in history
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs with any beauty to charm in decay chain", {prong, prong}, {-1, -1}); // signal at pair level
+    MCSignal* signal = new MCSignal(name, "ee pairs with any beauty to charm in decay chain", {prong, prong}, {-1, -1}); // signal at pair level
     return signal;
-  }
+  });
 
   // Any b->e and Any b->X->c->e
   // Looking at such decays: B -> (e) D -> (e)e and bar{B} -> e
   // Signal allows combinations of ee from the same B meson
   // + the combination of e fom B and e from bar{B}
-  if (!nameStr.compare("eeFromBandAnyBtoC")) {
+  factories.emplace("eeFromBandAnyBtoC", [](const char* name) {
     MCProng prongB(2, {11, 502}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prongB.SetSourceBit(0, MCProng::kPhysicalPrimary);
     MCProng prongBtoC(2, {11, 402}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {false}); // check if mother pdg code is in history
     prongBtoC.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from b->e and b->X->c->e", {prongB, prongBtoC}, {-1, -1}); // signal at pair level
+    MCSignal* signal = new MCSignal(name, "ee pairs from b->e and b->X->c->e", {prongB, prongBtoC}, {-1, -1}); // signal at pair level
     return signal;
-  }
+  });
 
   // Any b->e and Any b->X->c->e
-  if (!nameStr.compare("eeFromBandAnyBtoCBis")) {
+  factories.emplace("eeFromBandAnyBtoCBis", [](const char* name) {
     MCProng prongB(2, {11, 502}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prongB.SetSourceBit(0, MCProng::kPhysicalPrimary);
     MCProng prongBtoC(2, {11, 402}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {false}); // check if mother pdg code is in history
     prongBtoC.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from b->X->c->e and b->e", {prongBtoC, prongB}, {-1, -1}); // signal at pair level
+    MCSignal* signal = new MCSignal(name, "ee pairs from b->X->c->e and b->e", {prongBtoC, prongB}, {-1, -1}); // signal at pair level
     return signal;
-  }
+  });
 
   // b->e and b->c->e
-  if (!nameStr.compare("eeFromBandBtoC")) {
+  factories.emplace("eeFromBandBtoC", [](const char* name) {
     MCProng prongB(2, {11, 502}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prongB.SetSourceBit(0, MCProng::kPhysicalPrimary);
     MCProng prongBtoC(3, {11, 402, 502}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false}, false); // check if mother pdg code is in history
     prongBtoC.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "direkt ee pairs from b->e and b->c->e", {prongB, prongBtoC}, {-1, -1}); // signal at pair level
+    MCSignal* signal = new MCSignal(name, "direkt ee pairs from b->e and b->c->e", {prongB, prongBtoC}, {-1, -1}); // signal at pair level
     return signal;
-  }
+  });
 
   // b->e and b->c->e
-  if (!nameStr.compare("eeFromBandBtoCBis")) {
+  factories.emplace("eeFromBandBtoCBis", [](const char* name) {
     MCProng prongB(2, {11, 502}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prongB.SetSourceBit(0, MCProng::kPhysicalPrimary);
     MCProng prongBtoC(3, {11, 402, 502}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false}, false); // check if mother pdg code is in history
     prongBtoC.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from b->c->e and b->e", {prongBtoC, prongB}, {-1, -1}); // signal at pair level
+    MCSignal* signal = new MCSignal(name, "ee pairs from b->c->e and b->e", {prongBtoC, prongB}, {-1, -1}); // signal at pair level
     return signal;
-  }
+  });
 
   // b->e and b->c->e (same mother/grandmother)
   // require that the mother is the grandmother of the other electron
-  if (!nameStr.compare("eeFromBandBtoCsameGM")) {
+  factories.emplace("eeFromBandBtoCsameGM", [](const char* name) {
     MCProng prongB(2, {11, 502}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prongB.SetSourceBit(0, MCProng::kPhysicalPrimary);
     MCProng prongBtoC(3, {11, 402, 502}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false}, false); // check if mother pdg code is in history
     prongBtoC.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from b->e and b->c->e, mother = grandmother", {prongB, prongBtoC}, {1, 2}, false); // signal at pair level, accept commonAncestor Pairs
+    MCSignal* signal = new MCSignal(name, "ee pairs from b->e and b->c->e, mother = grandmother", {prongB, prongBtoC}, {1, 2}, false); // signal at pair level, accept commonAncestor Pairs
     return signal;
-  }
+  });
 
   // b->e and b->c->e (same mother/grandmother)
   // require that the mother is the grandmother of the other electron
-  if (!nameStr.compare("eeFromBandBtoCsameGMBis")) {
+  factories.emplace("eeFromBandBtoCsameGMBis", [](const char* name) {
     MCProng prongB(2, {11, 502}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prongB.SetSourceBit(0, MCProng::kPhysicalPrimary);
     MCProng prongBtoC(3, {11, 402, 502}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false}, false); // check if mother pdg code is in history
     prongBtoC.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from b->c->e and b->e, mother = grandmother", {prongBtoC, prongB}, {2, 1}, false); // signal at pair level, accept commonAncestor Pairs
+    MCSignal* signal = new MCSignal(name, "ee pairs from b->c->e and b->e, mother = grandmother", {prongBtoC, prongB}, {2, 1}, false); // signal at pair level, accept commonAncestor Pairs
     return signal;
-  }
+  });
 
   // b->e and b->c->e (different mother/grandmother)
   // require that the mother is not the grandmother of the other electron
-  if (!nameStr.compare("eeFromBandBtoCdiffGM")) {
+  factories.emplace("eeFromBandBtoCdiffGM", [](const char* name) {
     MCProng prongB(2, {11, 502}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prongB.SetSourceBit(0, MCProng::kPhysicalPrimary);
     MCProng prongBtoC(3, {11, 402, 502}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false}, false); // check if mother pdg code is in history
     prongBtoC.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from b->e and b->c->e, mother != grandmother", {prongB, prongBtoC}, {1, 2}, true); // signal at pair level, exclude commonAncestor Pairs
+    MCSignal* signal = new MCSignal(name, "ee pairs from b->e and b->c->e, mother != grandmother", {prongB, prongBtoC}, {1, 2}, true); // signal at pair level, exclude commonAncestor Pairs
     return signal;
-  }
+  });
 
   // b->e and b->c->e (different mother/grandmother)
   // require that the mother is not the grandmother of the other electron
-  if (!nameStr.compare("eeFromBandBtoCdiffGMBis")) {
+  factories.emplace("eeFromBandBtoCdiffGMBis", [](const char* name) {
     MCProng prongB(2, {11, 502}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prongB.SetSourceBit(0, MCProng::kPhysicalPrimary);
     MCProng prongBtoC(3, {11, 402, 502}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false}, false); // check if mother pdg code is in history
     prongBtoC.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from b->c->e and b->e, mother != grandmother", {prongBtoC, prongB}, {2, 1}, true); // signal at pair level, exclude commonAncestor Pairs
+    MCSignal* signal = new MCSignal(name, "ee pairs from b->c->e and b->e, mother != grandmother", {prongBtoC, prongB}, {2, 1}, true); // signal at pair level, exclude commonAncestor Pairs
     return signal;
-  }
+  });
 
   // b->e and b->e
-  if (!nameStr.compare("eeFromBB")) {
+  factories.emplace("eeFromBB", [](const char* name) {
     MCProng prong(2, {11, 502}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from b->e and b->e", {prong, prong}, {-1, -1}); // signal at pair level
+    MCSignal* signal = new MCSignal(name, "ee pairs from b->e and b->e", {prong, prong}, {-1, -1}); // signal at pair level
     return signal;
-  }
+  });
 
   // b->e and b->e (commonAncestors)
-  if (!nameStr.compare("eeFromSameB")) {
+  factories.emplace("eeFromSameB", [](const char* name) {
     MCProng prong(2, {11, 502}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from b->e and b->e", {prong, prong}, {1, 1}); // signal at pair level
+    MCSignal* signal = new MCSignal(name, "ee pairs from b->e and b->e", {prong, prong}, {1, 1}); // signal at pair level
     return signal;
-  }
+  });
 
   // b->e and c->e no check
-  if (!nameStr.compare("eeFromBandFromC")) {
+  factories.emplace("eeFromBandFromC", [](const char* name) {
     MCProng prongB(2, {11, 502}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prongB.SetSourceBit(0, MCProng::kPhysicalPrimary);
     MCProng prongC(2, {11, 402}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prongC.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from b->e and c->e", {prongB, prongC}, {-1, -1}); // signal at pair level
+    MCSignal* signal = new MCSignal(name, "ee pairs from b->e and c->e", {prongB, prongC}, {-1, -1}); // signal at pair level
     return signal;
-  }
+  });
 
   // b->e and c->e no check
-  if (!nameStr.compare("eeFromBandFromCBis")) {
+  factories.emplace("eeFromBandFromCBis", [](const char* name) {
     MCProng prongB(2, {11, 502}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prongB.SetSourceBit(0, MCProng::kPhysicalPrimary);
     MCProng prongC(2, {11, 402}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prongC.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from b->e and c->e", {prongC, prongB}, {-1, -1}); // signal at pair level
+    MCSignal* signal = new MCSignal(name, "ee pairs from b->e and c->e", {prongC, prongB}, {-1, -1}); // signal at pair level
     return signal;
-  }
+  });
 
   // b->e and b->c->e (single b)
-  if (!nameStr.compare("eeFromSingleBandBtoC")) {
+  factories.emplace("eeFromSingleBandBtoC", [](const char* name) {
     MCProng prongB(2, {11, 502}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prongB.SetSourceBit(0, MCProng::kPhysicalPrimary);
     MCProng prongBtoC(3, {11, 402, 502}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     prongBtoC.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from b->e and b->c->e (single b)", {prongB, prongBtoC}, {1, 2}); // signal at pair level
+    MCSignal* signal = new MCSignal(name, "ee pairs from b->e and b->c->e (single b)", {prongB, prongBtoC}, {1, 2}); // signal at pair level
     return signal;
-  }
+  });
 
   //_________________________________________________________________________________________________________________________
 
-  if (!nameStr.compare("kaonFromBplus")) {
+  factories.emplace("kaonFromBplus", [](const char* name) {
     MCProng prong(2, {321, 521}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Kaons from B+ decays", {prong}, {1});
+    MCSignal* signal = new MCSignal(name, "Kaons from B+ decays", {prong}, {1});
     return signal;
-  }
+  });
 
-  if (!nameStr.compare("kaonFromBplusHistory")) {
+  factories.emplace("kaonFromBplusHistory", [](const char* name) {
     MCProng prong(1, {321}, {true}, {false}, {0}, {0}, {false}, false, {521}, {false});
-    signal = new MCSignal(name, "Kaons from B+ decays", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Kaons from B+ decays", {prong}, {-1});
     return signal;
-  }
+  });
 
-  if (!nameStr.compare("kaonPrimaryFromBplusHistory")) {
+  factories.emplace("kaonPrimaryFromBplusHistory", [](const char* name) {
     MCProng prong(1, {321}, {true}, {false}, {0}, {0}, {false}, false, {521}, {false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Kaons from B+ decays", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Kaons from B+ decays", {prong}, {-1});
     return signal;
-  }
+  });
 
-  if (!nameStr.compare("kaonPrimaryFromBplusFS")) {
+  factories.emplace("kaonPrimaryFromBplusFS", [](const char* name) {
     MCProng prong(2, {321, 521}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
     prong.SetSourceBit(1, MCProng::kHEPMCFinalState);
-    signal = new MCSignal(name, "Kaons from B+ decays", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Kaons from B+ decays", {prong}, {-1});
     return signal;
-  }
+  });
 
-  if (!nameStr.compare("kaonFromAnyBHistory")) {
+  factories.emplace("kaonFromAnyBHistory", [](const char* name) {
     MCProng prong(1, {321}, {true}, {false}, {0}, {0}, {false}, false, {503}, {false});
-    signal = new MCSignal(name, "Kaons from B+ decays", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Kaons from B+ decays", {prong}, {-1});
     return signal;
-  }
+  });
 
-  if (!nameStr.compare("JpsiFromBplus")) {
+  factories.emplace("JpsiFromBplus", [](const char* name) {
     MCProng prong(2, {443, 521}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Jpsi from B+ decays", {prong}, {1});
+    MCSignal* signal = new MCSignal(name, "Jpsi from B+ decays", {prong}, {1});
     return signal;
-  }
+  });
 
-  if (!nameStr.compare("eFromJpsiFromBplus")) {
+  factories.emplace("eFromJpsiFromBplus", [](const char* name) {
     MCProng prong(3, {11, 443, 521}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
-    signal = new MCSignal(name, "Electrons from Jpsi from B+ decays", {prong}, {1});
+    MCSignal* signal = new MCSignal(name, "Electrons from Jpsi from B+ decays", {prong}, {1});
     return signal;
-  }
+  });
 
-  if (!nameStr.compare("electronFromJpsiFromBplus")) {
+  factories.emplace("electronFromJpsiFromBplus", [](const char* name) {
     MCProng prong(3, {11, 443, 521}, {false, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
-    signal = new MCSignal(name, "Electrons from Jpsi from B+ decays", {prong}, {1});
+    MCSignal* signal = new MCSignal(name, "Electrons from Jpsi from B+ decays", {prong}, {1});
     return signal;
-  }
+  });
 
-  if (!nameStr.compare("positronFromJpsiFromBplus")) {
+  factories.emplace("positronFromJpsiFromBplus", [](const char* name) {
     MCProng prong(3, {-11, 443, 521}, {false, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
-    signal = new MCSignal(name, "Positrons from Jpsi from B+ decays", {prong}, {1});
+    MCSignal* signal = new MCSignal(name, "Positrons from Jpsi from B+ decays", {prong}, {1});
     return signal;
-  }
+  });
 
-  if (!nameStr.compare("eeFromJpsiFromBplus")) {
+  factories.emplace("eeFromJpsiFromBplus", [](const char* name) {
     MCProng prong(3, {11, 443, 521}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
-    signal = new MCSignal(name, "Electron pair from Jpsi from B+ decays", {prong, prong}, {1, 1});
+    MCSignal* signal = new MCSignal(name, "Electron pair from Jpsi from B+ decays", {prong, prong}, {1, 1});
     return signal;
-  }
+  });
 
-  if (!nameStr.compare("eeKaonFromBplus")) {
+  factories.emplace("eeKaonFromBplus", [](const char* name) {
     MCProng pronge(3, {11, 443, 521}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     MCProng prongKaon(2, {321, 521}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Kaon and electron pair from B+", {pronge, pronge, prongKaon}, {2, 2, 1});
+    MCSignal* signal = new MCSignal(name, "Kaon and electron pair from B+", {pronge, pronge, prongKaon}, {2, 2, 1});
     return signal;
-  }
+  });
 
-  if (!nameStr.compare("eeFromJpsiKaonAny")) {
+  factories.emplace("eeFromJpsiKaonAny", [](const char* name) {
     MCProng pronge(2, {11, 443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     MCProng prongKaon(1, {321}, {true}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "Kaon and electron pair", {pronge, pronge, prongKaon}, {-1, -1, -1});
+    MCSignal* signal = new MCSignal(name, "Kaon and electron pair", {pronge, pronge, prongKaon}, {-1, -1, -1});
     return signal;
-  }
+  });
 
-  if (!nameStr.compare("eeKaonFromBplusExclusive")) {
+  factories.emplace("eeKaonFromBplusExclusive", [](const char* name) {
     MCProng pronge(3, {11, 443, 521}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     MCProng prongKaon(2, {321, 521}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Kaon and electron pair from B+", {pronge, pronge, prongKaon}, {2, 2, 1});
+    MCSignal* signal = new MCSignal(name, "Kaon and electron pair from B+", {pronge, pronge, prongKaon}, {2, 2, 1});
     signal->SetDecayChannelIsExclusive(2, true);
     return signal;
-  }
+  });
 
-  if (!nameStr.compare("eeKaonFromBplusNotExclusive")) {
+  factories.emplace("eeKaonFromBplusNotExclusive", [](const char* name) {
     MCProng pronge(3, {11, 443, 521}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     MCProng prongKaon(2, {321, 521}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Kaon and electron pair from B+", {pronge, pronge, prongKaon}, {2, 2, 1});
+    MCSignal* signal = new MCSignal(name, "Kaon and electron pair from B+", {pronge, pronge, prongKaon}, {2, 2, 1});
     signal->SetDecayChannelIsNotExclusive(2, true);
     return signal;
-  }
+  });
 
   // correlated background
-  if (!nameStr.compare("eePionFromBplus")) {
+  factories.emplace("eePionFromBplus", [](const char* name) {
     MCProng pronge(3, {11, 443, 521}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     MCProng prongPion(2, {211, 521}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Pion and electron pair from B+", {pronge, pronge, prongPion}, {2, 2, 1});
+    MCSignal* signal = new MCSignal(name, "Pion and electron pair from B+", {pronge, pronge, prongPion}, {2, 2, 1});
     return signal;
-  }
+  });
 
-  if (!nameStr.compare("eeKaonFromBplusViaEverything")) {
+  factories.emplace("eeKaonFromBplusViaEverything", [](const char* name) {
     MCProng pronge(3, {11, 443, 521}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     MCProng prongKaon(3, {321, 0, 521}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
-    signal = new MCSignal(name, "Kaon and electron pair from B+ via everything", {pronge, pronge, prongKaon}, {2, 2, 2});
+    MCSignal* signal = new MCSignal(name, "Kaon and electron pair from B+ via everything", {pronge, pronge, prongKaon}, {2, 2, 2});
     return signal;
-  }
+  });
 
-  if (!nameStr.compare("eeKaonFromB0")) {
+  factories.emplace("eeKaonFromB0", [](const char* name) {
     MCProng pronge(3, {11, 443, 511}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     MCProng prongKaon(2, {321, 511}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Kaon and electron pair from B0", {pronge, pronge, prongKaon}, {2, 2, 1});
+    MCSignal* signal = new MCSignal(name, "Kaon and electron pair from B0", {pronge, pronge, prongKaon}, {2, 2, 1});
     return signal;
-  }
+  });
 
-  if (!nameStr.compare("eePionFromB0ViaEverything")) { // catching feed-down for B0
+  factories.emplace("eePionFromB0ViaEverything", [](const char* name) { // catching feed-down for B0
     MCProng pronge(3, {11, 443, 511}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     MCProng prongPion(3, {211, 0, 511}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
-    signal = new MCSignal(name, "Pion and electron pair from B0", {pronge, pronge, prongPion}, {2, 2, 1});
+    MCSignal* signal = new MCSignal(name, "Pion and electron pair from B0", {pronge, pronge, prongPion}, {2, 2, 1});
     return signal;
-  }
+  });
 
-  if (!nameStr.compare("eeKaonFromOpenBeautyMesons")) {
+  factories.emplace("eeKaonFromOpenBeautyMesons", [](const char* name) {
     MCProng pronge(3, {11, 443, 501}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     MCProng prongKaon(2, {321, 501}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Excited kaon and electron pair from B0", {pronge, pronge, prongKaon}, {2, 2, 2});
+    MCSignal* signal = new MCSignal(name, "Excited kaon and electron pair from B0", {pronge, pronge, prongKaon}, {2, 2, 2});
     return signal;
-  }
+  });
 
-  if (!nameStr.compare("eeKaonFromOpenBeautyHadrons")) {
+  factories.emplace("eeKaonFromOpenBeautyHadrons", [](const char* name) {
     MCProng pronge(3, {11, 443, 502}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     MCProng prongKaon(2, {321, 502}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Kaon and electron pair from open beauty hadrons", {pronge, pronge, prongKaon}, {2, 2, 1});
+    MCSignal* signal = new MCSignal(name, "Kaon and electron pair from open beauty hadrons", {pronge, pronge, prongKaon}, {2, 2, 1});
     return signal;
-  }
+  });
 
-  if (!nameStr.compare("eeKaonFromLambdaB")) {
+  factories.emplace("eeKaonFromLambdaB", [](const char* name) {
     MCProng pronge(3, {11, 443, 5122}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     MCProng prongKaon(2, {321, 5122}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Kaon and electron pair from lambda B", {pronge, pronge, prongKaon}, {2, 2, 1});
+    MCSignal* signal = new MCSignal(name, "Kaon and electron pair from lambda B", {pronge, pronge, prongKaon}, {2, 2, 1});
     return signal;
-  }
+  });
 
-  if (!nameStr.compare("eeKaonPion0FromBplus")) {
+  factories.emplace("eeKaonPion0FromBplus", [](const char* name) {
     MCProng pronge(3, {11, 443, 521}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     MCProng prongKaon(2, {321, 521}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     MCProng prongPion(2, {111, 521}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Kaon, pi0 and electron pair from B+", {pronge, pronge, prongKaon, prongPion}, {2, 2, 1, 1});
+    MCSignal* signal = new MCSignal(name, "Kaon, pi0 and electron pair from B+", {pronge, pronge, prongKaon, prongPion}, {2, 2, 1, 1});
     return signal;
-  }
+  });
 
-  if (!nameStr.compare("eeKaonEtaFromBplus")) {
+  factories.emplace("eeKaonEtaFromBplus", [](const char* name) {
     MCProng pronge(3, {11, 443, 521}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     MCProng prongKaon(2, {321, 521}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     MCProng prongEta(2, {221, 521}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Kaon, eta and electron pair from B+", {pronge, pronge, prongKaon, prongEta}, {2, 2, 1, 1});
+    MCSignal* signal = new MCSignal(name, "Kaon, eta and electron pair from B+", {pronge, pronge, prongKaon, prongEta}, {2, 2, 1, 1});
     return signal;
-  }
+  });
 
-  if (!nameStr.compare("eeKaonOmegaFromBplus")) {
+  factories.emplace("eeKaonOmegaFromBplus", [](const char* name) {
     MCProng pronge(3, {11, 443, 521}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     MCProng prongKaon(2, {321, 521}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     MCProng prongOmega(2, {223, 521}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Kaon, omega and electron pair from B+", {pronge, pronge, prongKaon, prongOmega}, {2, 2, 1, 1});
+    MCSignal* signal = new MCSignal(name, "Kaon, omega and electron pair from B+", {pronge, pronge, prongKaon, prongOmega}, {2, 2, 1, 1});
     return signal;
-  }
+  });
 
-  if (!nameStr.compare("eeKaonPionFromBplus")) {
+  factories.emplace("eeKaonPionFromBplus", [](const char* name) {
     MCProng pronge(3, {11, 443, 521}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     MCProng prongKaon(2, {321, 521}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     MCProng prongPion(2, {211, 521}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Kaon, pion and electron pair from B+", {pronge, pronge, prongKaon, prongPion}, {2, 2, 1, 1});
+    MCSignal* signal = new MCSignal(name, "Kaon, pion and electron pair from B+", {pronge, pronge, prongKaon, prongPion}, {2, 2, 1, 1});
     return signal;
-  }
+  });
 
-  if (!nameStr.compare("Bplus")) {
+  factories.emplace("Bplus", [](const char* name) {
     MCProng prong(1, {521}, {true}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "B+", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "B+", {prong}, {-1});
     return signal;
-  }
+  });
 
-  if (!nameStr.compare("BplusFS")) {
+  factories.emplace("BplusFS", [](const char* name) {
     MCProng prong(1, {521}, {true}, {false}, {0}, {0}, {false});
     prong.SetSourceBit(0, MCProng::kHEPMCFinalState);
-    signal = new MCSignal(name, "B+", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "B+", {prong}, {-1});
     return signal;
-  }
+  });
 
-  if (!nameStr.compare("beautyPairs")) {
+  factories.emplace("beautyPairs", [](const char* name) {
     MCProng prong(1, {503}, {true}, {false}, {0}, {0}, {false});
-    signal = new MCSignal("beautyPairs", "Beauty hadron pair", {prong, prong}, {-1, -1});
+    MCSignal* signal = new MCSignal("beautyPairs", "Beauty hadron pair", {prong, prong}, {-1, -1});
     return signal;
-  }
-  if (!nameStr.compare("everythingFromBeautyPairs")) {
+  });
+  factories.emplace("everythingFromBeautyPairs", [](const char* name) {
     MCProng prong(2, {0, 503}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal("everythingFromBeautyPairs", "Everything from beauty hadrons pair", {prong, prong}, {-1, -1});
+    MCSignal* signal = new MCSignal("everythingFromBeautyPairs", "Everything from beauty hadrons pair", {prong, prong}, {-1, -1});
     return signal;
-  }
-  if (!nameStr.compare("everythingFromEverythingFromBeautyPairsCM")) {
+  });
+  factories.emplace("everythingFromEverythingFromBeautyPairsCM", [](const char* name) {
     MCProng prong(3, {0, 0, 503}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
-    signal = new MCSignal("everythingFromEverythingFromBeautyPairs", "Everything from everything from beauty hadrons pair with common grand-mother", {prong, prong}, {2, 2});
+    MCSignal* signal = new MCSignal("everythingFromEverythingFromBeautyPairs", "Everything from everything from beauty hadrons pair with common grand-mother", {prong, prong}, {2, 2});
     return signal;
-  }
-  if (!nameStr.compare("everythingFromBeautyANDeverythingFromEverythingFromBeautyPairs")) {
+  });
+  factories.emplace("everythingFromBeautyANDeverythingFromEverythingFromBeautyPairs", [](const char* name) {
     MCProng prong1(3, {0, 0, 503}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     MCProng prong2(2, {0, 503}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal("everythingFromBeautyANDeverythingFromEverythingFromBeautyPairs", "Everything beauty and everything from everything from beauty hadrons pair", {prong1, prong2}, {2, 1});
+    MCSignal* signal = new MCSignal("everythingFromBeautyANDeverythingFromEverythingFromBeautyPairs", "Everything beauty and everything from everything from beauty hadrons pair", {prong1, prong2}, {2, 1});
     return signal;
-  }
+  });
 
   //------------------------------------------------------------------------------------
 
-  if (!nameStr.compare("D0")) {
+  factories.emplace("D0", [](const char* name) {
     MCProng prong(1, {Pdg::kD0}, {true}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "D0", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "D0", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("nonPromptD0")) {
+  });
+  factories.emplace("nonPromptD0", [](const char* name) {
     MCProng prong(2, {Pdg::kD0, 503}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Non-prompt D0", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Non-prompt D0", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("D0FS")) {
+  });
+  factories.emplace("D0FS", [](const char* name) {
     MCProng prong(1, {Pdg::kD0}, {true}, {false}, {0}, {0}, {false});
     prong.SetSourceBit(0, MCProng::kHEPMCFinalState);
-    signal = new MCSignal(name, "D0", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "D0", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("KPiFromD0")) {
+  });
+  factories.emplace("KPiFromD0", [](const char* name) {
     MCProng prongKaon(2, {321, Pdg::kD0}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     MCProng prongPion(2, {211, Pdg::kD0}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Kaon and pion pair from D0", {prongKaon, prongPion}, {1, 1});
+    MCSignal* signal = new MCSignal(name, "Kaon and pion pair from D0", {prongKaon, prongPion}, {1, 1});
     return signal;
-  }
-  if (!nameStr.compare("KPiFromD0Reflected")) {
+  });
+  factories.emplace("KPiFromD0Reflected", [](const char* name) {
     MCProng prongFalseKaon(2, {211, Pdg::kD0}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     MCProng prongFalsePion(2, {321, Pdg::kD0}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Kaon and pion pair from D0 with reflected mass assumption", {prongFalseKaon, prongFalsePion}, {1, 1});
+    MCSignal* signal = new MCSignal(name, "Kaon and pion pair from D0 with reflected mass assumption", {prongFalseKaon, prongFalsePion}, {1, 1});
     return signal;
-  }
-  if (!nameStr.compare("Dcharged")) {
+  });
+  factories.emplace("Dcharged", [](const char* name) {
     MCProng prong(1, {Pdg::kDPlus}, {true}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "D+/-", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "D+/-", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("Dplus")) {
+  });
+  factories.emplace("Dplus", [](const char* name) {
     MCProng prong(1, {Pdg::kDPlus}, {false}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "D+", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "D+", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("Dminus")) {
+  });
+  factories.emplace("Dminus", [](const char* name) {
     MCProng prong(1, {-Pdg::kDPlus}, {false}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "D+", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "D+", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("KPiPiFromDcharged")) {
+  });
+  factories.emplace("KPiPiFromDcharged", [](const char* name) {
     MCProng prongKaon(2, {321, Pdg::kDPlus}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     MCProng prongPion(2, {211, Pdg::kDPlus}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Kaon pion pion triplet from D+/-", {prongKaon, prongPion, prongPion}, {1, 1, 1});
+    MCSignal* signal = new MCSignal(name, "Kaon pion pion triplet from D+/-", {prongKaon, prongPion, prongPion}, {1, 1, 1});
     return signal;
-  }
-  if (!nameStr.compare("KPiPiFromDplus")) {
+  });
+  factories.emplace("KPiPiFromDplus", [](const char* name) {
     MCProng prongKaon(2, {-321, Pdg::kDPlus}, {false, false}, {false, false}, {0, 0}, {0, 0}, {false, false});
     MCProng prongPion(2, {211, Pdg::kDPlus}, {false, false}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Kaon pion pion triplet from D+", {prongKaon, prongPion, prongPion}, {1, 1, 1});
+    MCSignal* signal = new MCSignal(name, "Kaon pion pion triplet from D+", {prongKaon, prongPion, prongPion}, {1, 1, 1});
     return signal;
-  }
-  if (!nameStr.compare("KPiPiFromDminus")) {
+  });
+  factories.emplace("KPiPiFromDminus", [](const char* name) {
     MCProng prongKaon(2, {321, -Pdg::kDPlus}, {false, false}, {false, false}, {0, 0}, {0, 0}, {false, false});
     MCProng prongPion(2, {-211, -Pdg::kDPlus}, {false, false}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Kaon pion pion triplet from D-", {prongKaon, prongPion, prongPion}, {1, 1, 1});
+    MCSignal* signal = new MCSignal(name, "Kaon pion pion triplet from D-", {prongKaon, prongPion, prongPion}, {1, 1, 1});
     return signal;
-  }
-  if (!nameStr.compare("Dstar")) {
+  });
+  factories.emplace("Dstar", [](const char* name) {
     MCProng prong(1, {Pdg::kDStar}, {true}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "D*", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "D*", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("DstarPlus")) {
+  });
+  factories.emplace("DstarPlus", [](const char* name) {
     MCProng prong(1, {Pdg::kDStar}, {false}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "D*+", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "D*+", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("DstarMinus")) {
+  });
+  factories.emplace("DstarMinus", [](const char* name) {
     MCProng prong(1, {-Pdg::kDStar}, {false}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "D*-", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "D*-", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("pionFromDstar")) {
+  });
+  factories.emplace("pionFromDstar", [](const char* name) {
     MCProng prong(2, {211, Pdg::kDStar}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Pions from D* decays", {prong}, {1});
+    MCSignal* signal = new MCSignal(name, "Pions from D* decays", {prong}, {1});
     return signal;
-  }
-  if (!nameStr.compare("D0FromDstar")) {
+  });
+  factories.emplace("D0FromDstar", [](const char* name) {
     MCProng prong(2, {Pdg::kD0, Pdg::kDStar}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "D0 from D* decays", {prong}, {1});
+    MCSignal* signal = new MCSignal(name, "D0 from D* decays", {prong}, {1});
     return signal;
-  }
-  if (!nameStr.compare("KFromD0FromDstar")) {
+  });
+  factories.emplace("KFromD0FromDstar", [](const char* name) {
     MCProng prong(3, {321, Pdg::kD0, Pdg::kDStar}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
-    signal = new MCSignal(name, "Kaons from D0 from D* decays", {prong}, {1});
+    MCSignal* signal = new MCSignal(name, "Kaons from D0 from D* decays", {prong}, {1});
     return signal;
-  }
-  if (!nameStr.compare("PiFromD0FromDstar")) {
+  });
+  factories.emplace("PiFromD0FromDstar", [](const char* name) {
     MCProng prong(3, {211, Pdg::kD0, Pdg::kDStar}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
-    signal = new MCSignal(name, "Pions from D0 from D* decays", {prong}, {1});
+    MCSignal* signal = new MCSignal(name, "Pions from D0 from D* decays", {prong}, {1});
     return signal;
-  }
-  if (!nameStr.compare("KPiFromD0FromDstar")) {
+  });
+  factories.emplace("KPiFromD0FromDstar", [](const char* name) {
     MCProng prongKaon(3, {321, Pdg::kD0, Pdg::kDStar}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     MCProng prongPion(3, {321, Pdg::kD0, Pdg::kDStar}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
-    signal = new MCSignal(name, "Kaon and pion pair from D0 from D* decay", {prongKaon, prongPion}, {1, 1});
+    MCSignal* signal = new MCSignal(name, "Kaon and pion pair from D0 from D* decay", {prongKaon, prongPion}, {1, 1});
     return signal;
-  }
-  if (!nameStr.compare("KPiPiFromD0FromDstar")) {
+  });
+  factories.emplace("KPiPiFromD0FromDstar", [](const char* name) {
     MCProng prongKaon(3, {321, Pdg::kD0, Pdg::kDStar}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     MCProng prongPionSecondary(3, {211, Pdg::kD0, Pdg::kDStar}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     MCProng prongPion(2, {211, Pdg::kDStar}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Kaon pion pion triplet from D*", {prongKaon, prongPionSecondary, prongPion}, {2, 2, 1});
+    MCSignal* signal = new MCSignal(name, "Kaon pion pion triplet from D*", {prongKaon, prongPionSecondary, prongPion}, {2, 2, 1});
     return signal;
-  }
-  if (!nameStr.compare("KPiPiFromD0FromDstarPlus")) {
+  });
+  factories.emplace("KPiPiFromD0FromDstarPlus", [](const char* name) {
     MCProng prongKaon(3, {-321, Pdg::kD0, Pdg::kDStar}, {false, false, false}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     MCProng prongPionSecondary(3, {211, Pdg::kD0, Pdg::kDStar}, {false, false, false}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     MCProng prongPion(2, {211, Pdg::kDStar}, {false, false}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Kaon pion pion triplet from D*+", {prongKaon, prongPionSecondary, prongPion}, {2, 2, 1});
+    MCSignal* signal = new MCSignal(name, "Kaon pion pion triplet from D*+", {prongKaon, prongPionSecondary, prongPion}, {2, 2, 1});
     return signal;
-  }
-  if (!nameStr.compare("KPiPiFromD0FromDstarMinus")) {
+  });
+  factories.emplace("KPiPiFromD0FromDstarMinus", [](const char* name) {
     MCProng prongKaon(3, {321, Pdg::kD0, Pdg::kDStar}, {false, false, false}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     MCProng prongPionSecondary(3, {-211, Pdg::kD0, Pdg::kDStar}, {false, false, false}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     MCProng prongPion(2, {-211, Pdg::kDStar}, {false, false}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Kaon pion pion triplet from D*-", {prongKaon, prongPionSecondary, prongPion}, {2, 2, 1});
+    MCSignal* signal = new MCSignal(name, "Kaon pion pion triplet from D*-", {prongKaon, prongPionSecondary, prongPion}, {2, 2, 1});
     return signal;
-  }
-  if (!nameStr.compare("KFromDplus")) {
+  });
+  factories.emplace("KFromDplus", [](const char* name) {
     MCProng prong(2, {321, Pdg::kDPlus}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Kaons from D+/- decays", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Kaons from D+/- decays", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("LambdaC")) {
+  });
+  factories.emplace("LambdaC", [](const char* name) {
     MCProng prong(1, {Pdg::kLambdaCPlus}, {true}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "Lambda_c", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Lambda_c", {prong}, {-1});
     return signal;
-  }
+  });
 
   //--------------------------------------------------------------------------------
 
-  if (!nameStr.compare("JpsiFromChic0")) {
+  factories.emplace("JpsiFromChic0", [](const char* name) {
     MCProng prong(2, {443, 10441}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Jpsi from Chic0 decays", {prong}, {1});
+    MCSignal* signal = new MCSignal(name, "Jpsi from Chic0 decays", {prong}, {1});
     return signal;
-  }
-  if (!nameStr.compare("eFromJpsiFromChic0")) {
+  });
+  factories.emplace("eFromJpsiFromChic0", [](const char* name) {
     MCProng prong(3, {11, 443, 10441}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Electrons from Jpsi from Chic0 decays", {prong}, {1});
+    MCSignal* signal = new MCSignal(name, "Electrons from Jpsi from Chic0 decays", {prong}, {1});
     return signal;
-  }
-  if (!nameStr.compare("eeFromJpsiFromChic0")) {
+  });
+  factories.emplace("eeFromJpsiFromChic0", [](const char* name) {
     MCProng prong(3, {11, 443, 10441}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Electron pair from Jpsi from Chic0 decays", {prong, prong}, {2, 2});
+    MCSignal* signal = new MCSignal(name, "Electron pair from Jpsi from Chic0 decays", {prong, prong}, {2, 2});
     return signal;
-  }
-  if (!nameStr.compare("JpsiFromChic1")) {
+  });
+  factories.emplace("JpsiFromChic1", [](const char* name) {
     MCProng prong(2, {443, 20443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Jpsi from Chic1 decays", {prong}, {1});
+    MCSignal* signal = new MCSignal(name, "Jpsi from Chic1 decays", {prong}, {1});
     return signal;
-  }
-  if (!nameStr.compare("eFromJpsiFromChic1")) {
+  });
+  factories.emplace("eFromJpsiFromChic1", [](const char* name) {
     MCProng prong(3, {11, 443, 20443}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Electrons from Jpsi from Chic1 decays", {prong}, {2});
+    MCSignal* signal = new MCSignal(name, "Electrons from Jpsi from Chic1 decays", {prong}, {2});
     return signal;
-  }
-  if (!nameStr.compare("eeFromJpsiFromChic1")) {
+  });
+  factories.emplace("eeFromJpsiFromChic1", [](const char* name) {
     MCProng prong(3, {11, 443, 20443}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Electron pair from Jpsi from Chic1 decays", {prong, prong}, {2, 2});
+    MCSignal* signal = new MCSignal(name, "Electron pair from Jpsi from Chic1 decays", {prong, prong}, {2, 2});
     return signal;
-  }
-  if (!nameStr.compare("JpsiFromChic2")) {
+  });
+  factories.emplace("JpsiFromChic2", [](const char* name) {
     MCProng prong(2, {443, 445}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Jpsi from Chic2 decays", {prong}, {1});
+    MCSignal* signal = new MCSignal(name, "Jpsi from Chic2 decays", {prong}, {1});
     return signal;
-  }
-  if (!nameStr.compare("JpsiFromChic2")) {
+  });
+  factories.emplace("JpsiFromChic2", [](const char* name) {
     MCProng prong(2, {443, 904}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Jpsi from Chic0, Chic1 or Chic2 decays", {prong}, {1});
+    MCSignal* signal = new MCSignal(name, "Jpsi from Chic0, Chic1 or Chic2 decays", {prong}, {1});
     return signal;
-  }
-  if (!nameStr.compare("eFromJpsiFromChic2")) {
+  });
+  factories.emplace("eFromJpsiFromChic2", [](const char* name) {
     MCProng prong(3, {11, 443, 445}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Electrons from Jpsi from Chic2 decays", {prong}, {2});
+    MCSignal* signal = new MCSignal(name, "Electrons from Jpsi from Chic2 decays", {prong}, {2});
     return signal;
-  }
-  if (!nameStr.compare("eeFromJpsiFromChic2")) {
+  });
+  factories.emplace("eeFromJpsiFromChic2", [](const char* name) {
     MCProng prong(3, {11, 443, 445}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Electron pair from Jpsi from Chic2 decays", {prong, prong}, {2, 2});
+    MCSignal* signal = new MCSignal(name, "Electron pair from Jpsi from Chic2 decays", {prong, prong}, {2, 2});
     return signal;
-  }
-  if (!nameStr.compare("eeFromJpsiFromChic012")) {
+  });
+  factories.emplace("eeFromJpsiFromChic012", [](const char* name) {
     MCProng prong(3, {11, 443, 904}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Electron pair from Jpsi from Chic0, Chic1 or Chic2 decays", {prong, prong}, {2, 2});
+    MCSignal* signal = new MCSignal(name, "Electron pair from Jpsi from Chic0, Chic1 or Chic2 decays", {prong, prong}, {2, 2});
     return signal;
-  }
-  if (!nameStr.compare("PhotonFromChic0")) {
+  });
+  factories.emplace("PhotonFromChic0", [](const char* name) {
     MCProng prong(2, {22, 10441}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Photon from Chic0 decays", {prong}, {1});
+    MCSignal* signal = new MCSignal(name, "Photon from Chic0 decays", {prong}, {1});
     return signal;
-  }
-  if (!nameStr.compare("PhotonFromChic1")) {
+  });
+  factories.emplace("PhotonFromChic1", [](const char* name) {
     MCProng prong(2, {22, 20443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Photon from Chic1 decays", {prong}, {1});
+    MCSignal* signal = new MCSignal(name, "Photon from Chic1 decays", {prong}, {1});
     return signal;
-  }
-  if (!nameStr.compare("PhotonFromChic2")) {
+  });
+  factories.emplace("PhotonFromChic2", [](const char* name) {
     MCProng prong(2, {22, 445}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Photon from Chic2 decays", {prong}, {1});
+    MCSignal* signal = new MCSignal(name, "Photon from Chic2 decays", {prong}, {1});
     return signal;
-  }
-  if (!nameStr.compare("PhotonFromChic012")) {
+  });
+  factories.emplace("PhotonFromChic012", [](const char* name) {
     MCProng prong(2, {22, 904}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Photon from Chic0, Chic1, and Chic2 decays", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Photon from Chic0, Chic1, and Chic2 decays", {prong}, {-1});
     return signal;
-  }
-  if (!nameStr.compare("PhotonFromPi0")) {
+  });
+  factories.emplace("PhotonFromPi0", [](const char* name) {
     MCProng prong(2, {22, 111}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     // prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Photon from Pi0 decays", {prong}, {1});
+    MCSignal* signal = new MCSignal(name, "Photon from Pi0 decays", {prong}, {1});
     return signal;
-  }
-  if (!nameStr.compare("PhotonPhotonFromPi0")) {
+  });
+  factories.emplace("PhotonPhotonFromPi0", [](const char* name) {
     MCProng prong(2, {22, 111}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Photon Photon from Pi0 decays", {prong, prong}, {1, 1});
+    MCSignal* signal = new MCSignal(name, "Photon Photon from Pi0 decays", {prong, prong}, {1, 1});
     return signal;
-  }
+  });
 
-  if (!nameStr.compare("eePhotonFromChic1")) {
+  factories.emplace("eePhotonFromChic1", [](const char* name) {
     MCProng pronge(3, {11, 443, 20443}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     MCProng prongPhoton(2, {22, 20443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     pronge.SetSourceBit(0, MCProng::kPhysicalPrimary);
     prongPhoton.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Photon and electron pair from Chic1", {pronge, pronge, prongPhoton}, {2, 2, 1});
+    MCSignal* signal = new MCSignal(name, "Photon and electron pair from Chic1", {pronge, pronge, prongPhoton}, {2, 2, 1});
     return signal;
-  }
+  });
 
-  if (!nameStr.compare("eePhotonFromChic2")) {
+  factories.emplace("eePhotonFromChic2", [](const char* name) {
     MCProng pronge(3, {11, 443, 445}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     MCProng prongPhoton(2, {22, 445}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     pronge.SetSourceBit(0, MCProng::kPhysicalPrimary);
     prongPhoton.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Photon and electron pair from Chic2", {pronge, pronge, prongPhoton}, {2, 2, 1});
+    MCSignal* signal = new MCSignal(name, "Photon and electron pair from Chic2", {pronge, pronge, prongPhoton}, {2, 2, 1});
     return signal;
-  }
+  });
 
-  if (!nameStr.compare("eePhotonFromChic12")) {
+  factories.emplace("eePhotonFromChic12", [](const char* name) {
     MCProng pronge(3, {11, 443, MCProng::kPDGCodeNotAssigned}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     MCProng prongPhoton(2, {22, MCProng::kPDGCodeNotAssigned}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     pronge.SetSourceBit(0, MCProng::kPhysicalPrimary);
     prongPhoton.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Photon and electron pair from Chic0, Chic1 and Chic2", {pronge, pronge, prongPhoton}, {2, 2, 1});
+    MCSignal* signal = new MCSignal(name, "Photon and electron pair from Chic0, Chic1 and Chic2", {pronge, pronge, prongPhoton}, {2, 2, 1});
     return signal;
-  }
+  });
 
-  if (!nameStr.compare("eePhotonFromPi0")) {
+  factories.emplace("eePhotonFromPi0", [](const char* name) {
     MCProng pronge(2, {11, 111}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     MCProng prongPhoton(2, {22, 111}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     pronge.SetSourceBit(0, MCProng::kPhysicalPrimary);
     prongPhoton.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Photon and electron pair from Pi0", {pronge, pronge, prongPhoton}, {1, 1, 1});
+    MCSignal* signal = new MCSignal(name, "Photon and electron pair from Pi0", {pronge, pronge, prongPhoton}, {1, 1, 1});
     return signal;
-  }
+  });
 
   //--------------------------------------------------------------------------------
 
-  if (!nameStr.compare("X3872")) {
+  factories.emplace("X3872", [](const char* name) {
     MCProng prong(1, {9920443}, {true}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "Inclusive X(3872)", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Inclusive X(3872)", {prong}, {-1});
     return signal;
-  }
+  });
 
-  if (!nameStr.compare("JpsiFromX3872")) {
+  factories.emplace("JpsiFromX3872", [](const char* name) {
     MCProng prong(1, {443}, {true}, {false}, {0}, {0}, {false}, false, {9920443}, {false});
-    signal = new MCSignal(name, "Jpsi from X3872", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Jpsi from X3872", {prong}, {-1});
     return signal;
-  }
+  });
 
-  if (!nameStr.compare("eFromX3872")) {
+  factories.emplace("eFromX3872", [](const char* name) {
     MCProng prong(3, {11, 443, 9920443}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
-    signal = new MCSignal(name, "Electron from Jpsi from X3872", {prong}, {1});
+    MCSignal* signal = new MCSignal(name, "Electron from Jpsi from X3872", {prong}, {1});
     return signal;
-  }
+  });
 
-  if (!nameStr.compare("PionFromX3872")) {
+  factories.emplace("PionFromX3872", [](const char* name) {
     MCProng prong(1, {211}, {true}, {false}, {0}, {0}, {false}, false, {9920443}, {false});
-    signal = new MCSignal(name, "Pion from Jpsi from X3872", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Pion from Jpsi from X3872", {prong}, {-1});
     return signal;
-  }
+  });
 
-  if (!nameStr.compare("JpsiFromPsi2S")) {
+  factories.emplace("JpsiFromPsi2S", [](const char* name) {
     MCProng prong(1, {443}, {true}, {false}, {0}, {0}, {false}, false, {100443}, {false});
-    signal = new MCSignal(name, "Jpsi from Psi2S", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Jpsi from Psi2S", {prong}, {-1});
     return signal;
-  }
+  });
 
-  if (!nameStr.compare("JpsiFromPromptPsi2S")) {
+  factories.emplace("JpsiFromPromptPsi2S", [](const char* name) {
     MCProng prong(2, {443, 100443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {503}, {true});
-    signal = new MCSignal(name, "Jpsi from prompt Psi2S", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Jpsi from prompt Psi2S", {prong}, {-1});
     return signal;
-  }
+  });
 
-  if (!nameStr.compare("JpsiFromNonpromptPsi2S")) {
+  factories.emplace("JpsiFromNonpromptPsi2S", [](const char* name) {
     MCProng prong(2, {443, 100443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {503}, {false});
-    signal = new MCSignal(name, "Jpsi from non-prompt Psi2S", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Jpsi from non-prompt Psi2S", {prong}, {-1});
     return signal;
-  }
+  });
 
-  if (!nameStr.compare("eFromJpsiFromPsi2S")) {
+  factories.emplace("eFromJpsiFromPsi2S", [](const char* name) {
     MCProng prong(3, {11, 443, 100443}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
-    signal = new MCSignal(name, "Electron from Jpsi from Psi2S", {prong}, {1});
+    MCSignal* signal = new MCSignal(name, "Electron from Jpsi from Psi2S", {prong}, {1});
     return signal;
-  }
+  });
 
-  if (!nameStr.compare("eFromJpsiFromPromptPsi2S")) {
+  factories.emplace("eFromJpsiFromPromptPsi2S", [](const char* name) {
     MCProng prong(3, {11, 443, 100443}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false}, false, {503}, {true});
-    signal = new MCSignal(name, "Electron from Jpsi from prompt Psi2S", {prong}, {1});
+    MCSignal* signal = new MCSignal(name, "Electron from Jpsi from prompt Psi2S", {prong}, {1});
     return signal;
-  }
+  });
 
-  if (!nameStr.compare("eFromJpsiFromNonpromptPsi2S")) {
+  factories.emplace("eFromJpsiFromNonpromptPsi2S", [](const char* name) {
     MCProng prong(3, {11, 443, 100443}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false}, false, {503}, {false});
-    signal = new MCSignal(name, "Electron from Jpsi from non-prompt Psi2S", {prong}, {1});
+    MCSignal* signal = new MCSignal(name, "Electron from Jpsi from non-prompt Psi2S", {prong}, {1});
     return signal;
-  }
+  });
 
-  if (!nameStr.compare("PionFromPsi2S")) {
+  factories.emplace("PionFromPsi2S", [](const char* name) {
     MCProng prong(1, {211}, {true}, {false}, {0}, {0}, {false}, false, {100443}, {false});
-    signal = new MCSignal(name, "Pion from Jpsi from Psi2S", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Pion from Jpsi from Psi2S", {prong}, {-1});
     return signal;
-  }
+  });
 
-  if (!nameStr.compare("PionFromPromptPsi2S")) {
+  factories.emplace("PionFromPromptPsi2S", [](const char* name) {
     MCProng prong(2, {211, 100443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {503}, {true});
-    signal = new MCSignal(name, "Pion from prompt Psi2S", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Pion from prompt Psi2S", {prong}, {-1});
     return signal;
-  }
+  });
 
-  if (!nameStr.compare("PionFromNonpromptPsi2S")) {
+  factories.emplace("PionFromNonpromptPsi2S", [](const char* name) {
     MCProng prong(2, {211, 100443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {503}, {false});
-    signal = new MCSignal(name, "Pion from non-prompt Psi2S", {prong}, {-1});
+    MCSignal* signal = new MCSignal(name, "Pion from non-prompt Psi2S", {prong}, {-1});
     return signal;
-  }
+  });
 
-  if (!nameStr.compare("eeFromJpsiFromX3872")) {
+  factories.emplace("eeFromJpsiFromX3872", [](const char* name) {
     MCProng prong(2, {11, 443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {9920443}, {false});
-    signal = new MCSignal(name, "Electron pair from Jpsi from X3872", {prong, prong}, {1, 1});
+    MCSignal* signal = new MCSignal(name, "Electron pair from Jpsi from X3872", {prong, prong}, {1, 1});
     return signal;
-  }
+  });
 
-  if (!nameStr.compare("JpsiPiPiFromX3872")) {
+  factories.emplace("JpsiPiPiFromX3872", [](const char* name) {
     MCProng prongJpsi(2, {443, 9920443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     MCProng prongPi(2, {211, 9920443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Jpsi and pion pair from X3872", {prongJpsi, prongPi, prongPi}, {1, 1, 1});
+    MCSignal* signal = new MCSignal(name, "Jpsi and pion pair from X3872", {prongJpsi, prongPi, prongPi}, {1, 1, 1});
     return signal;
-  }
+  });
 
-  if (!nameStr.compare("eePiPiFromX3872")) {
+  factories.emplace("eePiPiFromX3872", [](const char* name) {
     MCProng pronge(3, {11, 443, 9920443}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     MCProng prongPi(2, {211, 9920443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Electron pair and pion pair from X3872", {pronge, pronge, prongPi, prongPi}, {2, 2, 1, 1});
+    MCSignal* signal = new MCSignal(name, "Electron pair and pion pair from X3872", {pronge, pronge, prongPi, prongPi}, {2, 2, 1, 1});
     return signal;
-  }
+  });
 
-  if (!nameStr.compare("eeFromJpsiFromPsi2S")) {
+  factories.emplace("eeFromJpsiFromPsi2S", [](const char* name) {
     MCProng prong(2, {11, 443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {100443}, {false});
-    signal = new MCSignal(name, "Electron pair from Jpsi from Psi2S", {prong, prong}, {1, 1});
+    MCSignal* signal = new MCSignal(name, "Electron pair from Jpsi from Psi2S", {prong, prong}, {1, 1});
     return signal;
-  }
+  });
 
-  if (!nameStr.compare("eeFromJpsiFromPromptPsi2S")) {
+  factories.emplace("eeFromJpsiFromPromptPsi2S", [](const char* name) {
     MCProng prong(3, {11, 443, 100443}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false}, false, {503}, {true});
-    signal = new MCSignal(name, "Electron pair from Jpsi from prompt Psi2S", {prong, prong}, {1, 1});
+    MCSignal* signal = new MCSignal(name, "Electron pair from Jpsi from prompt Psi2S", {prong, prong}, {1, 1});
     return signal;
-  }
+  });
 
-  if (!nameStr.compare("eeFromJpsiFromNonpromptPsi2S")) {
+  factories.emplace("eeFromJpsiFromNonpromptPsi2S", [](const char* name) {
     MCProng prong(3, {11, 443, 100443}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false}, false, {503}, {false});
-    signal = new MCSignal(name, "Electron pair from Jpsi from non-prompt Psi2S", {prong, prong}, {1, 1});
+    MCSignal* signal = new MCSignal(name, "Electron pair from Jpsi from non-prompt Psi2S", {prong, prong}, {1, 1});
     return signal;
-  }
+  });
 
-  if (!nameStr.compare("JpsiPiPiFromPsi2S")) {
+  factories.emplace("JpsiPiPiFromPsi2S", [](const char* name) {
     MCProng prongJpsi(2, {443, 100443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     MCProng prongPi(2, {211, 100443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Jpsi and pion pair from Psi2S", {prongJpsi, prongPi, prongPi}, {1, 1, 1});
+    MCSignal* signal = new MCSignal(name, "Jpsi and pion pair from Psi2S", {prongJpsi, prongPi, prongPi}, {1, 1, 1});
     return signal;
-  }
+  });
 
-  if (!nameStr.compare("eePiPiFromPsi2S")) {
+  factories.emplace("eePiPiFromPsi2S", [](const char* name) {
     MCProng pronge(3, {11, 443, 100443}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     MCProng prongPi(2, {211, 100443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Electron pair and pion pair from Psi2S", {pronge, pronge, prongPi, prongPi}, {2, 2, 1, 1});
+    MCSignal* signal = new MCSignal(name, "Electron pair and pion pair from Psi2S", {pronge, pronge, prongPi, prongPi}, {2, 2, 1, 1});
     return signal;
-  }
+  });
 
-  if (!nameStr.compare("eePiPiFromPromptPsi2S")) {
+  factories.emplace("eePiPiFromPromptPsi2S", [](const char* name) {
     MCProng pronge(3, {11, 443, 100443}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false}, false, {503}, {true});
     MCProng prongPi(2, {211, 100443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {503}, {true});
-    signal = new MCSignal(name, "Electron pair and pion pair from prompt Psi2S", {pronge, pronge, prongPi, prongPi}, {2, 2, 1, 1});
+    MCSignal* signal = new MCSignal(name, "Electron pair and pion pair from prompt Psi2S", {pronge, pronge, prongPi, prongPi}, {2, 2, 1, 1});
     return signal;
-  }
+  });
 
-  if (!nameStr.compare("eePiPiFromNonpromptPsi2S")) {
+  factories.emplace("eePiPiFromNonpromptPsi2S", [](const char* name) {
     MCProng pronge(3, {11, 443, 100443}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false}, false, {503}, {false});
     MCProng prongPi(2, {211, 100443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {503}, {false});
-    signal = new MCSignal(name, "Electron pair and pion pair from non-prompt Psi2S", {pronge, pronge, prongPi, prongPi}, {2, 2, 1, 1});
+    MCSignal* signal = new MCSignal(name, "Electron pair and pion pair from non-prompt Psi2S", {pronge, pronge, prongPi, prongPi}, {2, 2, 1, 1});
     return signal;
-  }
+  });
 
-  if (!nameStr.compare("eeFromPromptJpsiAnyPrimary")) {
+  factories.emplace("eeFromPromptJpsiAnyPrimary", [](const char* name) {
     MCProng pronge(2, {11, 443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {503}, {true});
     pronge.SetSourceBit(0, MCProng::kPhysicalPrimary);
     MCProng prongPrimary(1);
     prongPrimary.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "anyprimary and electron pair from prompt jpsi", {pronge, pronge, prongPrimary}, {1, 1, -1});
+    MCSignal* signal = new MCSignal(name, "anyprimary and electron pair from prompt jpsi", {pronge, pronge, prongPrimary}, {1, 1, -1});
     return signal;
-  }
+  });
 
-  if (!nameStr.compare("eeFromJpsiAnyPrimary")) {
+  factories.emplace("eeFromJpsiAnyPrimary", [](const char* name) {
     MCProng pronge(2, {11, 443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     pronge.SetSourceBit(0, MCProng::kPhysicalPrimary);
     MCProng prongPrimary(1);
     prongPrimary.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "anyprimary and electron pair from prompt jpsi", {pronge, pronge, prongPrimary}, {1, 1, -1});
+    MCSignal* signal = new MCSignal(name, "anyprimary and electron pair from prompt jpsi", {pronge, pronge, prongPrimary}, {1, 1, -1});
     return signal;
-  }
+  });
 
-  if (!nameStr.compare("eeFromNonPromptJpsiAnyPrimary")) {
+  factories.emplace("eeFromNonPromptJpsiAnyPrimary", [](const char* name) {
     MCProng pronge(3, {11, 443, 503}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     pronge.SetSourceBit(0, MCProng::kPhysicalPrimary);
     MCProng prongPrimary(1);
     prongPrimary.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "anyprimary and electron pair from non-prompt jpsi", {pronge, pronge, prongPrimary}, {1, 1, -1});
+    MCSignal* signal = new MCSignal(name, "anyprimary and electron pair from non-prompt jpsi", {pronge, pronge, prongPrimary}, {1, 1, -1});
     return signal;
-  }
-  return nullptr;
+  });
 }
 
 //_______________________________________________________________________________________________
@@ -16,6 +16,7 @@
 #define PWGDQ_CORE_MCSIGNALLIBRARY_H_
 
 #include <string>
+#include <vector>
 #include "rapidjson/document.h"
 #include "PWGDQ/Core/MCProng.h"
 #include "PWGDQ/Core/MCSignal.h"
@@ -25,6 +26,7 @@ namespace o2::aod
 namespace dqmcsignals
 {
 MCSignal* GetMCSignal(const char* signalName);
+std::vector<std::string> GetMCSignalNames();
 
 std::vector<MCSignal*> GetMCSignalsFromJSON(const char* json);
 
@@ -62,6 +62,7 @@ void MixingHandler::AddMixingVariable(int var, int nBins, float* binLims)
   TArrayF varBins;
   varBins.Set(nBins, binLims);
   fVariableLimits.push_back(varBins);
+  fBinning = eventmixing::MixingBinning();
   VarManager::SetUseVariable(var);
 }
 
@@ -111,14 +112,22 @@ void MixingHandler::Init()
   // Initialization of pools
   //       The correct event category will be retrieved using the function FindEventCategory()
   //
-  int size = 1;
-  for (auto v : fVariableLimits) {
-    size *= (v.GetSize() - 1);
-  }
-  (void)size;
+  BuildBinning();
   fIsInitialized = kTRUE;
 }
 
+//_________________________________________________________________________
+void MixingHandler::BuildBinning() const
+{
+  //
+  // Build the category lookup from the bin limits, which are the only persistent description of the binning
+  //
+  fBinning = eventmixing::MixingBinning();
+  for (const auto& limits : fVariableLimits) {
+    fBinning.addAxis(std::vector<float>(limits.GetArray(), limits.GetArray() + limits.GetSize()));
+  }
+}
+
 //_________________________________________________________________________
 int MixingHandler::FindEventCategory(float* values)
 {
@@ -128,37 +137,11 @@ int MixingHandler::FindEventCategory(float* values)
   if (fVariables.size() == 0) {
     return -1;
   }
-  if (!fIsInitialized) {
+  if (!fIsInitialized || fBinning.getNAxes() != static_cast<int>(fVariables.size())) {
     Init();
   }
 
-  std::vector<int> bin;
-  int iVar = 0;
-  for (auto v = fVariableLimits.begin(); v != fVariableLimits.end(); v++, iVar++) {
-    int binValue = TMath::BinarySearch((*v).GetSize(), (*v).GetArray(), values[fVariables[iVar]]);
-    bin.push_back(binValue);
-    if (bin[iVar] == -1 || bin[iVar] == (*v).GetSize() - 1) {
-      return -1; // all variables must be inside limits
-    }
-  }
-
-  int category = 0;
-  int tempCategory = 1;
-  int iv1 = 0;
-  int iv2 = 0;
-  for (auto v1 = fVariables.begin(); v1 != fVariables.end(); v1++, iv1++) {
-    tempCategory = 1;
-    iv2 = iv1;
-    for (auto v2 = v1; v2 != fVariables.end(); v2++, iv2++) {
-      if (iv2 == iv1) {
-        tempCategory *= bin[iv2];
-      } else {
-        tempCategory *= (fVariableLimits[iv2].GetSize() - 1);
-      }
-    }
-    category += tempCategory;
-  }
-  return category;
+  return fBinning.getCategory(values, fVariables.data()); // -1 unless all variables are inside limits
 }
 
 //_________________________________________________________________________
@@ -179,12 +162,14 @@ int MixingHandler::GetBinFromCategory(VarManager::Variables var, int category) c
     }
   }
 
-  // extract the bin position in variable "var" from the category
-  int norm = 1;
-  for (int i = fVariables.size() - 1; i > tempVar; --i) {
-    norm *= (fVariableLimits[i].GetSize() - 1);
+  if (tempVar == static_cast<int>(fVariables.size())) {
+    return -1;
+  }
+
+  if (fBinning.getNAxes() != static_cast<int>(fVariables.size())) {
+    BuildBinning();
   }
-  int truncatedCategory = category - (category % norm);
-  truncatedCategory /= norm;
-  return truncatedCategory % (fVariableLimits[tempVar].GetSize() - 1);
+
+  // extract the bin position in variable "var" from the category
+  return fBinning.getAxisBin(tempVar, category);
 }
@@ -24,6 +24,7 @@
 #include <TList.h>
 #include <TString.h>
 
+#include "Common/Core/EventMixing.h"
 #include "PWGDQ/Core/HistogramManager.h"
 #include "PWGDQ/Core/VarManager.h"
 
@@ -52,11 +53,14 @@ class MixingHandler : public TNamed
   MixingHandler(const MixingHandler& handler);
   MixingHandler& operator=(const MixingHandler& handler);
 
+  void BuildBinning() const;
+
   // User options
   bool fIsInitialized; // check if the mixing handler is initialized
 
   std::vector<TArrayF> fVariableLimits;
   std::vector<int> fVariables;
+  mutable eventmixing::MixingBinning fBinning; //! lookup of the event category, rebuilt from fVariableLimits
 
   ClassDef(MixingHandler, 1);
 };
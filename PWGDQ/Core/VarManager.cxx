@@ -216,10 +216,14 @@ float VarManager::calculateCosPA(KFParticle kfp, KFParticle PV)
 }
 
 //__________________________________________________________________
-double VarManager::ComputePIDcalibration(int species, double nSigmaValue)
+double VarManager::ComputePIDcalibration(int species, double nSigmaValue, float* values)
 {
   // species: 0 - electron, 1 - pion, 2 - kaon, 3 - proton
+  // values: array holding the track and event variables the calibration depends on (fgValues by default)
   // Depending on the PID calibration type, we use different types of calibration histograms
+  if (!values) {
+    values = fgValues;
+  }
 
   if (fgCalibrationType == 1) {
     // get the calibration histograms
@@ -254,13 +258,13 @@ double VarManager::ComputePIDcalibration(int species, double nSigmaValue)
     }
 
     // Get the bin indices for the calibration histograms
-    int binTPCncls = calibMeanHist->GetXaxis()->FindBin(fgValues[kTPCncls]);
+    int binTPCncls = calibMeanHist->GetXaxis()->FindBin(values[kTPCncls]);
     binTPCncls = (binTPCncls == 0 ? 1 : binTPCncls);
     binTPCncls = (binTPCncls > calibMeanHist->GetXaxis()->GetNbins() ? calibMeanHist->GetXaxis()->GetNbins() : binTPCncls);
-    int binPin = calibMeanHist->GetYaxis()->FindBin(fgValues[kPin]);
+    int binPin = calibMeanHist->GetYaxis()->FindBin(values[kPin]);
     binPin = (binPin == 0 ? 1 : binPin);
     binPin = (binPin > calibMeanHist->GetYaxis()->GetNbins() ? calibMeanHist->GetYaxis()->GetNbins() : binPin);
-    int binEta = calibMeanHist->GetZaxis()->FindBin(fgValues[kEta]);
+    int binEta = calibMeanHist->GetZaxis()->FindBin(values[kEta]);
     binEta = (binEta == 0 ? 1 : binEta);
     binEta = (binEta > calibMeanHist->GetZaxis()->GetNbins() ? calibMeanHist->GetZaxis()->GetNbins() : binEta);
 
@@ -305,16 +309,16 @@ double VarManager::ComputePIDcalibration(int species, double nSigmaValue)
     }
 
     // Get the bin indices for the calibration histograms
-    int binEta = calibMeanHist->GetAxis(0)->FindBin(fgValues[kEta]);
+    int binEta = calibMeanHist->GetAxis(0)->FindBin(values[kEta]);
     binEta = (binEta == 0 ? 1 : binEta);
     binEta = (binEta > calibMeanHist->GetAxis(0)->GetNbins() ? calibMeanHist->GetAxis(0)->GetNbins() : binEta);
-    int binNpv = calibMeanHist->GetAxis(1)->FindBin(fgValues[kVtxNcontribReal]);
+    int binNpv = calibMeanHist->GetAxis(1)->FindBin(values[kVtxNcontribReal]);
     binNpv = (binNpv == 0 ? 1 : binNpv);
     binNpv = (binNpv > calibMeanHist->GetAxis(1)->GetNbins() ? calibMeanHist->GetAxis(1)->GetNbins() : binNpv);
-    int binNlong = calibMeanHist->GetAxis(2)->FindBin(fgValues[kNTPCcontribLongA]);
+    int binNlong = calibMeanHist->GetAxis(2)->FindBin(values[kNTPCcontribLongA]);
     binNlong = (binNlong == 0 ? 1 : binNlong);
     binNlong = (binNlong > calibMeanHist->GetAxis(2)->GetNbins() ? calibMeanHist->GetAxis(2)->GetNbins() : binNlong);
-    int binTlong = calibMeanHist->GetAxis(3)->FindBin(fgValues[kNTPCmedianTimeLongA]);
+    int binTlong = calibMeanHist->GetAxis(3)->FindBin(values[kNTPCmedianTimeLongA]);
     binTlong = (binTlong == 0 ? 1 : binTlong);
     binTlong = (binTlong > calibMeanHist->GetAxis(3)->GetNbins() ? calibMeanHist->GetAxis(3)->GetNbins() : binTlong);
 
@@ -1277,7 +1277,7 @@ class VarManager : public TObject
     fgCalibrationType = type;
     fgUseInterpolatedCalibration = useInterpolation;
   }
-  static double ComputePIDcalibration(int species, double nSigmaValue);
+  static double ComputePIDcalibration(int species, double nSigmaValue, float* values = nullptr);
 
   static TObject* GetCalibrationObject(CalibObjects calib)
   {
@@ -1366,6 +1366,96 @@ class VarManager : public TObject
   ClassDef(VarManager, 4);
 };
 
+//__________________________________________________________________
+// Container for the values computed by the VarManager, owned by the caller and to be used instead of VarManager::fgValues
+//  The values keep the full kNVars layout, since Fill* functions, cuts and histograms index them by the Variables enum.
+//  The used variables (from the VarManager flags) are compacted such that only these are reset,
+//  and the values of several candidates can be gathered into a structure-of-arrays block (see AnalysisCut::IsSelectedBatch).
+//  Usage: VarManager::FillTrack<gkTrackFillMap>(track, ctx.GetValues()); cut.IsSelected(ctx.GetValues()); hm->FillHistClass(idx, ctx.GetValues());
+//  NOTE: the calibration objects, the fitters and the other configuration are still VarManager statics,
+//        so separate contexts do not make the Fill* functions safe to run concurrently
+class VarContext
+{
+ public:
+  VarContext() : fValues(VarManager::kNVars, -9999.f), fColumns(VarManager::kNVars, nullptr) {}
+
+  // Compact the list of used variables and clear the block
+  //  This is done on the first Reset() or PushToBlock(), and has to be called again if the used variables change afterwards
+  void UpdateUsedVars()
+  {
+    fUsedVars.clear();
+    for (int var = 0; var < VarManager::kNVars; ++var) {
+      if (VarManager::GetUsedVar(var)) {
+        fUsedVars.push_back(var);
+      }
+    }
+    fColumns.assign(VarManager::kNVars, nullptr);
+    fBlock.clear();
+    fBlockSize = 0;
+    fBlockCapacity = 0;
+    fUsedVarsUpdated = true;
+  }
+  const std::vector<int>& GetUsedVars() const { return fUsedVars; }
+
+  float* GetValues() { return fValues.data(); }
+  float& operator[](int var) { return fValues[var]; }
+
+  // Reset the used variables to the same neutral value as VarManager::ResetValues()
+  void Reset()
+  {
+    if (!fUsedVarsUpdated) {
+      UpdateUsedVars();
+    }
+    for (auto var : fUsedVars) {
+      fValues[var] = -9999.f;
+    }
+  }
+
+  // Append the current values of the used variables as a new row of the structure-of-arrays block
+  // \return index of the row in the block
+  int PushToBlock()
+  {
+    if (!fUsedVarsUpdated) {
+      UpdateUsedVars();
+    }
+    const int nUsed = fUsedVars.size();
+    if (fBlockSize == fBlockCapacity) {
+      Reserve(fBlockCapacity > 0 ? 2 * fBlockCapacity : 64);
+    }
+    for (int i = 0; i < nUsed; ++i) {
+      fBlock[i * fBlockCapacity + fBlockSize] = fValues[fUsedVars[i]];
+    }
+    return fBlockSize++;
+  }
+  void ClearBlock() { fBlockSize = 0; }
+  int GetBlockSize() const { return fBlockSize; }
+  // Columns of the block indexed by variable (nullptr for unused variables), valid until the next PushToBlock()
+  float* const* GetBlockColumns() { return fColumns.data(); }
+
+ private:
+  void Reserve(int capacity)
+  {
+    const int nUsed = fUsedVars.size();
+    std::vector<float> block(nUsed * capacity);
+    for (int i = 0; i < nUsed; ++i) {
+      std::copy(fBlock.begin() + i * fBlockCapacity, fBlock.begin() + i * fBlockCapacity + fBlockSize, block.begin() + i * capacity);
+    }
+    fBlock.swap(block);
+    fBlockCapacity = capacity;
+    for (int i = 0; i < nUsed; ++i) {
+      fColumns[fUsedVars[i]] = fBlock.data() + i * fBlockCapacity;
+    }
+  }
+
+  std::vector<float> fValues;    // values of all variables, indexed as in VarManager::Variables
+  std::vector<int> fUsedVars;    // compacted indices of the used variables
+  std::vector<float> fBlock;     // structure-of-arrays block, one column of fBlockCapacity values per used variable
+  std::vector<float*> fColumns;  // pointers to the columns of the block, indexed by variable
+  int fBlockSize = 0;            // number of rows in the block
+  int fBlockCapacity = 0;        // number of allocated rows in the block
+  bool fUsedVarsUpdated = false; // true once the used variables are compacted
+};
+
 template <typename T, typename C>
 o2::track::TrackParCovFwd VarManager::FwdToTrackPar(const T& track, const C& cov)
 {
@@ -2600,7 +2690,7 @@ void VarManager::FillTrack(T const& track, float* values)
     // compute TPC postcalibrated electron nsigma based on calibration histograms from CCDB
     if (fgUsedVars[kTPCnSigmaEl_Corr] && fgRunTPCPostCalibration[0]) {
       if (!isTPCCalibrated) {
-        values[kTPCnSigmaEl_Corr] = ComputePIDcalibration(0, values[kTPCnSigmaEl]);
+        values[kTPCnSigmaEl_Corr] = ComputePIDcalibration(0, values[kTPCnSigmaEl], values);
       } else {
         LOG(fatal) << "TPC PID postcalibration is configured but the tracks are already postcalibrated. This is not allowed. Please check your configuration.";
         values[kTPCnSigmaEl_Corr] = track.tpcNSigmaEl();
@@ -2610,7 +2700,7 @@ void VarManager::FillTrack(T const& track, float* values)
     // compute TPC postcalibrated pion nsigma if required
     if (fgUsedVars[kTPCnSigmaPi_Corr] && fgRunTPCPostCalibration[1]) {
       if (!isTPCCalibrated) {
-        values[kTPCnSigmaPi_Corr] = ComputePIDcalibration(1, values[kTPCnSigmaPi]);
+        values[kTPCnSigmaPi_Corr] = ComputePIDcalibration(1, values[kTPCnSigmaPi], values);
       } else {
         LOG(fatal) << "TPC PID postcalibration is configured but the tracks are already postcalibrated. This is not allowed. Please check your configuration.";
         values[kTPCnSigmaPi_Corr] = track.tpcNSigmaPi();
@@ -2619,7 +2709,7 @@ void VarManager::FillTrack(T const& track, float* values)
     if (fgUsedVars[kTPCnSigmaKa_Corr] && fgRunTPCPostCalibration[2]) {
       // compute TPC postcalibrated kaon nsigma if required
       if (!isTPCCalibrated) {
-        values[kTPCnSigmaKa_Corr] = ComputePIDcalibration(2, values[kTPCnSigmaKa]);
+        values[kTPCnSigmaKa_Corr] = ComputePIDcalibration(2, values[kTPCnSigmaKa], values);
       } else {
         LOG(fatal) << "TPC PID postcalibration is configured but the tracks are already postcalibrated. This is not allowed. Please check your configuration.";
         values[kTPCnSigmaKa_Corr] = track.tpcNSigmaKa();
@@ -2628,7 +2718,7 @@ void VarManager::FillTrack(T const& track, float* values)
     // compute TPC postcalibrated proton nsigma if required
     if (fgUsedVars[kTPCnSigmaPr_Corr] && fgRunTPCPostCalibration[3]) {
       if (!isTPCCalibrated) {
-        values[kTPCnSigmaPr_Corr] = ComputePIDcalibration(3, values[kTPCnSigmaPr]);
+        values[kTPCnSigmaPr_Corr] = ComputePIDcalibration(3, values[kTPCnSigmaPr], values);
       } else {
         LOG(fatal) << "TPC PID postcalibration is configured but the tracks are already postcalibrated. This is not allowed. Please check your configuration.";
         values[kTPCnSigmaPr_Corr] = track.tpcNSigmaPr();
@@ -5126,23 +5216,23 @@ void VarManager::FillPairVn(T1 const& t1, T2 const& t2, float* values)
   values[kV2EP] = std::isnan(V2EP) || std::isinf(V2EP) ? 0. : V2EP;
   values[kWV2EP] = std::isnan(V2EP) || std::isinf(V2EP) ? 0. : 1.0;
 
-  if (std::isnan(VarManager::fgValues[VarManager::kU2Q2]) == true) {
+  if (std::isnan(values[kU2Q2]) == true) {
     values[kU2Q2] = -999.;
     values[kR2SP_AB] = -999.;
     values[kR2SP_AC] = -999.;
     values[kR2SP_BC] = -999.;
   }
-  if (std::isnan(VarManager::fgValues[VarManager::kU3Q3]) == true) {
+  if (std::isnan(values[kU3Q3]) == true) {
     values[kU3Q3] = -999.;
     values[kR3SP] = -999.;
   }
-  if (std::isnan(VarManager::fgValues[VarManager::kCos2DeltaPhi]) == true) {
+  if (std::isnan(values[kCos2DeltaPhi]) == true) {
     values[kCos2DeltaPhi] = -999.;
     values[kR2EP_AB] = -999.;
     values[kR2EP_AC] = -999.;
     values[kR2EP_BC] = -999.;
   }
-  if (std::isnan(VarManager::fgValues[VarManager::kCos3DeltaPhi]) == true) {
+  if (std::isnan(values[kCos3DeltaPhi]) == true) {
     values[kCos3DeltaPhi] = -999.;
     values[kR3EP] = -999.;
   }
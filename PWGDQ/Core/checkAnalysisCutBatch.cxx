@@ -0,0 +1,138 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// \file   checkAnalysisCutBatch.cxx
+/// \brief  exec to check that AnalysisCut::FillFilterMaps and IsSelectedBatch give the same decisions as IsSelected per candidate
+///         arguments: [nCandidates]
+///         the cuts cover constant and function-dependent limits, exclusion ranges, dependent variables and composite AND / OR cuts
+///
+
+#include "PWGDQ/Core/AnalysisCompositeCut.h"
+#include "PWGDQ/Core/AnalysisCut.h"
+#include "PWGDQ/Core/VarManager.h"
+
+#include <Framework/Logger.h>
+
+#include <TF1.h>
+#include <TRandom.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+int main(int argc, char* argv[])
+{
+  const int nCandidates = argc > 1 ? std::atoi(argv[1]) : 10000;
+
+  // cut with constant limits and an exclusion range
+  AnalysisCut kine("kine", "kine");
+  kine.AddCut(VarManager::kPt, 1.0, 5.0);
+  kine.AddCut(VarManager::kEta, -0.2, 0.2, true);
+
+  // cut applied only if the dependent variables are inside / outside the requested ranges
+  AnalysisCut pidEl("pidEl", "pidEl");
+  pidEl.AddCut(VarManager::kTPCnSigmaEl, -3.0, 3.0, false, VarManager::kPin, 2.0, 4.0, true);
+  pidEl.AddCut(VarManager::kTPCncls, 70.0, 160.0, false, VarManager::kPin, 0.5, 10.0, false, VarManager::kEta, -0.5, 0.5, false);
+
+  // cut with limits given by functions of the dependent variable
+  TF1* funcLow = new TF1("funcLow", "[0]+[1]*x", 0.0, 10.0);
+  funcLow->SetParameters(-2.0, 0.5);
+  TF1* funcHigh = new TF1("funcHigh", "[0]+[1]*x*x", 0.0, 10.0);
+  funcHigh->SetParameters(2.0, 0.25);
+  AnalysisCut pidPr("pidPr", "pidPr");
+  pidPr.AddCut(VarManager::kTPCnSigmaPr, funcLow, funcHigh, false, VarManager::kPin, 0.0, 10.0);
+  pidPr.AddCut(VarManager::kTPCnSigmaPr, funcLow, 1.0, true, VarManager::kPin, 1.0, 3.0);
+
+  AnalysisCompositeCut pidOR("pidOR", "pidOR", false);
+  pidOR.AddCut(&pidEl);
+  pidOR.AddCut(&pidPr);
+
+  AnalysisCompositeCut kineAndPid("kineAndPid", "kineAndPid", true);
+  kineAndPid.AddCut(&kine);
+  kineAndPid.AddCut(&pidOR);
+
+  AnalysisCompositeCut kineOrPid("kineOrPid", "kineOrPid", false);
+  kineOrPid.AddCut(&kine);
+  kineOrPid.AddCut(&pidPr);
+  kineOrPid.AddCut(&kineAndPid);
+
+  std::vector<AnalysisCut> simpleCuts = {kine, pidEl, pidPr};
+  std::vector<AnalysisCompositeCut> compositeCuts = {pidOR, kineAndPid, kineOrPid};
+
+  // values are drawn on a grid that contains the cut limits, such that the boundaries are hit exactly
+  std::vector<int> usedVars = AnalysisCut::fgUsedVars;
+  std::sort(usedVars.begin(), usedVars.end());
+  usedVars.erase(std::unique(usedVars.begin(), usedVars.end()), usedVars.end());
+  std::vector<std::vector<float>> columns(VarManager::kNVars);
+  std::vector<float*> values(VarManager::kNVars, nullptr);
+  for (const auto var : usedVars) {
+    columns[var].resize(nCandidates);
+    for (auto& value : columns[var]) {
+      value = 0.25f * gRandom->Integer(var == VarManager::kTPCncls ? 800 : 60) - (var == VarManager::kTPCncls ? 0.f : 5.f);
+    }
+    values[var] = columns[var].data();
+  }
+
+  std::vector<uint32_t> filterMapsSimple(nCandidates, 0);
+  std::vector<uint32_t> filterMapsComposite(nCandidates, 0);
+  AnalysisCut::FillFilterMaps(simpleCuts, values.data(), nCandidates, filterMapsSimple.data());
+  AnalysisCut::FillFilterMaps(compositeCuts, values.data(), nCandidates, filterMapsComposite.data());
+
+  int nDifferent = 0;
+  std::vector<uint32_t> nSelected(simpleCuts.size() + compositeCuts.size(), 0);
+  std::vector<float> row(VarManager::kNVars, 0.f);
+  for (int iCand = 0; iCand < nCandidates; iCand++) {
+    for (const auto var : usedVars) {
+      row[var] = columns[var][iCand];
+    }
+    uint32_t filterMapSimple = 0;
+    for (std::size_t icut = 0; icut < simpleCuts.size(); icut++) {
+      if (simpleCuts[icut].IsSelected(row.data())) {
+        filterMapSimple |= (static_cast<uint32_t>(1) << icut);
+        nSelected[icut]++;
+      }
+    }
+    uint32_t filterMapComposite = 0;
+    for (std::size_t icut = 0; icut < compositeCuts.size(); icut++) {
+      if (compositeCuts[icut].IsSelected(row.data())) {
+        filterMapComposite |= (static_cast<uint32_t>(1) << icut);
+        nSelected[simpleCuts.size() + icut]++;
+      }
+    }
+    if (filterMapSimple != filterMapsSimple[iCand] || filterMapComposite != filterMapsComposite[iCand]) {
+      nDifferent++;
+    }
+  }
+
+  // candidates already rejected on input must stay rejected
+  std::vector<uint8_t> selected(nCandidates);
+  for (int iCand = 0; iCand < nCandidates; iCand++) {
+    selected[iCand] = iCand % 2;
+  }
+  kineOrPid.IsSelectedBatch(values.data(), nCandidates, selected.data());
+  for (int iCand = 0; iCand < nCandidates; iCand += 2) {
+    if (selected[iCand]) {
+      nDifferent++;
+    }
+  }
+
+  for (std::size_t icut = 0; icut < nSelected.size(); icut++) {
+    LOG(info) << "cut " << icut << ": " << nSelected[icut] << " / " << nCandidates << " candidates selected";
+  }
+  if (nDifferent > 0) {
+    LOG(error) << nDifferent << " candidates with different batch and per-candidate decisions";
+    return 1;
+  }
+  LOG(info) << nCandidates << " candidates: batch and per-candidate decisions are identical";
+  return 0;
+}
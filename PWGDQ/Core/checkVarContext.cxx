@@ -0,0 +1,119 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// \file   checkVarContext.cxx
+/// \brief  exec to check the structure-of-arrays block of VarContext, also after the used variables are updated,
+///         and that cuts evaluated on the block give the same decisions as on the values of each candidate
+///         arguments: [nCandidates]
+///
+
+#include "PWGDQ/Core/AnalysisCut.h"
+#include "PWGDQ/Core/VarManager.h"
+
+#include <Framework/Logger.h>
+
+#include <TRandom.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+namespace
+{
+// fill nCand candidates with random values of the used variables and check the block against them
+int fillAndCheck(VarContext& ctx, AnalysisCut& cut, int nCand)
+{
+  std::vector<std::vector<float>> rows(nCand);
+  std::vector<uint8_t> expected(nCand);
+  ctx.ClearBlock();
+  for (int iCand = 0; iCand < nCand; iCand++) {
+    ctx.Reset();
+    for (const auto var : ctx.GetUsedVars()) {
+      ctx[var] = gRandom->Uniform(-2., 10.);
+      rows[iCand].push_back(ctx[var]);
+    }
+    expected[iCand] = cut.IsSelected(ctx.GetValues());
+    if (ctx.PushToBlock() != iCand) {
+      LOG(error) << "Block row out of order for candidate " << iCand;
+      return 1;
+    }
+  }
+  if (ctx.GetBlockSize() != nCand) {
+    LOG(error) << "Block holds " << ctx.GetBlockSize() << " rows instead of " << nCand;
+    return 1;
+  }
+
+  int nErrors = 0;
+  float* const* columns = ctx.GetBlockColumns();
+  const auto& usedVars = ctx.GetUsedVars();
+  for (int var = 0; var < VarManager::kNVars; var++) {
+    if (!VarManager::GetUsedVar(var) && columns[var] != nullptr) {
+      LOG(error) << "Column set for the unused variable " << var;
+      nErrors++;
+    }
+  }
+  for (std::size_t i = 0; i < usedVars.size(); i++) {
+    if (columns[usedVars[i]] == nullptr) {
+      LOG(error) << "No column for the used variable " << usedVars[i];
+      return 1;
+    }
+    for (int iCand = 0; iCand < nCand; iCand++) {
+      nErrors += (columns[usedVars[i]][iCand] != rows[iCand][i]);
+    }
+  }
+
+  std::vector<uint8_t> selected(nCand, 1);
+  cut.IsSelectedBatch(columns, nCand, selected.data());
+  for (int iCand = 0; iCand < nCand; iCand++) {
+    nErrors += (selected[iCand] != expected[iCand]);
+  }
+  return nErrors;
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+  const int nCandidates = argc > 1 ? std::atoi(argv[1]) : 1000;
+
+  // the context is created before the configuration, as for a task member
+  VarContext ctx;
+
+  AnalysisCut cut("cut", "cut");
+  cut.AddCut(VarManager::kPt, 1.0, 5.0);
+  cut.AddCut(VarManager::kEta, 0.0, 2.0, true, VarManager::kPt, 2.0, 4.0);
+  VarManager::SetUseVars(AnalysisCut::fgUsedVars);
+  VarManager::SetUseVariable(VarManager::kPhi);
+
+  int nErrors = fillAndCheck(ctx, cut, nCandidates);
+
+  // unused variables are not touched by Reset()
+  ctx[VarManager::kP] = 7.f;
+  ctx.Reset();
+  if (ctx[VarManager::kP] != 7.f || ctx[VarManager::kPt] != -9999.f) {
+    LOG(error) << "Reset() changed an unused variable or did not reset a used one";
+    nErrors++;
+  }
+
+  // more variables used after the first fill: the block is rebuilt and filled again
+  cut.AddCut(VarManager::kTPCncls, 3.0, 8.0);
+  VarManager::SetUseVars(AnalysisCut::fgUsedVars);
+  ctx.UpdateUsedVars();
+  nErrors += fillAndCheck(ctx, cut, nCandidates / 3 + 1);
+  nErrors += fillAndCheck(ctx, cut, nCandidates);
+
+  if (nErrors > 0) {
+    LOG(error) << nErrors << " errors in the VarContext block";
+    return 1;
+  }
+  LOG(info) << "VarContext block checked for " << nCandidates << " candidates";
+  return 0;
+}
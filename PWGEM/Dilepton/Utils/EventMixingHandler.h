@@ -15,68 +15,112 @@
 #ifndef PWGEM_DILEPTON_UTILS_EVENTMIXINGHANDLER_H_
 #define PWGEM_DILEPTON_UTILS_EVENTMIXINGHANDLER_H_
 
+#include "Common/Core/EventMixing.h"
+
 #include <map>
+#include <span>
 #include <utility>
 #include <vector>
 
 namespace o2::aod::pwgem::dilepton::utils
 {
+/// Event pool for mixing.
+/// Collisions of each mixing bin are kept in a shared eventmixing::MixingPool of depth ndepth, the tracks of each collision in a buffer
+/// which is recycled (keeping its capacity) when the collision leaves the pool.
+/// The getters return views into the pool, valid until tracks are added to the same collision or the collision is evicted.
 template <typename T, typename U, typename V>
 class EventMixingHandler
 {
  public:
-  EventMixingHandler()
-  {
-    fNdepth = 0;
-    fMapMixBins.clear();
-    fMap_Tracks_per_collision.clear();
-  }
+  EventMixingHandler() = default;
 
-  explicit EventMixingHandler(int ndepth)
-  {
-    fNdepth = ndepth;
-    fMapMixBins.clear();
-    fMap_Tracks_per_collision.clear();
-  }
+  explicit EventMixingHandler(int ndepth) { fPool.init(0, ndepth); }
+
+  ~EventMixingHandler() = default;
 
-  ~EventMixingHandler()
+  /// Change the depth, also of the mixing bins already filled; the oldest collisions which no longer fit are removed
+  void SetNdepth(int ndepth)
   {
-    fMapMixBins.clear();
-    fMap_Tracks_per_collision.clear();
+    fPool.setDepth(ndepth, [this](const U& key_df_collision) { ReleaseTrackBuffer(key_df_collision); });
   }
 
-  void SetNdepth(int ndepth) { fNdepth = ndepth; }
-
   void ReserveNTracksPerCollision(U key_df_collision, int ntrack)
   {
-    fMap_Tracks_per_collision[key_df_collision].reserve(ntrack);
+    fTrackBuffers[GetTrackBuffer(key_df_collision)].reserve(ntrack);
   }
 
   void AddTrackToEventPool(U key_df_collision, V obj)
   {
-    fMap_Tracks_per_collision[key_df_collision].emplace_back(obj);
+    fTrackBuffers[GetTrackBuffer(key_df_collision)].emplace_back(obj);
   }
 
-  std::vector<U> GetCollisionIdsFromEventPool(T key_bin) { return fMapMixBins[key_bin]; }
-  std::vector<V> GetTracksPerCollision(T key_bin, int index) { return fMap_Tracks_per_collision[fMapMixBins[key_bin][index]]; }
-  std::vector<V> GetTracksPerCollision(U key_df_collision) { return fMap_Tracks_per_collision[key_df_collision]; }
+  /// \return collisions in the pool of the mixing bin, from the oldest to the most recent one
+  std::span<const U> GetCollisionIdsFromEventPool(T key_bin) const
+  {
+    auto it = fMapMixBins.find(key_bin);
+    if (it == fMapMixBins.end()) {
+      return {};
+    }
+    return fPool.getEvents(it->second);
+  }
+  std::span<const V> GetTracksPerCollision(T key_bin, int index) const { return GetTracksPerCollision(GetCollisionIdsFromEventPool(key_bin)[index]); }
+  std::span<const V> GetTracksPerCollision(U key_df_collision) const
+  {
+    auto it = fMapTrackBuffer.find(key_df_collision);
+    if (it == fMapTrackBuffer.end()) {
+      return {};
+    }
+    return fTrackBuffers[it->second];
+  }
 
   // call this function at the end of collision loop
   void AddCollisionIdAtLast(T key_bin, U key_df_collision)
   {
-    // LOGF(info, "fMapMixBins[key_bin].size() = %d", fMapMixBins[key_bin].size());
-    if (static_cast<int>(fMapMixBins[key_bin].size()) >= fNdepth) {
-      fMap_Tracks_per_collision[fMapMixBins[key_bin][0]].clear();
-      fMap_Tracks_per_collision[fMapMixBins[key_bin][0]].shrink_to_fit();
-      fMapMixBins[key_bin].erase(fMapMixBins[key_bin].begin());
+    if (fPool.getDepth() < 1) {
+      ReleaseTrackBuffer(key_df_collision);
+      return;
+    }
+    auto [it, inserted] = fMapMixBins.try_emplace(key_bin, 0);
+    if (inserted) {
+      it->second = fPool.addCategory();
+    }
+    if (const U* evicted = fPool.push(it->second, key_df_collision)) {
+      ReleaseTrackBuffer(*evicted);
     }
-    fMapMixBins[key_bin].emplace_back(key_df_collision);
   }
 
  private:
-  int fNdepth;                                           // depth of event mixing
-  std::map<T, std::vector<U>> fMapMixBins;               // map : e.g. <zbin, centbin, epbin> -> pair<df index, global collision index>
-  std::map<U, std::vector<V>> fMap_Tracks_per_collision; // map : e.g. pair<df index, global collision index> -> track array
+  int GetTrackBuffer(U key_df_collision)
+  {
+    auto [it, inserted] = fMapTrackBuffer.try_emplace(key_df_collision, 0);
+    if (inserted) {
+      if (fFreeTrackBuffers.empty()) {
+        it->second = fTrackBuffers.size();
+        fTrackBuffers.emplace_back();
+      } else {
+        it->second = fFreeTrackBuffers.back();
+        fFreeTrackBuffers.pop_back();
+      }
+    }
+    return it->second;
+  }
+
+  void ReleaseTrackBuffer(U key_df_collision)
+  {
+    auto it = fMapTrackBuffer.find(key_df_collision);
+    if (it == fMapTrackBuffer.end()) {
+      return;
+    }
+    fTrackBuffers[it->second].clear(); // keep the capacity for the next collision
+    fFreeTrackBuffers.emplace_back(it->second);
+    fMapTrackBuffer.erase(it);
+  }
+
+  eventmixing::MixingPool<U> fPool;          // pools of pair<df index, global collision index>, one category per mixing bin
+  std::map<T, int> fMapMixBins;              // map : e.g. <zbin, centbin, epbin> -> category in fPool
+  std::map<U, int> fMapTrackBuffer;          // map : e.g. pair<df index, global collision index> -> index of the track buffer
+  std::vector<std::vector<V>> fTrackBuffers; // track buffers, reused after the collision left the pool
+  std::vector<int> fFreeTrackBuffers;        // indices of the track buffers not in use
 };
 } // namespace o2::aod::pwgem::dilepton::utils
 #endif // PWGEM_DILEPTON_UTILS_EVENTMIXINGHANDLER_H_
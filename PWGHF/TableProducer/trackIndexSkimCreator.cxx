@@ -1295,6 +1295,19 @@ struct HfTrackIndexSkimCreator {
   std::array<std::vector<double>, kN2ProngDecays> binsPt2Prong{};
   std::array<LabeledArray<double>, kN3ProngDecays> cut3Prong{};
   std::array<std::vector<double>, kN3ProngDecays> binsPt3Prong{};
+  double ptMin3Prong{0.}; // lowest pT edge among the 3-prong channels
+
+  /// Daughter track quantities which do not depend on the combination, computed once per collision
+  struct ProngTrackInfo {
+    o2::track::TrackParCov trackParVar; // track parameters, re-propagated to the collision if needed
+    std::array<float, 3> pVec;          // momentum at the DCA to the collision
+    std::array<float, 2> dcaInfo;       // DCA xy and z to the collision
+    float pt;                           // transverse momentum at the DCA to the collision
+    float ptMaxFromHere;                // highest pT of this and of the following tracks in the slice
+    bool isPropagated;                  // whether the track was re-propagated to the collision
+  };
+  std::vector<ProngTrackInfo> prongTrackInfosPos{};
+  std::vector<ProngTrackInfo> prongTrackInfosNeg{};
 
   // ML response
   o2::analysis::MlResponse<float> hfMlResponse2Prongs;                               // only D0
@@ -1364,6 +1377,10 @@ struct HfTrackIndexSkimCreator {
     // cuts for 3-prong decays retrieved by json. the order must be then one in hf_cand_3prong::DecayType
     cut3Prong = {config.cutsDplusToPiKPi, config.cutsLcToPKPi, config.cutsDsToKKPi, config.cutsXicToPKPi, config.cutsCdToDeKPi};
     binsPt3Prong = {config.binsPtDplusToPiKPi, config.binsPtLcToPKPi, config.binsPtDsToKKPi, config.binsPtXicToPKPi, config.binsPtCdToDeKPi};
+    ptMin3Prong = binsPt3Prong[0].front();
+    for (int iDecay3P = 1; iDecay3P < kN3ProngDecays; iDecay3P++) {
+      ptMin3Prong = std::min(ptMin3Prong, binsPt3Prong[iDecay3P].front());
+    }
 
     df2.setPropagateToPCA(config.propagateToPCA);
     df2.setMaxR(config.maxR);
@@ -1501,6 +1518,46 @@ struct HfTrackIndexSkimCreator {
     }
   }
 
+  /// Method to compute the daughter track quantities needed for the combinations of a collision
+  /// \param trackIndices are the track indices of the collision
+  /// \param collision is the collision
+  /// \param prongTrackInfos is the vector to be filled, one entry per track index in the same order
+  template <typename TTracks, typename TTrackIndices, typename TCollision>
+  void fillProngTrackInfos(TTrackIndices const& trackIndices, TCollision const& collision, std::vector<ProngTrackInfo>& prongTrackInfos)
+  {
+    prongTrackInfos.clear();
+    prongTrackInfos.reserve(trackIndices.size());
+    for (const auto& trackIndex : trackIndices) {
+      const auto track = trackIndex.template track_as<TTracks>();
+      auto& info = prongTrackInfos.emplace_back(ProngTrackInfo{getTrackParCov(track), track.pVector(), {track.dcaXY(), track.dcaZ()}, 0.f, 0.f, false});
+      if (collision.globalIndex() != track.collisionId()) { // this is not the "default" collision for this track, we have to re-propagate it
+        o2::base::Propagator::Instance()->propagateToDCABxByBz({collision.posX(), collision.posY(), collision.posZ()}, info.trackParVar, 2.f, noMatCorr, &info.dcaInfo);
+        getPxPyPz(info.trackParVar, info.pVec);
+        info.isPropagated = true;
+      }
+      info.pt = RecoDecay::pt(info.pVec);
+    }
+    float ptMax = 0.f;
+    for (auto info = prongTrackInfos.rbegin(); info != prongTrackInfos.rend(); ++info) {
+      ptMax = std::max(ptMax, info->pt);
+      info->ptMaxFromHere = ptMax;
+    }
+  }
+
+  /// Method to check whether 3-prong candidates with a given sum of daughter pT can be in the pT range of any 3-prong channel
+  /// \param ptSum is the scalar sum of the daughter pT, an upper limit of the candidate pT
+  /// \returns false if the 3-prong preselection would reject the candidate for all channels
+  bool isPtSumCompatibleWith3Prongs(const float ptSum) const
+  {
+    return ptSum * (1.f + 1.e-5f) + config.ptTolerance >= ptMin3Prong; // small margin for the rounding in the vector sum
+  }
+
+  /// \returns true if at least one track in prongTrackInfos from position first on can complete a 3-prong candidate with the given pT sum of the other two daughters
+  bool hasThirdProngCandidate(std::vector<ProngTrackInfo> const& prongTrackInfos, const std::size_t first, const float ptSum) const
+  {
+    return first < prongTrackInfos.size() && isPtSumCompatibleWith3Prongs(ptSum + prongTrackInfos[first].ptMaxFromHere);
+  }
+
   /// Method to perform selections for 2-prong candidates before vertex reconstruction
   /// \param pVecTrack0 is the momentum array of the first daughter track
   /// \param pVecTrack1 is the momentum array of the second daughter track
@@ -2157,10 +2214,17 @@ struct HfTrackIndexSkimCreator {
 
       const auto thisCollId = collision.globalIndex();
 
-      // first loop over positive tracks
+      // daughter track quantities, (re-)propagated once per collision instead of once per combination
       const auto groupedTrackIndicesPos1 = positiveFor2And3Prongs->sliceByCached(aod::track::collisionId, collision.globalIndex(), cache);
+      const auto groupedTrackIndicesNeg1 = negativeFor2And3Prongs->sliceByCached(aod::track::collisionId, collision.globalIndex(), cache);
+      fillProngTrackInfos<TTracks>(groupedTrackIndicesPos1, collision, prongTrackInfosPos);
+      fillProngTrackInfos<TTracks>(groupedTrackIndicesNeg1, collision, prongTrackInfosNeg);
+      const auto pvCovMatrix = getPrimaryVertex(collision).getCov();
+
+      // first loop over positive tracks
       int lastFilledD0 = -1; // index to be filled in table for D* mesons
-      for (auto trackIndexPos1 = groupedTrackIndicesPos1.begin(); trackIndexPos1 != groupedTrackIndicesPos1.end(); ++trackIndexPos1) {
+      std::size_t iPos1 = 0;
+      for (auto trackIndexPos1 = groupedTrackIndicesPos1.begin(); trackIndexPos1 != groupedTrackIndicesPos1.end(); ++trackIndexPos1, ++iPos1) {
         const auto trackPos1 = trackIndexPos1.template track_as<TTracks>();
 
         // retrieve the selection flag that corresponds to this collision
@@ -2168,17 +2232,14 @@ struct HfTrackIndexSkimCreator {
         const bool sel2ProngStatusPos = TESTBIT(isSelProngPos1, CandidateType::Cand2Prong);
         const bool sel3ProngStatusPos1 = TESTBIT(isSelProngPos1, CandidateType::Cand3Prong);
 
-        auto trackParVarPos1 = getTrackParCov(trackPos1);
-        std::array pVecTrackPos1{trackPos1.pVector()};
-        std::array dcaInfoPos1{trackPos1.dcaXY(), trackPos1.dcaZ()};
-        if (thisCollId != trackPos1.collisionId()) { // this is not the "default" collision for this track, we have to re-propagate it
-          o2::base::Propagator::Instance()->propagateToDCABxByBz({collision.posX(), collision.posY(), collision.posZ()}, trackParVarPos1, 2.f, noMatCorr, &dcaInfoPos1);
-          getPxPyPz(trackParVarPos1, pVecTrackPos1);
-        }
+        const auto& prongTrackInfoPos1 = prongTrackInfosPos[iPos1];
+        const auto& trackParVarPos1 = prongTrackInfoPos1.trackParVar;
+        const auto& pVecTrackPos1 = prongTrackInfoPos1.pVec;
+        const auto& dcaInfoPos1 = prongTrackInfoPos1.dcaInfo;
 
         // first loop over negative tracks
-        const auto groupedTrackIndicesNeg1 = negativeFor2And3Prongs->sliceByCached(aod::track::collisionId, collision.globalIndex(), cache);
-        for (auto trackIndexNeg1 = groupedTrackIndicesNeg1.begin(); trackIndexNeg1 != groupedTrackIndicesNeg1.end(); ++trackIndexNeg1) {
+        std::size_t iNeg1 = 0;
+        for (auto trackIndexNeg1 = groupedTrackIndicesNeg1.begin(); trackIndexNeg1 != groupedTrackIndicesNeg1.end(); ++trackIndexNeg1, ++iNeg1) {
           const auto trackNeg1 = trackIndexNeg1.template track_as<TTracks>();
 
           // retrieve the selection flag that corresponds to this collision
@@ -2186,13 +2247,10 @@ struct HfTrackIndexSkimCreator {
           const bool sel2ProngStatusNeg = TESTBIT(isSelProngNeg1, CandidateType::Cand2Prong);
           const bool sel3ProngStatusNeg1 = TESTBIT(isSelProngNeg1, CandidateType::Cand3Prong);
 
-          auto trackParVarNeg1 = getTrackParCov(trackNeg1);
-          std::array pVecTrackNeg1{trackNeg1.pVector()};
-          std::array dcaInfoNeg1{trackNeg1.dcaXY(), trackNeg1.dcaZ()};
-          if (thisCollId != trackNeg1.collisionId()) { // this is not the "default" collision for this track, we have to re-propagate it
-            o2::base::Propagator::Instance()->propagateToDCABxByBz({collision.posX(), collision.posY(), collision.posZ()}, trackParVarNeg1, 2.f, noMatCorr, &dcaInfoNeg1);
-            getPxPyPz(trackParVarNeg1, pVecTrackNeg1);
-          }
+          const auto& prongTrackInfoNeg1 = prongTrackInfosNeg[iNeg1];
+          const auto& trackParVarNeg1 = prongTrackInfoNeg1.trackParVar;
+          const auto& pVecTrackNeg1 = prongTrackInfoNeg1.pVec;
+          const auto& dcaInfoNeg1 = prongTrackInfoNeg1.dcaInfo;
 
           uint isSelected2ProngCand = n2ProngBit; // bitmap for checking status of two-prong candidates (1 is true, 0 is rejected)
 
@@ -2206,11 +2264,15 @@ struct HfTrackIndexSkimCreator {
 
           // initialise PV refit coordinates and cov matrix for 2-prongs already here for D*
           std::array pvRefitCoord2Prong = {collision.posX(), collision.posY(), collision.posZ()}; /// initialize to the original PV
-          std::array pvRefitCovMatrix2Prong = getPrimaryVertex(collision).getCov();               /// initialize to the original PV
+          std::array pvRefitCovMatrix2Prong = pvCovMatrix;                                        /// initialize to the original PV
 
           // 2-prong vertex reconstruction
           float pt2Prong{-1.};
           bool is2ProngCandidateGoodFor3Prong{sel3ProngStatusPos1 && sel3ProngStatusNeg1};
+          if (is2ProngCandidateGoodFor3Prong && !config.debug) { // no 3-prong combination if no third track can bring the candidate pT in the range of any 3-prong channel
+            const float ptSum2Prong = prongTrackInfoPos1.pt + prongTrackInfoNeg1.pt;
+            is2ProngCandidateGoodFor3Prong = hasThirdProngCandidate(prongTrackInfosPos, iPos1 + 1, ptSum2Prong) || hasThirdProngCandidate(prongTrackInfosNeg, iNeg1 + 1, ptSum2Prong);
+          }
           int nVtxFrom2ProngFitter = 0;
           if (sel2ProngStatusPos && sel2ProngStatusNeg) {
 
@@ -2401,7 +2463,8 @@ struct HfTrackIndexSkimCreator {
 
           if (config.do3Prong && is2ProngCandidateGoodFor3Prong) { // if 3 prongs are enabled and the first 2 tracks are selected for the 3-prong channels
             // second loop over positive tracks
-            for (auto trackIndexPos2 = trackIndexPos1 + 1; trackIndexPos2 != groupedTrackIndicesPos1.end(); ++trackIndexPos2) {
+            std::size_t iPos2 = iPos1 + 1;
+            for (auto trackIndexPos2 = trackIndexPos1 + 1; trackIndexPos2 != groupedTrackIndicesPos1.end(); ++trackIndexPos2, ++iPos2) {
 
               uint isSelected3ProngCand = n3ProngBit;
               if (!TESTBIT(trackIndexPos2.isSelProng(), CandidateType::Cand3Prong)) { // continue immediately
@@ -2418,17 +2481,22 @@ struct HfTrackIndexSkimCreator {
                 isSelected3ProngCand = 0;
               }
 
+              const auto& prongTrackInfoPos2 = prongTrackInfosPos[iPos2];
+              if (!config.debug && !isPtSumCompatibleWith3Prongs(prongTrackInfoPos1.pt + prongTrackInfoNeg1.pt + prongTrackInfoPos2.pt)) {
+                continue;
+              }
+
               const auto trackPos2 = trackIndexPos2.template track_as<TTracks>();
-              auto trackParVarPos2 = getTrackParCov(trackPos2);
-              std::array dcaInfoPos2{trackPos2.dcaXY(), trackPos2.dcaZ()};
+              auto trackParVarPos2 = prongTrackInfoPos2.trackParVar;
+              auto dcaInfoPos2 = prongTrackInfoPos2.dcaInfo;
+              if (!isSelected3ProngCand && prongTrackInfoPos2.isPropagated) { // in debug mode, rejected candidates are fitted without re-propagation
+                trackParVarPos2 = getTrackParCov(trackPos2);
+                dcaInfoPos2 = {trackPos2.dcaXY(), trackPos2.dcaZ()};
+              }
 
               // preselection of 3-prong candidates
               if (isSelected3ProngCand) {
-                std::array pVecTrackPos2{trackPos2.pVector()};
-                if (thisCollId != trackPos2.collisionId()) { // this is not the "default" collision for this track and we still did not re-propagate it, we have to re-propagate it
-                  o2::base::Propagator::Instance()->propagateToDCABxByBz({collision.posX(), collision.posY(), collision.posZ()}, trackParVarPos2, 2.f, noMatCorr, &dcaInfoPos2);
-                  getPxPyPz(trackParVarPos2, pVecTrackPos2);
-                }
+                const auto& pVecTrackPos2 = prongTrackInfoPos2.pVec;
 
                 if (config.debug) {
                   for (int iDecay3P = 0; iDecay3P < kN3ProngDecays; iDecay3P++) {
@@ -2449,7 +2517,7 @@ struct HfTrackIndexSkimCreator {
 
               /// PV refit excluding the candidate daughters, if contributors
               std::array pvRefitCoord3Prong2Pos1Neg{collision.posX(), collision.posY(), collision.posZ()}; /// initialize to the original PV
-              std::array pvRefitCovMatrix3Prong2Pos1Neg{getPrimaryVertex(collision).getCov()};             /// initialize to the original PV
+              std::array pvRefitCovMatrix3Prong2Pos1Neg{pvCovMatrix};                                      /// initialize to the original PV
               if constexpr (DoPvRefit) {
                 if (config.fillHistograms) {
                   registry.fill(HIST("PvRefit/verticesPerCandidate"), 1);
@@ -2657,7 +2725,8 @@ struct HfTrackIndexSkimCreator {
             }
 
             // second loop over negative tracks
-            for (auto trackIndexNeg2 = trackIndexNeg1 + 1; trackIndexNeg2 != groupedTrackIndicesNeg1.end(); ++trackIndexNeg2) {
+            std::size_t iNeg2 = iNeg1 + 1;
+            for (auto trackIndexNeg2 = trackIndexNeg1 + 1; trackIndexNeg2 != groupedTrackIndicesNeg1.end(); ++trackIndexNeg2, ++iNeg2) {
 
               int isSelected3ProngCand = n3ProngBit;
               if (!TESTBIT(trackIndexNeg2.isSelProng(), CandidateType::Cand3Prong)) { // continue immediately
@@ -2674,17 +2743,22 @@ struct HfTrackIndexSkimCreator {
                 isSelected3ProngCand = 0;
               }
 
+              const auto& prongTrackInfoNeg2 = prongTrackInfosNeg[iNeg2];
+              if (!config.debug && !isPtSumCompatibleWith3Prongs(prongTrackInfoPos1.pt + prongTrackInfoNeg1.pt + prongTrackInfoNeg2.pt)) {
+                continue;
+              }
+
               auto trackNeg2 = trackIndexNeg2.template track_as<TTracks>();
-              auto trackParVarNeg2 = getTrackParCov(trackNeg2);
-              std::array dcaInfoNeg2{trackNeg2.dcaXY(), trackNeg2.dcaZ()};
+              auto trackParVarNeg2 = prongTrackInfoNeg2.trackParVar;
+              auto dcaInfoNeg2 = prongTrackInfoNeg2.dcaInfo;
+              if (!isSelected3ProngCand && prongTrackInfoNeg2.isPropagated) { // in debug mode, rejected candidates are fitted without re-propagation
+                trackParVarNeg2 = getTrackParCov(trackNeg2);
+                dcaInfoNeg2 = {trackNeg2.dcaXY(), trackNeg2.dcaZ()};
+              }
 
               // preselection of 3-prong candidates
               if (isSelected3ProngCand) {
-                std::array pVecTrackNeg2{trackNeg2.pVector()};
-                if (thisCollId != trackNeg2.collisionId()) { // this is not the "default" collision for this track and we still did not re-propagate it, we have to re-propagate it
-                  o2::base::Propagator::Instance()->propagateToDCABxByBz({collision.posX(), collision.posY(), collision.posZ()}, trackParVarNeg2, 2.f, noMatCorr, &dcaInfoNeg2);
-                  getPxPyPz(trackParVarNeg2, pVecTrackNeg2);
-                }
+                const auto& pVecTrackNeg2 = prongTrackInfoNeg2.pVec;
 
                 if (config.debug) {
                   for (int iDecay3P = 0; iDecay3P < kN3ProngDecays; iDecay3P++) {
@@ -2705,7 +2779,7 @@ struct HfTrackIndexSkimCreator {
 
               /// PV refit excluding the candidate daughters, if contributors
               std::array pvRefitCoord3Prong1Pos2Neg{collision.posX(), collision.posY(), collision.posZ()}; /// initialize to the original PV
-              std::array pvRefitCovMatrix3Prong1Pos2Neg{getPrimaryVertex(collision).getCov()};             /// initialize to the original PV
+              std::array pvRefitCovMatrix3Prong1Pos2Neg{pvCovMatrix};                                      /// initialize to the original PV
               if constexpr (DoPvRefit) {
                 if (config.fillHistograms) {
                   registry.fill(HIST("PvRefit/verticesPerCandidate"), 1);
@@ -36,9 +36,11 @@
 
 #include <array>
 #include <cmath>
+#include <cstdint>
 #include <cstdlib>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 //__________________________________________
@@ -450,6 +452,13 @@ class BuilderModule
     bool found = false;
   };
 
+  // key of a (positive, negative) track pair, used to look up existing V0s
+  // and cascades in findable mode without scanning the full lists
+  static uint64_t trackPairKey(int posTrackId, int negTrackId)
+  {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(posTrackId)) << 32) | static_cast<uint32_t>(negTrackId);
+  }
+
   //*+-+*+-+*+-+*+-+*+-+*+-+*+-+*+-+*+-+*+-+*
   // Helper struct to contain V0MCCore information prior to filling
   struct mcV0info {
@@ -1012,24 +1021,48 @@ class BuilderModule
           }
         }
 
+        // index negative tracks by originating particle and existing V0s by track pair:
+        // pairing and searching for existing V0s is then linear instead of nested loops
+        std::unordered_map<int, std::vector<int>> negativeTracksPerOrigin;
+        for (size_t ii = 0; ii < negativeTrackArray.size(); ii++) {
+          negativeTracksPerOrigin[negativeTrackArray[ii].originId].push_back(ii);
+        }
+        std::unordered_map<uint64_t, int> existingV0s; // track pair -> first v0List entry (mode 1) or first aod::V0s entry (mode 2)
+        std::vector<v0Entry> existingV0Properties;     // globalId, v0Type, isCollinearV0 of the aod::V0s entries (mode 2)
+        if (baseOpts.mc_findableMode.value == 1) {
+          for (int ii = 0; ii < v0ListReconstructedSize; ii++) {
+            existingV0s.emplace(trackPairKey(v0List[ii].posTrackId, v0List[ii].negTrackId), ii);
+          }
+        }
+        if (baseOpts.mc_findableMode.value == 2) {
+          for (const auto& v0 : v0s) {
+            if (existingV0s.emplace(trackPairKey(v0.posTrackId(), v0.negTrackId()), existingV0Properties.size()).second) {
+              v0Entry existingV0Entry;
+              existingV0Entry.globalId = v0.globalIndex();
+              existingV0Entry.v0Type = v0.v0Type();
+              existingV0Entry.isCollinearV0 = v0.isCollinearV0();
+              existingV0Properties.push_back(existingV0Entry);
+            }
+          }
+        }
+
         // Nested loop only with valuable tracks
         for (const auto& positiveTrackIndex : positiveTrackArray) {
-          for (const auto& negativeTrackIndex : negativeTrackArray) {
-            if (positiveTrackIndex.originId != negativeTrackIndex.originId) {
-              continue; // not the same originating particle
-            }
+          auto negativeTracks = negativeTracksPerOrigin.find(positiveTrackIndex.originId);
+          if (negativeTracks == negativeTracksPerOrigin.end()) {
+            continue; // no negative track from the same originating particle
+          }
+          for (const auto& negativeTrackPosition : negativeTracks->second) {
+            const auto& negativeTrackIndex = negativeTrackArray[negativeTrackPosition];
+            auto existingV0 = existingV0s.find(trackPairKey(positiveTrackIndex.globalId, negativeTrackIndex.globalId));
             // findable mode 1: add non-reconstructed as v0Type 8
             if (baseOpts.mc_findableMode.value == 1) {
               bool detected = false;
-              for (int ii = 0; ii < v0ListReconstructedSize; ii++) {
-                // check if this particular combination already exists in v0List
-                if (v0List[ii].posTrackId == positiveTrackIndex.globalId &&
-                    v0List[ii].negTrackId == negativeTrackIndex.globalId) {
-                  detected = true;
-                  // override pdg code with something useful for cascade findable math
-                  v0List[ii].pdgCode = positiveTrackIndex.pdgCode;
-                  break;
-                }
+              if (existingV0 != existingV0s.end()) {
+                // this particular combination already exists in v0List
+                detected = true;
+                // override pdg code with something useful for cascade findable math
+                v0List[existingV0->second].pdgCode = positiveTrackIndex.pdgCode;
               }
               if (detected == false) {
                 // collision index: from best-version-of-this-mcCollision
@@ -1068,17 +1101,14 @@ class BuilderModule
                 currentV0Entry.isCollinearV0 = true;
               }
               currentV0Entry.found = false;
-              for (const auto& v0 : v0s) {
-                if (v0.posTrackId() == positiveTrackIndex.globalId &&
-                    v0.negTrackId() == negativeTrackIndex.globalId) {
-                  // this will override type, but not collision index
-                  // N.B.: collision index checks still desirable!
-                  currentV0Entry.globalId = v0.globalIndex();
-                  currentV0Entry.v0Type = v0.v0Type();
-                  currentV0Entry.isCollinearV0 = v0.isCollinearV0();
-                  currentV0Entry.found = true;
-                  break;
-                }
+              if (existingV0 != existingV0s.end()) {
+                // this will override type, but not collision index
+                // N.B.: collision index checks still desirable!
+                const auto& v0 = existingV0Properties[existingV0->second];
+                currentV0Entry.globalId = v0.globalId;
+                currentV0Entry.v0Type = v0.v0Type;
+                currentV0Entry.isCollinearV0 = v0.isCollinearV0;
+                currentV0Entry.found = true;
               }
               if (v0BuilderOpts.mc_findableDetachedV0.value || currentV0Entry.collisionId >= 0) {
                 v0List.push_back(currentV0Entry);
@@ -1159,6 +1189,38 @@ class BuilderModule
             bachelorTrackArray.push_back(currentTrackEntry);
           }
 
+          // index bachelor tracks by originating particle and existing cascades by track pair
+          std::unordered_map<int, std::vector<int>> bachelorTracksPerOrigin;
+          for (size_t ii = 0; ii < bachelorTrackArray.size(); ii++) {
+            bachelorTracksPerOrigin[bachelorTrackArray[ii].originId].push_back(ii);
+          }
+          // track pair -> (bachelor track, cascade globalId) of the existing cascades, in list/table order
+          std::unordered_map<uint64_t, std::vector<std::array<int, 2>>> existingCascades;
+          if (baseOpts.mc_findableMode.value == 1) {
+            for (size_t ii = 0; ii < cascadeListReconstructedSize; ii++) {
+              existingCascades[trackPairKey(cascadeList[ii].posTrackId, cascadeList[ii].negTrackId)].push_back({cascadeList[ii].bachTrackId, cascadeList[ii].globalId});
+            }
+          }
+          if (baseOpts.mc_findableMode.value == 2) {
+            for (const auto& cascade : cascades) {
+              auto const& v0fromAOD = cascade.v0();
+              existingCascades[trackPairKey(v0fromAOD.posTrackId(), v0fromAOD.negTrackId())].push_back({cascade.bachelorId(), static_cast<int>(cascade.globalIndex())});
+            }
+          }
+          // first existing cascade with these tracks, nullptr if none
+          auto findExistingCascade = [&](int posTrackId, int negTrackId, int bachTrackId) -> const std::array<int, 2>* {
+            auto candidates = existingCascades.find(trackPairKey(posTrackId, negTrackId));
+            if (candidates == existingCascades.end()) {
+              return nullptr;
+            }
+            for (const auto& candidate : candidates->second) {
+              if (candidate[0] == bachTrackId) {
+                return &candidate;
+              }
+            }
+            return nullptr;
+          };
+
           // determine which V0s are of interest to pair and do pairing
           for (size_t v0i = 0; v0i < v0List.size(); v0i++) {
             auto v0 = v0List[sorted_v0[v0i]];
@@ -1188,24 +1250,18 @@ class BuilderModule
             if (std::abs(v0OriginParticle.pdgCode()) != PDG_t::kXiMinus && std::abs(v0OriginParticle.pdgCode()) != PDG_t::kOmegaMinus) {
               continue; // this V0 does not come from any particle of interest, don't try
             }
-            for (const auto& bachelorTrackIndex : bachelorTrackArray) {
-              if (bachelorTrackIndex.originId != v0OriginParticle.globalIndex()) {
-                continue;
-              }
+            auto bachelorTracks = bachelorTracksPerOrigin.find(v0OriginParticle.globalIndex());
+            if (bachelorTracks == bachelorTracksPerOrigin.end()) {
+              continue; // no bachelor from the same originating particle
+            }
+            for (const auto& bachelorTrackPosition : bachelorTracks->second) {
+              const auto& bachelorTrackIndex = bachelorTrackArray[bachelorTrackPosition];
               // if we are here: v0 origin is 3312 or 3334, bachelor origin matches V0 origin
               // findable mode 1: add non-reconstructed as cascadeType 1
               if (baseOpts.mc_findableMode.value == 1) {
-                bool detected = false;
-                for (size_t ii = 0; ii < cascadeListReconstructedSize; ii++) {
-                  // check if this particular combination already exists in cascadeList
-                  // caution: use track indices (immutable) but not V0 indices (re-indexing)
-                  if (cascadeList[ii].posTrackId == v0.posTrackId &&
-                      cascadeList[ii].negTrackId == v0.negTrackId &&
-                      cascadeList[ii].bachTrackId == bachelorTrackIndex.globalId) {
-                    detected = true;
-                    break;
-                  }
-                }
+                // check if this particular combination already exists in cascadeList
+                // caution: use track indices (immutable) but not V0 indices (re-indexing)
+                bool detected = findExistingCascade(v0.posTrackId, v0.negTrackId, bachelorTrackIndex.globalId) != nullptr;
                 if (detected == false) {
                   // collision index: from best-version-of-this-mcCollision
                   // nota bene: this could be negative, caution advised
@@ -1239,17 +1295,11 @@ class BuilderModule
                 if (bestCollisionArray[bachelorTrackIndex.mcCollisionId] < 0) {
                   collisionLessCascades++;
                 }
-                for (const auto& cascade : cascades) {
-                  auto const& v0fromAOD = cascade.v0();
-                  if (v0fromAOD.posTrackId() == v0.posTrackId &&
-                      v0fromAOD.negTrackId() == v0.negTrackId &&
-                      cascade.bachelorId() == bachelorTrackIndex.globalId) {
-                    // this will override type, but not collision index
-                    // N.B.: collision index checks still desirable!
-                    currentCascadeEntry.found = true;
-                    currentCascadeEntry.globalId = cascade.globalIndex();
-                    break;
-                  }
+                if (const auto* cascade = findExistingCascade(v0.posTrackId, v0.negTrackId, bachelorTrackIndex.globalId)) {
+                  // this will override type, but not collision index
+                  // N.B.: collision index checks still desirable!
+                  currentCascadeEntry.found = true;
+                  currentCascadeEntry.globalId = (*cascade)[1];
                 }
                 if (cascadeBuilderOpts.mc_findableDetachedCascade.value || currentCascadeEntry.collisionId >= 0) {
                   cascadeList.push_back(currentCascadeEntry);
@@ -1262,15 +1312,16 @@ class BuilderModule
           // correct. We'll have to loop over all V0s and find the appropriate matches
           // ---> but only in mode 1, and only for AO2D-native V0s
           if (baseOpts.mc_findableMode.value == 1) {
+            // first sorted v0List position of each track pair
+            std::unordered_map<uint64_t, int> sortedV0Positions;
+            for (size_t v0i = 0; v0i < v0List.size(); v0i++) {
+              const auto& v0 = v0List[sorted_v0[v0i]];
+              sortedV0Positions.emplace(trackPairKey(v0.posTrackId, v0.negTrackId), v0i);
+            }
             for (size_t casci = 0; casci < cascadeListReconstructedSize; casci++) {
-              // loop over v0List to find corresponding v0 index, but do it in sorted way
-              for (size_t v0i = 0; v0i < v0List.size(); v0i++) {
-                auto v0 = v0List[sorted_v0[v0i]];
-                if (cascadeList[casci].posTrackId == v0.posTrackId &&
-                    cascadeList[casci].negTrackId == v0.negTrackId) {
-                  cascadeList[casci].v0Id = v0i; // fix, point to correct V0 index
-                  break;
-                }
+              auto v0Position = sortedV0Positions.find(trackPairKey(cascadeList[casci].posTrackId, cascadeList[casci].negTrackId));
+              if (v0Position != sortedV0Positions.end()) {
+                cascadeList[casci].v0Id = v0Position->second; // fix, point to correct V0 index
               }
             }
           }
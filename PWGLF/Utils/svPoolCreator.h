@@ -12,6 +12,7 @@
 #ifndef PWGLF_UTILS_SVPOOLCREATOR_H_
 #define PWGLF_UTILS_SVPOOLCREATOR_H_
 
+#include <algorithm>
 #include <array>
 #include <unordered_map>
 #include <vector>
@@ -65,6 +66,9 @@ class svPoolCreator
     tmap.clear();
     svCandPool.clear();
     bc2Coll.clear();
+    collBCs.clear();
+    ambiTrackRows.clear();
+    ambiTrackRowsFilled = false;
   }
 
   void setTimeMargin(float timeMargin) { timeMarginNS = timeMargin; }
@@ -76,13 +80,20 @@ class svPoolCreator
   template <typename C, typename BC>
   void fillBC2Coll(const C& collisions, BC const&)
   {
+    bc2Coll.clear();
+    collBCs.assign(collisions.size(), BcInvalid);
     for (unsigned i = 0; i < collisions.size(); i++) {
       auto collision = collisions.rawIteratorAt(i);
       if (!collision.has_bc()) {
         continue;
       }
-      bc2Coll[collision.template bc_as<BC>().globalBC()] = i;
+      collBCs[i] = collision.template bc_as<BC>().globalBC();
+      bc2Coll.emplace_back(collBCs[i], i);
     }
+    // sorted by BC, keeping only the last collision of each BC
+    std::stable_sort(bc2Coll.begin(), bc2Coll.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+    auto last = std::unique(bc2Coll.rbegin(), bc2Coll.rend(), [](const auto& a, const auto& b) { return a.first == b.first; });
+    bc2Coll.erase(bc2Coll.begin(), last.base());
   }
 
   template <typename T, typename C, typename BC>
@@ -93,23 +104,25 @@ class svPoolCreator
       return;
     }
     bool isDau0 = pdgHypo == track0Pdg;
-    constexpr uint64_t BcInvalid = -1;
     uint64_t globalBC = BcInvalid;
     if (trackCand.has_collision()) {
       if (trackCand.template collision_as<C>().has_bc()) {
         globalBC = trackCand.template collision_as<C>().template bc_as<BC>().globalBC();
       }
     } else if (!skipAmbiTracks) {
-      for (const auto& ambTrack : ambiTracks) {
-        if (ambTrack.trackId() != trackCand.globalIndex()) {
-          continue;
+      if (!ambiTrackRowsFilled) {
+        // track -> first ambiguous track row, filled once per pool
+        for (unsigned i = 0; i < ambiTracks.size(); i++) {
+          ambiTrackRows.emplace(ambiTracks.rawIteratorAt(i).trackId(), i);
         }
-        if (!ambTrack.has_bc() || ambTrack.bc_as<BC>().size() == 0) {
-          globalBC = BcInvalid;
-          break;
+        ambiTrackRowsFilled = true;
+      }
+      const auto& ambRow = ambiTrackRows.find(trackCand.globalIndex());
+      if (ambRow != ambiTrackRows.end()) {
+        const auto& ambTrack = ambiTracks.rawIteratorAt(ambRow->second);
+        if (ambTrack.has_bc() && ambTrack.bc_as<BC>().size() != 0) {
+          globalBC = ambTrack.bc_as<BC>().begin().globalBC();
         }
-        globalBC = ambTrack.bc_as<BC>().begin().globalBC();
-        break;
       }
     } else {
       globalBC = BcInvalid;
@@ -121,24 +134,19 @@ class svPoolCreator
 
     uint64_t firstBC = globalBC < bOffsetMax ? 0 : globalBC - bOffsetMax;
     uint64_t lastBC = globalBC + bOffsetMax;
-    int firstCollIdx = -1;
-    while (firstBC < lastBC) {
-      if (bc2Coll.find(firstBC) != bc2Coll.end()) {
-        firstCollIdx = bc2Coll[firstBC];
-        break;
-      }
-      firstBC++;
-    }
-    if (firstCollIdx == -1) {
+    // first BC with a collision in [firstBC, lastBC)
+    auto firstColl = std::lower_bound(bc2Coll.begin(), bc2Coll.end(), firstBC, [](const auto& entry, uint64_t bc) { return entry.first < bc; });
+    if (firstColl == bc2Coll.end() || firstColl->first >= lastBC) {
       return;
     }
+    int firstCollIdx = firstColl->second;
 
     // now loop over all the collisions to make the pool
     for (int i = firstCollIdx; i < collisions.size(); i++) {
       const auto& collision = collisions.rawIteratorAt(i);
       float collTime = collision.collisionTime();
       float collTimeRes2 = collision.collisionTimeRes() * collision.collisionTimeRes();
-      uint64_t collBC = collision.template bc_as<BC>().globalBC();
+      uint64_t collBC = collBCs[i];
       int collIdx = collision.globalIndex();
       int64_t bcOffset = globalBC - static_cast<int64_t>(collBC);
       if (static_cast<uint64_t>(std::abs(bcOffset)) > bOffsetMax) {
@@ -200,8 +208,6 @@ class svPoolCreator
   {
     gsl::span<std::vector<TrackCand>> track0Pool{trackCandPool.data(), 2};
     gsl::span<std::vector<TrackCand>> track1Pool{trackCandPool.data() + 2, 2};
-    std::array<std::vector<int>, 2> mVtxTrack0{}; // 1st pos. and neg. track of the kink pool for each vertex
-
     for (int i = 0; i < 2; i++) {
       mVtxTrack0[i].clear();
       mVtxTrack0[i].resize(collisions.size(), -1);
@@ -264,8 +270,13 @@ class svPoolCreator
   int track1Pdg;
   float timeMarginNS = 600.;
   bool skipAmbiTracks = false;
+  static constexpr uint64_t BcInvalid = -1;
   std::unordered_map<int, std::pair<int, int>> tmap;
-  std::unordered_map<uint64_t, int> bc2Coll;
+  std::vector<std::pair<uint64_t, int>> bc2Coll; // (BC, collision index) sorted by BC
+  std::vector<uint64_t> collBCs;                 // BC of each collision
+  std::unordered_map<int, int> ambiTrackRows;    // track index -> row in the ambiguous tracks
+  bool ambiTrackRowsFilled = false;
+  std::array<std::vector<int>, 2> mVtxTrack0{}; // 1st pos. and neg. track of the kink pool for each vertex, reused across calls
 
   std::array<std::vector<TrackCand>, 4> trackCandPool; // Sorting: dau0 pos, dau0 neg, dau1 pos, dau1 neg
   std::vector<SVCand> svCandPool;                      // index of the two tracks in the track table
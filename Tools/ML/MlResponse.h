@@ -23,6 +23,7 @@
 #include <Framework/Array2D.h>
 #include <Framework/Logger.h>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <map>
@@ -168,20 +169,7 @@ class MlResponse
   {
     int nModel = findBin(candVar);
     auto output = getModelOutput(input, nModel);
-    uint8_t iClass{0};
-    for (const auto& outputValue : output) {
-      uint8_t dir = mCutDir.at(iClass);
-      if (dir != o2::cuts_ml::CutDirection::CutNot) {
-        if (dir == o2::cuts_ml::CutDirection::CutGreater && outputValue > mCuts.get(nModel, iClass)) {
-          return false;
-        }
-        if (dir == o2::cuts_ml::CutDirection::CutSmaller && outputValue < mCuts.get(nModel, iClass)) {
-          return false;
-        }
-      }
-      ++iClass;
-    }
-    return true;
+    return passCuts(nModel, output.data());
   }
 
   /// ML selections
@@ -194,20 +182,83 @@ class MlResponse
   {
     int nModel = findBin(candVar);
     output = getModelOutput(input, nModel);
-    uint8_t iClass{0};
-    for (const auto& outputValue : output) {
-      uint8_t dir = mCutDir.at(iClass);
-      if (dir != o2::cuts_ml::CutDirection::CutNot) {
-        if (dir == o2::cuts_ml::CutDirection::CutGreater && outputValue > mCuts.get(nModel, iClass)) {
-          return false;
-        }
-        if (dir == o2::cuts_ml::CutDirection::CutSmaller && outputValue < mCuts.get(nModel, iClass)) {
-          return false;
-        }
+    return passCuts(nModel, output.data());
+  }
+
+  /// Initialize the deferred mode: candidates are queued per model bin and each model is evaluated once over its queue
+  /// \param maxCandidates is the number of candidates per model for which buffers are preallocated (grown if needed)
+  /// \note Only float models are supported, to be called after init()
+  void initDeferred(std::size_t maxCandidates = 1000)
+  {
+    for (auto& model : mModels) {
+      model.initBatch(maxCandidates);
+      if (model.getBatchNOutputs() < mNClasses) {
+        LOG(fatal) << "The ML model has " << model.getBatchNOutputs() << " outputs per candidate, fewer than the number of classes (" << static_cast<int>(mNClasses) << ")! Please check your configurables.";
       }
-      ++iClass;
     }
-    return true;
+    mDeferredModel.reserve(maxCandidates);
+    mDeferredRow.reserve(maxCandidates);
+    mDeferredSelected.reserve(maxCandidates);
+  }
+
+  /// Reset the queues of the deferred mode, e.g. at the beginning of each collision or time frame
+  void clearDeferred()
+  {
+    for (auto& model : mModels) {
+      model.clearBatch();
+    }
+    mDeferredModel.clear();
+    mDeferredRow.clear();
+    mDeferredSelected.clear();
+  }
+
+  /// Queue a candidate for the deferred ML selection
+  /// \param input is the input features
+  /// \param candVar is the variable value (e.g. pT) used to select which model to use
+  /// \return index of the candidate in the deferred queue, same ordering as the push calls
+  template <typename T1, typename T2>
+  std::size_t pushCandidate(const T1& input, const T2& candVar)
+  {
+    int nModel = findBin(candVar);
+    if (nModel < 0 || static_cast<std::size_t>(nModel) >= mModels.size()) {
+      LOG(fatal) << "Model index " << nModel << " is out of range! The number of initialised models is " << mModels.size() << ". Please check your configurables.";
+    }
+    mDeferredModel.push_back(nModel);
+    mDeferredRow.push_back(mModels[nModel].pushRow(input));
+    return mDeferredModel.size() - 1;
+  }
+
+  /// Evaluate each model once over its queue and apply the selections
+  /// \return selection decision for each queued candidate (1 if selected), aligned with the push order
+  const std::vector<uint8_t>& evalDeferred()
+  {
+    for (auto& model : mModels) {
+      if (!model.evalBatch()) {
+        LOG(fatal) << "Error in the deferred evaluation of the ML models!";
+      }
+    }
+    mDeferredSelected.resize(mDeferredModel.size());
+    std::vector<TypeOutputScore> scores(mNClasses);
+    for (std::size_t iCand{0}; iCand < mDeferredModel.size(); ++iCand) {
+      const float* outputPtr = mModels[mDeferredModel[iCand]].getBatchOutput(mDeferredRow[iCand]);
+      std::copy(outputPtr, outputPtr + mNClasses, scores.begin());
+      mDeferredSelected[iCand] = passCuts(mDeferredModel[iCand], scores.data());
+    }
+    return mDeferredSelected;
+  }
+
+  /// Get the model scores of a candidate evaluated in deferred mode
+  /// \param iCand is the index returned by pushCandidate
+  /// \param output is a container to be filled with model output
+  /// \return boolean telling if model predictions pass the cuts
+  bool getDeferredOutput(std::size_t iCand, std::vector<TypeOutputScore>& output) const
+  {
+    if (iCand >= mDeferredSelected.size()) {
+      LOG(fatal) << "Candidate " << iCand << " requested, but only " << mDeferredSelected.size() << " candidates were evaluated in deferred mode!";
+    }
+    const float* outputPtr = mModels[mDeferredModel[iCand]].getBatchOutput(mDeferredRow[iCand]);
+    output.assign(outputPtr, outputPtr + mNClasses);
+    return mDeferredSelected[iCand];
   }
 
  protected:
@@ -224,6 +275,30 @@ class MlResponse
   virtual void setAvailableInputFeatures() { return; } // method to fill the map of available input features
 
  private:
+  std::vector<uint8_t> mDeferredModel;    // model index of each candidate queued in deferred mode
+  std::vector<std::size_t> mDeferredRow;  // row of each queued candidate in the batch of its model
+  std::vector<uint8_t> mDeferredSelected; // selection decision of each queued candidate
+
+  /// Applies the selections of a given bin on the model scores
+  /// \param nModel is the model index
+  /// \param scores is a pointer to the mNClasses model scores
+  /// \return boolean telling if model predictions pass the cuts
+  bool passCuts(int nModel, const TypeOutputScore* scores) const
+  {
+    for (uint8_t iClass{0}; iClass < mNClasses; ++iClass) {
+      uint8_t dir = mCutDir.at(iClass);
+      if (dir != o2::cuts_ml::CutDirection::CutNot) {
+        if (dir == o2::cuts_ml::CutDirection::CutGreater && scores[iClass] > mCuts.get(nModel, iClass)) {
+          return false;
+        }
+        if (dir == o2::cuts_ml::CutDirection::CutSmaller && scores[iClass] < mCuts.get(nModel, iClass)) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
   /// Finds matching bin in mBinsLimits
   /// \param value e.g. pT
   /// \return index of the matching bin, used to access mModels
@@ -0,0 +1,78 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// \file   checkBatchInference.cxx
+/// \brief  exec to check that the batched inference of OnnxModel gives the same scores as the per-candidate evaluation
+///         arguments: <model.onnx> [nRows] [tolerance]
+///
+
+#include "Tools/ML/model.h"
+
+#include <Framework/Logger.h>
+
+#include <TRandom.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+using namespace o2;
+
+int main(int argc, char* argv[])
+{
+  if (argc < 2) {
+    LOG(error) << "Usage: " << argv[0] << " <model.onnx> [nRows] [tolerance]";
+    return 1;
+  }
+  const std::string modelPath = argv[1];
+  const std::size_t nRows = argc > 2 ? std::atoi(argv[2]) : 1000;
+  const float tolerance = argc > 3 ? std::atof(argv[3]) : 1.e-6f;
+
+  ml::OnnxModel model;
+  model.initModel(modelPath);
+  // preallocate fewer rows than pushed, to exercise the growth of the buffers
+  model.initBatch(nRows / 3);
+
+  const std::size_t nFeatures = model.getNumInputNodes();
+  std::vector<std::vector<float>> rows(nRows, std::vector<float>(nFeatures));
+  for (auto& row : rows) {
+    for (auto& feature : row) {
+      feature = gRandom->Uniform(-5., 5.);
+    }
+    model.pushRow(row);
+  }
+  if (!model.evalBatch()) {
+    LOG(error) << "Batched evaluation failed";
+    return 1;
+  }
+
+  const std::size_t nOutputs = model.getBatchNOutputs();
+  float maxDeviation = 0.f;
+  for (std::size_t iRow = 0; iRow < nRows; iRow++) {
+    std::vector<float> input = rows[iRow];
+    const float* single = model.evalModel<float>(input);
+    const float* batched = model.getBatchOutput(iRow);
+    for (std::size_t iOutput = 0; iOutput < nOutputs; iOutput++) {
+      maxDeviation = std::max(maxDeviation, std::abs(batched[iOutput] - single[iOutput]));
+    }
+  }
+
+  LOG(info) << nRows << " rows, " << nFeatures << " features, " << nOutputs << " outputs: max |batched - single| = " << maxDeviation;
+  if (maxDeviation > tolerance) {
+    LOG(error) << "Batched and per-candidate scores differ by more than " << tolerance;
+    return 1;
+  }
+  return 0;
+}
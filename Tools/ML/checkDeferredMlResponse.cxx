@@ -0,0 +1,107 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// \file   checkDeferredMlResponse.cxx
+/// \brief  exec to check that the deferred (batched per bin) ML selection gives the same decisions and scores as isSelectedMl
+///         arguments: <model.onnx> <nClasses> [nCandidates] [tolerance]
+///         the same model is used in two pT bins, with a cut at 0.5 on the first score
+///
+
+#include "Tools/ML/MlResponse.h"
+
+#include <Framework/Array2D.h>
+#include <Framework/Logger.h>
+
+#include <TRandom.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+using namespace o2;
+
+int main(int argc, char* argv[])
+{
+  if (argc < 3) {
+    LOG(error) << "Usage: " << argv[0] << " <model.onnx> <nClasses> [nCandidates] [tolerance]";
+    return 1;
+  }
+  const std::string modelPath = argv[1];
+  const int nClasses = std::atoi(argv[2]);
+  const std::size_t nCandidates = argc > 3 ? std::atoi(argv[3]) : 1000;
+  const float tolerance = argc > 4 ? std::atof(argv[4]) : 1.e-6f;
+
+  const std::vector<double> binsPt = {0., 5., 50.};
+  std::vector<double> cutValues(2 * nClasses, 0.);
+  cutValues[0] = cutValues[nClasses] = 0.5;
+  std::vector<int> cutDir(nClasses, cuts_ml::CutNot);
+  cutDir[0] = cuts_ml::CutGreater;
+
+  analysis::MlResponse<float> immediate;
+  analysis::MlResponse<float> deferred;
+  for (auto* response : {&immediate, &deferred}) {
+    response->configure(binsPt, framework::LabeledArray<double>{cutValues.data(), 2, static_cast<uint32_t>(nClasses)}, cutDir, nClasses);
+    response->setModelPathsLocal({modelPath, modelPath});
+    response->init();
+  }
+  // preallocate fewer candidates than pushed, to exercise the growth of the buffers
+  deferred.initDeferred(nCandidates / 5);
+
+  ml::OnnxModel probe;
+  probe.initModel(modelPath);
+  const std::size_t nFeatures = probe.getNumInputNodes();
+
+  std::vector<std::vector<float>> features(nCandidates, std::vector<float>(nFeatures));
+  std::vector<float> pts(nCandidates);
+  deferred.clearDeferred();
+  for (std::size_t iCand = 0; iCand < nCandidates; iCand++) {
+    for (auto& feature : features[iCand]) {
+      feature = gRandom->Uniform(-5., 5.);
+    }
+    pts[iCand] = gRandom->Uniform(0., 50.);
+    if (deferred.pushCandidate(features[iCand], pts[iCand]) != iCand) {
+      LOG(error) << "Deferred queue index out of order for candidate " << iCand;
+      return 1;
+    }
+  }
+  const auto& selected = deferred.evalDeferred();
+
+  int nDifferentDecisions = 0;
+  float maxDeviation = 0.f;
+  std::vector<float> scoresImmediate;
+  std::vector<float> scoresDeferred;
+  for (std::size_t iCand = 0; iCand < nCandidates; iCand++) {
+    const bool isSelected = immediate.isSelectedMl(features[iCand], pts[iCand], scoresImmediate);
+    const bool isSelectedDeferred = deferred.getDeferredOutput(iCand, scoresDeferred);
+    if (isSelected != isSelectedDeferred || isSelected != static_cast<bool>(selected[iCand])) {
+      nDifferentDecisions++;
+    }
+    for (int iClass = 0; iClass < nClasses; iClass++) {
+      maxDeviation = std::max(maxDeviation, std::abs(scoresDeferred[iClass] - scoresImmediate[iClass]));
+    }
+  }
+
+  LOG(info) << nCandidates << " candidates: " << nDifferentDecisions << " different decisions, max |deferred - immediate| score = " << maxDeviation;
+  if (maxDeviation > tolerance) {
+    LOG(error) << "Deferred and immediate scores differ by more than " << tolerance;
+    return 1;
+  }
+  // a decision can only flip if a score sits within the tolerance of the cut
+  if (maxDeviation == 0.f && nDifferentDecisions > 0) {
+    LOG(error) << "Deferred and immediate decisions differ";
+    return 1;
+  }
+  return 0;
+}
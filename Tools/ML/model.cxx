@@ -121,6 +121,80 @@ void OnnxModel::initModel(const std::string& localPath, const bool enableOptimiz
   LOG(info) << "--- Model initialized! ---";
 }
 
+void OnnxModel::initBatch(const std::size_t maxRows)
+{
+  if (!mSession) {
+    LOG(fatal) << "Batched inference requested before the model is initialised!";
+  }
+  if (mInputNames.size() != 1) {
+    LOG(fatal) << "Batched inference supports only models with a single input node, this model has " << mInputNames.size() << "!";
+  }
+
+  // per-row sizes from the model specification, only the first (batch) dimension may be dynamic
+  mBatchInputShape = mInputShapes[0];
+  mBatchOutputShape = mOutputShapes.back();
+  mBatchNFeatures = 1;
+  for (std::size_t idim = 1; idim < mBatchInputShape.size(); idim++) {
+    if (mBatchInputShape[idim] < 0) {
+      LOG(fatal) << "Batched inference requires a fixed input shape apart from the batch dimension: " << printShape(mBatchInputShape);
+    }
+    mBatchNFeatures *= mBatchInputShape[idim];
+  }
+  mBatchNOutputs = 1;
+  for (std::size_t idim = 1; idim < mBatchOutputShape.size(); idim++) {
+    if (mBatchOutputShape[idim] < 0) {
+      LOG(fatal) << "Batched inference requires a fixed output shape apart from the batch dimension: " << printShape(mBatchOutputShape);
+    }
+    mBatchNOutputs *= mBatchOutputShape[idim];
+  }
+
+  mMemoryInfo = Ort::MemoryInfo::CreateCpu(OrtAllocatorType::OrtArenaAllocator, OrtMemType::OrtMemTypeDefault);
+  mRunOptions = Ort::RunOptions{};
+  mIoBinding = std::make_unique<Ort::IoBinding>(*mSession);
+  mBatchRows = 0;
+  growBatch(maxRows > 0 ? maxRows : 1);
+
+  LOG(info) << "Batched inference enabled: " << mBatchNFeatures << " features and " << mBatchNOutputs << " outputs per row, " << mBatchCapacity << " rows preallocated";
+}
+
+void OnnxModel::growBatch(const std::size_t capacity)
+{
+  mBatchCapacity = capacity;
+  mBatchInput.resize(mBatchCapacity * mBatchNFeatures);
+  mBatchOutput.resize(mBatchCapacity * mBatchNOutputs);
+  mBoundRows = 0; // buffers may have been reallocated
+}
+
+bool OnnxModel::evalBatch()
+{
+  if (!mIoBinding) {
+    LOG(fatal) << "evalBatch called without initBatch!";
+  }
+  if (mBatchRows == 0) {
+    return true;
+  }
+
+  try {
+    // tensors are views on the persistent buffers, they only need to be rebound when the number of rows changes
+    if (mBatchRows != mBoundRows) {
+      mIoBinding->ClearBoundInputs();
+      mIoBinding->ClearBoundOutputs();
+      mBatchInputShape[0] = static_cast<int64_t>(mBatchRows);
+      mBatchOutputShape[0] = static_cast<int64_t>(mBatchRows);
+      mBatchInputTensor = Ort::Value::CreateTensor<float>(mMemoryInfo, mBatchInput.data(), mBatchRows * mBatchNFeatures, mBatchInputShape.data(), mBatchInputShape.size());
+      mBatchOutputTensor = Ort::Value::CreateTensor<float>(mMemoryInfo, mBatchOutput.data(), mBatchRows * mBatchNOutputs, mBatchOutputShape.data(), mBatchOutputShape.size());
+      mIoBinding->BindInput(mInputNames[0].c_str(), mBatchInputTensor);
+      mIoBinding->BindOutput(mOutputNames.back().c_str(), mBatchOutputTensor);
+      mBoundRows = mBatchRows;
+    }
+    mSession->Run(mRunOptions, *mIoBinding);
+  } catch (const Ort::Exception& exception) {
+    LOG(error) << "Error running batched model inference: " << exception.what();
+    return false;
+  }
+  return true;
+}
+
 void OnnxModel::setActiveThreads(const int threads)
 {
   activeThreads = threads;
@@ -65,7 +65,9 @@ class OnnxModel
       std::vector<const char*> outputNamesChar(mOutputNames.size(), nullptr);
       std::transform(std::begin(mOutputNames), std::end(mOutputNames), std::begin(outputNamesChar),
                      [&](const std::string& str) { return str.c_str(); });
-      auto outputTensors = mSession->Run(runOptions, inputNamesChar.data(), input.data(), input.size(), outputNamesChar.data(), outputNamesChar.size());
+      // keep the output tensors alive until the next call, the returned pointer refers to their data
+      mOutputTensors = mSession->Run(runOptions, inputNamesChar.data(), input.data(), input.size(), outputNamesChar.data(), outputNamesChar.size());
+      auto& outputTensors = mOutputTensors;
       LOG(debug) << "Number of output tensors: " << outputTensors.size();
       if (outputTensors.size() != mOutputNames.size()) {
         LOG(fatal) << "Number of output tensors: " << outputTensors.size() << " does not agree with the model specified size: " << mOutputNames.size();
@@ -125,10 +127,51 @@ class OnnxModel
     return evalModel<T>(inputTensors);
   }
 
+  // Batched inference
+  // Feature rows are pushed into a reusable input buffer and the model is run once over all of them
+  // through pre-bound input/output tensors; scores are read back from a persistent output buffer.
+  // Only float models with a single input node are supported, the last output node is read back (as in evalModel)
+  void initBatch(const std::size_t);
+  void clearBatch() { mBatchRows = 0; }
+
+  /// Append one candidate to the batch
+  /// \param features container with the input features of the candidate (same ordering as the model input)
+  /// \return row index of the candidate in the batch, to be used with getBatchOutput
+  template <typename T>
+  std::size_t pushRow(const T& features)
+  {
+    if (static_cast<std::size_t>(features.size()) != mBatchNFeatures) {
+      LOG(fatal) << "Number of features (" << features.size() << ") does not agree with the model input size (" << mBatchNFeatures << ")!";
+    }
+    if (mBatchRows == mBatchCapacity) {
+      growBatch(2 * mBatchCapacity);
+    }
+    std::copy(std::begin(features), std::end(features), mBatchInput.begin() + mBatchRows * mBatchNFeatures);
+    return mBatchRows++;
+  }
+
+  bool evalBatch();
+
+  /// \return pointer to the getBatchNOutputs() scores of a row, valid until the next evalBatch() or pushRow() call
+  /// \note Callers must not read more than getBatchNOutputs() scores
+  const float* getBatchOutput(const std::size_t row) const
+  {
+    if (row >= mBatchRows) {
+      LOG(fatal) << "Row " << row << " requested from a batch of " << mBatchRows << " rows!";
+    }
+    return mBatchOutput.data() + row * mBatchNOutputs;
+  }
+  std::size_t getBatchRows() const { return mBatchRows; }
+  std::size_t getBatchNOutputs() const { return mBatchNOutputs; }
+
   // Reset session
   void resetSession()
   {
     mSession.reset(new Ort::Session{*mEnv, modelPath.c_str(), sessionOptions});
+    if (mIoBinding) {
+      mIoBinding = std::make_unique<Ort::IoBinding>(*mSession);
+      mBoundRows = 0;
+    }
   }
 
   // Getters & Setters
@@ -155,6 +198,23 @@ class OnnxModel
   std::vector<std::vector<int64_t>> mInputShapes;
   std::vector<std::string> mOutputNames;
   std::vector<std::vector<int64_t>> mOutputShapes;
+  std::vector<Ort::Value> mOutputTensors; // output of the last evalModel call
+
+  // Batched inference buffers
+  Ort::MemoryInfo mMemoryInfo{nullptr};
+  Ort::RunOptions mRunOptions{nullptr};
+  std::unique_ptr<Ort::IoBinding> mIoBinding = nullptr;
+  Ort::Value mBatchInputTensor{nullptr};
+  Ort::Value mBatchOutputTensor{nullptr};
+  std::vector<float> mBatchInput;
+  std::vector<float> mBatchOutput;
+  std::vector<int64_t> mBatchInputShape;
+  std::vector<int64_t> mBatchOutputShape;
+  std::size_t mBatchNFeatures = 0;
+  std::size_t mBatchNOutputs = 0;
+  std::size_t mBatchCapacity = 0;
+  std::size_t mBatchRows = 0;
+  std::size_t mBoundRows = 0; // number of rows the tensors are currently bound to, 0 forces rebinding
 
   // Environment settings
   std::string modelPath;
@@ -165,6 +225,7 @@ class OnnxModel
   // Internal function for printing the shape of tensors
   std::string printShape(const std::vector<int64_t>&);
   bool checkHyperloop(const bool = true);
+  void growBatch(const std::size_t);
 };
 
 } // namespace ml